@@ -18,3 +18,11 @@ scons -Q --enable-werror --build-3rdparty=all \
       --enable-benchmarks \
       --enable-examples \
       test
+
+# debug: yes, refcount stats: yes
+scons -Q --enable-werror --build-3rdparty=all \
+      --enable-debug \
+      --enable-refcount-stats \
+      --enable-tests \
+      --enable-benchmarks \
+      test
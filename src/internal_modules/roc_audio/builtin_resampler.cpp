@@ -8,6 +8,7 @@
 
 #include "roc_audio/builtin_resampler.h"
 #include "roc_audio/sample_spec_to_str.h"
+#include "roc_audio/sinc_table_cache.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
 #include "roc_core/stddefs.h"
@@ -136,7 +137,6 @@ BuiltinResampler::BuiltinResampler(core::IArena& arena,
     , window_interp_bits_(calc_bits(window_interp_))
     , frame_size_ch_(get_frame_size(window_size_, in_spec, out_spec))
     , frame_size_(frame_size_ch_ * in_spec.num_channels())
-    , sinc_table_(arena)
     , sinc_table_ptr_(NULL)
     , qt_half_window_size_(float_to_fixedpoint((float)window_size_ / scaling_))
     , qt_epsilon_(float_to_fixedpoint(5e-8f))
@@ -157,7 +157,7 @@ BuiltinResampler::BuiltinResampler(core::IArena& arena,
         return;
     }
 
-    if (!fill_sinc_()) {
+    if (!init_sinc_()) {
         return;
     }
 
@@ -297,6 +297,36 @@ float BuiltinResampler::n_left_to_process() const {
     return fixedpoint_to_float(2 * qt_frame_size_ - qt_sample_) * in_spec_.num_channels();
 }
 
+bool BuiltinResampler::get_period(size_t& in_period,
+                                  size_t& out_period,
+                                  size_t& window) const {
+    if (qt_dt_ == 0 || qt_epsilon_ != 0) {
+        // Scaling is not set, or positions are snapped to integers,
+        // and grid doesn't repeat exactly.
+        return false;
+    }
+
+    // Position of n-th output sample is exactly n * qt_dt_ in fixed-point,
+    // so it hits the same fractional position every qt_dt_ / gcd(qt_dt_, qt_one)
+    // input samples, and resample_() depends only on that fractional position
+    // and input samples around it.
+    fixedpoint_t a = qt_dt_, b = qt_one;
+    while (b != 0) {
+        const fixedpoint_t t = a % b;
+        a = b;
+        b = t;
+    }
+
+    in_period = qt_dt_ / a;
+    out_period = qt_one / a;
+
+    // Output is computed from previous, current, and next frame, and
+    // next frame is pushed only when it's filled completely.
+    window = frame_size_ch_ * 4;
+
+    return true;
+}
+
 bool BuiltinResampler::alloc_frames_(FrameFactory& frame_factory) {
     for (size_t n = 0; n < ROC_ARRAY_SIZE(frames_); n++) {
         frames_[n] = frame_factory.new_raw_buffer();
@@ -364,28 +394,14 @@ bool BuiltinResampler::check_config_() const {
     return true;
 }
 
-bool BuiltinResampler::fill_sinc_() {
-    if (!sinc_table_.resize(window_size_ * window_interp_ + 2)) {
+bool BuiltinResampler::init_sinc_() {
+    sinc_table_ = SincTableCache::instance().get_table(window_size_, window_interp_);
+    if (!sinc_table_) {
         roc_log(LogError, "builtin resampler: can't allocate sinc table");
         return false;
     }
 
-    const double sinc_step = 1.0 / (double)window_interp_;
-    double sinc_t = sinc_step;
-
-    sinc_table_[0] = 1.0f;
-    for (size_t i = 1; i < sinc_table_.size(); ++i) {
-        const double window = 0.54
-            - 0.46
-                * std::cos(2 * M_PI
-                           * ((double)(i - 1) / 2.0 / (double)sinc_table_.size() + 0.5));
-        sinc_table_[i] = (float)(std::sin(M_PI * sinc_t) / M_PI / sinc_t * window);
-        sinc_t += sinc_step;
-    }
-    sinc_table_[sinc_table_.size() - 2] = 0;
-    sinc_table_[sinc_table_.size() - 1] = 0;
-
-    sinc_table_ptr_ = &sinc_table_[0];
+    sinc_table_ptr_ = sinc_table_->data();
 
     return true;
 }
@@ -19,8 +19,9 @@
 #include "roc_audio/resampler_config.h"
 #include "roc_audio/sample.h"
 #include "roc_audio/sample_spec.h"
-#include "roc_core/array.h"
+#include "roc_audio/sinc_table.h"
 #include "roc_core/noncopyable.h"
+#include "roc_core/shared_ptr.h"
 #include "roc_core/slice.h"
 #include "roc_core/stddefs.h"
 #include "roc_packet/units.h"
@@ -71,6 +72,9 @@ public:
     //! How many samples were pushed but not processed yet.
     virtual float n_left_to_process() const;
 
+    //! Get period after which resampling grid repeats.
+    virtual bool get_period(size_t& in_period, size_t& out_period, size_t& window) const;
+
 private:
     typedef uint32_t fixedpoint_t;
     typedef uint64_t long_fixedpoint_t;
@@ -85,7 +89,7 @@ private:
 
     bool check_config_() const;
 
-    bool fill_sinc_();
+    bool init_sinc_();
     sample_t sinc_(fixedpoint_t x, float fract_x);
 
     // Computes single sample of the particular audio channel.
@@ -114,7 +118,7 @@ private:
     const size_t frame_size_ch_;
     const size_t frame_size_;
 
-    core::Array<sample_t> sinc_table_;
+    core::SharedPtr<SincTable> sinc_table_;
     const sample_t* sinc_table_ptr_;
 
     // half window len in Q8.24 in terms of input signal
@@ -247,6 +247,15 @@ float DecimationResampler::n_left_to_process() const {
     return n_samples;
 }
 
+bool DecimationResampler::get_period(size_t& in_period,
+                                     size_t& out_period,
+                                     size_t& window) const {
+    roc_panic_if_not(is_valid());
+
+    // Decimation depends on accumulated history of scaling.
+    return false;
+}
+
 void DecimationResampler::report_stats_() {
     if (!report_limiter_.allow()) {
         return;
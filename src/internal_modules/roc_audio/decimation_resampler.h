@@ -76,6 +76,9 @@ public:
     //! How many samples were pushed but not processed yet.
     virtual float n_left_to_process() const;
 
+    //! Get period after which resampling grid repeats.
+    virtual bool get_period(size_t& in_period, size_t& out_period, size_t& window) const;
+
 private:
     void report_stats_();
 
@@ -38,13 +38,18 @@ Depacketizer::Depacketizer(packet::IReader& reader,
                            bool beep)
     : reader_(reader)
     , payload_decoder_(payload_decoder)
+    , plc_(NULL)
     , sample_spec_(sample_spec)
+    , passthrough_format_(PcmFormat_Invalid)
+    , passthrough_sample_size_(0)
     , stream_ts_(0)
     , next_capture_ts_(0)
     , valid_capture_ts_(false)
     , zero_samples_(0)
     , missing_samples_(0)
     , packet_samples_(0)
+    , total_missing_samples_(0)
+    , total_concealed_samples_(0)
     , rate_limiter_(LogInterval)
     , beep_(beep)
     , first_packet_(true)
@@ -74,6 +79,35 @@ packet::stream_timestamp_t Depacketizer::next_timestamp() const {
     return stream_ts_;
 }
 
+void Depacketizer::enable_passthrough(PcmFormat format) {
+    const PcmTraits traits = pcm_format_traits(format);
+
+    if (!traits.is_valid || !traits.is_signed || traits.bit_width % 8 != 0) {
+        roc_panic("depacketizer: unsupported passthrough format: format=%s",
+                  pcm_format_to_str(format));
+    }
+
+    roc_log(LogDebug, "depacketizer: enabling passthrough: format=%s",
+            pcm_format_to_str(format));
+
+    passthrough_format_ = format;
+    passthrough_sample_size_ = traits.bit_width / 8;
+}
+
+void Depacketizer::enable_plc(IPlc& plc) {
+    roc_log(LogDebug, "depacketizer: enabling packet loss concealment");
+
+    plc_ = &plc;
+}
+
+DepacketizerMetrics Depacketizer::metrics() const {
+    DepacketizerMetrics metrics;
+    metrics.missing_samples = total_missing_samples_;
+    metrics.concealed_samples = total_concealed_samples_;
+
+    return metrics;
+}
+
 bool Depacketizer::read(Frame& frame) {
     read_frame_(frame);
 
@@ -83,25 +117,44 @@ bool Depacketizer::read(Frame& frame) {
 }
 
 void Depacketizer::read_frame_(Frame& frame) {
-    if (frame.num_raw_samples() % sample_spec_.num_channels() != 0) {
+    const size_t frame_size = frame_sample_count_(frame);
+
+    if (frame_size % sample_spec_.num_channels() != 0) {
         roc_panic("depacketizer: unexpected frame size");
     }
 
-    sample_t* buff_ptr = frame.raw_samples();
-    sample_t* buff_end = frame.raw_samples() + frame.num_raw_samples();
+    size_t frame_pos = 0;
 
     FrameInfo info;
 
-    while (buff_ptr < buff_end) {
-        buff_ptr = read_samples_(buff_ptr, buff_end, info);
+    while (frame_pos < frame_size) {
+        frame_pos = read_samples_(frame, frame_pos, frame_size, info);
+    }
+
+    roc_panic_if(frame_pos != frame_size);
+    set_frame_props_(frame, frame_size, info);
+}
+
+size_t Depacketizer::frame_sample_count_(const Frame& frame) const {
+    if (frame.is_raw()) {
+        return frame.num_raw_samples();
     }
 
-    roc_panic_if(buff_ptr != buff_end);
-    set_frame_props_(frame, info);
+    if (passthrough_sample_size_ == 0) {
+        roc_panic("depacketizer: got non-raw frame, but passthrough is not enabled");
+    }
+
+    if (frame.num_bytes() % passthrough_sample_size_ != 0) {
+        roc_panic("depacketizer: unexpected frame size");
+    }
+
+    return frame.num_bytes() / passthrough_sample_size_;
 }
 
-sample_t*
-Depacketizer::read_samples_(sample_t* buff_ptr, sample_t* buff_end, FrameInfo& info) {
+size_t Depacketizer::read_samples_(Frame& frame,
+                                   size_t frame_pos,
+                                   size_t frame_end,
+                                   FrameInfo& info) {
     update_packet_(info);
 
     if (packet_) {
@@ -113,10 +166,10 @@ Depacketizer::read_samples_(sample_t* buff_ptr, sample_t* buff_end, FrameInfo& i
             const size_t mis_samples = sample_spec_.num_channels()
                 * (size_t)packet::stream_timestamp_diff(next_timestamp, stream_ts_);
 
-            const size_t max_samples = (size_t)(buff_end - buff_ptr);
+            const size_t max_samples = frame_end - frame_pos;
             const size_t n_samples = std::min(mis_samples, max_samples);
 
-            buff_ptr = read_missing_samples_(buff_ptr, buff_ptr + n_samples);
+            frame_pos = read_missing_samples_(frame, frame_pos, frame_pos + n_samples);
 
             //           next_capture_ts_
             //           next_timestamp
@@ -132,9 +185,10 @@ Depacketizer::read_samples_(sample_t* buff_ptr, sample_t* buff_end, FrameInfo& i
             }
         }
 
-        if (buff_ptr < buff_end) {
-            sample_t* new_buff_ptr = read_packet_samples_(buff_ptr, buff_end);
-            const size_t n_samples = size_t(new_buff_ptr - buff_ptr);
+        if (frame_pos < frame_end) {
+            const size_t new_frame_pos =
+                read_packet_samples_(frame, frame_pos, frame_end);
+            const size_t n_samples = new_frame_pos - frame_pos;
 
             info.n_decoded_samples += n_samples;
             if (n_samples && !info.capture_ts && valid_capture_ts_) {
@@ -146,12 +200,12 @@ Depacketizer::read_samples_(sample_t* buff_ptr, sample_t* buff_end, FrameInfo& i
             }
 
             info.n_filled_samples += n_samples;
-            buff_ptr = new_buff_ptr;
+            frame_pos = new_frame_pos;
         }
 
-        return buff_ptr;
+        return frame_pos;
     } else {
-        const size_t n_samples = size_t(buff_end - buff_ptr);
+        const size_t n_samples = frame_end - frame_pos;
 
         if (!info.capture_ts && valid_capture_ts_) {
             info.capture_ts = next_capture_ts_
@@ -162,15 +216,30 @@ Depacketizer::read_samples_(sample_t* buff_ptr, sample_t* buff_end, FrameInfo& i
         }
 
         info.n_filled_samples += n_samples;
-        return read_missing_samples_(buff_ptr, buff_end);
+        return read_missing_samples_(frame, frame_pos, frame_end);
     }
 }
 
-sample_t* Depacketizer::read_packet_samples_(sample_t* buff_ptr, sample_t* buff_end) {
+size_t
+Depacketizer::read_packet_samples_(Frame& frame, size_t frame_pos, size_t frame_end) {
     const size_t requested_samples =
-        size_t(buff_end - buff_ptr) / sample_spec_.num_channels();
+        (frame_end - frame_pos) / sample_spec_.num_channels();
 
-    const size_t decoded_samples = payload_decoder_.read(buff_ptr, requested_samples);
+    size_t decoded_samples = 0;
+
+    if (frame.is_raw()) {
+        decoded_samples =
+            payload_decoder_.read(frame.raw_samples() + frame_pos, requested_samples);
+    } else {
+        decoded_samples = payload_decoder_.read_pcm(
+            passthrough_format_, frame.bytes() + frame_pos * passthrough_sample_size_,
+            requested_samples);
+    }
+
+    if (plc_ && frame.is_raw() && decoded_samples != 0) {
+        plc_->process_history(frame.raw_samples() + frame_pos,
+                              decoded_samples * sample_spec_.num_channels());
+    }
 
     stream_ts_ += (packet::stream_timestamp_t)decoded_samples;
     packet_samples_ += (packet::stream_timestamp_t)decoded_samples;
@@ -180,17 +249,31 @@ sample_t* Depacketizer::read_packet_samples_(sample_t* buff_ptr, sample_t* buff_
         packet_ = NULL;
     }
 
-    return (buff_ptr + decoded_samples * sample_spec_.num_channels());
+    return (frame_pos + decoded_samples * sample_spec_.num_channels());
 }
 
-sample_t* Depacketizer::read_missing_samples_(sample_t* buff_ptr, sample_t* buff_end) {
-    const size_t num_samples =
-        (size_t)(buff_end - buff_ptr) / sample_spec_.num_channels();
-
-    if (beep_) {
-        write_beep(buff_ptr, num_samples * sample_spec_.num_channels());
+size_t
+Depacketizer::read_missing_samples_(Frame& frame, size_t frame_pos, size_t frame_end) {
+    const size_t num_samples = (frame_end - frame_pos) / sample_spec_.num_channels();
+
+    size_t concealed_samples = 0;
+
+    if (frame.is_raw()) {
+        if (plc_ && !beep_ && !first_packet_) {
+            concealed_samples =
+                plc_->process_loss(frame.raw_samples() + frame_pos,
+                                   num_samples * sample_spec_.num_channels())
+                / sample_spec_.num_channels();
+        } else if (beep_) {
+            write_beep(frame.raw_samples() + frame_pos,
+                       num_samples * sample_spec_.num_channels());
+        } else {
+            write_zeros(frame.raw_samples() + frame_pos,
+                        num_samples * sample_spec_.num_channels());
+        }
     } else {
-        write_zeros(buff_ptr, num_samples * sample_spec_.num_channels());
+        memset(frame.bytes() + frame_pos * passthrough_sample_size_, 0,
+               num_samples * sample_spec_.num_channels() * passthrough_sample_size_);
     }
 
     stream_ts_ += (packet::stream_timestamp_t)num_samples;
@@ -199,9 +282,11 @@ sample_t* Depacketizer::read_missing_samples_(sample_t* buff_ptr, sample_t* buff
         zero_samples_ += (packet::stream_timestamp_t)num_samples;
     } else {
         missing_samples_ += (packet::stream_timestamp_t)num_samples;
+        total_missing_samples_ += num_samples;
+        total_concealed_samples_ += concealed_samples;
     }
 
-    return (buff_ptr + num_samples * sample_spec_.num_channels());
+    return (frame_pos + num_samples * sample_spec_.num_channels());
 }
 
 void Depacketizer::update_packet_(FrameInfo& info) {
@@ -212,7 +297,7 @@ void Depacketizer::update_packet_(FrameInfo& info) {
     packet::stream_timestamp_t pkt_timestamp = 0;
     unsigned n_dropped = 0;
 
-    while ((packet_ = read_packet_())) {
+    while (read_packet_()) {
         payload_decoder_.begin(packet_->stream_timestamp(), packet_->payload().data(),
                                packet_->payload().size());
 
@@ -276,9 +361,9 @@ void Depacketizer::update_packet_(FrameInfo& info) {
     }
 }
 
-packet::PacketPtr Depacketizer::read_packet_() {
-    packet::PacketPtr pp;
-    const status::StatusCode code = reader_.read(pp);
+bool Depacketizer::read_packet_() {
+    // Read directly into packet_, to avoid extra reference counting.
+    const status::StatusCode code = reader_.read(packet_);
     if (code != status::StatusOK) {
         if (code != status::StatusNoData) {
             // TODO(gh-302): forward status
@@ -286,20 +371,27 @@ packet::PacketPtr Depacketizer::read_packet_() {
                     status::code_to_str(code));
         }
 
-        return NULL;
+        packet_ = NULL;
+        return false;
     }
 
-    return pp;
+    return true;
 }
 
-void Depacketizer::set_frame_props_(Frame& frame, const FrameInfo& info) {
+void Depacketizer::set_frame_props_(Frame& frame,
+                                    size_t frame_size,
+                                    const FrameInfo& info) {
     unsigned flags = 0;
 
+    if (!frame.is_raw()) {
+        flags |= Frame::FlagNotRaw;
+    }
+
     if (info.n_decoded_samples != 0) {
         flags |= Frame::FlagNotBlank;
     }
 
-    if (info.n_decoded_samples < frame.num_raw_samples()) {
+    if (info.n_decoded_samples < frame_size) {
         flags |= Frame::FlagNotComplete;
     }
 
@@ -308,7 +400,7 @@ void Depacketizer::set_frame_props_(Frame& frame, const FrameInfo& info) {
     }
 
     frame.set_flags(flags);
-    frame.set_duration(frame.num_raw_samples() / sample_spec_.num_channels());
+    frame.set_duration(frame_size / sample_spec_.num_channels());
 
     if (info.capture_ts > 0) {
         // do not produce negative cts, which may happen when first packet was in
@@ -326,8 +418,12 @@ void Depacketizer::report_stats_() {
     const double loss_ratio =
         total_samples != 0 ? (double)missing_samples_ / total_samples : 0.;
 
-    roc_log(LogDebug, "depacketizer: ts=%lu loss_ratio=%.5lf", (unsigned long)stream_ts_,
-            loss_ratio);
+    const double conceal_ratio = total_missing_samples_ != 0
+        ? (double)total_concealed_samples_ / total_missing_samples_
+        : 0.;
+
+    roc_log(LogDebug, "depacketizer: ts=%lu loss_ratio=%.5lf conceal_ratio=%.5lf",
+            (unsigned long)stream_ts_, loss_ratio, conceal_ratio);
 }
 
 } // namespace audio
@@ -12,8 +12,11 @@
 #ifndef ROC_AUDIO_DEPACKETIZER_H_
 #define ROC_AUDIO_DEPACKETIZER_H_
 
+#include "roc_audio/depacketizer_metrics.h"
 #include "roc_audio/iframe_decoder.h"
 #include "roc_audio/iframe_reader.h"
+#include "roc_audio/iplc.h"
+#include "roc_audio/pcm_format.h"
 #include "roc_audio/sample.h"
 #include "roc_audio/sample_spec.h"
 #include "roc_core/noncopyable.h"
@@ -27,6 +30,13 @@ namespace audio {
 //! @remarks
 //!  Reads packets from a packet reader, decodes samples from packets using a
 //!  decoder, and produces an audio stream.
+//!
+//!  By default, produces frames of raw samples. If passthrough is enabled,
+//!  frames with Frame::FlagNotRaw flag are filled with samples in passthrough
+//!  format, taken directly from decoder without conversion to raw samples.
+//!
+//!  By default, gaps caused by lost or late packets are filled with silence.
+//!  If PLC is enabled, gaps in raw frames are filled by PLC instead.
 class Depacketizer : public IFrameReader, public core::NonCopyable<> {
 public:
     //! Initialization.
@@ -47,6 +57,25 @@ public:
     //! Did depacketizer catch first packet?
     bool is_started() const;
 
+    //! Enable passthrough.
+    //! @remarks
+    //!  After this call, if read() is invoked with a frame which has
+    //!  Frame::FlagNotRaw flag set, the frame is filled with samples in
+    //!  given PCM @p format instead of raw samples.
+    //!  Only byte-aligned signed formats are supported, because they represent
+    //!  silence with zero bytes.
+    void enable_passthrough(PcmFormat format);
+
+    //! Enable packet loss concealment.
+    //! @remarks
+    //!  After this call, all raw samples are passed through @p plc, which
+    //!  fills gaps instead of silence. Non-raw (passthrough) frames and
+    //!  beeping mode are not affected.
+    void enable_plc(IPlc& plc);
+
+    //! Get metrics.
+    DepacketizerMetrics metrics() const;
+
     //! Read audio frame.
     virtual bool read(Frame& frame);
 
@@ -79,23 +108,30 @@ private:
 
     void read_frame_(Frame& frame);
 
-    sample_t* read_samples_(sample_t* buff_ptr, sample_t* buff_end, FrameInfo& info);
+    size_t frame_sample_count_(const Frame& frame) const;
+
+    size_t
+    read_samples_(Frame& frame, size_t frame_pos, size_t frame_end, FrameInfo& info);
 
-    sample_t* read_packet_samples_(sample_t* buff_ptr, sample_t* buff_end);
-    sample_t* read_missing_samples_(sample_t* buff_ptr, sample_t* buff_end);
+    size_t read_packet_samples_(Frame& frame, size_t frame_pos, size_t frame_end);
+    size_t read_missing_samples_(Frame& frame, size_t frame_pos, size_t frame_end);
 
     void update_packet_(FrameInfo& info);
-    packet::PacketPtr read_packet_();
+    bool read_packet_();
 
-    void set_frame_props_(Frame& frame, const FrameInfo& info);
+    void set_frame_props_(Frame& frame, size_t frame_size, const FrameInfo& info);
 
     void report_stats_();
 
     packet::IReader& reader_;
     IFrameDecoder& payload_decoder_;
+    IPlc* plc_;
 
     const SampleSpec sample_spec_;
 
+    PcmFormat passthrough_format_;
+    size_t passthrough_sample_size_;
+
     packet::PacketPtr packet_;
 
     packet::stream_timestamp_t stream_ts_;
@@ -106,6 +142,9 @@ private:
     packet::stream_timestamp_t missing_samples_;
     packet::stream_timestamp_t packet_samples_;
 
+    uint64_t total_missing_samples_;
+    uint64_t total_concealed_samples_;
+
     core::RateLimiter rate_limiter_;
 
     const bool beep_;
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/depacketizer_metrics.h
+//! @brief Depacketizer metrics.
+
+#ifndef ROC_AUDIO_DEPACKETIZER_METRICS_H_
+#define ROC_AUDIO_DEPACKETIZER_METRICS_H_
+
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace audio {
+
+//! Depacketizer metrics.
+struct DepacketizerMetrics {
+    //! Cumulative count of samples (per channel) missing in the stream because
+    //! of lost or late packets.
+    uint64_t missing_samples;
+
+    //! Cumulative count of missing samples (per channel) which were synthesized
+    //! by packet loss concealment instead of being filled with silence.
+    uint64_t concealed_samples;
+
+    DepacketizerMetrics()
+        : missing_samples(0)
+        , concealed_samples(0) {
+    }
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_DEPACKETIZER_METRICS_H_
@@ -7,10 +7,47 @@
  */
 
 #include "roc_audio/fanout.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
 
 namespace roc {
 namespace audio {
 
+Fanout::Fanout()
+    : arena_(NULL)
+    , work_cond_(mutex_)
+    , done_cond_(mutex_)
+    , cur_frame_(NULL)
+    , next_writer_(NULL)
+    , pending_writers_(0)
+    , stop_(false)
+    , valid_(true) {
+}
+
+Fanout::Fanout(const FanoutConfig& config, core::IArena& arena)
+    : arena_(&arena)
+    , work_cond_(mutex_)
+    , done_cond_(mutex_)
+    , cur_frame_(NULL)
+    , next_writer_(NULL)
+    , pending_writers_(0)
+    , stop_(false)
+    , valid_(false) {
+    if (config.num_threads != 0 && !start_workers_(config.num_threads)) {
+        return;
+    }
+
+    valid_ = true;
+}
+
+Fanout::~Fanout() {
+    stop_workers_();
+}
+
+bool Fanout::is_valid() const {
+    return valid_;
+}
+
 bool Fanout::has_output(IFrameWriter& writer) {
     return writers_.contains(writer);
 }
@@ -24,10 +61,148 @@ void Fanout::remove_output(IFrameWriter& writer) {
 }
 
 void Fanout::write(Frame& frame) {
+    roc_panic_if(!is_valid());
+
+    if (workers_.size() != 0 && writers_.size() > 1) {
+        write_parallel_(frame);
+        return;
+    }
+
     for (IFrameWriter* wp = writers_.front(); wp; wp = writers_.nextof(*wp)) {
         wp->write(frame);
     }
 }
 
+Fanout::Worker::Worker(Fanout& fanout)
+    : fanout_(fanout) {
+}
+
+Fanout::Worker::~Worker() {
+}
+
+void Fanout::Worker::run() {
+    fanout_.run_worker_();
+}
+
+bool Fanout::start_workers_(size_t num_threads) {
+    roc_log(LogDebug, "fanout: starting worker threads: num_threads=%lu",
+            (unsigned long)num_threads);
+
+    for (size_t n = 0; n < num_threads; n++) {
+        Worker* worker = new (*arena_) Worker(*this);
+        if (!worker) {
+            roc_log(LogError, "fanout: can't allocate worker thread");
+            return false;
+        }
+
+        workers_.push_back(*worker);
+
+        if (!worker->start()) {
+            roc_log(LogError, "fanout: can't start worker thread");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void Fanout::stop_workers_() {
+    if (workers_.size() == 0) {
+        return;
+    }
+
+    {
+        core::Mutex::Lock lock(mutex_);
+
+        stop_ = true;
+        work_cond_.broadcast();
+    }
+
+    while (Worker* worker = workers_.front()) {
+        workers_.remove(*worker);
+
+        if (worker->is_joinable()) {
+            worker->join();
+        }
+
+        arena_->destroy_object(*worker);
+    }
+}
+
+void Fanout::run_worker_() {
+    for (;;) {
+        {
+            core::Mutex::Lock lock(mutex_);
+
+            while (!stop_ && !next_writer_) {
+                work_cond_.wait();
+            }
+
+            if (stop_) {
+                return;
+            }
+        }
+
+        process_outputs_();
+    }
+}
+
+// Called from write() when there are workers and more than one output.
+// Publishes frame to workers, takes part in processing, and waits until
+// all outputs are done.
+void Fanout::write_parallel_(Frame& frame) {
+    {
+        core::Mutex::Lock lock(mutex_);
+
+        cur_frame_ = &frame;
+        next_writer_ = writers_.front();
+        pending_writers_ = writers_.size();
+
+        work_cond_.broadcast();
+    }
+
+    process_outputs_();
+
+    core::Mutex::Lock lock(mutex_);
+
+    while (pending_writers_ != 0) {
+        done_cond_.wait();
+    }
+
+    cur_frame_ = NULL;
+}
+
+// Called from write() and from worker threads.
+// Takes outputs one by one and writes current frame to them,
+// until there are no more outputs to take.
+void Fanout::process_outputs_() {
+    IFrameWriter* writer = NULL;
+    Frame* frame = NULL;
+
+    for (;;) {
+        {
+            core::Mutex::Lock lock(mutex_);
+
+            if (writer) {
+                roc_panic_if(pending_writers_ == 0);
+
+                if (--pending_writers_ == 0) {
+                    done_cond_.signal();
+                }
+            }
+
+            writer = next_writer_;
+            if (!writer) {
+                return;
+            }
+
+            frame = cur_frame_;
+            next_writer_ = writers_.nextof(*writer);
+        }
+
+        writer->write(*frame);
+    }
+}
+
 } // namespace audio
 } // namespace roc
@@ -14,17 +14,56 @@
 
 #include "roc_audio/iframe_writer.h"
 #include "roc_audio/sample.h"
+#include "roc_core/cond.h"
+#include "roc_core/iarena.h"
 #include "roc_core/list.h"
+#include "roc_core/list_node.h"
+#include "roc_core/mutex.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/slice.h"
+#include "roc_core/thread.h"
 
 namespace roc {
 namespace audio {
 
+//! Fanout parameters.
+struct FanoutConfig {
+    //! Number of worker threads.
+    //! @remarks
+    //!  If zero, frame is written to outputs one by one from the calling thread.
+    //!  Otherwise, outputs are distributed between the calling thread and
+    //!  workers, and are written in parallel.
+    size_t num_threads;
+
+    FanoutConfig()
+        : num_threads(0) {
+    }
+};
+
 //! Fanout.
 //! Duplicates audio stream to multiple output writers.
+//! @remarks
+//!  Optionally, writes to different outputs are performed in parallel using
+//!  a pool of worker threads. In this case outputs must not share state that
+//!  is not thread-safe, and must not modify the frame. Every output still gets
+//!  frames in the same order, and write() returns only when the frame was
+//!  written to all outputs, so that the next frame is never processed by one
+//!  output while another output is still processing the previous one.
 class Fanout : public IFrameWriter, public core::NonCopyable<> {
 public:
+    //! Initialize fanout without worker threads.
+    Fanout();
+
+    //! Initialize fanout with worker threads.
+    //! @remarks
+    //!  @p arena is used to allocate worker threads.
+    Fanout(const FanoutConfig& config, core::IArena& arena);
+
+    ~Fanout();
+
+    //! Check if object was constructed successfully.
+    bool is_valid() const;
+
     //! Check if writer is already added.
     bool has_output(IFrameWriter&);
 
@@ -40,7 +79,42 @@ public:
     virtual void write(Frame& frame);
 
 private:
+    class Worker : public core::Thread, public core::ListNode<> {
+    public:
+        explicit Worker(Fanout& fanout);
+        virtual ~Worker();
+
+    private:
+        virtual void run();
+
+        Fanout& fanout_;
+    };
+
+    friend class Worker;
+
+    bool start_workers_(size_t num_threads);
+    void stop_workers_();
+    void run_worker_();
+
+    void write_parallel_(Frame& frame);
+    void process_outputs_();
+
     core::List<IFrameWriter, core::NoOwnership> writers_;
+
+    core::IArena* arena_;
+    core::List<Worker, core::NoOwnership> workers_;
+
+    // Protects fields below; writers_ list is not modified
+    // while there is a frame in progress.
+    core::Mutex mutex_;
+    core::Cond work_cond_;
+    core::Cond done_cond_;
+    Frame* cur_frame_;
+    IFrameWriter* next_writer_;
+    size_t pending_writers_;
+    bool stop_;
+
+    bool valid_;
 };
 
 } // namespace audio
@@ -109,6 +109,20 @@ void FreqEstimator::update(packet::stream_timestamp_t current) {
     }
 }
 
+void FreqEstimator::track(packet::stream_timestamp_t current) {
+    double filtered;
+
+    (void)run_decimators_(current, filtered);
+}
+
+void FreqEstimator::update_target_latency(packet::stream_timestamp_t target_latency) {
+    // Integrator keeps accumulated error, which compensates clock drift, so it's
+    // not reset. Proportional term reacts to the new target immediately, and
+    // resulting coefficient is bounded by the caller (LatencyTuner), so the
+    // latency moves towards new target smoothly.
+    target_ = target_latency;
+}
+
 bool FreqEstimator::run_decimators_(packet::stream_timestamp_t current,
                                     double& filtered) {
     samples_counter_++;
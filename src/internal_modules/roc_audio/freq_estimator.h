@@ -75,12 +75,24 @@ public:
     //! Compute new value of frequency coefficient.
     void update(packet::stream_timestamp_t current_latency);
 
+    //! Feed current latency to filters without updating frequency coefficient.
+    //! @remarks
+    //!  Used while latency is driven by someone else (e.g. during fast start),
+    //!  to keep filters warm without accumulating error in integrator.
+    void track(packet::stream_timestamp_t current_latency);
+
+    //! Change target latency.
+    //! @remarks
+    //!  Frequency coefficient will be gradually adjusted to move latency
+    //!  towards new target.
+    void update_target_latency(packet::stream_timestamp_t target_latency);
+
 private:
     bool run_decimators_(packet::stream_timestamp_t current, double& filtered);
     double run_controller_(double current);
 
     const FreqEstimatorConfig config_;
-    const double target_; // Target latency.
+    double target_; // Target latency.
 
     double dec1_casc_buff_[fe_decim_len];
     size_t dec1_ind_;
@@ -12,6 +12,7 @@
 #ifndef ROC_AUDIO_IFRAME_DECODER_H_
 #define ROC_AUDIO_IFRAME_DECODER_H_
 
+#include "roc_audio/pcm_format.h"
 #include "roc_audio/sample.h"
 #include "roc_core/stddefs.h"
 #include "roc_packet/packet.h"
@@ -86,6 +87,27 @@ public:
     //!  This method may be called only between begin() and end() calls.
     virtual size_t read(sample_t* samples, size_t n_samples) = 0;
 
+    //! Read samples from current frame in given PCM format.
+    //!
+    //! @b Parameters
+    //!  - @p format - PCM format of samples to be written to @p buffer
+    //!  - @p buffer - buffer to write samples to
+    //!  - @p n_samples - number of samples to be decoded per channel
+    //!
+    //! @remarks
+    //!  Same as read(), but writes samples in given PCM format instead of raw
+    //!  samples. Used for passthrough, when samples are delivered to the sink
+    //!  without converting them to raw format and back. If @p format has the same
+    //!  bit depth and signedness as encoded samples, the result is bit-exact.
+    //!
+    //! @returns
+    //!  number of samples decoded per channel. The returned value can be fewer than
+    //!  @p n_samples if there are no more samples in the current frame.
+    //!
+    //! @pre
+    //!  This method may be called only between begin() and end() calls.
+    virtual size_t read_pcm(PcmFormat format, void* buffer, size_t n_samples) = 0;
+
     //! Shift samples from current frame.
     //!
     //! @b Parameters
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/iplc.h
+//! @brief Packet loss concealment interface.
+
+#ifndef ROC_AUDIO_IPLC_H_
+#define ROC_AUDIO_IPLC_H_
+
+#include "roc_audio/sample.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace audio {
+
+//! Packet loss concealment interface.
+//! @remarks
+//!  Depacketizer passes every sample of the stream through PLC: decoded
+//!  samples are passed to process_history(), and gaps caused by lost or
+//!  late packets are passed to process_loss().
+//!  Implementations should not allocate memory in these methods.
+class IPlc {
+public:
+    virtual ~IPlc();
+
+    //! Check if the object was successfully constructed.
+    virtual bool is_valid() const = 0;
+
+    //! Process decoded samples.
+    //! @remarks
+    //!  @p samples contains @p n_samples interleaved samples decoded from packets.
+    //!  PLC remembers them to be able to synthesize next gap. If this call follows
+    //!  a gap, PLC may modify beginning of the buffer to smoothly transition from
+    //!  synthesized to real signal.
+    virtual void process_history(sample_t* samples, size_t n_samples) = 0;
+
+    //! Fill gap.
+    //! @remarks
+    //!  @p samples contains @p n_samples interleaved samples to be filled
+    //!  instead of missing ones.
+    //! @returns
+    //!  number of samples that were actually synthesized; the rest of
+    //!  samples is filled with silence.
+    virtual size_t process_loss(sample_t* samples, size_t n_samples) = 0;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_IPLC_H_
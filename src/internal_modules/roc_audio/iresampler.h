@@ -65,6 +65,22 @@ public:
     //! @returns
     //!  Number of samples multiplied by channel count.
     virtual float n_left_to_process() const = 0;
+
+    //! Get period after which resampling grid repeats.
+    //! @remarks
+    //!  Returns true if, with current scaling, every @p in_period input samples
+    //!  produce exactly @p out_period output samples, and output sample depends
+    //!  only on input within @p window samples around it (including internal
+    //!  buffering). In this case, two resamplers started at input positions
+    //!  differing by a multiple of @p in_period produce identical output, except
+    //!  output within @p window from the start. This allows to resample input
+    //!  split into segments independently, and stitch results exactly.
+    //! @note
+    //!  All values are in samples per channel.
+    //! @returns
+    //!  false if backend doesn't guarantee this.
+    virtual bool
+    get_period(size_t& in_period, size_t& out_period, size_t& window) const = 0;
 };
 
 } // namespace audio
@@ -33,6 +33,8 @@ LatencyMonitor::LatencyMonitor(IFrameReader& frame_reader,
     , resampler_(resampler)
     , enable_scaling_(config.tuner_profile != audio::LatencyTunerProfile_Intact)
     , capture_ts_(0)
+    , first_packet_ts_(0)
+    , has_first_audio_(false)
     , packet_sample_spec_(packet_sample_spec)
     , frame_sample_spec_(frame_sample_spec)
     , alive_(true)
@@ -109,6 +111,8 @@ bool LatencyMonitor::pre_process_(const Frame& frame) {
         return false;
     }
 
+    latency_metrics_.target_latency = tuner_.target_latency();
+
     if (enable_scaling_) {
         if (!update_scaling_()) {
             // TODO(gh-183): forward status code
@@ -123,11 +127,27 @@ void LatencyMonitor::post_process_(const Frame& frame) {
     // for end-2-end latency calculations
     capture_ts_ = frame.capture_timestamp();
 
+    if (!has_first_audio_) {
+        compute_first_audio_();
+    }
+
     // after reading the frame we know its duration
     tuner_.advance_stream(frame.duration());
 }
 
 void LatencyMonitor::compute_niq_latency_() {
+    if (first_packet_ts_ == 0) {
+        // Until playback is started, packets are accumulated in the queue,
+        // so its head is the first packet of the session.
+        packet::PacketPtr first_packet = incoming_queue_.head();
+        if (first_packet) {
+            first_packet_ts_ = first_packet->receive_timestamp();
+            if (first_packet_ts_ <= 0) {
+                first_packet_ts_ = core::timestamp(core::ClockUnix);
+            }
+        }
+    }
+
     if (!depacketizer_.is_started()) {
         return;
     }
@@ -177,6 +197,28 @@ void LatencyMonitor::compute_e2e_latency_(const core::nanoseconds_t playback_tim
     latency_metrics_.e2e_latency = playback_timestamp - capture_ts_;
 }
 
+void LatencyMonitor::compute_first_audio_() {
+    if (first_packet_ts_ == 0) {
+        return;
+    }
+
+    // Frame flags are not preserved by resampler, so instead we check if
+    // depacketizer has started producing samples from packets.
+    if (!depacketizer_.is_started()) {
+        return;
+    }
+
+    has_first_audio_ = true;
+
+    const core::nanoseconds_t now = core::timestamp(core::ClockUnix);
+
+    latency_metrics_.time_to_first_audio =
+        std::max(now - first_packet_ts_, (core::nanoseconds_t)1);
+
+    roc_log(LogDebug, "latency monitor: got first audio: time_to_first_audio=%.3fms",
+            (double)latency_metrics_.time_to_first_audio / core::Millisecond);
+}
+
 void LatencyMonitor::query_link_meter_() {
     if (!link_meter_.has_metrics()) {
         return;
@@ -41,6 +41,8 @@ namespace audio {
 //!  - asks LatencyTuner to calculate scaling factor based on the actual and
 //!    target latencies
 //!  - passes calculated scaling factor to resampler
+//!  - calculates time to first audio - how much time passed between receiving
+//!    first packet and returning first frame with samples from packets
 //!
 //! @b Flow
 //!
@@ -94,6 +96,7 @@ public:
 private:
     void compute_niq_latency_();
     void compute_e2e_latency_(core::nanoseconds_t playback_timestamp);
+    void compute_first_audio_();
     void query_link_meter_();
 
     bool pre_process_(const Frame& frame);
@@ -118,6 +121,9 @@ private:
 
     core::nanoseconds_t capture_ts_;
 
+    core::nanoseconds_t first_packet_ts_;
+    bool has_first_audio_;
+
     const SampleSpec packet_sample_spec_;
     const SampleSpec frame_sample_spec_;
 
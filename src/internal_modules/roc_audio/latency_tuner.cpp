@@ -18,6 +18,35 @@ namespace {
 
 const core::nanoseconds_t LogInterval = 5 * core::Second;
 
+// How often adaptive target is recomputed.
+const core::nanoseconds_t AdaptInterval = core::Second;
+
+// Desired target is this many times larger than jitter peak.
+const double AdaptJitterMultiplier = 4;
+
+// Desired target is increased by this fraction per each percent of losses.
+const double AdaptLossMultiplier = 0.1;
+
+// How quickly jitter peak decays when jitter decreases.
+const double AdaptJitterDecay = 0.1;
+
+// Smoothing factor for loss ratio.
+const double AdaptLossSmoothing = 0.3;
+
+// Which part of difference between current and desired target is applied
+// per interval, when growing and shrinking target. We grow quickly to avoid
+// underruns, but shrink slowly to avoid oscillations.
+const double AdaptGrowRate = 0.5;
+const double AdaptShrinkRate = 0.1;
+
+// Target is not changed if desired target is within this range.
+const double AdaptHysteresis = 0.05;
+
+// During this last fraction of fast start ramp, slowdown is gradually
+// reduced, so that there is no sharp change of playback speed when
+// the ramp is finished.
+const double StartTaper = 0.25;
+
 } // namespace
 
 void LatencyConfig::deduce_defaults(core::nanoseconds_t default_target_latency,
@@ -82,6 +111,16 @@ void LatencyConfig::deduce_defaults(core::nanoseconds_t default_target_latency,
 
     // If latency tuning is enabled.
     if (tuner_profile != LatencyTunerProfile_Intact) {
+        // Deduce defaults for adaptive target range.
+        if (enable_adaptive_target && target_latency > 0) {
+            if (min_target_latency == 0) {
+                min_target_latency = target_latency / 2;
+            }
+            if (max_target_latency == 0) {
+                max_target_latency = target_latency * 2;
+            }
+        }
+
         // Deduce defaults for min_latency & max_latency if both are zero.
         if (latency_tolerance == 0) {
             if (target_latency > 0) {
@@ -119,6 +158,11 @@ void LatencyConfig::deduce_defaults(core::nanoseconds_t default_target_latency,
         if (scaling_tolerance == 0) {
             scaling_tolerance = 0.005f;
         }
+
+        // Deduce default for fast start.
+        if (start_latency != 0 && start_scaling_tolerance == 0) {
+            start_scaling_tolerance = 0.01f;
+        }
     }
 
     // If latency bounding is enabled.
@@ -158,6 +202,21 @@ LatencyTuner::LatencyTuner(const LatencyConfig& config, const SampleSpec& sample
     , e2e_latency_(0)
     , has_jitter_(false)
     , jitter_(0)
+    , enable_adaptive_(config.enable_adaptive_target)
+    , adapt_interval_(sample_spec.ns_2_stream_timestamp_delta(AdaptInterval))
+    , adapt_pos_(0)
+    , min_target_latency_(0)
+    , max_target_latency_(0)
+    , interval_jitter_(0)
+    , jitter_peak_(0)
+    , total_packets_(0)
+    , lost_packets_(0)
+    , last_total_packets_(0)
+    , last_lost_packets_(0)
+    , loss_ratio_(0)
+    , starting_(false)
+    , start_latency_(0)
+    , start_coeff_max_delta_(config.start_scaling_tolerance)
     , target_latency_(0)
     , min_latency_(0)
     , max_latency_(0)
@@ -169,7 +228,7 @@ LatencyTuner::LatencyTuner(const LatencyConfig& config, const SampleSpec& sample
             " target_latency=%ld(%.3fms) latency_tolerance=%ld(%.3fms)"
             " stale_tolerance=%ld(%.3fms)"
             " scaling_interval=%ld(%.3fms) scaling_tolerance=%f"
-            " backend=%s profile=%s",
+            " backend=%s profile=%s adaptive=%d start_latency=%ld(%.3fms)",
             (long)sample_spec_.ns_2_stream_timestamp_delta(config.target_latency),
             (double)config.target_latency / core::Millisecond,
             (long)sample_spec_.ns_2_stream_timestamp_delta(config.latency_tolerance),
@@ -179,7 +238,9 @@ LatencyTuner::LatencyTuner(const LatencyConfig& config, const SampleSpec& sample
             (long)sample_spec_.ns_2_stream_timestamp_delta(config.scaling_interval),
             (double)config.scaling_interval / core::Millisecond,
             (double)config.scaling_tolerance, latency_tuner_backend_to_str(backend_),
-            latency_tuner_profile_to_str(profile_));
+            latency_tuner_profile_to_str(profile_), (int)enable_adaptive_,
+            (long)sample_spec_.ns_2_stream_timestamp_delta(config.start_latency),
+            (double)config.start_latency / core::Millisecond);
 
     if (config.target_latency < 0) {
         roc_log(LogError,
@@ -200,11 +261,43 @@ LatencyTuner::LatencyTuner(const LatencyConfig& config, const SampleSpec& sample
             return;
         }
 
+        if (enable_adaptive_) {
+            min_target_latency_ =
+                sample_spec_.ns_2_stream_timestamp_delta(config.min_target_latency);
+            max_target_latency_ =
+                sample_spec_.ns_2_stream_timestamp_delta(config.max_target_latency);
+
+            if (!enable_tuning_) {
+                roc_log(LogError,
+                        "latency tuner: invalid config:"
+                        " adaptive target requires latency tuning to be enabled");
+                return;
+            }
+
+            if (config.min_target_latency <= 0 || min_target_latency_ <= 0
+                || config.max_target_latency < config.min_target_latency
+                || config.target_latency < config.min_target_latency
+                || config.target_latency > config.max_target_latency) {
+                roc_log(LogError,
+                        "latency tuner: invalid config: adaptive target range is invalid:"
+                        " target_latency=%.3fms min_target_latency=%.3fms"
+                        " max_target_latency=%.3fms",
+                        (double)config.target_latency / core::Millisecond,
+                        (double)config.min_target_latency / core::Millisecond,
+                        (double)config.max_target_latency / core::Millisecond);
+                return;
+            }
+        } else {
+            min_target_latency_ = max_target_latency_ = target_latency_;
+        }
+
         if (enable_bounds_) {
-            min_latency_ = sample_spec_.ns_2_stream_timestamp_delta(
-                config.target_latency - config.latency_tolerance);
-            max_latency_ = sample_spec_.ns_2_stream_timestamp_delta(
-                config.target_latency + config.latency_tolerance);
+            // When target is adaptive, bounds cover the whole range of targets,
+            // so that changing target never causes session termination.
+            min_latency_ = min_target_latency_
+                - sample_spec_.ns_2_stream_timestamp_delta(config.latency_tolerance);
+            max_latency_ = max_target_latency_
+                + sample_spec_.ns_2_stream_timestamp_delta(config.latency_tolerance);
             max_stalling_ =
                 sample_spec_.ns_2_stream_timestamp_delta(config.stale_tolerance);
 
@@ -254,6 +347,40 @@ LatencyTuner::LatencyTuner(const LatencyConfig& config, const SampleSpec& sample
         }
     }
 
+    if (config.start_latency != 0) {
+        if (!enable_tuning_) {
+            roc_log(LogError,
+                    "latency tuner: invalid config:"
+                    " fast start requires latency tuning to be enabled");
+            return;
+        }
+
+        start_latency_ = sample_spec_.ns_2_stream_timestamp_delta(config.start_latency);
+
+        if (config.start_latency < 0 || start_latency_ <= 0
+            || config.start_latency > config.target_latency) {
+            roc_log(LogError,
+                    "latency tuner: invalid config: start_latency is out of bounds:"
+                    " start_latency=%ld(%.3fms) target_latency=%ld(%.3fms)",
+                    (long)start_latency_,
+                    (double)config.start_latency / core::Millisecond,
+                    (long)target_latency_,
+                    (double)config.target_latency / core::Millisecond);
+            return;
+        }
+
+        if (config.start_scaling_tolerance <= 0) {
+            roc_log(LogError,
+                    "latency tuner: invalid config:"
+                    " start_scaling_tolerance is out of bounds:"
+                    " start_scaling_tolerance=%f",
+                    (double)config.start_scaling_tolerance);
+            return;
+        }
+
+        starting_ = start_latency_ < target_latency_;
+    }
+
     valid_ = true;
 }
 
@@ -284,6 +411,12 @@ void LatencyTuner::write_metrics(const LatencyMetrics& latency_metrics,
         jitter_ = sample_spec_.ns_2_stream_timestamp_delta(link_metrics.jitter);
         has_jitter_ = true;
     }
+
+    if (enable_adaptive_) {
+        interval_jitter_ = std::max(interval_jitter_, jitter_);
+        total_packets_ = link_metrics.total_packets;
+        lost_packets_ = link_metrics.lost_packets;
+    }
 }
 
 bool LatencyTuner::update_stream() {
@@ -310,14 +443,32 @@ bool LatencyTuner::update_stream() {
         break;
     }
 
+    if (starting_ && latency >= target_latency_) {
+        roc_log(LogDebug,
+                "latency tuner: fast start finished:"
+                " latency=%ld(%.3fms) target=%ld(%.3fms)",
+                (long)latency, sample_spec_.stream_timestamp_delta_2_ms(latency),
+                (long)target_latency_,
+                sample_spec_.stream_timestamp_delta_2_ms(target_latency_));
+        starting_ = false;
+    }
+
     if (enable_bounds_) {
         if (!check_bounds_(latency)) {
             return false;
         }
     }
 
+    if (enable_adaptive_) {
+        adapt_target_();
+    }
+
     if (enable_tuning_) {
-        compute_scaling_(latency);
+        if (starting_) {
+            compute_start_scaling_(latency);
+        } else {
+            compute_scaling_(latency);
+        }
     }
 
     return true;
@@ -342,13 +493,31 @@ float LatencyTuner::fetch_scaling() {
     return freq_coeff_;
 }
 
+core::nanoseconds_t LatencyTuner::target_latency() const {
+    roc_panic_if(!is_valid());
+
+    return sample_spec_.stream_timestamp_delta_2_ns(target_latency_);
+}
+
+bool LatencyTuner::is_starting() const {
+    roc_panic_if(!is_valid());
+
+    return starting_;
+}
+
 bool LatencyTuner::check_bounds_(const packet::stream_timestamp_diff_t latency) {
     // Queue is considered "stalling" if there were no new packets for
     // some period of time.
     const bool is_stalling = backend_ == audio::LatencyTunerBackend_Niq
         && niq_stalling_ > max_stalling_ && max_stalling_ > 0;
 
-    if (latency < min_latency_ && is_stalling) {
+    // During fast start, latency is expected to be lower than target,
+    // so lower bound is shifted down by the distance from start to target.
+    const packet::stream_timestamp_diff_t min_latency = starting_
+        ? std::min(min_latency_, min_latency_ - (min_target_latency_ - start_latency_))
+        : min_latency_;
+
+    if (latency < min_latency && is_stalling) {
         // There are two possible reasons why queue latency becomes lower than minimum:
         //  1. either we were not able to compensate clock drift (or compensation is
         //     disabled) and queue slowly exhausted,
@@ -368,7 +537,7 @@ bool LatencyTuner::check_bounds_(const packet::stream_timestamp_diff_t latency)
         return true;
     }
 
-    if (latency < min_latency_ || latency > max_latency_) {
+    if (latency < min_latency || latency > max_latency_) {
         roc_log(
             LogDebug,
             "latency tuner: latency out of bounds:"
@@ -376,8 +545,8 @@ bool LatencyTuner::check_bounds_(const packet::stream_timestamp_diff_t latency)
             " min=%ld(%.3fms) max=%ld(%.3fms) stale=%ld(%.3fms)",
             (long)latency, sample_spec_.stream_timestamp_delta_2_ms(latency),
             (long)target_latency_,
-            sample_spec_.stream_timestamp_delta_2_ms(target_latency_), (long)min_latency_,
-            sample_spec_.stream_timestamp_delta_2_ms(min_latency_), (long)max_latency_,
+            sample_spec_.stream_timestamp_delta_2_ms(target_latency_), (long)min_latency,
+            sample_spec_.stream_timestamp_delta_2_ms(min_latency), (long)max_latency_,
             sample_spec_.stream_timestamp_delta_2_ms(max_latency_), (long)niq_stalling_,
             sample_spec_.stream_timestamp_delta_2_ms(niq_stalling_));
         return false;
@@ -407,6 +576,121 @@ void LatencyTuner::compute_scaling_(packet::stream_timestamp_diff_t latency) {
     freq_coeff_ = std::max(freq_coeff_, 1.0f - freq_coeff_max_delta_);
 }
 
+void LatencyTuner::compute_start_scaling_(packet::stream_timestamp_diff_t latency) {
+    if (latency < 0) {
+        latency = 0;
+    }
+
+    if (stream_pos_ < scale_pos_) {
+        return;
+    }
+
+    // Keep estimator filters fed with actual latency, so that when the ramp
+    // finishes, regular tuning starts from real history instead of the initial
+    // target-filled state. Integrator is not updated, since latency is driven
+    // by the ramp, not by clock drift.
+    while (stream_pos_ >= scale_pos_) {
+        fe_->track((packet::stream_timestamp_t)latency);
+        scale_pos_ += (packet::stream_timestamp_t)scale_interval_;
+    }
+
+    // Fraction of the ramp that is not yet passed, from 1 to 0.
+    const double ramp_len = (double)std::max(target_latency_ - start_latency_,
+                                             (packet::stream_timestamp_diff_t)1);
+    const double ramp_remaining = double(target_latency_ - latency) / ramp_len;
+
+    // Slow down playback as much as allowed, until the last part of the ramp,
+    // where slowdown is reduced down to the regular scaling tolerance.
+    float delta = start_coeff_max_delta_
+        * (float)std::max(0.0, std::min(1.0, ramp_remaining / StartTaper));
+    delta = std::max(delta, freq_coeff_max_delta_);
+
+    has_new_freq_coeff_ = true;
+    freq_coeff_ = 1.0f - delta;
+}
+
+void LatencyTuner::adapt_target_() {
+    if (stream_pos_ < adapt_pos_) {
+        return;
+    }
+
+    while (stream_pos_ >= adapt_pos_) {
+        adapt_pos_ += (packet::stream_timestamp_t)adapt_interval_;
+    }
+
+    if (!has_jitter_) {
+        // Link meter didn't report anything yet.
+        return;
+    }
+
+    // Track jitter peak: follow increases immediately, and decay slowly,
+    // so that a short period of calm doesn't shrink the target.
+    if (interval_jitter_ > jitter_peak_) {
+        jitter_peak_ = interval_jitter_;
+    } else {
+        jitter_peak_ += (interval_jitter_ - jitter_peak_) * AdaptJitterDecay;
+    }
+    interval_jitter_ = jitter_;
+
+    // Track loss ratio during recent intervals.
+    if (total_packets_ > last_total_packets_) {
+        double ratio = double(lost_packets_ - last_lost_packets_)
+            / double(total_packets_ - last_total_packets_);
+        ratio = std::max(0.0, std::min(1.0, ratio));
+
+        loss_ratio_ += (ratio - loss_ratio_) * AdaptLossSmoothing;
+    }
+    last_total_packets_ = total_packets_;
+    last_lost_packets_ = lost_packets_;
+
+    double desired_target = jitter_peak_ * AdaptJitterMultiplier
+        * (1 + AdaptLossMultiplier * loss_ratio_ * 100);
+    desired_target = std::max(desired_target, (double)min_target_latency_);
+    desired_target = std::min(desired_target, (double)max_target_latency_);
+
+    double new_target = target_latency_;
+
+    if (desired_target > target_latency_ * (1 + AdaptHysteresis)) {
+        new_target += (desired_target - target_latency_) * AdaptGrowRate;
+    } else if (desired_target < target_latency_ * (1 - AdaptHysteresis)) {
+        new_target += (desired_target - target_latency_) * AdaptShrinkRate;
+    } else {
+        return;
+    }
+
+    if (std::abs(desired_target - new_target) < desired_target * AdaptHysteresis) {
+        // Close enough, snap to desired target, to not get stuck
+        // near it because of hysteresis.
+        new_target = desired_target;
+    }
+
+    const packet::stream_timestamp_diff_t new_target_latency =
+        std::max(min_target_latency_,
+                 std::min(max_target_latency_,
+                          (packet::stream_timestamp_diff_t)(new_target + 0.5)));
+
+    if (new_target_latency == target_latency_) {
+        return;
+    }
+
+    roc_log(LogDebug,
+            "latency tuner: updating target latency:"
+            " old=%ld(%.3fms) new=%ld(%.3fms) jitter_peak=%.3fms loss_ratio=%.4f",
+            (long)target_latency_,
+            sample_spec_.stream_timestamp_delta_2_ms(target_latency_),
+            (long)new_target_latency,
+            sample_spec_.stream_timestamp_delta_2_ms(new_target_latency),
+            sample_spec_.stream_timestamp_delta_2_ms(
+                (packet::stream_timestamp_diff_t)jitter_peak_),
+            loss_ratio_);
+
+    target_latency_ = new_target_latency;
+
+    // Frequency estimator will smoothly move latency towards new target
+    // via resampler scaling, without dropping or inserting samples.
+    fe_->update_target_latency((packet::stream_timestamp_t)target_latency_);
+}
+
 void LatencyTuner::report_() {
     if (stream_pos_ < report_pos_) {
         return;
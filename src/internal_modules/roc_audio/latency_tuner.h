@@ -114,6 +114,51 @@ struct LatencyConfig {
     //!  Negative value is an error.
     float scaling_tolerance;
 
+    //! Enable adaptive target latency.
+    //! @remarks
+    //!  If enabled, target latency is periodically recomputed from network jitter
+    //!  and losses reported by link meter. It shrinks towards min_target_latency
+    //!  on stable links and grows up to max_target_latency when jitter rises.
+    //!  Initial target is target_latency. Transitions are performed by the
+    //!  resampler, so latency tuning (non-intact profile) is required.
+    bool enable_adaptive_target;
+
+    //! Minimum target latency for adaptive mode.
+    //! @note
+    //!  If zero, half of target_latency is used.
+    //!  Negative value is an error.
+    core::nanoseconds_t min_target_latency;
+
+    //! Maximum target latency for adaptive mode.
+    //! @note
+    //!  If zero, double target_latency is used.
+    //!  Negative value is an error.
+    core::nanoseconds_t max_target_latency;
+
+    //! Start latency for fast start.
+    //! @remarks
+    //!  If non-zero, playback starts as soon as this much is buffered, instead of
+    //!  waiting until target_latency is buffered. After that, latency tuner
+    //!  slows down playback via resampler until latency grows up to target.
+    //!  Latency tuning (non-intact profile) is required.
+    //! @note
+    //!  If zero, fast start is disabled.
+    //!  Negative value is an error.
+    core::nanoseconds_t start_latency;
+
+    //! Maximum allowed deviation of freq_coeff from 1.0 during fast start.
+    //! @remarks
+    //!  Defines how quickly latency grows from start_latency to target_latency.
+    //!  For example, 0.01 (default) means that playback is up to 1% slower than
+    //!  capture, i.e. every second of playback adds up to 10ms of latency, and
+    //!  ramp from 40ms to 200ms takes about 16 seconds (plus a few seconds of
+    //!  tapering near the target). Larger values make ramp faster, but pitch
+    //!  shift becomes audible (5% is almost a semitone).
+    //! @note
+    //!  If zero, default value is used.
+    //!  Negative value is an error.
+    float start_scaling_tolerance;
+
     //! Initialize.
     LatencyConfig()
         : tuner_backend(LatencyTunerBackend_Default)
@@ -122,7 +167,12 @@ struct LatencyConfig {
         , latency_tolerance(0)
         , stale_tolerance(0)
         , scaling_interval(0)
-        , scaling_tolerance(0) {
+        , scaling_tolerance(0)
+        , enable_adaptive_target(false)
+        , min_target_latency(0)
+        , max_target_latency(0)
+        , start_latency(0)
+        , start_scaling_tolerance(0) {
     }
 
     //! Automatically fill missing settings.
@@ -144,10 +194,23 @@ struct LatencyMetrics {
     //! on receiver.
     core::nanoseconds_t e2e_latency;
 
+    //! Current target latency.
+    //! Equals to configured target latency, unless adaptive target is enabled,
+    //! in which case it's the target currently chosen by latency tuner.
+    core::nanoseconds_t target_latency;
+
+    //! Time to first audio.
+    //! Delay between receiving first packet of the session and playing first
+    //! frame with samples from packets. Calculated on receiver, zero until
+    //! playback starts.
+    core::nanoseconds_t time_to_first_audio;
+
     LatencyMetrics()
         : niq_latency(0)
         , niq_stalling(0)
-        , e2e_latency(0) {
+        , e2e_latency(0)
+        , target_latency(0)
+        , time_to_first_audio(0) {
     }
 };
 
@@ -164,6 +227,9 @@ struct LatencyMetrics {
 //! - assuming that the difference between actual latency and target latency is
 //!   caused by the clock drift between sender and receiver, calculates scaling
 //!   factor for resampler to compensate it
+//! - optionally, adapts target latency to network jitter and losses
+//! - optionally, performs fast start: if playback was started with latency
+//!   lower than target, ramps latency up to target by slowing down playback
 class LatencyTuner : public core::NonCopyable<> {
 public:
     //! Initialize.
@@ -199,9 +265,23 @@ public:
     //!  Returned value is close to 1.0.
     float fetch_scaling();
 
+    //! Get current target latency.
+    //! @remarks
+    //!  If adaptive target is disabled, returns configured target latency.
+    //!  Otherwise, returns target latency currently chosen by tuner.
+    core::nanoseconds_t target_latency() const;
+
+    //! Check if fast start ramp-up is in progress.
+    //! @remarks
+    //!  Returns true if fast start is enabled and latency didn't reach
+    //!  target yet.
+    bool is_starting() const;
+
 private:
     bool check_bounds_(packet::stream_timestamp_diff_t latency);
     void compute_scaling_(packet::stream_timestamp_diff_t latency);
+    void compute_start_scaling_(packet::stream_timestamp_diff_t latency);
+    void adapt_target_();
     void report_();
 
     core::Optional<FreqEstimator> fe_;
@@ -234,6 +314,23 @@ private:
     bool has_jitter_;
     packet::stream_timestamp_diff_t jitter_;
 
+    const bool enable_adaptive_;
+    packet::stream_timestamp_diff_t adapt_interval_;
+    packet::stream_timestamp_t adapt_pos_;
+    packet::stream_timestamp_diff_t min_target_latency_;
+    packet::stream_timestamp_diff_t max_target_latency_;
+    packet::stream_timestamp_diff_t interval_jitter_;
+    double jitter_peak_;
+    uint64_t total_packets_;
+    int64_t lost_packets_;
+    uint64_t last_total_packets_;
+    int64_t last_lost_packets_;
+    double loss_ratio_;
+
+    bool starting_;
+    packet::stream_timestamp_diff_t start_latency_;
+    const float start_coeff_max_delta_;
+
     packet::stream_timestamp_diff_t target_latency_;
     packet::stream_timestamp_diff_t min_latency_;
     packet::stream_timestamp_diff_t max_latency_;
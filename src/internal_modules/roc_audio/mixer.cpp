@@ -7,6 +7,7 @@
  */
 
 #include "roc_audio/mixer.h"
+#include "roc_audio/sample_ops.h"
 #include "roc_audio/sample_spec_to_str.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
@@ -124,13 +125,8 @@ void Mixer::read_(sample_t* out_data,
             continue;
         }
 
-        for (size_t n = 0; n < out_size; n++) {
-            out_data[n] += temp_data[n];
-
-            // Saturate on overflow.
-            out_data[n] = std::min(out_data[n], Sample_Max);
-            out_data[n] = std::max(out_data[n], Sample_Min);
-        }
+        // Add samples and saturate on overflow.
+        mix_samples(out_data, temp_data, out_size);
 
         // Accumulate flags from all mixed frames.
         out_flags |= temp_frame.flags();
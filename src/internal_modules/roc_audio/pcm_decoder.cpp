@@ -9,6 +9,7 @@
 #include "roc_audio/pcm_decoder.h"
 #include "roc_audio/sample.h"
 #include "roc_core/panic.h"
+#include "roc_core/stddefs.h"
 
 namespace roc {
 namespace audio {
@@ -84,6 +85,48 @@ size_t PcmDecoder::read(sample_t* samples, size_t n_samples) {
     return n_mapped_samples;
 }
 
+size_t PcmDecoder::read_pcm(PcmFormat format, void* buffer, size_t n_samples) {
+    if (!frame_data_) {
+        roc_panic("pcm decoder: read should be called only between begin/end");
+    }
+
+    if (n_samples > (size_t)stream_avail_) {
+        n_samples = (size_t)stream_avail_;
+    }
+
+    size_t n_mapped_samples = 0;
+
+    if (format == pcm_mapper_.input_format() && frame_bit_off_ % 8 == 0
+        && pcm_mapper_.input_bit_count(1) % 8 == 0) {
+        // Fast path: samples already have requested format, just copy bytes.
+        const size_t n_bytes = pcm_mapper_.input_byte_count(n_samples * n_chans_);
+
+        roc_panic_if_not(frame_bit_off_ / 8 + n_bytes <= frame_byte_size_);
+
+        memcpy(buffer, (const uint8_t*)frame_data_ + frame_bit_off_ / 8, n_bytes);
+        frame_bit_off_ += n_bytes * 8;
+
+        n_mapped_samples = n_samples;
+    } else {
+        PcmMapper mapper(pcm_mapper_.input_format(), format);
+
+        size_t buffer_bit_off = 0;
+
+        n_mapped_samples =
+            mapper.map(frame_data_, frame_byte_size_, frame_bit_off_, buffer,
+                       mapper.output_byte_count(n_samples * n_chans_), buffer_bit_off,
+                       n_samples * n_chans_)
+            / n_chans_;
+
+        roc_panic_if_not(n_mapped_samples <= n_samples);
+    }
+
+    stream_pos_ += (packet::stream_timestamp_t)n_mapped_samples;
+    stream_avail_ -= (packet::stream_timestamp_t)n_mapped_samples;
+
+    return n_mapped_samples;
+}
+
 size_t PcmDecoder::shift(size_t n_samples) {
     if (!frame_data_) {
         roc_panic("pcm decoder: shift should be called only between begin/end");
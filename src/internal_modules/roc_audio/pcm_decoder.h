@@ -46,6 +46,9 @@ public:
     //! Read samples from current frame.
     virtual size_t read(sample_t* samples, size_t n_samples);
 
+    //! Read samples from current frame in given PCM format.
+    virtual size_t read_pcm(PcmFormat format, void* buffer, size_t n_samples);
+
     //! Shift samples from current frame.
     virtual size_t shift(size_t n_samples);
 
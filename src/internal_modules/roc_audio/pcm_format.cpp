@@ -10133,7 +10133,9 @@ template <> struct pcm_code_converter<PcmCode_SInt8, PcmCode_Float32> {
 
         float out;
         // integer to float
-        out = float(in * (1.0 / ((double)pcm_sint8_max + 1.0)));
+        // (input fits into float mantissa and scale is a power of two, so single
+        // precision gives exactly the same result as double and is faster)
+        out = float(in) * float(1.0 / ((double)pcm_sint8_max + 1.0));
 
         return out;
     }
@@ -10147,7 +10149,9 @@ template <> struct pcm_code_converter<PcmCode_UInt8, PcmCode_Float32> {
 
         float out;
         // integer to float
-        out = float(in * (1.0 / ((double)pcm_sint8_max + 1.0)));
+        // (input fits into float mantissa and scale is a power of two, so single
+        // precision gives exactly the same result as double and is faster)
+        out = float(in) * float(1.0 / ((double)pcm_sint8_max + 1.0));
 
         return out;
     }
@@ -10160,7 +10164,9 @@ template <> struct pcm_code_converter<PcmCode_SInt16, PcmCode_Float32> {
 
         float out;
         // integer to float
-        out = float(in * (1.0 / ((double)pcm_sint16_max + 1.0)));
+        // (input fits into float mantissa and scale is a power of two, so single
+        // precision gives exactly the same result as double and is faster)
+        out = float(in) * float(1.0 / ((double)pcm_sint16_max + 1.0));
 
         return out;
     }
@@ -10174,7 +10180,9 @@ template <> struct pcm_code_converter<PcmCode_UInt16, PcmCode_Float32> {
 
         float out;
         // integer to float
-        out = float(in * (1.0 / ((double)pcm_sint16_max + 1.0)));
+        // (input fits into float mantissa and scale is a power of two, so single
+        // precision gives exactly the same result as double and is faster)
+        out = float(in) * float(1.0 / ((double)pcm_sint16_max + 1.0));
 
         return out;
     }
@@ -10187,7 +10195,9 @@ template <> struct pcm_code_converter<PcmCode_SInt18, PcmCode_Float32> {
 
         float out;
         // integer to float
-        out = float(in * (1.0 / ((double)pcm_sint18_max + 1.0)));
+        // (input fits into float mantissa and scale is a power of two, so single
+        // precision gives exactly the same result as double and is faster)
+        out = float(in) * float(1.0 / ((double)pcm_sint18_max + 1.0));
 
         return out;
     }
@@ -10201,7 +10211,9 @@ template <> struct pcm_code_converter<PcmCode_UInt18, PcmCode_Float32> {
 
         float out;
         // integer to float
-        out = float(in * (1.0 / ((double)pcm_sint18_max + 1.0)));
+        // (input fits into float mantissa and scale is a power of two, so single
+        // precision gives exactly the same result as double and is faster)
+        out = float(in) * float(1.0 / ((double)pcm_sint18_max + 1.0));
 
         return out;
     }
@@ -10214,7 +10226,9 @@ template <> struct pcm_code_converter<PcmCode_SInt18_3, PcmCode_Float32> {
 
         float out;
         // integer to float
-        out = float(in * (1.0 / ((double)pcm_sint18_3_max + 1.0)));
+        // (input fits into float mantissa and scale is a power of two, so single
+        // precision gives exactly the same result as double and is faster)
+        out = float(in) * float(1.0 / ((double)pcm_sint18_3_max + 1.0));
 
         return out;
     }
@@ -10228,7 +10242,9 @@ template <> struct pcm_code_converter<PcmCode_UInt18_3, PcmCode_Float32> {
 
         float out;
         // integer to float
-        out = float(in * (1.0 / ((double)pcm_sint18_3_max + 1.0)));
+        // (input fits into float mantissa and scale is a power of two, so single
+        // precision gives exactly the same result as double and is faster)
+        out = float(in) * float(1.0 / ((double)pcm_sint18_3_max + 1.0));
 
         return out;
     }
@@ -10241,7 +10257,9 @@ template <> struct pcm_code_converter<PcmCode_SInt18_4, PcmCode_Float32> {
 
         float out;
         // integer to float
-        out = float(in * (1.0 / ((double)pcm_sint18_4_max + 1.0)));
+        // (input fits into float mantissa and scale is a power of two, so single
+        // precision gives exactly the same result as double and is faster)
+        out = float(in) * float(1.0 / ((double)pcm_sint18_4_max + 1.0));
 
         return out;
     }
@@ -10255,7 +10273,9 @@ template <> struct pcm_code_converter<PcmCode_UInt18_4, PcmCode_Float32> {
 
         float out;
         // integer to float
-        out = float(in * (1.0 / ((double)pcm_sint18_4_max + 1.0)));
+        // (input fits into float mantissa and scale is a power of two, so single
+        // precision gives exactly the same result as double and is faster)
+        out = float(in) * float(1.0 / ((double)pcm_sint18_4_max + 1.0));
 
         return out;
     }
@@ -10268,7 +10288,9 @@ template <> struct pcm_code_converter<PcmCode_SInt20, PcmCode_Float32> {
 
         float out;
         // integer to float
-        out = float(in * (1.0 / ((double)pcm_sint20_max + 1.0)));
+        // (input fits into float mantissa and scale is a power of two, so single
+        // precision gives exactly the same result as double and is faster)
+        out = float(in) * float(1.0 / ((double)pcm_sint20_max + 1.0));
 
         return out;
     }
@@ -10282,7 +10304,9 @@ template <> struct pcm_code_converter<PcmCode_UInt20, PcmCode_Float32> {
 
         float out;
         // integer to float
-        out = float(in * (1.0 / ((double)pcm_sint20_max + 1.0)));
+        // (input fits into float mantissa and scale is a power of two, so single
+        // precision gives exactly the same result as double and is faster)
+        out = float(in) * float(1.0 / ((double)pcm_sint20_max + 1.0));
 
         return out;
     }
@@ -10295,7 +10319,9 @@ template <> struct pcm_code_converter<PcmCode_SInt20_3, PcmCode_Float32> {
 
         float out;
         // integer to float
-        out = float(in * (1.0 / ((double)pcm_sint20_3_max + 1.0)));
+        // (input fits into float mantissa and scale is a power of two, so single
+        // precision gives exactly the same result as double and is faster)
+        out = float(in) * float(1.0 / ((double)pcm_sint20_3_max + 1.0));
 
         return out;
     }
@@ -10309,7 +10335,9 @@ template <> struct pcm_code_converter<PcmCode_UInt20_3, PcmCode_Float32> {
 
         float out;
         // integer to float
-        out = float(in * (1.0 / ((double)pcm_sint20_3_max + 1.0)));
+        // (input fits into float mantissa and scale is a power of two, so single
+        // precision gives exactly the same result as double and is faster)
+        out = float(in) * float(1.0 / ((double)pcm_sint20_3_max + 1.0));
 
         return out;
     }
@@ -10322,7 +10350,9 @@ template <> struct pcm_code_converter<PcmCode_SInt20_4, PcmCode_Float32> {
 
         float out;
         // integer to float
-        out = float(in * (1.0 / ((double)pcm_sint20_4_max + 1.0)));
+        // (input fits into float mantissa and scale is a power of two, so single
+        // precision gives exactly the same result as double and is faster)
+        out = float(in) * float(1.0 / ((double)pcm_sint20_4_max + 1.0));
 
         return out;
     }
@@ -10336,7 +10366,9 @@ template <> struct pcm_code_converter<PcmCode_UInt20_4, PcmCode_Float32> {
 
         float out;
         // integer to float
-        out = float(in * (1.0 / ((double)pcm_sint20_4_max + 1.0)));
+        // (input fits into float mantissa and scale is a power of two, so single
+        // precision gives exactly the same result as double and is faster)
+        out = float(in) * float(1.0 / ((double)pcm_sint20_4_max + 1.0));
 
         return out;
     }
@@ -10349,7 +10381,9 @@ template <> struct pcm_code_converter<PcmCode_SInt24, PcmCode_Float32> {
 
         float out;
         // integer to float
-        out = float(in * (1.0 / ((double)pcm_sint24_max + 1.0)));
+        // (input fits into float mantissa and scale is a power of two, so single
+        // precision gives exactly the same result as double and is faster)
+        out = float(in) * float(1.0 / ((double)pcm_sint24_max + 1.0));
 
         return out;
     }
@@ -10363,7 +10397,9 @@ template <> struct pcm_code_converter<PcmCode_UInt24, PcmCode_Float32> {
 
         float out;
         // integer to float
-        out = float(in * (1.0 / ((double)pcm_sint24_max + 1.0)));
+        // (input fits into float mantissa and scale is a power of two, so single
+        // precision gives exactly the same result as double and is faster)
+        out = float(in) * float(1.0 / ((double)pcm_sint24_max + 1.0));
 
         return out;
     }
@@ -10376,7 +10412,9 @@ template <> struct pcm_code_converter<PcmCode_SInt24_4, PcmCode_Float32> {
 
         float out;
         // integer to float
-        out = float(in * (1.0 / ((double)pcm_sint24_4_max + 1.0)));
+        // (input fits into float mantissa and scale is a power of two, so single
+        // precision gives exactly the same result as double and is faster)
+        out = float(in) * float(1.0 / ((double)pcm_sint24_4_max + 1.0));
 
         return out;
     }
@@ -10390,7 +10428,9 @@ template <> struct pcm_code_converter<PcmCode_UInt24_4, PcmCode_Float32> {
 
         float out;
         // integer to float
-        out = float(in * (1.0 / ((double)pcm_sint24_4_max + 1.0)));
+        // (input fits into float mantissa and scale is a power of two, so single
+        // precision gives exactly the same result as double and is faster)
+        out = float(in) * float(1.0 / ((double)pcm_sint24_4_max + 1.0));
 
         return out;
     }
@@ -11031,6 +11071,32 @@ template <> struct pcm_packer<PcmCode_SInt8, PcmEndian_Big> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, int8_t arg) {
+        // native-endian view of octets
+        pcm_sample<int8_t> p;
+        p.value = arg;
+
+        // write in big-endian order
+        buffer[0] = p.octets.octet0;
+        buffer += 1;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline int8_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<int8_t> p;
+
+        // read in big-endian order
+        p.octets.octet0 = buffer[0];
+        buffer += 1;
+
+        return p.value;
+    }
 };
 
 // SInt8 Little-Endian packer / unpacker
@@ -11055,6 +11121,32 @@ template <> struct pcm_packer<PcmCode_SInt8, PcmEndian_Little> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, int8_t arg) {
+        // native-endian view of octets
+        pcm_sample<int8_t> p;
+        p.value = arg;
+
+        // write in little-endian order
+        buffer[0] = p.octets.octet0;
+        buffer += 1;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline int8_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<int8_t> p;
+
+        // read in little-endian order
+        p.octets.octet0 = buffer[0];
+        buffer += 1;
+
+        return p.value;
+    }
 };
 
 // UInt8 Big-Endian packer / unpacker
@@ -11079,6 +11171,32 @@ template <> struct pcm_packer<PcmCode_UInt8, PcmEndian_Big> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, uint8_t arg) {
+        // native-endian view of octets
+        pcm_sample<uint8_t> p;
+        p.value = arg;
+
+        // write in big-endian order
+        buffer[0] = p.octets.octet0;
+        buffer += 1;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline uint8_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<uint8_t> p;
+
+        // read in big-endian order
+        p.octets.octet0 = buffer[0];
+        buffer += 1;
+
+        return p.value;
+    }
 };
 
 // UInt8 Little-Endian packer / unpacker
@@ -11103,6 +11221,32 @@ template <> struct pcm_packer<PcmCode_UInt8, PcmEndian_Little> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, uint8_t arg) {
+        // native-endian view of octets
+        pcm_sample<uint8_t> p;
+        p.value = arg;
+
+        // write in little-endian order
+        buffer[0] = p.octets.octet0;
+        buffer += 1;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline uint8_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<uint8_t> p;
+
+        // read in little-endian order
+        p.octets.octet0 = buffer[0];
+        buffer += 1;
+
+        return p.value;
+    }
 };
 
 // SInt16 Big-Endian packer / unpacker
@@ -11129,6 +11273,34 @@ template <> struct pcm_packer<PcmCode_SInt16, PcmEndian_Big> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, int16_t arg) {
+        // native-endian view of octets
+        pcm_sample<int16_t> p;
+        p.value = arg;
+
+        // write in big-endian order
+        buffer[0] = p.octets.octet1;
+        buffer[1] = p.octets.octet0;
+        buffer += 2;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline int16_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<int16_t> p;
+
+        // read in big-endian order
+        p.octets.octet1 = buffer[0];
+        p.octets.octet0 = buffer[1];
+        buffer += 2;
+
+        return p.value;
+    }
 };
 
 // SInt16 Little-Endian packer / unpacker
@@ -11155,6 +11327,34 @@ template <> struct pcm_packer<PcmCode_SInt16, PcmEndian_Little> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, int16_t arg) {
+        // native-endian view of octets
+        pcm_sample<int16_t> p;
+        p.value = arg;
+
+        // write in little-endian order
+        buffer[0] = p.octets.octet0;
+        buffer[1] = p.octets.octet1;
+        buffer += 2;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline int16_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<int16_t> p;
+
+        // read in little-endian order
+        p.octets.octet0 = buffer[0];
+        p.octets.octet1 = buffer[1];
+        buffer += 2;
+
+        return p.value;
+    }
 };
 
 // UInt16 Big-Endian packer / unpacker
@@ -11181,6 +11381,34 @@ template <> struct pcm_packer<PcmCode_UInt16, PcmEndian_Big> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, uint16_t arg) {
+        // native-endian view of octets
+        pcm_sample<uint16_t> p;
+        p.value = arg;
+
+        // write in big-endian order
+        buffer[0] = p.octets.octet1;
+        buffer[1] = p.octets.octet0;
+        buffer += 2;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline uint16_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<uint16_t> p;
+
+        // read in big-endian order
+        p.octets.octet1 = buffer[0];
+        p.octets.octet0 = buffer[1];
+        buffer += 2;
+
+        return p.value;
+    }
 };
 
 // UInt16 Little-Endian packer / unpacker
@@ -11207,6 +11435,34 @@ template <> struct pcm_packer<PcmCode_UInt16, PcmEndian_Little> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, uint16_t arg) {
+        // native-endian view of octets
+        pcm_sample<uint16_t> p;
+        p.value = arg;
+
+        // write in little-endian order
+        buffer[0] = p.octets.octet0;
+        buffer[1] = p.octets.octet1;
+        buffer += 2;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline uint16_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<uint16_t> p;
+
+        // read in little-endian order
+        p.octets.octet0 = buffer[0];
+        p.octets.octet1 = buffer[1];
+        buffer += 2;
+
+        return p.value;
+    }
 };
 
 // SInt18 Big-Endian packer / unpacker
@@ -11241,6 +11497,9 @@ template <> struct pcm_packer<PcmCode_SInt18, PcmEndian_Big> {
 
         return p.value;
     }
+
+    // Sample doesn't occupy whole octets
+    static const bool is_aligned = false;
 };
 
 // SInt18 Little-Endian packer / unpacker
@@ -11275,6 +11534,9 @@ template <> struct pcm_packer<PcmCode_SInt18, PcmEndian_Little> {
 
         return p.value;
     }
+
+    // Sample doesn't occupy whole octets
+    static const bool is_aligned = false;
 };
 
 // UInt18 Big-Endian packer / unpacker
@@ -11304,6 +11566,9 @@ template <> struct pcm_packer<PcmCode_UInt18, PcmEndian_Big> {
 
         return p.value;
     }
+
+    // Sample doesn't occupy whole octets
+    static const bool is_aligned = false;
 };
 
 // UInt18 Little-Endian packer / unpacker
@@ -11333,6 +11598,9 @@ template <> struct pcm_packer<PcmCode_UInt18, PcmEndian_Little> {
 
         return p.value;
     }
+
+    // Sample doesn't occupy whole octets
+    static const bool is_aligned = false;
 };
 
 // SInt18_3 Big-Endian packer / unpacker
@@ -11373,6 +11641,48 @@ template <> struct pcm_packer<PcmCode_SInt18_3, PcmEndian_Big> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, int32_t arg) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+        p.value = arg;
+
+        // zeroise padding bits
+        p.value &= 0x3ffff;
+
+        // write in big-endian order
+        buffer[0] = p.octets.octet2;
+        buffer[1] = p.octets.octet1;
+        buffer[2] = p.octets.octet0;
+        buffer += 3;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline int32_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+
+        // read in big-endian order
+        p.octets.octet3 = 0;
+        p.octets.octet2 = buffer[0];
+        p.octets.octet1 = buffer[1];
+        p.octets.octet0 = buffer[2];
+        buffer += 3;
+
+        // zeroise padding bits
+        p.value &= 0x3ffff;
+
+        if (p.value & 0x20000) {
+            // sign extension
+            p.value |= (int32_t)0xfffc0000;
+        }
+
+        return p.value;
+    }
 };
 
 // SInt18_3 Little-Endian packer / unpacker
@@ -11413,6 +11723,48 @@ template <> struct pcm_packer<PcmCode_SInt18_3, PcmEndian_Little> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, int32_t arg) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+        p.value = arg;
+
+        // zeroise padding bits
+        p.value &= 0x3ffff;
+
+        // write in little-endian order
+        buffer[0] = p.octets.octet0;
+        buffer[1] = p.octets.octet1;
+        buffer[2] = p.octets.octet2;
+        buffer += 3;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline int32_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+
+        // read in little-endian order
+        p.octets.octet0 = buffer[0];
+        p.octets.octet1 = buffer[1];
+        p.octets.octet2 = buffer[2];
+        p.octets.octet3 = 0;
+        buffer += 3;
+
+        // zeroise padding bits
+        p.value &= 0x3ffff;
+
+        if (p.value & 0x20000) {
+            // sign extension
+            p.value |= (int32_t)0xfffc0000;
+        }
+
+        return p.value;
+    }
 };
 
 // UInt18_3 Big-Endian packer / unpacker
@@ -11448,6 +11800,43 @@ template <> struct pcm_packer<PcmCode_UInt18_3, PcmEndian_Big> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, uint32_t arg) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+        p.value = arg;
+
+        // zeroise padding bits
+        p.value &= 0x3ffffu;
+
+        // write in big-endian order
+        buffer[0] = p.octets.octet2;
+        buffer[1] = p.octets.octet1;
+        buffer[2] = p.octets.octet0;
+        buffer += 3;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline uint32_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+
+        // read in big-endian order
+        p.octets.octet3 = 0;
+        p.octets.octet2 = buffer[0];
+        p.octets.octet1 = buffer[1];
+        p.octets.octet0 = buffer[2];
+        buffer += 3;
+
+        // zeroise padding bits
+        p.value &= 0x3ffffu;
+
+        return p.value;
+    }
 };
 
 // UInt18_3 Little-Endian packer / unpacker
@@ -11483,6 +11872,43 @@ template <> struct pcm_packer<PcmCode_UInt18_3, PcmEndian_Little> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, uint32_t arg) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+        p.value = arg;
+
+        // zeroise padding bits
+        p.value &= 0x3ffffu;
+
+        // write in little-endian order
+        buffer[0] = p.octets.octet0;
+        buffer[1] = p.octets.octet1;
+        buffer[2] = p.octets.octet2;
+        buffer += 3;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline uint32_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+
+        // read in little-endian order
+        p.octets.octet0 = buffer[0];
+        p.octets.octet1 = buffer[1];
+        p.octets.octet2 = buffer[2];
+        p.octets.octet3 = 0;
+        buffer += 3;
+
+        // zeroise padding bits
+        p.value &= 0x3ffffu;
+
+        return p.value;
+    }
 };
 
 // SInt18_4 Big-Endian packer / unpacker
@@ -11524,12 +11950,12 @@ template <> struct pcm_packer<PcmCode_SInt18_4, PcmEndian_Big> {
 
         return p.value;
     }
-};
 
-// SInt18_4 Little-Endian packer / unpacker
-template <> struct pcm_packer<PcmCode_SInt18_4, PcmEndian_Little> {
-    // Pack next sample to buffer
-    static inline void pack(uint8_t* buffer, size_t& bit_offset, int32_t arg) {
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, int32_t arg) {
         // native-endian view of octets
         pcm_sample<int32_t> p;
         p.value = arg;
@@ -11537,23 +11963,25 @@ template <> struct pcm_packer<PcmCode_SInt18_4, PcmEndian_Little> {
         // zeroise padding bits
         p.value &= 0x3ffff;
 
-        // write in little-endian order
-        pcm_aligned_write(buffer, bit_offset, p.octets.octet0);
-        pcm_aligned_write(buffer, bit_offset, p.octets.octet1);
-        pcm_aligned_write(buffer, bit_offset, p.octets.octet2);
-        pcm_aligned_write(buffer, bit_offset, p.octets.octet3);
+        // write in big-endian order
+        buffer[0] = p.octets.octet3;
+        buffer[1] = p.octets.octet2;
+        buffer[2] = p.octets.octet1;
+        buffer[3] = p.octets.octet0;
+        buffer += 4;
     }
 
-    // Unpack next sample from buffer
-    static inline int32_t unpack(const uint8_t* buffer, size_t& bit_offset) {
+    // Unpack next sample from byte-aligned buffer
+    static inline int32_t unpack_aligned(const uint8_t*& buffer) {
         // native-endian view of octets
         pcm_sample<int32_t> p;
 
-        // read in little-endian order
-        p.octets.octet0 = pcm_aligned_read(buffer, bit_offset);
-        p.octets.octet1 = pcm_aligned_read(buffer, bit_offset);
-        p.octets.octet2 = pcm_aligned_read(buffer, bit_offset);
-        p.octets.octet3 = pcm_aligned_read(buffer, bit_offset);
+        // read in big-endian order
+        p.octets.octet3 = buffer[0];
+        p.octets.octet2 = buffer[1];
+        p.octets.octet1 = buffer[2];
+        p.octets.octet0 = buffer[3];
+        buffer += 4;
 
         // zeroise padding bits
         p.value &= 0x3ffff;
@@ -11567,8 +11995,92 @@ template <> struct pcm_packer<PcmCode_SInt18_4, PcmEndian_Little> {
     }
 };
 
-// UInt18_4 Big-Endian packer / unpacker
-template <> struct pcm_packer<PcmCode_UInt18_4, PcmEndian_Big> {
+// SInt18_4 Little-Endian packer / unpacker
+template <> struct pcm_packer<PcmCode_SInt18_4, PcmEndian_Little> {
+    // Pack next sample to buffer
+    static inline void pack(uint8_t* buffer, size_t& bit_offset, int32_t arg) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+        p.value = arg;
+
+        // zeroise padding bits
+        p.value &= 0x3ffff;
+
+        // write in little-endian order
+        pcm_aligned_write(buffer, bit_offset, p.octets.octet0);
+        pcm_aligned_write(buffer, bit_offset, p.octets.octet1);
+        pcm_aligned_write(buffer, bit_offset, p.octets.octet2);
+        pcm_aligned_write(buffer, bit_offset, p.octets.octet3);
+    }
+
+    // Unpack next sample from buffer
+    static inline int32_t unpack(const uint8_t* buffer, size_t& bit_offset) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+
+        // read in little-endian order
+        p.octets.octet0 = pcm_aligned_read(buffer, bit_offset);
+        p.octets.octet1 = pcm_aligned_read(buffer, bit_offset);
+        p.octets.octet2 = pcm_aligned_read(buffer, bit_offset);
+        p.octets.octet3 = pcm_aligned_read(buffer, bit_offset);
+
+        // zeroise padding bits
+        p.value &= 0x3ffff;
+
+        if (p.value & 0x20000) {
+            // sign extension
+            p.value |= (int32_t)0xfffc0000;
+        }
+
+        return p.value;
+    }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, int32_t arg) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+        p.value = arg;
+
+        // zeroise padding bits
+        p.value &= 0x3ffff;
+
+        // write in little-endian order
+        buffer[0] = p.octets.octet0;
+        buffer[1] = p.octets.octet1;
+        buffer[2] = p.octets.octet2;
+        buffer[3] = p.octets.octet3;
+        buffer += 4;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline int32_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+
+        // read in little-endian order
+        p.octets.octet0 = buffer[0];
+        p.octets.octet1 = buffer[1];
+        p.octets.octet2 = buffer[2];
+        p.octets.octet3 = buffer[3];
+        buffer += 4;
+
+        // zeroise padding bits
+        p.value &= 0x3ffff;
+
+        if (p.value & 0x20000) {
+            // sign extension
+            p.value |= (int32_t)0xfffc0000;
+        }
+
+        return p.value;
+    }
+};
+
+// UInt18_4 Big-Endian packer / unpacker
+template <> struct pcm_packer<PcmCode_UInt18_4, PcmEndian_Big> {
     // Pack next sample to buffer
     static inline void pack(uint8_t* buffer, size_t& bit_offset, uint32_t arg) {
         // native-endian view of octets
@@ -11601,6 +12113,44 @@ template <> struct pcm_packer<PcmCode_UInt18_4, PcmEndian_Big> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, uint32_t arg) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+        p.value = arg;
+
+        // zeroise padding bits
+        p.value &= 0x3ffffu;
+
+        // write in big-endian order
+        buffer[0] = p.octets.octet3;
+        buffer[1] = p.octets.octet2;
+        buffer[2] = p.octets.octet1;
+        buffer[3] = p.octets.octet0;
+        buffer += 4;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline uint32_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+
+        // read in big-endian order
+        p.octets.octet3 = buffer[0];
+        p.octets.octet2 = buffer[1];
+        p.octets.octet1 = buffer[2];
+        p.octets.octet0 = buffer[3];
+        buffer += 4;
+
+        // zeroise padding bits
+        p.value &= 0x3ffffu;
+
+        return p.value;
+    }
 };
 
 // UInt18_4 Little-Endian packer / unpacker
@@ -11637,6 +12187,44 @@ template <> struct pcm_packer<PcmCode_UInt18_4, PcmEndian_Little> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, uint32_t arg) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+        p.value = arg;
+
+        // zeroise padding bits
+        p.value &= 0x3ffffu;
+
+        // write in little-endian order
+        buffer[0] = p.octets.octet0;
+        buffer[1] = p.octets.octet1;
+        buffer[2] = p.octets.octet2;
+        buffer[3] = p.octets.octet3;
+        buffer += 4;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline uint32_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+
+        // read in little-endian order
+        p.octets.octet0 = buffer[0];
+        p.octets.octet1 = buffer[1];
+        p.octets.octet2 = buffer[2];
+        p.octets.octet3 = buffer[3];
+        buffer += 4;
+
+        // zeroise padding bits
+        p.value &= 0x3ffffu;
+
+        return p.value;
+    }
 };
 
 // SInt20 Big-Endian packer / unpacker
@@ -11671,6 +12259,9 @@ template <> struct pcm_packer<PcmCode_SInt20, PcmEndian_Big> {
 
         return p.value;
     }
+
+    // Sample doesn't occupy whole octets
+    static const bool is_aligned = false;
 };
 
 // SInt20 Little-Endian packer / unpacker
@@ -11705,6 +12296,9 @@ template <> struct pcm_packer<PcmCode_SInt20, PcmEndian_Little> {
 
         return p.value;
     }
+
+    // Sample doesn't occupy whole octets
+    static const bool is_aligned = false;
 };
 
 // UInt20 Big-Endian packer / unpacker
@@ -11734,6 +12328,9 @@ template <> struct pcm_packer<PcmCode_UInt20, PcmEndian_Big> {
 
         return p.value;
     }
+
+    // Sample doesn't occupy whole octets
+    static const bool is_aligned = false;
 };
 
 // UInt20 Little-Endian packer / unpacker
@@ -11763,6 +12360,9 @@ template <> struct pcm_packer<PcmCode_UInt20, PcmEndian_Little> {
 
         return p.value;
     }
+
+    // Sample doesn't occupy whole octets
+    static const bool is_aligned = false;
 };
 
 // SInt20_3 Big-Endian packer / unpacker
@@ -11803,6 +12403,48 @@ template <> struct pcm_packer<PcmCode_SInt20_3, PcmEndian_Big> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, int32_t arg) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+        p.value = arg;
+
+        // zeroise padding bits
+        p.value &= 0xfffff;
+
+        // write in big-endian order
+        buffer[0] = p.octets.octet2;
+        buffer[1] = p.octets.octet1;
+        buffer[2] = p.octets.octet0;
+        buffer += 3;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline int32_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+
+        // read in big-endian order
+        p.octets.octet3 = 0;
+        p.octets.octet2 = buffer[0];
+        p.octets.octet1 = buffer[1];
+        p.octets.octet0 = buffer[2];
+        buffer += 3;
+
+        // zeroise padding bits
+        p.value &= 0xfffff;
+
+        if (p.value & 0x80000) {
+            // sign extension
+            p.value |= (int32_t)0xfff00000;
+        }
+
+        return p.value;
+    }
 };
 
 // SInt20_3 Little-Endian packer / unpacker
@@ -11843,6 +12485,48 @@ template <> struct pcm_packer<PcmCode_SInt20_3, PcmEndian_Little> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, int32_t arg) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+        p.value = arg;
+
+        // zeroise padding bits
+        p.value &= 0xfffff;
+
+        // write in little-endian order
+        buffer[0] = p.octets.octet0;
+        buffer[1] = p.octets.octet1;
+        buffer[2] = p.octets.octet2;
+        buffer += 3;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline int32_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+
+        // read in little-endian order
+        p.octets.octet0 = buffer[0];
+        p.octets.octet1 = buffer[1];
+        p.octets.octet2 = buffer[2];
+        p.octets.octet3 = 0;
+        buffer += 3;
+
+        // zeroise padding bits
+        p.value &= 0xfffff;
+
+        if (p.value & 0x80000) {
+            // sign extension
+            p.value |= (int32_t)0xfff00000;
+        }
+
+        return p.value;
+    }
 };
 
 // UInt20_3 Big-Endian packer / unpacker
@@ -11878,6 +12562,43 @@ template <> struct pcm_packer<PcmCode_UInt20_3, PcmEndian_Big> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, uint32_t arg) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+        p.value = arg;
+
+        // zeroise padding bits
+        p.value &= 0xfffffu;
+
+        // write in big-endian order
+        buffer[0] = p.octets.octet2;
+        buffer[1] = p.octets.octet1;
+        buffer[2] = p.octets.octet0;
+        buffer += 3;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline uint32_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+
+        // read in big-endian order
+        p.octets.octet3 = 0;
+        p.octets.octet2 = buffer[0];
+        p.octets.octet1 = buffer[1];
+        p.octets.octet0 = buffer[2];
+        buffer += 3;
+
+        // zeroise padding bits
+        p.value &= 0xfffffu;
+
+        return p.value;
+    }
 };
 
 // UInt20_3 Little-Endian packer / unpacker
@@ -11913,6 +12634,43 @@ template <> struct pcm_packer<PcmCode_UInt20_3, PcmEndian_Little> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, uint32_t arg) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+        p.value = arg;
+
+        // zeroise padding bits
+        p.value &= 0xfffffu;
+
+        // write in little-endian order
+        buffer[0] = p.octets.octet0;
+        buffer[1] = p.octets.octet1;
+        buffer[2] = p.octets.octet2;
+        buffer += 3;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline uint32_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+
+        // read in little-endian order
+        p.octets.octet0 = buffer[0];
+        p.octets.octet1 = buffer[1];
+        p.octets.octet2 = buffer[2];
+        p.octets.octet3 = 0;
+        buffer += 3;
+
+        // zeroise padding bits
+        p.value &= 0xfffffu;
+
+        return p.value;
+    }
 };
 
 // SInt20_4 Big-Endian packer / unpacker
@@ -11954,6 +12712,49 @@ template <> struct pcm_packer<PcmCode_SInt20_4, PcmEndian_Big> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, int32_t arg) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+        p.value = arg;
+
+        // zeroise padding bits
+        p.value &= 0xfffff;
+
+        // write in big-endian order
+        buffer[0] = p.octets.octet3;
+        buffer[1] = p.octets.octet2;
+        buffer[2] = p.octets.octet1;
+        buffer[3] = p.octets.octet0;
+        buffer += 4;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline int32_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+
+        // read in big-endian order
+        p.octets.octet3 = buffer[0];
+        p.octets.octet2 = buffer[1];
+        p.octets.octet1 = buffer[2];
+        p.octets.octet0 = buffer[3];
+        buffer += 4;
+
+        // zeroise padding bits
+        p.value &= 0xfffff;
+
+        if (p.value & 0x80000) {
+            // sign extension
+            p.value |= (int32_t)0xfff00000;
+        }
+
+        return p.value;
+    }
 };
 
 // SInt20_4 Little-Endian packer / unpacker
@@ -11995,6 +12796,49 @@ template <> struct pcm_packer<PcmCode_SInt20_4, PcmEndian_Little> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, int32_t arg) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+        p.value = arg;
+
+        // zeroise padding bits
+        p.value &= 0xfffff;
+
+        // write in little-endian order
+        buffer[0] = p.octets.octet0;
+        buffer[1] = p.octets.octet1;
+        buffer[2] = p.octets.octet2;
+        buffer[3] = p.octets.octet3;
+        buffer += 4;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline int32_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+
+        // read in little-endian order
+        p.octets.octet0 = buffer[0];
+        p.octets.octet1 = buffer[1];
+        p.octets.octet2 = buffer[2];
+        p.octets.octet3 = buffer[3];
+        buffer += 4;
+
+        // zeroise padding bits
+        p.value &= 0xfffff;
+
+        if (p.value & 0x80000) {
+            // sign extension
+            p.value |= (int32_t)0xfff00000;
+        }
+
+        return p.value;
+    }
 };
 
 // UInt20_4 Big-Endian packer / unpacker
@@ -12031,6 +12875,44 @@ template <> struct pcm_packer<PcmCode_UInt20_4, PcmEndian_Big> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, uint32_t arg) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+        p.value = arg;
+
+        // zeroise padding bits
+        p.value &= 0xfffffu;
+
+        // write in big-endian order
+        buffer[0] = p.octets.octet3;
+        buffer[1] = p.octets.octet2;
+        buffer[2] = p.octets.octet1;
+        buffer[3] = p.octets.octet0;
+        buffer += 4;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline uint32_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+
+        // read in big-endian order
+        p.octets.octet3 = buffer[0];
+        p.octets.octet2 = buffer[1];
+        p.octets.octet1 = buffer[2];
+        p.octets.octet0 = buffer[3];
+        buffer += 4;
+
+        // zeroise padding bits
+        p.value &= 0xfffffu;
+
+        return p.value;
+    }
 };
 
 // UInt20_4 Little-Endian packer / unpacker
@@ -12067,6 +12949,44 @@ template <> struct pcm_packer<PcmCode_UInt20_4, PcmEndian_Little> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, uint32_t arg) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+        p.value = arg;
+
+        // zeroise padding bits
+        p.value &= 0xfffffu;
+
+        // write in little-endian order
+        buffer[0] = p.octets.octet0;
+        buffer[1] = p.octets.octet1;
+        buffer[2] = p.octets.octet2;
+        buffer[3] = p.octets.octet3;
+        buffer += 4;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline uint32_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+
+        // read in little-endian order
+        p.octets.octet0 = buffer[0];
+        p.octets.octet1 = buffer[1];
+        p.octets.octet2 = buffer[2];
+        p.octets.octet3 = buffer[3];
+        buffer += 4;
+
+        // zeroise padding bits
+        p.value &= 0xfffffu;
+
+        return p.value;
+    }
 };
 
 // SInt24 Big-Endian packer / unpacker
@@ -12101,6 +13021,42 @@ template <> struct pcm_packer<PcmCode_SInt24, PcmEndian_Big> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, int32_t arg) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+        p.value = arg;
+
+        // write in big-endian order
+        buffer[0] = p.octets.octet2;
+        buffer[1] = p.octets.octet1;
+        buffer[2] = p.octets.octet0;
+        buffer += 3;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline int32_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+
+        // read in big-endian order
+        p.octets.octet3 = 0;
+        p.octets.octet2 = buffer[0];
+        p.octets.octet1 = buffer[1];
+        p.octets.octet0 = buffer[2];
+        buffer += 3;
+
+        if (p.value & 0x800000) {
+            // sign extension
+            p.value |= (int32_t)0xff000000;
+        }
+
+        return p.value;
+    }
 };
 
 // SInt24 Little-Endian packer / unpacker
@@ -12135,6 +13091,42 @@ template <> struct pcm_packer<PcmCode_SInt24, PcmEndian_Little> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, int32_t arg) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+        p.value = arg;
+
+        // write in little-endian order
+        buffer[0] = p.octets.octet0;
+        buffer[1] = p.octets.octet1;
+        buffer[2] = p.octets.octet2;
+        buffer += 3;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline int32_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+
+        // read in little-endian order
+        p.octets.octet0 = buffer[0];
+        p.octets.octet1 = buffer[1];
+        p.octets.octet2 = buffer[2];
+        p.octets.octet3 = 0;
+        buffer += 3;
+
+        if (p.value & 0x800000) {
+            // sign extension
+            p.value |= (int32_t)0xff000000;
+        }
+
+        return p.value;
+    }
 };
 
 // UInt24 Big-Endian packer / unpacker
@@ -12164,6 +13156,37 @@ template <> struct pcm_packer<PcmCode_UInt24, PcmEndian_Big> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, uint32_t arg) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+        p.value = arg;
+
+        // write in big-endian order
+        buffer[0] = p.octets.octet2;
+        buffer[1] = p.octets.octet1;
+        buffer[2] = p.octets.octet0;
+        buffer += 3;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline uint32_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+
+        // read in big-endian order
+        p.octets.octet3 = 0;
+        p.octets.octet2 = buffer[0];
+        p.octets.octet1 = buffer[1];
+        p.octets.octet0 = buffer[2];
+        buffer += 3;
+
+        return p.value;
+    }
 };
 
 // UInt24 Little-Endian packer / unpacker
@@ -12193,6 +13216,37 @@ template <> struct pcm_packer<PcmCode_UInt24, PcmEndian_Little> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, uint32_t arg) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+        p.value = arg;
+
+        // write in little-endian order
+        buffer[0] = p.octets.octet0;
+        buffer[1] = p.octets.octet1;
+        buffer[2] = p.octets.octet2;
+        buffer += 3;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline uint32_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+
+        // read in little-endian order
+        p.octets.octet0 = buffer[0];
+        p.octets.octet1 = buffer[1];
+        p.octets.octet2 = buffer[2];
+        p.octets.octet3 = 0;
+        buffer += 3;
+
+        return p.value;
+    }
 };
 
 // SInt24_4 Big-Endian packer / unpacker
@@ -12234,6 +13288,49 @@ template <> struct pcm_packer<PcmCode_SInt24_4, PcmEndian_Big> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, int32_t arg) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+        p.value = arg;
+
+        // zeroise padding bits
+        p.value &= 0xffffff;
+
+        // write in big-endian order
+        buffer[0] = p.octets.octet3;
+        buffer[1] = p.octets.octet2;
+        buffer[2] = p.octets.octet1;
+        buffer[3] = p.octets.octet0;
+        buffer += 4;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline int32_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+
+        // read in big-endian order
+        p.octets.octet3 = buffer[0];
+        p.octets.octet2 = buffer[1];
+        p.octets.octet1 = buffer[2];
+        p.octets.octet0 = buffer[3];
+        buffer += 4;
+
+        // zeroise padding bits
+        p.value &= 0xffffff;
+
+        if (p.value & 0x800000) {
+            // sign extension
+            p.value |= (int32_t)0xff000000;
+        }
+
+        return p.value;
+    }
 };
 
 // SInt24_4 Little-Endian packer / unpacker
@@ -12254,16 +13351,59 @@ template <> struct pcm_packer<PcmCode_SInt24_4, PcmEndian_Little> {
         pcm_aligned_write(buffer, bit_offset, p.octets.octet3);
     }
 
-    // Unpack next sample from buffer
-    static inline int32_t unpack(const uint8_t* buffer, size_t& bit_offset) {
+    // Unpack next sample from buffer
+    static inline int32_t unpack(const uint8_t* buffer, size_t& bit_offset) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+
+        // read in little-endian order
+        p.octets.octet0 = pcm_aligned_read(buffer, bit_offset);
+        p.octets.octet1 = pcm_aligned_read(buffer, bit_offset);
+        p.octets.octet2 = pcm_aligned_read(buffer, bit_offset);
+        p.octets.octet3 = pcm_aligned_read(buffer, bit_offset);
+
+        // zeroise padding bits
+        p.value &= 0xffffff;
+
+        if (p.value & 0x800000) {
+            // sign extension
+            p.value |= (int32_t)0xff000000;
+        }
+
+        return p.value;
+    }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, int32_t arg) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+        p.value = arg;
+
+        // zeroise padding bits
+        p.value &= 0xffffff;
+
+        // write in little-endian order
+        buffer[0] = p.octets.octet0;
+        buffer[1] = p.octets.octet1;
+        buffer[2] = p.octets.octet2;
+        buffer[3] = p.octets.octet3;
+        buffer += 4;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline int32_t unpack_aligned(const uint8_t*& buffer) {
         // native-endian view of octets
         pcm_sample<int32_t> p;
 
         // read in little-endian order
-        p.octets.octet0 = pcm_aligned_read(buffer, bit_offset);
-        p.octets.octet1 = pcm_aligned_read(buffer, bit_offset);
-        p.octets.octet2 = pcm_aligned_read(buffer, bit_offset);
-        p.octets.octet3 = pcm_aligned_read(buffer, bit_offset);
+        p.octets.octet0 = buffer[0];
+        p.octets.octet1 = buffer[1];
+        p.octets.octet2 = buffer[2];
+        p.octets.octet3 = buffer[3];
+        buffer += 4;
 
         // zeroise padding bits
         p.value &= 0xffffff;
@@ -12311,6 +13451,44 @@ template <> struct pcm_packer<PcmCode_UInt24_4, PcmEndian_Big> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, uint32_t arg) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+        p.value = arg;
+
+        // zeroise padding bits
+        p.value &= 0xffffffu;
+
+        // write in big-endian order
+        buffer[0] = p.octets.octet3;
+        buffer[1] = p.octets.octet2;
+        buffer[2] = p.octets.octet1;
+        buffer[3] = p.octets.octet0;
+        buffer += 4;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline uint32_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+
+        // read in big-endian order
+        p.octets.octet3 = buffer[0];
+        p.octets.octet2 = buffer[1];
+        p.octets.octet1 = buffer[2];
+        p.octets.octet0 = buffer[3];
+        buffer += 4;
+
+        // zeroise padding bits
+        p.value &= 0xffffffu;
+
+        return p.value;
+    }
 };
 
 // UInt24_4 Little-Endian packer / unpacker
@@ -12347,6 +13525,44 @@ template <> struct pcm_packer<PcmCode_UInt24_4, PcmEndian_Little> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, uint32_t arg) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+        p.value = arg;
+
+        // zeroise padding bits
+        p.value &= 0xffffffu;
+
+        // write in little-endian order
+        buffer[0] = p.octets.octet0;
+        buffer[1] = p.octets.octet1;
+        buffer[2] = p.octets.octet2;
+        buffer[3] = p.octets.octet3;
+        buffer += 4;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline uint32_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+
+        // read in little-endian order
+        p.octets.octet0 = buffer[0];
+        p.octets.octet1 = buffer[1];
+        p.octets.octet2 = buffer[2];
+        p.octets.octet3 = buffer[3];
+        buffer += 4;
+
+        // zeroise padding bits
+        p.value &= 0xffffffu;
+
+        return p.value;
+    }
 };
 
 // SInt32 Big-Endian packer / unpacker
@@ -12377,6 +13593,38 @@ template <> struct pcm_packer<PcmCode_SInt32, PcmEndian_Big> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, int32_t arg) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+        p.value = arg;
+
+        // write in big-endian order
+        buffer[0] = p.octets.octet3;
+        buffer[1] = p.octets.octet2;
+        buffer[2] = p.octets.octet1;
+        buffer[3] = p.octets.octet0;
+        buffer += 4;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline int32_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+
+        // read in big-endian order
+        p.octets.octet3 = buffer[0];
+        p.octets.octet2 = buffer[1];
+        p.octets.octet1 = buffer[2];
+        p.octets.octet0 = buffer[3];
+        buffer += 4;
+
+        return p.value;
+    }
 };
 
 // SInt32 Little-Endian packer / unpacker
@@ -12407,6 +13655,38 @@ template <> struct pcm_packer<PcmCode_SInt32, PcmEndian_Little> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, int32_t arg) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+        p.value = arg;
+
+        // write in little-endian order
+        buffer[0] = p.octets.octet0;
+        buffer[1] = p.octets.octet1;
+        buffer[2] = p.octets.octet2;
+        buffer[3] = p.octets.octet3;
+        buffer += 4;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline int32_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<int32_t> p;
+
+        // read in little-endian order
+        p.octets.octet0 = buffer[0];
+        p.octets.octet1 = buffer[1];
+        p.octets.octet2 = buffer[2];
+        p.octets.octet3 = buffer[3];
+        buffer += 4;
+
+        return p.value;
+    }
 };
 
 // UInt32 Big-Endian packer / unpacker
@@ -12437,6 +13717,38 @@ template <> struct pcm_packer<PcmCode_UInt32, PcmEndian_Big> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, uint32_t arg) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+        p.value = arg;
+
+        // write in big-endian order
+        buffer[0] = p.octets.octet3;
+        buffer[1] = p.octets.octet2;
+        buffer[2] = p.octets.octet1;
+        buffer[3] = p.octets.octet0;
+        buffer += 4;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline uint32_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+
+        // read in big-endian order
+        p.octets.octet3 = buffer[0];
+        p.octets.octet2 = buffer[1];
+        p.octets.octet1 = buffer[2];
+        p.octets.octet0 = buffer[3];
+        buffer += 4;
+
+        return p.value;
+    }
 };
 
 // UInt32 Little-Endian packer / unpacker
@@ -12467,6 +13779,38 @@ template <> struct pcm_packer<PcmCode_UInt32, PcmEndian_Little> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, uint32_t arg) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+        p.value = arg;
+
+        // write in little-endian order
+        buffer[0] = p.octets.octet0;
+        buffer[1] = p.octets.octet1;
+        buffer[2] = p.octets.octet2;
+        buffer[3] = p.octets.octet3;
+        buffer += 4;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline uint32_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<uint32_t> p;
+
+        // read in little-endian order
+        p.octets.octet0 = buffer[0];
+        p.octets.octet1 = buffer[1];
+        p.octets.octet2 = buffer[2];
+        p.octets.octet3 = buffer[3];
+        buffer += 4;
+
+        return p.value;
+    }
 };
 
 // SInt64 Big-Endian packer / unpacker
@@ -12505,6 +13849,46 @@ template <> struct pcm_packer<PcmCode_SInt64, PcmEndian_Big> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, int64_t arg) {
+        // native-endian view of octets
+        pcm_sample<int64_t> p;
+        p.value = arg;
+
+        // write in big-endian order
+        buffer[0] = p.octets.octet7;
+        buffer[1] = p.octets.octet6;
+        buffer[2] = p.octets.octet5;
+        buffer[3] = p.octets.octet4;
+        buffer[4] = p.octets.octet3;
+        buffer[5] = p.octets.octet2;
+        buffer[6] = p.octets.octet1;
+        buffer[7] = p.octets.octet0;
+        buffer += 8;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline int64_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<int64_t> p;
+
+        // read in big-endian order
+        p.octets.octet7 = buffer[0];
+        p.octets.octet6 = buffer[1];
+        p.octets.octet5 = buffer[2];
+        p.octets.octet4 = buffer[3];
+        p.octets.octet3 = buffer[4];
+        p.octets.octet2 = buffer[5];
+        p.octets.octet1 = buffer[6];
+        p.octets.octet0 = buffer[7];
+        buffer += 8;
+
+        return p.value;
+    }
 };
 
 // SInt64 Little-Endian packer / unpacker
@@ -12543,6 +13927,46 @@ template <> struct pcm_packer<PcmCode_SInt64, PcmEndian_Little> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, int64_t arg) {
+        // native-endian view of octets
+        pcm_sample<int64_t> p;
+        p.value = arg;
+
+        // write in little-endian order
+        buffer[0] = p.octets.octet0;
+        buffer[1] = p.octets.octet1;
+        buffer[2] = p.octets.octet2;
+        buffer[3] = p.octets.octet3;
+        buffer[4] = p.octets.octet4;
+        buffer[5] = p.octets.octet5;
+        buffer[6] = p.octets.octet6;
+        buffer[7] = p.octets.octet7;
+        buffer += 8;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline int64_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<int64_t> p;
+
+        // read in little-endian order
+        p.octets.octet0 = buffer[0];
+        p.octets.octet1 = buffer[1];
+        p.octets.octet2 = buffer[2];
+        p.octets.octet3 = buffer[3];
+        p.octets.octet4 = buffer[4];
+        p.octets.octet5 = buffer[5];
+        p.octets.octet6 = buffer[6];
+        p.octets.octet7 = buffer[7];
+        buffer += 8;
+
+        return p.value;
+    }
 };
 
 // UInt64 Big-Endian packer / unpacker
@@ -12581,6 +14005,46 @@ template <> struct pcm_packer<PcmCode_UInt64, PcmEndian_Big> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, uint64_t arg) {
+        // native-endian view of octets
+        pcm_sample<uint64_t> p;
+        p.value = arg;
+
+        // write in big-endian order
+        buffer[0] = p.octets.octet7;
+        buffer[1] = p.octets.octet6;
+        buffer[2] = p.octets.octet5;
+        buffer[3] = p.octets.octet4;
+        buffer[4] = p.octets.octet3;
+        buffer[5] = p.octets.octet2;
+        buffer[6] = p.octets.octet1;
+        buffer[7] = p.octets.octet0;
+        buffer += 8;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline uint64_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<uint64_t> p;
+
+        // read in big-endian order
+        p.octets.octet7 = buffer[0];
+        p.octets.octet6 = buffer[1];
+        p.octets.octet5 = buffer[2];
+        p.octets.octet4 = buffer[3];
+        p.octets.octet3 = buffer[4];
+        p.octets.octet2 = buffer[5];
+        p.octets.octet1 = buffer[6];
+        p.octets.octet0 = buffer[7];
+        buffer += 8;
+
+        return p.value;
+    }
 };
 
 // UInt64 Little-Endian packer / unpacker
@@ -12619,6 +14083,46 @@ template <> struct pcm_packer<PcmCode_UInt64, PcmEndian_Little> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, uint64_t arg) {
+        // native-endian view of octets
+        pcm_sample<uint64_t> p;
+        p.value = arg;
+
+        // write in little-endian order
+        buffer[0] = p.octets.octet0;
+        buffer[1] = p.octets.octet1;
+        buffer[2] = p.octets.octet2;
+        buffer[3] = p.octets.octet3;
+        buffer[4] = p.octets.octet4;
+        buffer[5] = p.octets.octet5;
+        buffer[6] = p.octets.octet6;
+        buffer[7] = p.octets.octet7;
+        buffer += 8;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline uint64_t unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<uint64_t> p;
+
+        // read in little-endian order
+        p.octets.octet0 = buffer[0];
+        p.octets.octet1 = buffer[1];
+        p.octets.octet2 = buffer[2];
+        p.octets.octet3 = buffer[3];
+        p.octets.octet4 = buffer[4];
+        p.octets.octet5 = buffer[5];
+        p.octets.octet6 = buffer[6];
+        p.octets.octet7 = buffer[7];
+        buffer += 8;
+
+        return p.value;
+    }
 };
 
 // Float32 Big-Endian packer / unpacker
@@ -12649,6 +14153,38 @@ template <> struct pcm_packer<PcmCode_Float32, PcmEndian_Big> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, float arg) {
+        // native-endian view of octets
+        pcm_sample<float> p;
+        p.value = arg;
+
+        // write in big-endian order
+        buffer[0] = p.octets.octet3;
+        buffer[1] = p.octets.octet2;
+        buffer[2] = p.octets.octet1;
+        buffer[3] = p.octets.octet0;
+        buffer += 4;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline float unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<float> p;
+
+        // read in big-endian order
+        p.octets.octet3 = buffer[0];
+        p.octets.octet2 = buffer[1];
+        p.octets.octet1 = buffer[2];
+        p.octets.octet0 = buffer[3];
+        buffer += 4;
+
+        return p.value;
+    }
 };
 
 // Float32 Little-Endian packer / unpacker
@@ -12679,6 +14215,38 @@ template <> struct pcm_packer<PcmCode_Float32, PcmEndian_Little> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, float arg) {
+        // native-endian view of octets
+        pcm_sample<float> p;
+        p.value = arg;
+
+        // write in little-endian order
+        buffer[0] = p.octets.octet0;
+        buffer[1] = p.octets.octet1;
+        buffer[2] = p.octets.octet2;
+        buffer[3] = p.octets.octet3;
+        buffer += 4;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline float unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<float> p;
+
+        // read in little-endian order
+        p.octets.octet0 = buffer[0];
+        p.octets.octet1 = buffer[1];
+        p.octets.octet2 = buffer[2];
+        p.octets.octet3 = buffer[3];
+        buffer += 4;
+
+        return p.value;
+    }
 };
 
 // Float64 Big-Endian packer / unpacker
@@ -12717,6 +14285,46 @@ template <> struct pcm_packer<PcmCode_Float64, PcmEndian_Big> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, double arg) {
+        // native-endian view of octets
+        pcm_sample<double> p;
+        p.value = arg;
+
+        // write in big-endian order
+        buffer[0] = p.octets.octet7;
+        buffer[1] = p.octets.octet6;
+        buffer[2] = p.octets.octet5;
+        buffer[3] = p.octets.octet4;
+        buffer[4] = p.octets.octet3;
+        buffer[5] = p.octets.octet2;
+        buffer[6] = p.octets.octet1;
+        buffer[7] = p.octets.octet0;
+        buffer += 8;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline double unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<double> p;
+
+        // read in big-endian order
+        p.octets.octet7 = buffer[0];
+        p.octets.octet6 = buffer[1];
+        p.octets.octet5 = buffer[2];
+        p.octets.octet4 = buffer[3];
+        p.octets.octet3 = buffer[4];
+        p.octets.octet2 = buffer[5];
+        p.octets.octet1 = buffer[6];
+        p.octets.octet0 = buffer[7];
+        buffer += 8;
+
+        return p.value;
+    }
 };
 
 // Float64 Little-Endian packer / unpacker
@@ -12755,6 +14363,95 @@ template <> struct pcm_packer<PcmCode_Float64, PcmEndian_Little> {
 
         return p.value;
     }
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, double arg) {
+        // native-endian view of octets
+        pcm_sample<double> p;
+        p.value = arg;
+
+        // write in little-endian order
+        buffer[0] = p.octets.octet0;
+        buffer[1] = p.octets.octet1;
+        buffer[2] = p.octets.octet2;
+        buffer[3] = p.octets.octet3;
+        buffer[4] = p.octets.octet4;
+        buffer[5] = p.octets.octet5;
+        buffer[6] = p.octets.octet6;
+        buffer[7] = p.octets.octet7;
+        buffer += 8;
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline double unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<double> p;
+
+        // read in little-endian order
+        p.octets.octet0 = buffer[0];
+        p.octets.octet1 = buffer[1];
+        p.octets.octet2 = buffer[2];
+        p.octets.octet3 = buffer[3];
+        p.octets.octet4 = buffer[4];
+        p.octets.octet5 = buffer[5];
+        p.octets.octet6 = buffer[6];
+        p.octets.octet7 = buffer[7];
+        buffer += 8;
+
+        return p.value;
+    }
+};
+
+// Mapping function implementation for byte-aligned samples
+// (used when either input or output samples don't occupy whole octets)
+template <bool IsAligned,
+          PcmCode InCode,
+          PcmEndian InEndian,
+          PcmCode OutCode,
+          PcmEndian OutEndian>
+struct pcm_aligned_mapper {
+    static bool map(const uint8_t* in_data,
+                    size_t& in_bit_off,
+                    uint8_t* out_data,
+                    size_t& out_bit_off,
+                    size_t n_samples) {
+        return false;
+    }
+};
+
+// Mapping function implementation for byte-aligned samples
+// (used when both input and output samples occupy whole octets)
+template <PcmCode InCode, PcmEndian InEndian, PcmCode OutCode, PcmEndian OutEndian>
+struct pcm_aligned_mapper<true, InCode, InEndian, OutCode, OutEndian> {
+    static bool map(const uint8_t* in_data,
+                    size_t& in_bit_off,
+                    uint8_t* out_data,
+                    size_t& out_bit_off,
+                    size_t n_samples) {
+        if ((in_bit_off & 0x7u) != 0 || (out_bit_off & 0x7u) != 0) {
+            return false;
+        }
+
+        // Operating on plain pointers instead of bit offsets allows compiler
+        // to merge octet accesses and vectorize the loop.
+        const uint8_t* in_ptr = in_data + (in_bit_off >> 3);
+        uint8_t* out_ptr = out_data + (out_bit_off >> 3);
+
+        for (size_t n = 0; n < n_samples; n++) {
+            pcm_packer<OutCode, OutEndian>::pack_aligned(
+                out_ptr,
+                pcm_code_converter<InCode, OutCode>::convert(
+                    pcm_packer<InCode, InEndian>::unpack_aligned(in_ptr)));
+        }
+
+        in_bit_off = size_t(in_ptr - in_data) << 3;
+        out_bit_off = size_t(out_ptr - out_data) << 3;
+
+        return true;
+    }
 };
 
 // Mapping function implementation
@@ -12765,12 +14462,31 @@ struct pcm_mapper {
                     uint8_t* out_data,
                     size_t& out_bit_off,
                     size_t n_samples) {
+        if (pcm_aligned_mapper<(pcm_packer<InCode, InEndian>::is_aligned
+                                && pcm_packer<OutCode, OutEndian>::is_aligned),
+                               InCode, InEndian, OutCode, OutEndian>::map(in_data,
+                                                                          in_bit_off,
+                                                                          out_data,
+                                                                          out_bit_off,
+                                                                          n_samples)) {
+            return;
+        }
+
+        // Use local copies of offsets, otherwise compiler has to assume that
+        // writes to output buffer may modify them (uint8_t may alias anything),
+        // and reloads them on every octet, which also prevents vectorization.
+        size_t in_off = in_bit_off;
+        size_t out_off = out_bit_off;
+
         for (size_t n = 0; n < n_samples; n++) {
             pcm_packer<OutCode, OutEndian>::pack(
-                out_data, out_bit_off,
+                out_data, out_off,
                 pcm_code_converter<InCode, OutCode>::convert(
-                    pcm_packer<InCode, InEndian>::unpack(in_data, in_bit_off)));
+                    pcm_packer<InCode, InEndian>::unpack(in_data, in_off)));
         }
+
+        in_bit_off = in_off;
+        out_bit_off = out_off;
     }
 };
 
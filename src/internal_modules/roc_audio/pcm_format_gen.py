@@ -653,6 +653,11 @@ pcm_sign_converter<PcmCode_{{ in.code }}>::to_signed(arg);
 {% if not out.is_integer and not in.is_integer %}
         // float to float
         out = {{ out.type }}(in);
+{% elif not out.is_integer and in.is_integer and out.width == 32 and in.width <= 24 %}
+        // integer to float
+        // (input fits into float mantissa and scale is a power of two, so single
+        // precision gives exactly the same result as double and is faster)
+        out = float(in) * float(1.0 / ((double){{ in.signed_max }} + 1.0));
 {% elif not out.is_integer and in.is_integer %}
         // integer to float
         out = {{ out.type }}(in * (1.0 / ((double){{ in.signed_max }} + 1.0)));
@@ -848,10 +853,125 @@ template <> struct pcm_packer<PcmCode_{{ code.code }}, PcmEndian_{{ endian }}> {
 {% endif %}
         return p.value;
     }
+{% if code.packed_width % 8 == 0 %}
+
+    // Sample occupies whole octets
+    static const bool is_aligned = true;
+
+    // Pack next sample to byte-aligned buffer
+    static inline void pack_aligned(uint8_t*& buffer, {{ code.type }} arg) {
+        // native-endian view of octets
+        pcm_sample<{{ code.type }}> p;
+        p.value = arg;
+
+{% if code.width < code.packed_width %}
+        // zeroise padding bits
+        p.value &= {{ code.value_mask }};
+
+{% endif %}
+        // write in {{ endian.lower() }}-endian order
+{% for n in range(code.packed_octets) %}
+{% if endian == 'Big' %}
+        buffer[{{ n }}] = p.octets.octet{{ code.packed_octets - n - 1 }};
+{% else %}
+        buffer[{{ n }}] = p.octets.octet{{ n }};
+{% endif %}
+{% endfor %}
+        buffer += {{ code.packed_octets }};
+    }
+
+    // Unpack next sample from byte-aligned buffer
+    static inline {{ code.type }} unpack_aligned(const uint8_t*& buffer) {
+        // native-endian view of octets
+        pcm_sample<{{ code.type }}> p;
+
+        // read in {{ endian.lower() }}-endian order
+{% for n in range(code.unpacked_octets) %}
+{% if endian == 'Big' %}
+{% set n = code.unpacked_octets - n - 1 %}
+{% endif %}
+{% if n >= code.packed_octets %}
+        p.octets.octet{{ n }} = 0;
+{% elif endian == 'Big' %}
+        p.octets.octet{{ n }} = buffer[{{ code.packed_octets - n - 1 }}];
+{% else %}
+        p.octets.octet{{ n }} = buffer[{{ n }}];
+{% endif %}
+{% endfor %}
+        buffer += {{ code.packed_octets }};
+
+{% if code.width < code.packed_width %}
+        // zeroise padding bits
+        p.value &= {{ code.value_mask }};
+
+{% endif %}
+{% if code.is_signed and code.width < code.unpacked_width %}
+        if (p.value & {{ code.sign_mask }}) {
+            // sign extension
+            p.value |= ({{ code.type }}){{ code.lsb_mask }};
+        }
+
+{% endif %}
+        return p.value;
+    }
+{% else %}
+
+    // Sample doesn't occupy whole octets
+    static const bool is_aligned = false;
+{% endif %}
 };
 
 {% endfor %}
 {% endfor %}
+// Mapping function implementation for byte-aligned samples
+// (used when either input or output samples don't occupy whole octets)
+template <bool IsAligned,
+          PcmCode InCode,
+          PcmEndian InEndian,
+          PcmCode OutCode,
+          PcmEndian OutEndian>
+struct pcm_aligned_mapper {
+    static bool map(const uint8_t* in_data,
+                    size_t& in_bit_off,
+                    uint8_t* out_data,
+                    size_t& out_bit_off,
+                    size_t n_samples) {
+        return false;
+    }
+};
+
+// Mapping function implementation for byte-aligned samples
+// (used when both input and output samples occupy whole octets)
+template <PcmCode InCode, PcmEndian InEndian, PcmCode OutCode, PcmEndian OutEndian>
+struct pcm_aligned_mapper<true, InCode, InEndian, OutCode, OutEndian> {
+    static bool map(const uint8_t* in_data,
+                    size_t& in_bit_off,
+                    uint8_t* out_data,
+                    size_t& out_bit_off,
+                    size_t n_samples) {
+        if ((in_bit_off & 0x7u) != 0 || (out_bit_off & 0x7u) != 0) {
+            return false;
+        }
+
+        // Operating on plain pointers instead of bit offsets allows compiler
+        // to merge octet accesses and vectorize the loop.
+        const uint8_t* in_ptr = in_data + (in_bit_off >> 3);
+        uint8_t* out_ptr = out_data + (out_bit_off >> 3);
+
+        for (size_t n = 0; n < n_samples; n++) {
+            pcm_packer<OutCode, OutEndian>::pack_aligned(
+                out_ptr,
+                pcm_code_converter<InCode, OutCode>::convert(
+                    pcm_packer<InCode, InEndian>::unpack_aligned(in_ptr)));
+        }
+
+        in_bit_off = size_t(in_ptr - in_data) << 3;
+        out_bit_off = size_t(out_ptr - out_data) << 3;
+
+        return true;
+    }
+};
+
 // Mapping function implementation
 template <PcmCode InCode, PcmEndian InEndian, PcmCode OutCode, PcmEndian OutEndian>
 struct pcm_mapper {
@@ -860,12 +980,31 @@ struct pcm_mapper {
                     uint8_t* out_data,
                     size_t& out_bit_off,
                     size_t n_samples) {
+        if (pcm_aligned_mapper<(pcm_packer<InCode, InEndian>::is_aligned
+                                && pcm_packer<OutCode, OutEndian>::is_aligned),
+                               InCode, InEndian, OutCode, OutEndian>::map(in_data,
+                                                                          in_bit_off,
+                                                                          out_data,
+                                                                          out_bit_off,
+                                                                          n_samples)) {
+            return;
+        }
+
+        // Use local copies of offsets, otherwise compiler has to assume that
+        // writes to output buffer may modify them (uint8_t may alias anything),
+        // and reloads them on every octet, which also prevents vectorization.
+        size_t in_off = in_bit_off;
+        size_t out_off = out_bit_off;
+
         for (size_t n = 0; n < n_samples; n++) {
             pcm_packer<OutCode, OutEndian>::pack(
-                out_data, out_bit_off,
+                out_data, out_off,
                 pcm_code_converter<InCode, OutCode>::convert(
-                    pcm_packer<InCode, InEndian>::unpack(in_data, in_bit_off)));
+                    pcm_packer<InCode, InEndian>::unpack(in_data, in_off)));
         }
+
+        in_bit_off = in_off;
+        out_bit_off = out_off;
     }
 };
 
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/plc_config.h
+//! @brief Packet loss concealment config.
+
+#ifndef ROC_AUDIO_PLC_CONFIG_H_
+#define ROC_AUDIO_PLC_CONFIG_H_
+
+namespace roc {
+namespace audio {
+
+//! Packet loss concealment backends.
+enum PlcBackend {
+    //! No concealment.
+    //! Gaps are filled with silence.
+    PlcBackend_None,
+
+    //! Waveform-similarity overlap-add extrapolation.
+    //! Gaps are filled with pitch-periodic continuation of recent signal,
+    //! which fades out on long gaps.
+    PlcBackend_Wsola
+};
+
+//! Packet loss concealment config.
+struct PlcConfig {
+    //! PLC backend.
+    PlcBackend backend;
+
+    PlcConfig()
+        : backend(PlcBackend_None) {
+    }
+};
+
+//! Get string name of PLC backend.
+const char* plc_backend_to_str(PlcBackend backend);
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_PLC_CONFIG_H_
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_audio/plc_map.h"
+#include "roc_audio/wsola_plc.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_core/scoped_ptr.h"
+
+namespace roc {
+namespace audio {
+
+namespace {
+
+template <class T> IPlc* plc_ctor(core::IArena& arena, const SampleSpec& sample_spec) {
+    return new (arena) T(sample_spec, arena);
+}
+
+} // namespace
+
+PlcMap::PlcMap()
+    : n_backends_(0) {
+    {
+        Backend back;
+        back.id = PlcBackend_Wsola;
+        back.ctor = &plc_ctor<WsolaPlc>;
+        add_backend_(back);
+    }
+}
+
+size_t PlcMap::num_backends() const {
+    return n_backends_;
+}
+
+PlcBackend PlcMap::nth_backend(size_t n) const {
+    roc_panic_if_not(n < n_backends_);
+    return backends_[n].id;
+}
+
+bool PlcMap::is_supported(PlcBackend backend_id) const {
+    return find_backend_(backend_id) != NULL;
+}
+
+IPlc* PlcMap::new_plc(core::IArena& arena,
+                      const PlcConfig& config,
+                      const SampleSpec& sample_spec) {
+    const Backend* backend = find_backend_(config.backend);
+    if (!backend) {
+        roc_log(LogError, "plc map: unsupported plc backend: [%d] %s", config.backend,
+                plc_backend_to_str(config.backend));
+        return NULL;
+    }
+
+    core::ScopedPtr<IPlc> plc(backend->ctor(arena, sample_spec), arena);
+
+    if (!plc || !plc->is_valid()) {
+        return NULL;
+    }
+
+    return plc.release();
+}
+
+void PlcMap::add_backend_(const Backend& backend) {
+    roc_panic_if(n_backends_ == MaxBackends);
+    backends_[n_backends_++] = backend;
+}
+
+const PlcMap::Backend* PlcMap::find_backend_(PlcBackend backend_id) const {
+    for (size_t n = 0; n < n_backends_; n++) {
+        if (backends_[n].id == backend_id) {
+            return &backends_[n];
+        }
+    }
+    return NULL;
+}
+
+} // namespace audio
+} // namespace roc
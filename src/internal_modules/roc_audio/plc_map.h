@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/plc_map.h
+//! @brief PLC map.
+
+#ifndef ROC_AUDIO_PLC_MAP_H_
+#define ROC_AUDIO_PLC_MAP_H_
+
+#include "roc_audio/iplc.h"
+#include "roc_audio/plc_config.h"
+#include "roc_audio/sample_spec.h"
+#include "roc_core/iarena.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/singleton.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace audio {
+
+//! Factory class for IPlc objects, according to the PlcBackend input.
+class PlcMap : public core::NonCopyable<> {
+public:
+    //! Get instance.
+    static PlcMap& instance() {
+        return core::Singleton<PlcMap>::instance();
+    }
+
+    //! Get number of backends.
+    size_t num_backends() const;
+
+    //! Get backend ID by number.
+    PlcBackend nth_backend(size_t n) const;
+
+    //! Check if given backend is supported.
+    bool is_supported(PlcBackend backend_id) const;
+
+    //! Instantiate IPlc for given backend ID.
+    //! @remarks
+    //!  Returned object is allocated using @p arena.
+    //!  Returns NULL if backend is not supported or object can't be initialized.
+    IPlc* new_plc(core::IArena& arena,
+                  const PlcConfig& config,
+                  const SampleSpec& sample_spec);
+
+private:
+    friend class core::Singleton<PlcMap>;
+
+    enum { MaxBackends = 4 };
+
+    struct Backend {
+        Backend()
+            : id()
+            , ctor(NULL) {
+        }
+
+        PlcBackend id;
+        IPlc* (*ctor)(core::IArena& arena, const SampleSpec& sample_spec);
+    };
+
+    PlcMap();
+
+    void add_backend_(const Backend& backend);
+    const Backend* find_backend_(PlcBackend) const;
+
+    Backend backends_[MaxBackends];
+    size_t n_backends_;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_PLC_MAP_H_
@@ -17,7 +17,7 @@ ResamplerReader::ResamplerReader(IFrameReader& reader,
                                  IResampler& resampler,
                                  const SampleSpec& in_sample_spec,
                                  const SampleSpec& out_sample_spec)
-    : resampler_(resampler)
+    : resampler_(&resampler)
     , reader_(reader)
     , in_sample_spec_(in_sample_spec)
     , out_sample_spec_(out_sample_spec)
@@ -39,12 +39,12 @@ ResamplerReader::ResamplerReader(IFrameReader& reader,
                   sample_spec_to_str(out_sample_spec_).c_str());
     }
 
-    if (!resampler_.is_valid()) {
+    if (!resampler_->is_valid()) {
         return;
     }
 
-    if (!resampler_.set_scaling(in_sample_spec_.sample_rate(),
-                                out_sample_spec_.sample_rate(), 1.0f)) {
+    if (!resampler_->set_scaling(in_sample_spec_.sample_rate(),
+                                 out_sample_spec_.sample_rate(), 1.0f)) {
         return;
     }
 
@@ -60,8 +60,25 @@ bool ResamplerReader::set_scaling(float multiplier) {
 
     scaling_ = multiplier;
 
-    return resampler_.set_scaling(in_sample_spec_.sample_rate(),
-                                  out_sample_spec_.sample_rate(), multiplier);
+    return resampler_->set_scaling(in_sample_spec_.sample_rate(),
+                                   out_sample_spec_.sample_rate(), multiplier);
+}
+
+bool ResamplerReader::set_resampler(IResampler& resampler) {
+    roc_panic_if_not(is_valid());
+
+    if (!resampler.is_valid()) {
+        return false;
+    }
+
+    if (!resampler.set_scaling(in_sample_spec_.sample_rate(),
+                               out_sample_spec_.sample_rate(), scaling_)) {
+        return false;
+    }
+
+    resampler_ = &resampler;
+
+    return true;
 }
 
 bool ResamplerReader::read(Frame& out_frame) {
@@ -77,7 +94,7 @@ bool ResamplerReader::read(Frame& out_frame) {
         const size_t out_remain = out_frame.num_raw_samples() - out_pos;
 
         const size_t num_popped =
-            resampler_.pop_output(out_frame.raw_samples() + out_pos, out_remain);
+            resampler_->pop_output(out_frame.raw_samples() + out_pos, out_remain);
 
         if (num_popped < out_remain) {
             if (!push_input_()) {
@@ -95,7 +112,7 @@ bool ResamplerReader::read(Frame& out_frame) {
 }
 
 bool ResamplerReader::push_input_() {
-    const core::Slice<sample_t>& in_buff = resampler_.begin_push_input();
+    const core::Slice<sample_t>& in_buff = resampler_->begin_push_input();
 
     Frame in_frame(in_buff.data(), in_buff.size());
 
@@ -103,7 +120,7 @@ bool ResamplerReader::push_input_() {
         return false;
     }
 
-    resampler_.end_push_input();
+    resampler_->end_push_input();
 
     const core::nanoseconds_t in_cts = in_frame.capture_timestamp();
 
@@ -132,7 +149,8 @@ core::nanoseconds_t ResamplerReader::capture_ts_(Frame& out_frame) {
 
     // Subtract number of input samples that resampler haven't processed yet.
     // Now we have point in input stream corresponding to tail of output frame.
-    out_cts -= in_sample_spec_.fract_samples_overall_2_ns(resampler_.n_left_to_process());
+    out_cts -=
+        in_sample_spec_.fract_samples_overall_2_ns(resampler_->n_left_to_process());
 
     // Subtract length of current output frame multiplied by scaling.
     // Now we have point in input stream corresponding to head of output frame.
@@ -41,6 +41,16 @@ public:
     //! Set new resample factor.
     bool set_scaling(float multiplier);
 
+    //! Replace resampler.
+    //! @remarks
+    //!  New resampler gets current resample factor and continues reading input
+    //!  stream from current position. Samples buffered by previous resampler
+    //!  are dropped, so there is a small gap in the stream.
+    //! @returns
+    //!  false if new resampler is invalid or doesn't support current factor;
+    //!  in this case previous resampler is kept.
+    bool set_resampler(IResampler& resampler);
+
     //! Read audio frame.
     virtual bool read(Frame&);
 
@@ -48,7 +58,7 @@ private:
     bool push_input_();
     core::nanoseconds_t capture_ts_(Frame& out_frame);
 
-    IResampler& resampler_;
+    IResampler* resampler_;
     IFrameReader& reader_;
 
     const SampleSpec in_sample_spec_;
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_audio/sample_ops.h"
+#include "roc_core/cpu_dispatch.h"
+#include "roc_core/macro_helpers.h"
+
+#if defined(ROC_CPU_X86_KERNELS)
+#include <immintrin.h>
+#endif
+
+#if defined(ROC_CPU_NEON_KERNELS)
+#include <arm_neon.h>
+#endif
+
+namespace roc {
+namespace audio {
+
+namespace {
+
+typedef void (*MixFunc)(sample_t* dst, const sample_t* src, size_t size);
+
+void mix_generic(sample_t* dst, const sample_t* src, size_t size) {
+    for (size_t n = 0; n < size; n++) {
+        dst[n] += src[n];
+
+        // Saturate on overflow.
+        dst[n] = std::min(dst[n], Sample_Max);
+        dst[n] = std::max(dst[n], Sample_Min);
+    }
+}
+
+// In vector kernels, sum is passed as second argument of min and max, so that
+// NaN is propagated in the same way as in generic kernel.
+
+#if defined(ROC_CPU_X86_KERNELS)
+
+ROC_ATTR_TARGET("sse2")
+void mix_sse2(sample_t* dst, const sample_t* src, size_t size) {
+    const __m128 min = _mm_set1_ps(Sample_Min);
+    const __m128 max = _mm_set1_ps(Sample_Max);
+
+    size_t n = 0;
+
+    for (; n + 4 <= size; n += 4) {
+        __m128 sum = _mm_add_ps(_mm_loadu_ps(dst + n), _mm_loadu_ps(src + n));
+        sum = _mm_min_ps(max, sum);
+        sum = _mm_max_ps(min, sum);
+        _mm_storeu_ps(dst + n, sum);
+    }
+
+    mix_generic(dst + n, src + n, size - n);
+}
+
+ROC_ATTR_TARGET("avx")
+void mix_avx(sample_t* dst, const sample_t* src, size_t size) {
+    const __m256 min = _mm256_set1_ps(Sample_Min);
+    const __m256 max = _mm256_set1_ps(Sample_Max);
+
+    size_t n = 0;
+
+    for (; n + 8 <= size; n += 8) {
+        __m256 sum = _mm256_add_ps(_mm256_loadu_ps(dst + n), _mm256_loadu_ps(src + n));
+        sum = _mm256_min_ps(max, sum);
+        sum = _mm256_max_ps(min, sum);
+        _mm256_storeu_ps(dst + n, sum);
+    }
+
+    mix_generic(dst + n, src + n, size - n);
+}
+
+#endif // ROC_CPU_X86_KERNELS
+
+#if defined(ROC_CPU_NEON_KERNELS)
+
+void mix_neon(sample_t* dst, const sample_t* src, size_t size) {
+    const float32x4_t min = vdupq_n_f32(Sample_Min);
+    const float32x4_t max = vdupq_n_f32(Sample_Max);
+
+    size_t n = 0;
+
+    for (; n + 4 <= size; n += 4) {
+        float32x4_t sum = vaddq_f32(vld1q_f32(dst + n), vld1q_f32(src + n));
+        sum = vminq_f32(max, sum);
+        sum = vmaxq_f32(min, sum);
+        vst1q_f32(dst + n, sum);
+    }
+
+    mix_generic(dst + n, src + n, size - n);
+}
+
+#endif // ROC_CPU_NEON_KERNELS
+
+const core::CpuKernel<MixFunc> mix_kernels[] = {
+#if defined(ROC_CPU_X86_KERNELS)
+    { core::CpuIsa_AVX, mix_avx },
+    { core::CpuIsa_SSE2, mix_sse2 },
+#endif
+#if defined(ROC_CPU_NEON_KERNELS)
+    { core::CpuIsa_NEON, mix_neon },
+#endif
+    { core::CpuIsa_Generic, mix_generic },
+};
+
+core::CpuDispatcher<MixFunc>
+    mix_dispatcher("mix_samples", mix_kernels, ROC_ARRAY_SIZE(mix_kernels));
+
+} // namespace
+
+void mix_samples(sample_t* dst, const sample_t* src, size_t size) {
+    mix_dispatcher.get()(dst, src, size);
+}
+
+} // namespace audio
+} // namespace roc
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/sample_ops.h
+//! @brief Operations on sample buffers.
+
+#ifndef ROC_AUDIO_SAMPLE_OPS_H_
+#define ROC_AUDIO_SAMPLE_OPS_H_
+
+#include "roc_audio/sample.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace audio {
+
+//! Mix samples into destination buffer.
+//! @remarks
+//!  Computes dst[i] = clamp(dst[i] + src[i], Sample_Min, Sample_Max) for every
+//!  sample. Uses AVX, SSE2, or NEON when supported by CPU (see core::CpuFeatures).
+void mix_samples(sample_t* dst, const sample_t* src, size_t size);
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_SAMPLE_OPS_H_
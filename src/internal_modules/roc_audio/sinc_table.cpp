@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_audio/sinc_table.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace audio {
+
+SincTable::SincTable(core::IArena& arena, size_t window_size, size_t window_interp)
+    : core::RefCounted<SincTable, core::ArenaAllocation>(arena)
+    , window_size_(window_size)
+    , window_interp_(window_interp)
+    , memory_(NULL)
+    , data_(NULL)
+    , size_(window_size * window_interp + 2) {
+    roc_panic_if_msg(window_size == 0 || window_interp == 0,
+                     "sinc table: invalid parameters: window_size=%lu window_interp=%lu",
+                     (unsigned long)window_size, (unsigned long)window_interp);
+
+    memory_ = arena.allocate(size_ * sizeof(sample_t) + CacheLineSize);
+    if (!memory_) {
+        roc_log(LogError, "sinc table: can't allocate table: size=%lu",
+                (unsigned long)size_);
+        return;
+    }
+
+    const size_t addr = (size_t)memory_;
+    data_ = (sample_t*)(addr + (CacheLineSize - addr % CacheLineSize) % CacheLineSize);
+
+    fill_();
+}
+
+SincTable::~SincTable() {
+    if (memory_) {
+        arena().deallocate(memory_);
+    }
+}
+
+bool SincTable::is_valid() const {
+    return data_ != NULL;
+}
+
+size_t SincTable::window_size() const {
+    return window_size_;
+}
+
+size_t SincTable::window_interp() const {
+    return window_interp_;
+}
+
+const sample_t* SincTable::data() const {
+    roc_panic_if(!is_valid());
+
+    return data_;
+}
+
+size_t SincTable::size() const {
+    return size_;
+}
+
+void SincTable::fill_() {
+    const double sinc_step = 1.0 / (double)window_interp_;
+    double sinc_t = sinc_step;
+
+    data_[0] = 1.0f;
+    for (size_t i = 1; i < size_; ++i) {
+        const double window = 0.54
+            - 0.46 * std::cos(2 * M_PI * ((double)(i - 1) / 2.0 / (double)size_ + 0.5));
+        data_[i] = (float)(std::sin(M_PI * sinc_t) / M_PI / sinc_t * window);
+        sinc_t += sinc_step;
+    }
+    data_[size_ - 2] = 0;
+    data_[size_ - 1] = 0;
+}
+
+} // namespace audio
+} // namespace roc
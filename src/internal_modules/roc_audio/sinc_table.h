@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/sinc_table.h
+//! @brief Sinc table.
+
+#ifndef ROC_AUDIO_SINC_TABLE_H_
+#define ROC_AUDIO_SINC_TABLE_H_
+
+#include "roc_audio/sample.h"
+#include "roc_core/iarena.h"
+#include "roc_core/ref_counted.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace audio {
+
+//! Immutable table of windowed sinc function values.
+//!
+//! Used by BuiltinResampler for bandlimited interpolation. Table contains
+//! window_size * window_interp + 2 values of Hamming-windowed sinc, starting
+//! from zero with step 1 / window_interp; last two values are zeros.
+//!
+//! Table contents depend only on window size and interpolation factor, so
+//! a single table can be shared by any number of resamplers, see SincTableCache.
+//! Table data is aligned to cache line.
+class SincTable : public core::RefCounted<SincTable, core::ArenaAllocation> {
+public:
+    //! Initialize.
+    SincTable(core::IArena& arena, size_t window_size, size_t window_interp);
+
+    ~SincTable();
+
+    //! Check if table was successfully constructed.
+    bool is_valid() const;
+
+    //! Get window size.
+    size_t window_size() const;
+
+    //! Get window interpolation factor.
+    size_t window_interp() const;
+
+    //! Get table values.
+    const sample_t* data() const;
+
+    //! Get number of table values.
+    size_t size() const;
+
+private:
+    enum { CacheLineSize = 64 };
+
+    void fill_();
+
+    const size_t window_size_;
+    const size_t window_interp_;
+
+    void* memory_;
+    sample_t* data_;
+    size_t size_;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_SINC_TABLE_H_
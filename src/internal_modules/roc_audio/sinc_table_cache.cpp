@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_audio/sinc_table_cache.h"
+#include "roc_core/log.h"
+
+namespace roc {
+namespace audio {
+
+SincTableCache::SincTableCache() {
+}
+
+core::SharedPtr<SincTable> SincTableCache::get_table(size_t window_size,
+                                                     size_t window_interp) {
+    core::Mutex::Lock lock(mutex_);
+
+    int free_slot = -1;
+
+    for (int n = 0; n < MaxTables; n++) {
+        if (!tables_[n]) {
+            if (free_slot < 0) {
+                free_slot = n;
+            }
+            continue;
+        }
+
+        if (tables_[n]->window_size() == window_size
+            && tables_[n]->window_interp() == window_interp) {
+            return tables_[n];
+        }
+    }
+
+    if (free_slot < 0) {
+        // Evict table which is referenced only by cache.
+        for (int n = 0; n < MaxTables; n++) {
+            if (tables_[n]->getref() == 1) {
+                tables_[n] = NULL;
+                free_slot = n;
+                break;
+            }
+        }
+    }
+
+    if (free_slot < 0) {
+        roc_log(LogError, "sinc table cache: all tables are in use: max_tables=%d",
+                (int)MaxTables);
+        return NULL;
+    }
+
+    roc_log(LogDebug,
+            "sinc table cache: building table: window_size=%lu window_interp=%lu",
+            (unsigned long)window_size, (unsigned long)window_interp);
+
+    core::SharedPtr<SincTable> table =
+        new (arena_) SincTable(arena_, window_size, window_interp);
+    if (!table || !table->is_valid()) {
+        roc_log(LogError, "sinc table cache: can't allocate table");
+        return NULL;
+    }
+
+    tables_[free_slot] = table;
+
+    return table;
+}
+
+size_t SincTableCache::num_tables() const {
+    core::Mutex::Lock lock(mutex_);
+
+    size_t n_tables = 0;
+
+    for (int n = 0; n < MaxTables; n++) {
+        if (tables_[n]) {
+            n_tables++;
+        }
+    }
+
+    return n_tables;
+}
+
+} // namespace audio
+} // namespace roc
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/sinc_table_cache.h
+//! @brief Sinc table cache.
+
+#ifndef ROC_AUDIO_SINC_TABLE_CACHE_H_
+#define ROC_AUDIO_SINC_TABLE_CACHE_H_
+
+#include "roc_audio/sinc_table.h"
+#include "roc_core/heap_arena.h"
+#include "roc_core/mutex.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/shared_ptr.h"
+#include "roc_core/singleton.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace audio {
+
+//! Process-wide cache of sinc tables.
+//!
+//! Building a sinc table is expensive, and its contents depend only on
+//! window parameters, which are defined by resampler profile. Instead of
+//! building its own table, every resampler acquires a shared immutable
+//! table from the cache.
+//!
+//! Tables are reference counted. Cache keeps tables after all their users
+//! are gone, so that subsequent sessions with the same profile reuse them;
+//! unused tables are evicted when cache is full.
+//!
+//! Thread-safe.
+class SincTableCache : public core::NonCopyable<> {
+public:
+    //! Get instance.
+    static SincTableCache& instance() {
+        return core::Singleton<SincTableCache>::instance();
+    }
+
+    //! Get table for given parameters.
+    //! @remarks
+    //!  Returns cached table if there is one, otherwise builds and caches
+    //!  a new table.
+    //! @returns
+    //!  NULL if allocation failed or cache is full of tables in use.
+    core::SharedPtr<SincTable> get_table(size_t window_size, size_t window_interp);
+
+    //! Get number of tables in cache.
+    size_t num_tables() const;
+
+private:
+    friend class core::Singleton<SincTableCache>;
+
+    enum { MaxTables = 8 };
+
+    SincTableCache();
+
+    core::HeapArena arena_;
+    core::Mutex mutex_;
+
+    core::SharedPtr<SincTable> tables_[MaxTables];
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_SINC_TABLE_CACHE_H_
@@ -267,6 +267,16 @@ float SpeexResampler::n_left_to_process() const {
     return float(in_frame_size_ - in_frame_pos_) + float(in_latency_diff_);
 }
 
+bool SpeexResampler::get_period(size_t& in_period,
+                                size_t& out_period,
+                                size_t& window) const {
+    roc_panic_if_not(is_valid());
+
+    // Not implemented: ratio is approximated by speex_resampler_set_rate_frac(),
+    // and exactness of stitching wasn't verified for this backend.
+    return false;
+}
+
 void SpeexResampler::report_stats_() {
     if (!speex_state_) {
         return;
@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_audio/wsola_plc.h"
+#include "roc_audio/sample_spec_to_str.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace audio {
+
+namespace {
+
+// Range of periods to search (corresponds to 66..400 Hz).
+const core::nanoseconds_t MinPeriod = 2500 * core::Microsecond;
+const core::nanoseconds_t MaxPeriod = 15 * core::Millisecond;
+
+// Length of window used to measure similarity, and of all cross-fades.
+const core::nanoseconds_t Overlap = 4 * core::Millisecond;
+
+// Gap is filled at full volume during this time, and then fades out to silence.
+const core::nanoseconds_t FadeStart = 10 * core::Millisecond;
+const core::nanoseconds_t FadeLength = 50 * core::Millisecond;
+
+const double Epsilon = 1e-9;
+
+} // namespace
+
+WsolaPlc::WsolaPlc(const SampleSpec& sample_spec, core::IArena& arena)
+    : sample_spec_(sample_spec)
+    , num_ch_(sample_spec.num_channels())
+    , min_period_(0)
+    , max_period_(0)
+    , overlap_(0)
+    , fade_start_(0)
+    , fade_len_(0)
+    , history_(arena)
+    , mono_(arena)
+    , loop_(arena)
+    , history_len_(0)
+    , history_fill_(0)
+    , in_loss_(false)
+    , period_(0)
+    , loop_pos_(0)
+    , loss_pos_(0)
+    , xfade_pos_(0)
+    , valid_(false) {
+    roc_panic_if_msg(!sample_spec_.is_valid() || !sample_spec_.is_raw(),
+                     "wsola plc: required valid sample spec with raw format: %s",
+                     sample_spec_to_str(sample_spec_).c_str());
+
+    min_period_ = std::max(sample_spec_.ns_2_samples_per_chan(MinPeriod), (size_t)1);
+    max_period_ = std::max(sample_spec_.ns_2_samples_per_chan(MaxPeriod), min_period_);
+    overlap_ = std::max(sample_spec_.ns_2_samples_per_chan(Overlap), (size_t)1);
+    fade_start_ = sample_spec_.ns_2_samples_per_chan(FadeStart);
+    fade_len_ = std::max(sample_spec_.ns_2_samples_per_chan(FadeLength), (size_t)1);
+
+    history_len_ = max_period_ + overlap_;
+
+    roc_log(LogDebug,
+            "wsola plc: initializing:"
+            " min_period=%lu max_period=%lu overlap=%lu history=%lu n_channels=%lu",
+            (unsigned long)min_period_, (unsigned long)max_period_,
+            (unsigned long)overlap_, (unsigned long)history_len_,
+            (unsigned long)num_ch_);
+
+    if (!history_.resize(history_len_ * num_ch_) || !mono_.resize(history_len_)
+        || !loop_.resize(max_period_ * num_ch_)) {
+        roc_log(LogError, "wsola plc: can't allocate buffers");
+        return;
+    }
+
+    valid_ = true;
+}
+
+bool WsolaPlc::is_valid() const {
+    return valid_;
+}
+
+void WsolaPlc::process_history(sample_t* samples, size_t n_samples) {
+    roc_panic_if(!is_valid());
+
+    roc_panic_if_msg(n_samples % num_ch_ != 0,
+                     "wsola plc: unexpected number of samples: n_samples=%lu",
+                     (unsigned long)n_samples);
+
+    const size_t n_frames = n_samples / num_ch_;
+
+    if (in_loss_) {
+        in_loss_ = false;
+        xfade_pos_ = overlap_;
+    }
+
+    // Cross-fade continuation of the loop into real signal.
+    // If gap was long enough to fade out completely, this just fades in
+    // real signal from silence.
+    for (size_t n = 0; n < n_frames && xfade_pos_ > 0; n++, xfade_pos_--) {
+        sample_t* frame = samples + n * num_ch_;
+
+        const sample_t w = (sample_t)xfade_pos_ / (sample_t)(overlap_ + 1);
+        const sample_t gain = next_gain_() * w;
+
+        for (size_t c = 0; c < num_ch_; c++) {
+            frame[c] *= 1 - w;
+        }
+
+        if (gain > 0) {
+            next_frame_(frame, gain);
+        }
+    }
+
+    append_history_(samples, n_frames);
+}
+
+size_t WsolaPlc::process_loss(sample_t* samples, size_t n_samples) {
+    roc_panic_if(!is_valid());
+
+    roc_panic_if_msg(n_samples % num_ch_ != 0,
+                     "wsola plc: unexpected number of samples: n_samples=%lu",
+                     (unsigned long)n_samples);
+
+    const size_t n_frames = n_samples / num_ch_;
+
+    if (!in_loss_) {
+        begin_loss_();
+    }
+
+    memset(samples, 0, n_samples * sizeof(sample_t));
+
+    size_t n_concealed = 0;
+
+    for (size_t n = 0; n < n_frames; n++) {
+        const sample_t gain = next_gain_();
+
+        if (gain > 0) {
+            next_frame_(samples + n * num_ch_, gain);
+            n_concealed++;
+        }
+    }
+
+    append_history_(samples, n_frames);
+
+    return n_concealed * num_ch_;
+}
+
+void WsolaPlc::begin_loss_() {
+    in_loss_ = true;
+    xfade_pos_ = 0;
+    loss_pos_ = 0;
+    loop_pos_ = 0;
+    period_ = 0;
+
+    if (history_fill_ < history_len_) {
+        // Not enough history, gap will be filled with silence.
+        return;
+    }
+
+    period_ = find_period_();
+    build_loop_();
+}
+
+// Find period P, such that the last samples of history are most similar to
+// the samples which were P samples before them (normalized cross-correlation).
+size_t WsolaPlc::find_period_() {
+    const sample_t* hist = history_.data();
+    sample_t* mono = mono_.data();
+
+    for (size_t n = 0; n < history_len_; n++) {
+        sample_t s = 0;
+        for (size_t c = 0; c < num_ch_; c++) {
+            s += hist[n * num_ch_ + c];
+        }
+        mono[n] = s;
+    }
+
+    const sample_t* target = mono + history_len_ - overlap_;
+
+    // Energy of candidate window, updated incrementally.
+    double energy = 0;
+    for (size_t k = 0; k < overlap_; k++) {
+        const double s = (double)mono[history_len_ - min_period_ - overlap_ + k];
+        energy += s * s;
+    }
+
+    size_t best_period = max_period_;
+    double best_score = 0;
+
+    for (size_t period = min_period_; period <= max_period_; period++) {
+        const sample_t* cand = mono + history_len_ - period - overlap_;
+
+        if (period != min_period_) {
+            // Window moved one sample back.
+            const double head = (double)cand[0];
+            const double tail = (double)cand[overlap_];
+            energy += head * head - tail * tail;
+            energy = std::max(energy, 0.);
+        }
+
+        if (energy < Epsilon) {
+            continue;
+        }
+
+        double corr = 0;
+        for (size_t k = 0; k < overlap_; k++) {
+            corr += (double)target[k] * (double)cand[k];
+        }
+
+        const double score = corr / std::sqrt(energy);
+
+        if (score > best_score) {
+            best_score = score;
+            best_period = period;
+        }
+    }
+
+    return best_period;
+}
+
+// Build loop from the last period of history. Tail of the loop is overlap-added
+// with the samples preceding its head, so that when loop wraps around, there is
+// no discontinuity.
+void WsolaPlc::build_loop_() {
+    const sample_t* hist = history_.data();
+    sample_t* loop = loop_.data();
+
+    const size_t head = history_len_ - period_;
+
+    memcpy(loop, hist + head * num_ch_, period_ * num_ch_ * sizeof(sample_t));
+
+    const size_t overlap = std::min(overlap_, period_);
+
+    for (size_t k = 0; k < overlap; k++) {
+        const sample_t a = (sample_t)(k + 1) / (sample_t)(overlap + 1);
+
+        sample_t* dst = loop + (period_ - overlap + k) * num_ch_;
+        const sample_t* pre = hist + (head - overlap + k) * num_ch_;
+
+        for (size_t c = 0; c < num_ch_; c++) {
+            dst[c] = dst[c] * (1 - a) + pre[c] * a;
+        }
+    }
+}
+
+sample_t WsolaPlc::next_gain_() {
+    const size_t pos = loss_pos_++;
+
+    if (period_ == 0) {
+        return 0;
+    }
+
+    if (pos < fade_start_) {
+        return 1;
+    }
+
+    if (pos - fade_start_ >= fade_len_) {
+        return 0;
+    }
+
+    return 1 - (sample_t)(pos - fade_start_) / (sample_t)fade_len_;
+}
+
+void WsolaPlc::next_frame_(sample_t* frame, sample_t gain) {
+    const sample_t* src = loop_.data() + loop_pos_ * num_ch_;
+
+    for (size_t c = 0; c < num_ch_; c++) {
+        frame[c] += src[c] * gain;
+    }
+
+    if (++loop_pos_ == period_) {
+        loop_pos_ = 0;
+    }
+}
+
+void WsolaPlc::append_history_(const sample_t* samples, size_t n_frames) {
+    sample_t* hist = history_.data();
+
+    if (n_frames >= history_len_) {
+        memcpy(hist, samples + (n_frames - history_len_) * num_ch_,
+               history_len_ * num_ch_ * sizeof(sample_t));
+    } else {
+        memmove(hist, hist + n_frames * num_ch_,
+                (history_len_ - n_frames) * num_ch_ * sizeof(sample_t));
+        memcpy(hist + (history_len_ - n_frames) * num_ch_, samples,
+               n_frames * num_ch_ * sizeof(sample_t));
+    }
+
+    history_fill_ = std::min(history_fill_ + n_frames, history_len_);
+}
+
+} // namespace audio
+} // namespace roc
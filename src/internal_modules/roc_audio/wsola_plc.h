@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/wsola_plc.h
+//! @brief WSOLA-based packet loss concealment.
+
+#ifndef ROC_AUDIO_WSOLA_PLC_H_
+#define ROC_AUDIO_WSOLA_PLC_H_
+
+#include "roc_audio/iplc.h"
+#include "roc_audio/sample.h"
+#include "roc_audio/sample_spec.h"
+#include "roc_core/array.h"
+#include "roc_core/iarena.h"
+#include "roc_core/noncopyable.h"
+
+namespace roc {
+namespace audio {
+
+//! WSOLA-based packet loss concealment.
+//!
+//! Keeps short history of the stream. When a gap begins, searches history for
+//! the period which gives the best waveform similarity with the most recent
+//! samples, and builds a loop of that length, whose end is overlap-added with
+//! samples preceding it, so that the loop can be repeated without clicks.
+//! The gap is then filled by repeating the loop. Long gaps are faded out to
+//! silence. When real samples arrive after a gap, they are cross-faded with
+//! continuation of the loop.
+//!
+//! All buffers are allocated in constructor. Cost of processing is linear in
+//! the number of samples, plus a bounded period search at the start of each gap.
+class WsolaPlc : public IPlc, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    WsolaPlc(const SampleSpec& sample_spec, core::IArena& arena);
+
+    //! Check if the object was successfully constructed.
+    virtual bool is_valid() const;
+
+    //! Process decoded samples.
+    virtual void process_history(sample_t* samples, size_t n_samples);
+
+    //! Fill gap.
+    virtual size_t process_loss(sample_t* samples, size_t n_samples);
+
+private:
+    void begin_loss_();
+    size_t find_period_();
+    void build_loop_();
+
+    sample_t next_gain_();
+    void next_frame_(sample_t* frame, sample_t gain);
+
+    void append_history_(const sample_t* samples, size_t n_frames);
+
+    const SampleSpec sample_spec_;
+    const size_t num_ch_;
+
+    size_t min_period_;
+    size_t max_period_;
+    size_t overlap_;
+    size_t fade_start_;
+    size_t fade_len_;
+
+    core::Array<sample_t> history_;
+    core::Array<sample_t> mono_;
+    core::Array<sample_t> loop_;
+
+    size_t history_len_;
+    size_t history_fill_;
+
+    bool in_loss_;
+    size_t period_;
+    size_t loop_pos_;
+    size_t loss_pos_;
+    size_t xfade_pos_;
+
+    bool valid_;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_WSOLA_PLC_H_
@@ -63,6 +63,12 @@
 #define ROC_ATTR_ALIGNED(x) __attribute__((aligned(x)))
 #endif
 
+#if HEDLEY_HAS_ATTRIBUTE(target)
+//! Compile function for given instruction set, e.g. "avx2".
+//! Not defined if compiler doesn't support it.
+#define ROC_ATTR_TARGET(isa) __attribute__((target(isa)))
+#endif
+
 #if HEDLEY_HAS_ATTRIBUTE(no_sanitize)
 //! Suppress undefined behavior sanitizer for a particular function.
 #define ROC_ATTR_NO_SANITIZE_UB __attribute__((no_sanitize("undefined")))
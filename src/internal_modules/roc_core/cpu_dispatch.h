@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/cpu_dispatch.h
+//! @brief CPU-specific kernel dispatching.
+
+#ifndef ROC_CORE_CPU_DISPATCH_H_
+#define ROC_CORE_CPU_DISPATCH_H_
+
+#include "roc_core/atomic_ops.h"
+#include "roc_core/cpu_features.h"
+#include "roc_core/log.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/panic.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Kernel implementation for specific instruction set.
+template <class Func> struct CpuKernel {
+    //! Instruction set required by implementation.
+    CpuIsa isa;
+
+    //! Implementation.
+    Func func;
+};
+
+//! Selects best kernel implementation supported by CPU.
+//! @tparam Func is function pointer type.
+//! @remarks
+//!  Holds a table of implementations of the same function for different
+//!  instruction sets, ordered from most to least preferred. The last entry
+//!  should be CpuIsa_Generic. The first implementation enabled in CpuFeatures
+//!  is selected on first use, and is re-selected when CpuFeatures max isa
+//!  is changed. Selection is thread-safe and lock-free.
+//! @note
+//!  Table is not copied and should be a static array. Dispatcher itself is
+//!  usually a static variable in the module that implements the kernels.
+template <class Func> class CpuDispatcher : public NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  @p name is used for logging.
+    CpuDispatcher(const char* name, const CpuKernel<Func>* kernels, size_t n_kernels)
+        : name_(name)
+        , kernels_(kernels)
+        , n_kernels_(n_kernels)
+        , index_(0)
+        , generation_(0) {
+        roc_panic_if_msg(n_kernels == 0 || kernels[n_kernels - 1].isa != CpuIsa_Generic,
+                         "cpu dispatcher: last kernel should be generic: name=%s",
+                         name);
+    }
+
+    //! Get selected implementation.
+    Func get() {
+        return kernels_[select_()].func;
+    }
+
+    //! Get instruction set of selected implementation.
+    CpuIsa isa() {
+        return kernels_[select_()].isa;
+    }
+
+private:
+    size_t select_() {
+        // generation_ is zero until first selection, so it's shifted by one.
+        const unsigned gen = CpuFeatures::instance().generation() + 1;
+
+        if (AtomicOps::load_acquire(generation_) == gen) {
+            return AtomicOps::load_relaxed(index_);
+        }
+
+        size_t index = n_kernels_ - 1;
+
+        for (size_t n = 0; n < n_kernels_; n++) {
+            if (CpuFeatures::instance().is_enabled(kernels_[n].isa)) {
+                index = n;
+                break;
+            }
+        }
+
+        roc_log(LogDebug, "cpu dispatcher: selected kernel: name=%s isa=%s", name_,
+                cpu_isa_to_str(kernels_[index].isa));
+
+        // Concurrent selections may race, but they all store valid index.
+        AtomicOps::store_relaxed(index_, index);
+        AtomicOps::store_release(generation_, gen);
+
+        return index;
+    }
+
+    const char* name_;
+    const CpuKernel<Func>* kernels_;
+    const size_t n_kernels_;
+
+    size_t index_;
+    unsigned generation_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_CPU_DISPATCH_H_
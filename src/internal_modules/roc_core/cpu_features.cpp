@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "roc_core/atomic_ops.h"
+#include "roc_core/cpu_features.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+const char* isa_names[CpuIsa_Max] = {
+    "generic", "sse2", "sse4.1", "avx", "avx2", "neon",
+};
+
+enum CpuArch { CpuArch_None, CpuArch_X86, CpuArch_ARM };
+
+CpuArch isa_arch(int isa) {
+    switch (isa) {
+    case CpuIsa_SSE2:
+    case CpuIsa_SSE41:
+    case CpuIsa_AVX:
+    case CpuIsa_AVX2:
+        return CpuArch_X86;
+    case CpuIsa_NEON:
+        return CpuArch_ARM;
+    default:
+        break;
+    }
+    return CpuArch_None;
+}
+
+// Levels are ordered only within one architecture, so limit applies only to
+// levels of the same architecture as the limit itself. Generic limit disables
+// all optimized levels.
+bool isa_allowed(int isa, int max_isa) {
+    if (isa == CpuIsa_Generic) {
+        return true;
+    }
+    if (max_isa == CpuIsa_Generic) {
+        return false;
+    }
+    if (isa_arch(isa) != isa_arch(max_isa)) {
+        return true;
+    }
+    return isa <= max_isa;
+}
+
+} // namespace
+
+const char* cpu_isa_to_str(CpuIsa isa) {
+    if (isa < 0 || isa >= CpuIsa_Max) {
+        return "<invalid>";
+    }
+    return isa_names[isa];
+}
+
+bool parse_cpu_isa(const char* str, CpuIsa& isa) {
+    if (!str) {
+        return false;
+    }
+
+    for (int n = 0; n < CpuIsa_Max; n++) {
+        if (strcmp(str, isa_names[n]) == 0) {
+            isa = (CpuIsa)n;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+CpuFeatures::CpuFeatures()
+    : max_isa_(CpuIsa_Max - 1)
+    , generation_(0) {
+    detect_();
+    read_env_();
+}
+
+bool CpuFeatures::is_detected(CpuIsa isa) const {
+    roc_panic_if_not(isa >= 0 && isa < CpuIsa_Max);
+
+    return detected_[isa];
+}
+
+bool CpuFeatures::is_enabled(CpuIsa isa) const {
+    roc_panic_if_not(isa >= 0 && isa < CpuIsa_Max);
+
+    return detected_[isa] && isa_allowed(isa, AtomicOps::load_relaxed(max_isa_));
+}
+
+CpuIsa CpuFeatures::max_isa() const {
+    return (CpuIsa)AtomicOps::load_relaxed(max_isa_);
+}
+
+void CpuFeatures::set_max_isa(CpuIsa isa) {
+    roc_panic_if_not(isa >= 0 && isa < CpuIsa_Max);
+
+    if ((int)isa == AtomicOps::load_relaxed(max_isa_)) {
+        return;
+    }
+
+    roc_log(LogDebug, "cpu features: setting max isa: isa=%s", cpu_isa_to_str(isa));
+
+    AtomicOps::store_relaxed(max_isa_, (int)isa);
+    AtomicOps::fetch_add_release(generation_, 1u);
+}
+
+unsigned CpuFeatures::generation() const {
+    return AtomicOps::load_acquire(generation_);
+}
+
+void CpuFeatures::detect_() {
+    for (int n = 0; n < CpuIsa_Max; n++) {
+        detected_[n] = false;
+    }
+
+    detected_[CpuIsa_Generic] = true;
+
+#if defined(ROC_CPU_X86_KERNELS)
+    __builtin_cpu_init();
+
+    detected_[CpuIsa_SSE2] = __builtin_cpu_supports("sse2");
+    detected_[CpuIsa_SSE41] = detected_[CpuIsa_SSE2] && __builtin_cpu_supports("sse4.1");
+    detected_[CpuIsa_AVX] = detected_[CpuIsa_SSE41] && __builtin_cpu_supports("avx");
+    detected_[CpuIsa_AVX2] = detected_[CpuIsa_AVX] && __builtin_cpu_supports("avx2");
+#endif
+
+#if defined(ROC_CPU_NEON_KERNELS)
+    // NEON is mandatory on AArch64, and on 32-bit ARM it's available if
+    // the whole build is targeted for it.
+    detected_[CpuIsa_NEON] = true;
+#endif
+
+    for (int n = 0; n < CpuIsa_Max; n++) {
+        if (detected_[n]) {
+            roc_log(LogDebug, "cpu features: detected isa: %s", isa_names[n]);
+        }
+    }
+}
+
+void CpuFeatures::read_env_() {
+    const char* env = getenv("ROC_CPU_ISA");
+    if (!env || !*env) {
+        return;
+    }
+
+    CpuIsa isa = CpuIsa_Generic;
+    if (!parse_cpu_isa(env, isa)) {
+        roc_log(LogError, "cpu features: ignoring invalid ROC_CPU_ISA: value=%s", env);
+        return;
+    }
+
+    roc_log(LogInfo, "cpu features: limiting isa from environment: isa=%s",
+            cpu_isa_to_str(isa));
+
+    max_isa_ = isa;
+}
+
+} // namespace core
+} // namespace roc
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/cpu_features.h
+//! @brief Runtime CPU features detection.
+
+#ifndef ROC_CORE_CPU_FEATURES_H_
+#define ROC_CORE_CPU_FEATURES_H_
+
+#include "roc_core/attributes.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/singleton.h"
+#include "roc_core/stddefs.h"
+
+#if (defined(__i386__) || defined(__x86_64__)) && defined(ROC_ATTR_TARGET)
+//! Defined if x86 kernels can be compiled.
+//! @remarks
+//!  Kernels should be marked with ROC_ATTR_TARGET(), so that they can use
+//!  instructions not enabled for the whole build.
+#define ROC_CPU_X86_KERNELS 1
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+//! Defined if NEON kernels can be compiled.
+#define ROC_CPU_NEON_KERNELS 1
+#endif
+
+namespace roc {
+namespace core {
+
+//! Instruction set level.
+//! @remarks
+//!  Levels of the same architecture are ordered, so that every level
+//!  implies all previous levels. Levels of different architectures are
+//!  not comparable.
+enum CpuIsa {
+    CpuIsa_Generic, //!< Portable code, always available.
+    CpuIsa_SSE2,    //!< x86 SSE2.
+    CpuIsa_SSE41,   //!< x86 SSE4.1.
+    CpuIsa_AVX,     //!< x86 AVX.
+    CpuIsa_AVX2,    //!< x86 AVX2.
+    CpuIsa_NEON,    //!< ARM NEON.
+
+    CpuIsa_Max //!< Number of levels.
+};
+
+//! Get instruction set name.
+const char* cpu_isa_to_str(CpuIsa isa);
+
+//! Parse instruction set name.
+//! @returns
+//!  false if @p str is not a known name.
+bool parse_cpu_isa(const char* str, CpuIsa& isa);
+
+//! Runtime CPU features.
+//! @remarks
+//!  Instruction sets supported by CPU are detected once, when instance is
+//!  created. After that, the highest allowed level may be lowered (or raised
+//!  back), to force usage of slower implementations. This is done by tests,
+//!  to check all kernel variants on one machine, and can be done by user by
+//!  setting ROC_CPU_ISA environment variable to level name.
+class CpuFeatures : public NonCopyable<> {
+public:
+    //! Get instance.
+    static CpuFeatures& instance() {
+        return Singleton<CpuFeatures>::instance();
+    }
+
+    //! Check if instruction set is supported by CPU.
+    bool is_detected(CpuIsa isa) const;
+
+    //! Check if instruction set is supported by CPU and allowed to be used.
+    //! @remarks
+    //!  Returns true if @p isa is detected and is not above max_isa().
+    //!  max_isa() limits only levels of its own architecture, e.g. "sse2"
+    //!  doesn't disable NEON. Generic level is always enabled.
+    bool is_enabled(CpuIsa isa) const;
+
+    //! Get highest allowed instruction set.
+    CpuIsa max_isa() const;
+
+    //! Set highest allowed instruction set.
+    //! @remarks
+    //!  Kernels selected by CpuDispatcher are re-selected on next use.
+    //!  CpuIsa_Generic disables all optimized kernels. Other levels limit
+    //!  only kernels of the same architecture; e.g. CpuIsa_NEON enables
+    //!  everything that is detected on x86, and CpuIsa_AVX2 does the same
+    //!  on ARM.
+    void set_max_isa(CpuIsa isa);
+
+    //! Get generation number.
+    //! @remarks
+    //!  Incremented every time when max_isa() changes.
+    unsigned generation() const;
+
+private:
+    friend class Singleton<CpuFeatures>;
+
+    CpuFeatures();
+
+    void detect_();
+    void read_env_();
+
+    bool detected_[CpuIsa_Max];
+    int max_isa_;
+    unsigned generation_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_CPU_FEATURES_H_
@@ -18,6 +18,15 @@ namespace {
 
 uint32_t rng_state;
 
+uint32_t mix(uint32_t z) {
+    z = z ^ (z >> 16);
+    z *= 0x21F0AAAD;
+    z = z ^ (z >> 15);
+    z *= 0x735A2D97;
+    z = z ^ (z >> 15);
+    return z;
+}
+
 } // namespace
 
 // PRNG implementation is a lock-free adaptation of splitmix32 by Tommy Ettinger:
@@ -31,15 +40,14 @@ uint32_t fast_random() {
         AtomicOps::compare_exchange_seq_cst(rng_state, expected_state, new_state);
     }
 
-    uint32_t z;
+    return mix(AtomicOps::fetch_add_seq_cst(rng_state, 0x9E3779B9));
+}
 
-    z = AtomicOps::fetch_add_seq_cst(rng_state, 0x9E3779B9);
-    z = z ^ (z >> 16);
-    z *= 0x21F0AAAD;
-    z = z ^ (z >> 15);
-    z *= 0x735A2D97;
-    z = z ^ (z >> 15);
-    return z;
+// Same as fast_random(), but with non-atomic caller-provided state.
+uint32_t fast_random_seeded(uint32_t& state) {
+    const uint32_t z = state;
+    state += 0x9E3779B9;
+    return mix(z);
 }
 
 // Bounded PRNG implementation is based on "Debiased Modulo (Once) — Java's Method"
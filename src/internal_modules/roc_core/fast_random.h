@@ -32,6 +32,15 @@ uint32_t fast_random_range(uint32_t from, uint32_t to);
 //! @returns normally distibure random value with 1 variance.
 double fast_random_gaussian();
 
+//! Get a random integer from a non cryptographically secure, but fast PRNG
+//! with caller-provided state.
+//! Not thread-safe.
+//! @remarks
+//!  Produces the same sequence for the same initial @p state, which is useful
+//!  when a reproducible random process is needed. State is updated in-place.
+//! @returns random value between 0 and UINT32_MAX.
+uint32_t fast_random_seeded(uint32_t& state);
+
 } // namespace core
 } // namespace roc
 
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/linear_arena.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace core {
+
+LinearArena::LinearArena(IArena& parent_arena, size_t chunk_size)
+    : parent_arena_(parent_arena)
+    , chunk_size_(AlignOps::align_max(chunk_size))
+    , curr_chunk_(NULL)
+    , num_allocations_(0) {
+}
+
+LinearArena::~LinearArena() {
+    if (num_allocations_ != 0) {
+        roc_panic("linear arena: detected leak(s): %lu block(s) were not freed",
+                  (unsigned long)num_allocations_);
+    }
+
+    while (Chunk* chunk = chunks_.front()) {
+        chunks_.remove(*chunk);
+        chunk->~Chunk();
+        parent_arena_.deallocate(chunk);
+    }
+}
+
+size_t LinearArena::num_allocations() const {
+    return num_allocations_;
+}
+
+size_t LinearArena::num_chunks() const {
+    return chunks_.size();
+}
+
+void LinearArena::rewind() {
+    if (num_allocations_ != 0) {
+        roc_panic("linear arena: attempt to rewind with %lu allocated block(s)",
+                  (unsigned long)num_allocations_);
+    }
+
+    for (Chunk* chunk = chunks_.front(); chunk; chunk = chunks_.nextof(*chunk)) {
+        chunk->used = 0;
+    }
+
+    curr_chunk_ = chunks_.front();
+}
+
+void* LinearArena::allocate(size_t size) {
+    const size_t block_size = compute_allocated_size(size);
+
+    Chunk* chunk = find_chunk_(block_size);
+    if (!chunk) {
+        return NULL;
+    }
+
+    BlockHeader* block = (BlockHeader*)((char*)chunk->data + chunk->used);
+    block->size = size;
+
+    chunk->used += block_size;
+    num_allocations_++;
+
+    return (char*)block + sizeof(BlockHeader);
+}
+
+void LinearArena::deallocate(void* ptr) {
+    if (!ptr) {
+        roc_panic("linear arena: null pointer");
+    }
+
+    roc_panic_if_msg(num_allocations_ == 0, "linear arena: unpaired deallocation");
+
+    num_allocations_--;
+}
+
+size_t LinearArena::compute_allocated_size(size_t size) const {
+    return sizeof(BlockHeader) + AlignOps::align_max(size);
+}
+
+size_t LinearArena::allocated_size(void* ptr) const {
+    if (!ptr) {
+        roc_panic("linear arena: null pointer");
+    }
+
+    const BlockHeader* block = (const BlockHeader*)((char*)ptr - sizeof(BlockHeader));
+
+    return compute_allocated_size(block->size);
+}
+
+LinearArena::Chunk* LinearArena::find_chunk_(size_t block_size) {
+    // Try current chunk and chunks after it, which were allocated
+    // before last rewind() and are not used yet.
+    for (; curr_chunk_; curr_chunk_ = chunks_.nextof(*curr_chunk_)) {
+        if (curr_chunk_->size - curr_chunk_->used >= block_size) {
+            return curr_chunk_;
+        }
+    }
+
+    const size_t data_size = std::max(chunk_size_, block_size);
+
+    void* memory = parent_arena_.allocate(sizeof(Chunk) + data_size);
+    if (!memory) {
+        roc_log(LogError, "linear arena: can't allocate chunk: size=%lu",
+                (unsigned long)data_size);
+        return NULL;
+    }
+
+    Chunk* chunk = new (memory) Chunk;
+    chunk->size = data_size;
+    chunk->used = 0;
+
+    chunks_.push_back(*chunk);
+    curr_chunk_ = chunk;
+
+    return chunk;
+}
+
+} // namespace core
+} // namespace roc
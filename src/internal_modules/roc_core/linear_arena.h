@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/linear_arena.h
+//! @brief Rewindable linear arena.
+
+#ifndef ROC_CORE_LINEAR_ARENA_H_
+#define ROC_CORE_LINEAR_ARENA_H_
+
+#include "roc_core/align_ops.h"
+#include "roc_core/iarena.h"
+#include "roc_core/list.h"
+#include "roc_core/list_node.h"
+#include "roc_core/noncopyable.h"
+
+namespace roc {
+namespace core {
+
+//! Rewindable linear arena.
+//!
+//! Allocates memory sequentially from chunks obtained from parent arena.
+//! Deallocation doesn't return memory to chunks; instead, when all blocks
+//! are deallocated, rewind() makes all chunks available again.
+//!
+//! Chunks are returned to parent arena only in destructor. Hence, if a group
+//! of objects is repeatedly destroyed and created again, and its total size
+//! doesn't grow, there is no traffic to parent arena after the first round.
+//!
+//! Not suitable for objects that frequently reallocate memory during their
+//! lifetime, because memory is reclaimed only by rewind().
+//!
+//! Not thread-safe.
+class LinearArena : public IArena, public NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  @p chunk_size defines minimum size of chunk allocated from @p parent_arena.
+    LinearArena(IArena& parent_arena, size_t chunk_size);
+    ~LinearArena();
+
+    //! Get number of allocated blocks.
+    size_t num_allocations() const;
+
+    //! Get number of chunks allocated from parent arena.
+    size_t num_chunks() const;
+
+    //! Make all chunks available for allocation again.
+    //! @pre
+    //!  All blocks should be deallocated.
+    void rewind();
+
+    //! Allocate memory.
+    virtual void* allocate(size_t size);
+
+    //! Deallocate previously allocated memory.
+    virtual void deallocate(void* ptr);
+
+    //! Computes how many bytes will be actually allocated if allocate() is called with
+    //! given size. Covers all internal overhead, if any.
+    virtual size_t compute_allocated_size(size_t size) const;
+
+    //! Returns how many bytes was allocated for given pointer returned by allocate().
+    //! Covers all internal overhead, if any.
+    //! Returns same value as computed by compute_allocated_size(size).
+    virtual size_t allocated_size(void* ptr) const;
+
+private:
+    struct Chunk : ListNode<> {
+        // Total and used size of data.
+        size_t size;
+        size_t used;
+        // Data.
+        AlignMax data[];
+    };
+
+    union BlockHeader {
+        // Block data size.
+        size_t size;
+        AlignMax alignment;
+    };
+
+    Chunk* find_chunk_(size_t block_size);
+
+    IArena& parent_arena_;
+    const size_t chunk_size_;
+
+    List<Chunk, NoOwnership> chunks_;
+    Chunk* curr_chunk_;
+
+    size_t num_allocations_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_LINEAR_ARENA_H_
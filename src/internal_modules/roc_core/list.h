@@ -147,32 +147,44 @@ public:
 
     //! Pop first element from list.
     //!
+    //! @returns
+    //!  removed element.
+    //!
     //! @remarks
     //!  - removes first element of list
-    //!  - releases ownership of removed element
+    //!  - passes ownership of removed element to returned pointer, without
+    //!    releasing and re-acquiring it
     //!
     //! @pre
     //!  the list should not be empty.
-    void pop_front() {
+    Pointer pop_front() {
         ListData* data = impl_.pop_front();
-        T* elem = from_node_data_(data);
 
-        OwnershipPolicy<T>::release(*elem);
+        Pointer elem = NULL;
+        OwnershipPolicy<T>::transfer(*from_node_data_(data), elem);
+
+        return elem;
     }
 
     //! Pop last element from list.
     //!
+    //! @returns
+    //!  removed element.
+    //!
     //! @remarks
     //!  - removes last element of list
-    //!  - releases ownership of removed element
+    //!  - passes ownership of removed element to returned pointer, without
+    //!    releasing and re-acquiring it
     //!
     //! @pre
     //!  the list should not be empty.
-    void pop_back() {
+    Pointer pop_back() {
         ListData* data = impl_.pop_back();
-        T* elem = from_node_data_(data);
 
-        OwnershipPolicy<T>::release(*elem);
+        Pointer elem = NULL;
+        OwnershipPolicy<T>::transfer(*from_node_data_(data), elem);
+
+        return elem;
     }
 
     //! Insert element into list.
@@ -79,7 +79,7 @@ public:
 
     //! Try to remove object from the beginning of the queue (non-blocking version).
     //! Should NOT be called concurrently.
-    //! Releases ownership of the returned object.
+    //! Passes ownership of the removed object to the returned pointer.
     //! @remarks
     //!  - Returns NULL if the queue is empty.
     //!  - May return NULL even if the queue is actually non-empty, in particular if
@@ -89,20 +89,18 @@ public:
     //!  - This operation is both lock-free and wait-free on all architectures, i.e. it
     //!    never waits for sleeping threads and never spins indefinitely.
     Pointer try_pop_front_exclusive() {
-        MpscQueueData* data = impl_.pop_front(false);
-        if (!data) {
-            return NULL;
-        }
+        Pointer elem = NULL;
 
-        Pointer elem = from_node_data_(data);
-        OwnershipPolicy<T>::release(*elem);
+        if (MpscQueueData* data = impl_.pop_front(false)) {
+            OwnershipPolicy<T>::transfer(*from_node_data_(data), elem);
+        }
 
         return elem;
     }
 
     //! Remove object from the beginning of the queue (blocking version).
     //! Should NOT be called concurrently.
-    //! Releases ownership of the returned object.
+    //! Passes ownership of the removed object to the returned pointer.
     //! @remarks
     //!  - Returns NULL if the queue is empty.
     //!  - May spin while a concurrent push_back() call is running.
@@ -112,13 +110,11 @@ public:
     //!  - On the "fast-path", however, this operation does not wait for any
     //!    threads and just performs a few atomic reads and writes.
     Pointer pop_front_exclusive() {
-        MpscQueueData* data = impl_.pop_front(true);
-        if (!data) {
-            return NULL;
-        }
+        Pointer elem = NULL;
 
-        Pointer elem = from_node_data_(data);
-        OwnershipPolicy<T>::release(*elem);
+        if (MpscQueueData* data = impl_.pop_front(true)) {
+            OwnershipPolicy<T>::transfer(*from_node_data_(data), elem);
+        }
 
         return elem;
     }
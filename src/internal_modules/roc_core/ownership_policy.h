@@ -31,6 +31,14 @@ template <class T> struct RefCountedOwnership {
     static void release(T& object) {
         object.decref();
     }
+
+    //! Pass ownership to pointer.
+    //! @remarks
+    //!  Attaches @p pointer to @p object, taking over the reference that was
+    //!  acquired before, without touching reference counter.
+    static void transfer(T& object, Pointer& pointer) {
+        pointer.adopt(&object);
+    }
 };
 
 //! No ownership.
@@ -45,6 +53,11 @@ template <class T> struct NoOwnership {
     //! Release ownership.
     static void release(T&) {
     }
+
+    //! Pass ownership to pointer.
+    static void transfer(T& object, Pointer& pointer) {
+        pointer = &object;
+    }
 };
 
 } // namespace core
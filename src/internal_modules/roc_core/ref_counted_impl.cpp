@@ -7,11 +7,16 @@
  */
 
 #include "roc_core/ref_counted_impl.h"
+#include "roc_core/atomic_ops.h"
 #include "roc_core/panic.h"
 
 namespace roc {
 namespace core {
 
+#ifdef ROC_ENABLE_REFCOUNT_STATS
+size_t RefCountedImpl::num_ops_ = 0;
+#endif
+
 RefCountedImpl::RefCountedImpl()
     : counter_(0) {
 }
@@ -39,6 +44,10 @@ int RefCountedImpl::getref() const {
 }
 
 int RefCountedImpl::incref() const {
+#ifdef ROC_ENABLE_REFCOUNT_STATS
+    AtomicOps::fetch_add_relaxed(num_ops_, (size_t)1);
+#endif
+
     const int current_counter = ++counter_;
 
     if (current_counter < 0 || current_counter > MaxCounter) {
@@ -52,6 +61,10 @@ int RefCountedImpl::incref() const {
 }
 
 int RefCountedImpl::decref() const {
+#ifdef ROC_ENABLE_REFCOUNT_STATS
+    AtomicOps::fetch_add_relaxed(num_ops_, (size_t)1);
+#endif
+
     const int current_counter = --counter_;
 
     if (current_counter < 0 || current_counter > MaxCounter) {
@@ -63,5 +76,15 @@ int RefCountedImpl::decref() const {
     return current_counter;
 }
 
+#ifdef ROC_ENABLE_REFCOUNT_STATS
+size_t RefCountedImpl::num_refcount_ops() {
+    return AtomicOps::load_relaxed(num_ops_);
+}
+
+void RefCountedImpl::reset_refcount_ops() {
+    AtomicOps::store_relaxed(num_ops_, (size_t)0);
+}
+#endif
+
 } // namespace core
 } // namespace roc
@@ -13,6 +13,7 @@
 #define ROC_CORE_REF_COUNTED_IMPL_H_
 
 #include "roc_core/atomic.h"
+#include "roc_core/stddefs.h"
 
 namespace roc {
 namespace core {
@@ -38,10 +39,24 @@ public:
     //! @returns reference counter value after decrementing.
     int decref() const;
 
+#ifdef ROC_ENABLE_REFCOUNT_STATS
+    //! Get total number of incref() and decref() calls made on all objects.
+    //! @remarks
+    //!  Available only if built with --enable-refcount-stats.
+    static size_t num_refcount_ops();
+
+    //! Reset counter returned by num_refcount_ops().
+    static void reset_refcount_ops();
+#endif
+
 private:
     enum { MaxCounter = 100000 };
 
     mutable Atomic<int> counter_;
+
+#ifdef ROC_ENABLE_REFCOUNT_STATS
+    static size_t num_ops_;
+#endif
 };
 
 } // namespace core
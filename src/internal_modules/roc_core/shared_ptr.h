@@ -89,6 +89,51 @@ public:
         }
     }
 
+    //! Exchange objects with another shared pointer.
+    //! @remarks
+    //!  Doesn't change reference counters.
+    void swap(SharedPtr& other) {
+        T* ptr = ptr_;
+        ptr_ = other.ptr_;
+        other.ptr_ = ptr;
+    }
+
+    //! Transfer ownership to another shared pointer.
+    //! @remarks
+    //!  Releases object previously attached to @p dst, attaches @p dst to our
+    //!  object, and makes this pointer empty. The reference held by this pointer
+    //!  is handed over to @p dst, so reference counter of our object is not
+    //!  changed. This is a cheaper replacement for "dst = ptr; ptr = NULL".
+    void transfer_to(SharedPtr& dst) {
+        if (&dst == this) {
+            return;
+        }
+        dst.release_();
+        dst.ptr_ = ptr_;
+        ptr_ = NULL;
+    }
+
+    //! Reset shared pointer and attach it to another object without acquiring it.
+    //! @remarks
+    //!  Takes over a reference that was already acquired by caller, e.g. the one
+    //!  that was held by a container.
+    void adopt(T* ptr) {
+        release_();
+        ptr_ = ptr;
+    }
+
+    //! Detach shared pointer from object without releasing it.
+    //! @returns
+    //!  the object that was attached, or NULL.
+    //! @remarks
+    //!  The reference that was held by this pointer becomes owned by caller,
+    //!  who should either release it or pass it to adopt().
+    T* disown() {
+        T* ptr = ptr_;
+        ptr_ = NULL;
+        return ptr;
+    }
+
     //! Get underlying pointer.
     T* get() const {
         return ptr_;
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "roc_core/errno_to_str.h"
+#include "roc_core/log.h"
+#include "roc_core/mapped_file.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace core {
+
+MappedFile::MappedFile()
+    : data_(NULL)
+    , size_(0) {
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+bool MappedFile::is_open() const {
+    return data_ != NULL;
+}
+
+bool MappedFile::open(const char* path) {
+    roc_panic_if_msg(!path, "mapped file: path is null");
+
+    if (data_) {
+        roc_panic("mapped file: already opened");
+    }
+
+    const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+        roc_log(LogDebug, "mapped file: open(): %s: %s", path, errno_to_str().c_str());
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) == -1) {
+        roc_log(LogDebug, "mapped file: fstat(): %s: %s", path, errno_to_str().c_str());
+        (void)::close(fd);
+        return false;
+    }
+
+    if (!S_ISREG(st.st_mode) || st.st_size <= 0) {
+        roc_log(LogDebug, "mapped file: not a regular non-empty file: %s", path);
+        (void)::close(fd);
+        return false;
+    }
+
+    void* data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // Mapping keeps its own reference to the file.
+    if (::close(fd) == -1) {
+        roc_log(LogError, "mapped file: close(): %s: %s", path, errno_to_str().c_str());
+    }
+
+    if (data == MAP_FAILED) {
+        roc_log(LogDebug, "mapped file: mmap(): %s: %s", path, errno_to_str().c_str());
+        return false;
+    }
+
+    data_ = data;
+    size_ = (size_t)st.st_size;
+
+    if (int err = posix_madvise(data_, size_, POSIX_MADV_SEQUENTIAL)) {
+        roc_log(LogDebug, "mapped file: posix_madvise(): %s: %s", path,
+                errno_to_str(err).c_str());
+    }
+
+    roc_log(LogDebug, "mapped file: mapped %s: size=%lu", path, (unsigned long)size_);
+
+    return true;
+}
+
+void MappedFile::close() {
+    if (!data_) {
+        return;
+    }
+
+    if (munmap(data_, size_) == -1) {
+        roc_panic("mapped file: munmap(): %s", errno_to_str().c_str());
+    }
+
+    data_ = NULL;
+    size_ = 0;
+}
+
+const uint8_t* MappedFile::data() const {
+    roc_panic_if_msg(!data_, "mapped file: not opened");
+
+    return (const uint8_t*)data_;
+}
+
+size_t MappedFile::size() const {
+    return size_;
+}
+
+void MappedFile::read_ahead(size_t offset, size_t size) {
+    roc_panic_if_msg(!data_, "mapped file: not opened");
+
+    if (offset >= size_) {
+        return;
+    }
+    if (size > size_ - offset) {
+        size = size_ - offset;
+    }
+
+    // Address passed to posix_madvise() must be page-aligned.
+    const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    const size_t aligned_offset = offset / page_size * page_size;
+
+    if (int err = posix_madvise((uint8_t*)data_ + aligned_offset,
+                                size + (offset - aligned_offset), POSIX_MADV_WILLNEED)) {
+        roc_log(LogTrace, "mapped file: posix_madvise(): %s", errno_to_str(err).c_str());
+    }
+}
+
+} // namespace core
+} // namespace roc
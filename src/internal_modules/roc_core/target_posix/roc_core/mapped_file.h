@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/target_posix/roc_core/mapped_file.h
+//! @brief Read-only memory-mapped file.
+
+#ifndef ROC_CORE_MAPPED_FILE_H_
+#define ROC_CORE_MAPPED_FILE_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Read-only memory-mapped file.
+//! @remarks
+//!  Maps whole regular file into memory and hints the kernel that the file
+//!  will be accessed sequentially. Allows zero-copy reading of large files.
+class MappedFile : public core::NonCopyable<> {
+public:
+    //! Initialize empty object.
+    MappedFile();
+
+    //! Unmap file, if mapped.
+    ~MappedFile();
+
+    //! Check if file is mapped.
+    bool is_open() const;
+
+    //! Map file.
+    //! @returns
+    //!  false if file can't be opened, is not a regular file, is empty,
+    //!  or can't be mapped.
+    bool open(const char* path);
+
+    //! Unmap file.
+    void close();
+
+    //! Get pointer to mapped data.
+    const uint8_t* data() const;
+
+    //! Get size of mapped data in bytes.
+    size_t size() const;
+
+    //! Ask the kernel to read ahead given range.
+    //! @remarks
+    //!  Range is clamped to file size. Offset doesn't need to be page-aligned.
+    void read_ahead(size_t offset, size_t size);
+
+private:
+    void* data_;
+    size_t size_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_MAPPED_FILE_H_
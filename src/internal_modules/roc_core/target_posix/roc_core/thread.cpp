@@ -7,6 +7,7 @@
  */
 
 #if defined(__linux__)
+#include <sys/prctl.h>
 #include <sys/syscall.h>
 #elif defined(__FreeBSD__) || defined(__OpenBSD__)
 #include <pthread_np.h>
@@ -61,6 +62,38 @@ bool Thread::enable_realtime() {
     return true;
 }
 
+bool Thread::set_timer_slack(nanoseconds_t slack) {
+    roc_panic_if_msg(slack <= 0, "thread: timer slack should be positive");
+
+#if defined(__linux__) && defined(PR_SET_TIMERSLACK)
+    if (prctl(PR_SET_TIMERSLACK, (unsigned long)slack, 0, 0, 0) == -1) {
+        roc_log(LogDebug, "thread: can't set timer slack: prctl(): %s",
+                errno_to_str().c_str());
+        return false;
+    }
+
+    return true;
+#else
+    roc_log(LogDebug, "thread: can't set timer slack: not supported on this platform");
+    return false;
+#endif
+}
+
+nanoseconds_t Thread::get_timer_slack() {
+#if defined(__linux__) && defined(PR_GET_TIMERSLACK)
+    const int slack = prctl(PR_GET_TIMERSLACK, 0, 0, 0, 0);
+    if (slack == -1) {
+        roc_log(LogDebug, "thread: can't get timer slack: prctl(): %s",
+                errno_to_str().c_str());
+        return 0;
+    }
+
+    return (nanoseconds_t)slack;
+#else
+    return 0;
+#endif
+}
+
 Thread::Thread()
     : started_(0)
     , joinable_(0) {
@@ -19,6 +19,7 @@
 #include "roc_core/mutex.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/stddefs.h"
+#include "roc_core/time.h"
 
 namespace roc {
 namespace core {
@@ -35,6 +36,18 @@ public:
     //! Raise current thread priority to realtime.
     ROC_ATTR_NODISCARD static bool enable_realtime();
 
+    //! Set timer slack of current thread.
+    //! @remarks
+    //!  Timer slack defines how much the kernel is allowed to delay wakeups
+    //!  of sleeping thread to coalesce them with other timers. Supported only
+    //!  on Linux; on other platforms returns false.
+    ROC_ATTR_NODISCARD static bool set_timer_slack(nanoseconds_t slack);
+
+    //! Get timer slack of current thread.
+    //! @remarks
+    //!  Returns zero if not supported on this platform.
+    static nanoseconds_t get_timer_slack();
+
     //! Check if thread was started and can be joined.
     //! @returns
     //!  true if start() was called and join() was not called yet.
@@ -60,6 +60,25 @@ nanoseconds_t timestamp(clock_t) {
 
 #endif
 
+#if defined(CLOCK_THREAD_CPUTIME_ID)
+
+nanoseconds_t thread_cpu_timestamp() {
+    timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == -1) {
+        roc_panic("time: clock_gettime(): %s", errno_to_str().c_str());
+    }
+
+    return nanoseconds_t(ts.tv_sec) * 1000000000 + nanoseconds_t(ts.tv_nsec);
+}
+
+#else
+
+nanoseconds_t thread_cpu_timestamp() {
+    return timestamp(ClockMonotonic);
+}
+
+#endif
+
 #if defined(CLOCK_REALTIME) && !defined(__APPLE__) && !defined(__MACH__)
 
 void sleep_for(clock_t clock, nanoseconds_t ns) {
@@ -7,20 +7,26 @@
  */
 
 #include "roc_core/ticker.h"
+#include "roc_core/cpu_instructions.h"
+#include "roc_core/thread.h"
 
 namespace roc {
 namespace core {
 
-Ticker::Ticker(ticks_t freq)
+Ticker::Ticker(ticks_t freq, const TickerConfig& config)
     : ratio_(double(freq) / Second)
     , start_(0)
-    , started_(false) {
+    , started_(false)
+    , config_(config) {
+    roc_panic_if_msg(config_.spin_window < 0 || config_.timer_slack < 0,
+                     "ticker: invalid config");
 }
 
 void Ticker::start() {
     if (started_) {
         roc_panic("ticker: can't start ticker twice");
     }
+
     start_ = timestamp(ClockMonotonic);
     started_ = true;
 }
@@ -37,8 +43,83 @@ Ticker::ticks_t Ticker::elapsed() {
 void Ticker::wait(ticks_t ticks) {
     if (!started_) {
         start();
+        if (ticks == 0) {
+            return;
+        }
+    }
+    sleep_until_(start_ + nanoseconds_t(ticks / ratio_));
+}
+
+const TickerMetrics& Ticker::metrics() const {
+    return metrics_;
+}
+
+void Ticker::sleep_until_(nanoseconds_t deadline) {
+    nanoseconds_t now = timestamp(ClockMonotonic);
+
+    if (now >= deadline) {
+        metrics_.overruns++;
+        return;
+    }
+
+    // Slack is changed only while we're waiting, so that the rest of the
+    // code running on this thread is not affected.
+    // Zero slack means that it's not supported on this platform.
+    nanoseconds_t prev_slack = 0;
+    if (config_.timer_slack > 0) {
+        prev_slack = Thread::get_timer_slack();
+        if (prev_slack == config_.timer_slack
+            || (prev_slack > 0 && !Thread::set_timer_slack(config_.timer_slack))) {
+            prev_slack = 0;
+        }
+    }
+
+    wait_until_(deadline, now);
+
+    if (prev_slack > 0) {
+        (void)Thread::set_timer_slack(prev_slack);
+    }
+}
+
+void Ticker::wait_until_(nanoseconds_t deadline, nanoseconds_t now) {
+    if (!config_.enable_precise) {
+        sleep_until(ClockMonotonic, deadline);
+        report_wakeup_(deadline, timestamp(ClockMonotonic));
+        return;
+    }
+
+    // Wake up a bit earlier than needed, to be ready before the deadline
+    // even if the kernel delays wakeup because of timer slack or scheduling.
+    if (deadline - now > config_.spin_window) {
+        sleep_until(ClockMonotonic, deadline - config_.spin_window);
+        now = timestamp(ClockMonotonic);
+    }
+
+    // Spin until exact deadline. Number of iterations is bounded by spin
+    // window, because we get here no earlier than spin_window before deadline.
+    while (now < deadline) {
+        cpu_relax();
+        now = timestamp(ClockMonotonic);
+    }
+
+    report_wakeup_(deadline, now);
+}
+
+void Ticker::report_wakeup_(nanoseconds_t deadline, nanoseconds_t wakeup) {
+    const nanoseconds_t error = wakeup > deadline ? wakeup - deadline : 0;
+
+    size_t bucket = 0;
+    while (bucket < TickerMetrics::NumBuckets - 1
+           && error >= (nanoseconds_t(1) << bucket) * Microsecond) {
+        bucket++;
+    }
+
+    metrics_.wakeups++;
+    metrics_.wakeup_error_histogram[bucket]++;
+    metrics_.total_wakeup_error += error;
+    if (error > metrics_.max_wakeup_error) {
+        metrics_.max_wakeup_error = error;
     }
-    sleep_until(ClockMonotonic, start_ + nanoseconds_t(ticks / ratio_));
 }
 
 } // namespace core
@@ -19,6 +19,73 @@
 namespace roc {
 namespace core {
 
+//! Ticker parameters.
+struct TickerConfig {
+    //! Enable precise waiting.
+    //! @remarks
+    //!  If enabled, ticker sleeps until spin_window before the deadline, and
+    //!  then busy-waits until the deadline itself. This hides timer slack and
+    //!  scheduler wakeup latency at the cost of burning CPU during spin window.
+    bool enable_precise;
+
+    //! How long before deadline to stop sleeping and start busy-waiting.
+    //! @remarks
+    //!  Used only if enable_precise is set. Bounds CPU time spent in spin per
+    //!  wait. If wakeup happens later than the deadline, there is no spin.
+    nanoseconds_t spin_window;
+
+    //! Timer slack of the thread that waits on ticker.
+    //! @remarks
+    //!  If positive, set for the duration of every wait, and previous value
+    //!  is restored after it, because ticker may be used from a thread that
+    //!  doesn't belong to us. Zero keeps thread's own slack (50us by default
+    //!  on Linux). Supported only on Linux.
+    nanoseconds_t timer_slack;
+
+    TickerConfig()
+        : enable_precise(false)
+        , spin_window(200 * Microsecond)
+        , timer_slack(0) {
+    }
+};
+
+//! Ticker metrics.
+struct TickerMetrics {
+    //! Number of histogram buckets.
+    //! @remarks
+    //!  Bucket N counts wakeups with error in [2^(N-1), 2^N) microseconds,
+    //!  bucket 0 counts wakeups with error below 1 microsecond, and the last
+    //!  bucket counts all wakeups with error of 2^(NumBuckets-2) us and more.
+    enum { NumBuckets = 12 };
+
+    //! Number of times when ticker slept until deadline.
+    uint64_t wakeups;
+
+    //! Number of times when deadline was already passed when wait was called.
+    uint64_t overruns;
+
+    //! Histogram of wakeup error (delay of actual wakeup after deadline).
+    uint64_t wakeup_error_histogram[NumBuckets];
+
+    //! Maximum wakeup error.
+    nanoseconds_t max_wakeup_error;
+
+    //! Sum of all wakeup errors.
+    //! @remarks
+    //!  Divide by wakeups to get average error.
+    nanoseconds_t total_wakeup_error;
+
+    TickerMetrics()
+        : wakeups(0)
+        , overruns(0)
+        , max_wakeup_error(0)
+        , total_wakeup_error(0) {
+        for (size_t n = 0; n < NumBuckets; n++) {
+            wakeup_error_histogram[n] = 0;
+        }
+    }
+};
+
 //! Ticker.
 class Ticker : public NonCopyable<> {
 public:
@@ -28,7 +95,7 @@ public:
     //! Initialize.
     //! @remarks
     //!  @p freq defines the number of ticks per second.
-    explicit Ticker(ticks_t freq);
+    explicit Ticker(ticks_t freq, const TickerConfig& config = TickerConfig());
 
     //! Start ticker.
     void start();
@@ -41,10 +108,20 @@ public:
     //! If ticker is not started yet, it is started automatically.
     void wait(ticks_t ticks);
 
+    //! Get wakeup metrics.
+    const TickerMetrics& metrics() const;
+
 private:
+    void sleep_until_(nanoseconds_t deadline);
+    void wait_until_(nanoseconds_t deadline, nanoseconds_t now);
+    void report_wakeup_(nanoseconds_t deadline, nanoseconds_t wakeup);
+
     const double ratio_;
     nanoseconds_t start_;
     bool started_;
+
+    const TickerConfig config_;
+    TickerMetrics metrics_;
 };
 
 } // namespace core
@@ -81,6 +81,15 @@ const nanoseconds_t Day = 24 * Hour;
 //! Get current timestamp in nanoseconds.
 nanoseconds_t timestamp(clock_t clock);
 
+//! Get CPU time consumed by calling thread, in nanoseconds.
+//! @remarks
+//!  Unlike timestamp(), doesn't grow while thread is sleeping or waiting
+//!  for CPU, so the difference between two values defines how much CPU time
+//!  was spent by thread between them.
+//! @note
+//!  If platform does not support per-thread CPU clock, monotonic clock is used.
+nanoseconds_t thread_cpu_timestamp();
+
 //! Sleep until the specified absolute time point has been reached.
 //! @remarks
 //!  @p timestamp specifies absolute time point in nanoseconds.
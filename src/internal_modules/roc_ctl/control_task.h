@@ -76,6 +76,10 @@ protected:
         , renewed_deadline_(0)
         , effective_deadline_(0)
         , effective_version_(0)
+        , heap_prev_(NULL)
+        , heap_child_(NULL)
+        , heap_next_(NULL)
+        , heap_seqnum_(0)
         , func_(reinterpret_cast<ControlTaskFunc>(task_func))
         , executor_(NULL)
         , completer_(NULL)
@@ -86,6 +90,7 @@ protected:
 
 private:
     friend class ControlTaskQueue;
+    friend class ControlTaskHeap;
 
     enum State {
         // task is in ready queue or being fetched from it; after it's
@@ -155,6 +160,16 @@ private:
     // version of currently active task deadline
     core::seqlock_version_t effective_version_;
 
+    // links in heap of sleeping tasks:
+    // parent if task is leftmost child, otherwise left sibling
+    ControlTask* heap_prev_;
+    // leftmost child
+    ControlTask* heap_child_;
+    // right sibling
+    ControlTask* heap_next_;
+    // insertion order, to order tasks with equal deadlines
+    uint64_t heap_seqnum_;
+
     // function to be executed
     ControlTaskFunc func_;
 
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_ctl/control_task_heap.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace ctl {
+
+ControlTaskHeap::ControlTaskHeap()
+    : root_(NULL)
+    , size_(0)
+    , seqnum_(0) {
+}
+
+ControlTaskHeap::~ControlTaskHeap() {
+    while (root_) {
+        remove(*root_);
+    }
+}
+
+size_t ControlTaskHeap::size() const {
+    return size_;
+}
+
+bool ControlTaskHeap::contains(const ControlTask& task) const {
+    // Every task except root has a parent or a left sibling.
+    return &task == root_ || task.heap_prev_ != NULL;
+}
+
+ControlTask* ControlTaskHeap::front() const {
+    return root_;
+}
+
+void ControlTaskHeap::insert(ControlTask& task) {
+    roc_panic_if_msg(contains(task),
+                     "control task heap: attempt to insert task which is already in "
+                     "heap: ptr=%p",
+                     (const void*)&task);
+
+    roc_panic_if_not(task.heap_child_ == NULL && task.heap_next_ == NULL);
+
+    task.heap_seqnum_ = seqnum_++;
+
+    root_ = meld_(root_, &task);
+    size_++;
+}
+
+void ControlTaskHeap::remove(ControlTask& task) {
+    roc_panic_if_msg(!contains(task),
+                     "control task heap: attempt to remove task which is not in "
+                     "heap: ptr=%p",
+                     (const void*)&task);
+
+    ControlTask* children = task.heap_child_;
+    task.heap_child_ = NULL;
+
+    if (&task == root_) {
+        root_ = merge_pairs_(children);
+    } else {
+        // Unlink subtree from parent or left sibling.
+        ControlTask* prev = task.heap_prev_;
+        if (prev->heap_child_ == &task) {
+            prev->heap_child_ = task.heap_next_;
+        } else {
+            prev->heap_next_ = task.heap_next_;
+        }
+        if (task.heap_next_) {
+            task.heap_next_->heap_prev_ = prev;
+        }
+
+        task.heap_prev_ = NULL;
+        task.heap_next_ = NULL;
+
+        // Children of removed task form a new subtree, which is melded into root.
+        root_ = meld_(root_, merge_pairs_(children));
+    }
+
+    size_--;
+}
+
+bool ControlTaskHeap::less_(const ControlTask& a, const ControlTask& b) {
+    if (a.effective_deadline_ != b.effective_deadline_) {
+        return a.effective_deadline_ < b.effective_deadline_;
+    }
+    return a.heap_seqnum_ < b.heap_seqnum_;
+}
+
+// Link two trees, making the one with larger root the leftmost child of another.
+// Both roots should have no siblings.
+ControlTask* ControlTaskHeap::meld_(ControlTask* a, ControlTask* b) {
+    if (!a) {
+        return b;
+    }
+    if (!b) {
+        return a;
+    }
+
+    if (less_(*b, *a)) {
+        ControlTask* tmp = a;
+        a = b;
+        b = tmp;
+    }
+
+    b->heap_prev_ = a;
+    b->heap_next_ = a->heap_child_;
+    if (a->heap_child_) {
+        a->heap_child_->heap_prev_ = b;
+    }
+    a->heap_child_ = b;
+
+    return a;
+}
+
+// Combine list of siblings into one tree using standard two-pass scheme:
+// meld siblings pairwise from left to right, then meld resulting trees
+// from right to left.
+ControlTask* ControlTaskHeap::merge_pairs_(ControlTask* first) {
+    // First pass. Resulting trees are linked in reverse order via heap_next_.
+    ControlTask* pairs = NULL;
+
+    while (first) {
+        ControlTask* a = first;
+        ControlTask* b = a->heap_next_;
+
+        first = b ? b->heap_next_ : NULL;
+
+        a->heap_prev_ = a->heap_next_ = NULL;
+        if (b) {
+            b->heap_prev_ = b->heap_next_ = NULL;
+        }
+
+        ControlTask* tree = meld_(a, b);
+        tree->heap_next_ = pairs;
+        pairs = tree;
+    }
+
+    // Second pass.
+    ControlTask* result = NULL;
+
+    while (pairs) {
+        ControlTask* next = pairs->heap_next_;
+        pairs->heap_next_ = NULL;
+
+        result = meld_(result, pairs);
+        pairs = next;
+    }
+
+    return result;
+}
+
+} // namespace ctl
+} // namespace roc
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_ctl/control_task_heap.h
+//! @brief Heap of sleeping control tasks.
+
+#ifndef ROC_CTL_CONTROL_TASK_HEAP_H_
+#define ROC_CTL_CONTROL_TASK_HEAP_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+#include "roc_ctl/control_task.h"
+
+namespace roc {
+namespace ctl {
+
+//! Heap of sleeping control tasks, ordered by deadline.
+//!
+//! Implemented as an intrusive pairing heap: links are stored in the task itself,
+//! so insertion and removal never allocate.
+//!
+//! Complexity:
+//!  - front() is O(1)
+//!  - insert() is O(1)
+//!  - remove() is O(log N) amortized
+//!
+//! Tasks with equal deadlines are ordered by insertion time (FIFO).
+//!
+//! Deadline is read from ControlTask::effective_deadline_ and should not be
+//! changed while the task is in heap.
+//!
+//! Not thread-safe.
+class ControlTaskHeap : public core::NonCopyable<> {
+public:
+    //! Initialize empty heap.
+    ControlTaskHeap();
+
+    ~ControlTaskHeap();
+
+    //! Get number of tasks in heap.
+    size_t size() const;
+
+    //! Check if task is in heap.
+    bool contains(const ControlTask& task) const;
+
+    //! Get task with smallest deadline.
+    //! @returns
+    //!  NULL if heap is empty.
+    ControlTask* front() const;
+
+    //! Insert task into heap.
+    //! @pre
+    //!  Task should not be in heap.
+    void insert(ControlTask& task);
+
+    //! Remove task from heap.
+    //! @pre
+    //!  Task should be in heap.
+    void remove(ControlTask& task);
+
+private:
+    static bool less_(const ControlTask& a, const ControlTask& b);
+
+    static ControlTask* meld_(ControlTask* a, ControlTask* b);
+    static ControlTask* merge_pairs_(ControlTask* first);
+
+    ControlTask* root_;
+    size_t size_;
+
+    // incremented on every insertion, to order tasks with equal deadlines
+    uint64_t seqnum_;
+};
+
+} // namespace ctl
+} // namespace roc
+
+#endif // ROC_CTL_CONTROL_TASK_HEAP_H_
@@ -827,19 +827,7 @@ ControlTask* ControlTaskQueue::fetch_sleeping_task_() {
 void ControlTaskQueue::insert_sleeping_task_(ControlTask& task) {
     roc_panic_if_not(task.effective_deadline_ > 0);
 
-    ControlTask* pos = sleeping_queue_.front();
-
-    for (; pos; pos = sleeping_queue_.nextof(*pos)) {
-        if (pos->effective_deadline_ > task.effective_deadline_) {
-            break;
-        }
-    }
-
-    if (pos) {
-        sleeping_queue_.insert_before(task, *pos);
-    } else {
-        sleeping_queue_.push_back(task);
-    }
+    sleeping_queue_.insert(task);
 }
 
 void ControlTaskQueue::remove_sleeping_task_(ControlTask& task) {
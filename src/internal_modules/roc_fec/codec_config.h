@@ -18,6 +18,23 @@
 namespace roc {
 namespace fec {
 
+//! FEC codec backends.
+enum CodecBackend {
+    //! Default backend.
+    //! Resolved to OpenFEC if it is enabled at build time and supports
+    //! the scheme, and to built-in codec otherwise.
+    CodecBackend_Default,
+
+    //! OpenFEC library.
+    //! Supports Reed-Solomon and LDPC-Staircase.
+    //! May be disabled at build time.
+    CodecBackend_OpenFEC,
+
+    //! Built-in codec.
+    //! Supports LDPC-Staircase only.
+    CodecBackend_Builtin
+};
+
 //! FEC codec parameters.
 struct CodecConfig {
     //! FEC scheme.
@@ -32,14 +49,21 @@ struct CodecConfig {
     //! Configuration for ReedSolomon scheme.
     uint16_t rs_m;
 
+    //! FEC codec backend.
+    CodecBackend backend;
+
     CodecConfig()
         : scheme(packet::FEC_None)
         , ldpc_prng_seed(1297501556)
         , ldpc_N1(7)
-        , rs_m(8) {
+        , rs_m(8)
+        , backend(CodecBackend_Default) {
     }
 };
 
+//! Get string name of FEC codec backend.
+const char* codec_backend_to_str(CodecBackend backend);
+
 } // namespace fec
 } // namespace roc
 
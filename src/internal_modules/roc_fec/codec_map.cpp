@@ -11,6 +11,8 @@
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
 #include "roc_core/scoped_ptr.h"
+#include "roc_fec/ldpc_staircase_decoder.h"
+#include "roc_fec/ldpc_staircase_encoder.h"
 #include "roc_packet/fec_scheme_to_str.h"
 
 #ifdef ROC_TARGET_OPENFEC
@@ -24,9 +26,9 @@ namespace fec {
 namespace {
 
 template <class I, class T>
-ROC_ATTR_UNUSED I* ctor_func(const CodecConfig& config,
-                             packet::PacketFactory& packet_factory,
-                             core::IArena& arena) {
+I* ctor_func(const CodecConfig& config,
+             packet::PacketFactory& packet_factory,
+             core::IArena& arena) {
     core::ScopedPtr<T> codec(new (arena) T(config, packet_factory, arena), arena);
     if (!codec || !codec->is_valid()) {
         return NULL;
@@ -37,10 +39,14 @@ ROC_ATTR_UNUSED I* ctor_func(const CodecConfig& config,
 } // namespace
 
 CodecMap::CodecMap()
-    : n_codecs_(0) {
+    : n_codecs_(0)
+    , n_schemes_(0) {
+    // Codecs are registered in order of preference: default backend for
+    // a scheme is the first registered codec for it.
 #ifdef ROC_TARGET_OPENFEC
     {
         Codec codec;
+        codec.backend = CodecBackend_OpenFEC;
         codec.encoder_ctor = ctor_func<IBlockEncoder, OpenfecEncoder>;
         codec.decoder_ctor = ctor_func<IBlockDecoder, OpenfecDecoder>;
 
@@ -51,25 +57,41 @@ CodecMap::CodecMap()
         add_codec_(codec);
     }
 #endif // ROC_TARGET_OPENFEC
+    {
+        // Built-in codec is wire-compatible with OpenFEC. It's used by default
+        // when OpenFEC is not available, and can be selected explicitly
+        // via CodecConfig::backend otherwise.
+        Codec codec;
+        codec.backend = CodecBackend_Builtin;
+        codec.encoder_ctor = ctor_func<IBlockEncoder, LdpcStaircaseEncoder>;
+        codec.decoder_ctor = ctor_func<IBlockDecoder, LdpcStaircaseDecoder>;
+
+        codec.scheme = packet::FEC_LDPC_Staircase;
+        add_codec_(codec);
+    }
 }
 
 bool CodecMap::is_supported(packet::FecScheme scheme) const {
-    return find_codec_(scheme);
+    return find_codec_(scheme, CodecBackend_Default);
+}
+
+bool CodecMap::is_supported(packet::FecScheme scheme, CodecBackend backend) const {
+    return find_codec_(scheme, backend);
 }
 
 size_t CodecMap::num_schemes() const {
-    return n_codecs_;
+    return n_schemes_;
 }
 
 packet::FecScheme CodecMap::nth_scheme(size_t n) const {
-    roc_panic_if(n >= n_codecs_);
-    return codecs_[n].scheme;
+    roc_panic_if(n >= n_schemes_);
+    return schemes_[n];
 }
 
 IBlockEncoder* CodecMap::new_encoder(const CodecConfig& config,
                                      packet::PacketFactory& packet_factory,
                                      core::IArena& arena) const {
-    const Codec* codec = find_codec_(config.scheme);
+    const Codec* codec = find_codec_(config.scheme, config.backend);
     if (!codec) {
         return NULL;
     }
@@ -79,7 +101,7 @@ IBlockEncoder* CodecMap::new_encoder(const CodecConfig& config,
 IBlockDecoder* CodecMap::new_decoder(const CodecConfig& config,
                                      packet::PacketFactory& packet_factory,
                                      core::IArena& arena) const {
-    const Codec* codec = find_codec_(config.scheme);
+    const Codec* codec = find_codec_(config.scheme, config.backend);
     if (!codec) {
         return NULL;
     }
@@ -89,17 +111,27 @@ IBlockDecoder* CodecMap::new_decoder(const CodecConfig& config,
 void CodecMap::add_codec_(const Codec& codec) {
     roc_panic_if(n_codecs_ == MaxCodecs);
     codecs_[n_codecs_++] = codec;
+
+    for (size_t n = 0; n < n_schemes_; n++) {
+        if (schemes_[n] == codec.scheme) {
+            return;
+        }
+    }
+    schemes_[n_schemes_++] = codec.scheme;
 }
 
-const CodecMap::Codec* CodecMap::find_codec_(packet::FecScheme scheme) const {
+const CodecMap::Codec* CodecMap::find_codec_(packet::FecScheme scheme,
+                                             CodecBackend backend) const {
     for (size_t n = 0; n < n_codecs_; n++) {
-        if (codecs_[n].scheme == scheme) {
+        if (codecs_[n].scheme == scheme
+            && (backend == CodecBackend_Default || codecs_[n].backend == backend)) {
             return &codecs_[n];
         }
     }
 
-    roc_log(LogError, "codec map: no codec available for fec scheme '%s'",
-            packet::fec_scheme_to_str(scheme));
+    roc_log(LogError,
+            "codec map: no codec available for fec scheme '%s' and backend '%s'",
+            packet::fec_scheme_to_str(scheme), codec_backend_to_str(backend));
 
     return NULL;
 }
@@ -31,9 +31,12 @@ public:
         return core::Singleton<CodecMap>::instance();
     }
 
-    //! Check whether given FEC scheme is supported.
+    //! Check whether given FEC scheme is supported by any backend.
     bool is_supported(packet::FecScheme scheme) const;
 
+    //! Check whether given FEC scheme is supported by given backend.
+    bool is_supported(packet::FecScheme scheme, CodecBackend backend) const;
+
     //! Get number of supported FEC schemes.
     size_t num_schemes() const;
 
@@ -43,7 +46,7 @@ public:
     //! Create a new block encoder.
     //!
     //! @remarks
-    //!  The codec type is determined by @p config.
+    //!  The codec type is determined by @p config scheme and backend.
     //!
     //! @returns
     //!  NULL if parameters are invalid or given codec support is not enabled.
@@ -54,7 +57,7 @@ public:
     //! Create a new block decoder.
     //!
     //! @remarks
-    //!  The codec type is determined by @p config.
+    //!  The codec type is determined by @p config scheme and backend.
     //!
     //! @returns
     //!  NULL if parameters are invalid or given codec support is not enabled.
@@ -65,10 +68,11 @@ public:
 private:
     friend class core::Singleton<CodecMap>;
 
-    enum { MaxCodecs = 2 };
+    enum { MaxCodecs = 3 };
 
     struct Codec {
         packet::FecScheme scheme;
+        CodecBackend backend;
 
         IBlockEncoder* (*encoder_ctor)(const CodecConfig& config,
                                        packet::PacketFactory& packet_factory,
@@ -82,10 +86,13 @@ private:
     CodecMap();
 
     void add_codec_(const Codec& codec);
-    const Codec* find_codec_(packet::FecScheme scheme) const;
+    const Codec* find_codec_(packet::FecScheme scheme, CodecBackend backend) const;
 
     size_t n_codecs_;
     Codec codecs_[MaxCodecs];
+
+    size_t n_schemes_;
+    packet::FecScheme schemes_[MaxCodecs];
 };
 
 } // namespace fec
@@ -0,0 +1,551 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_fec/ldpc_staircase_decoder.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_fec/symbol_ops.h"
+
+namespace roc {
+namespace fec {
+
+namespace {
+
+const uint32_t NoUnknown = (uint32_t)-1;
+
+inline bool bit_get(const uint64_t* bits, size_t n) {
+    return (bits[n / 64] >> (n % 64)) & 1;
+}
+
+inline void bit_set(uint64_t* bits, size_t n) {
+    bits[n / 64] |= (uint64_t)1 << (n % 64);
+}
+
+} // namespace
+
+LdpcStaircaseDecoder::LdpcStaircaseDecoder(const CodecConfig& config,
+                                           packet::PacketFactory& packet_factory,
+                                           core::IArena& arena)
+    : sblen_(0)
+    , rblen_(0)
+    , payload_size_(0)
+    , prng_seed_((uint32_t)config.ldpc_prng_seed)
+    , n1_(config.ldpc_N1)
+    , packet_factory_(packet_factory)
+    , matrix_(arena)
+    , buff_tab_(arena)
+    , recv_tab_(arena)
+    , status_(arena)
+    , row_unknowns_(arena)
+    , row_queue_(arena)
+    , members_(arena)
+    , sources_(arena)
+    , unknown_syms_(arena)
+    , sym_unknowns_(arena)
+    , eq_rows_(arena)
+    , eq_bits_(arena)
+    , eq_values_(arena)
+    , has_new_packets_(false)
+    , valid_(false) {
+    if (config.scheme != packet::FEC_LDPC_Staircase) {
+        roc_panic("ldpc decoder: unexpected fec scheme");
+    }
+
+    roc_log(LogDebug, "ldpc decoder: initializing: prng_seed=%ld n1=%d",
+            (long)config.ldpc_prng_seed, (int)config.ldpc_N1);
+
+    if (config.ldpc_prng_seed <= 0 || config.ldpc_prng_seed == 0x7FFFFFFF
+        || config.ldpc_N1 == 0) {
+        roc_log(LogError, "ldpc decoder: invalid parameters: prng_seed=%ld n1=%d",
+                (long)config.ldpc_prng_seed, (int)config.ldpc_N1);
+        return;
+    }
+
+    valid_ = true;
+}
+
+LdpcStaircaseDecoder::~LdpcStaircaseDecoder() {
+}
+
+bool LdpcStaircaseDecoder::is_valid() const {
+    return valid_;
+}
+
+size_t LdpcStaircaseDecoder::max_block_length() const {
+    roc_panic_if_not(is_valid());
+
+    return MaxBlockLength;
+}
+
+bool LdpcStaircaseDecoder::begin(size_t sblen, size_t rblen, size_t payload_size) {
+    roc_panic_if_not(is_valid());
+
+    if (!resize_tabs_(sblen + rblen)) {
+        return false;
+    }
+
+    if (!row_unknowns_.resize(rblen) || !row_queue_.resize(rblen)) {
+        return false;
+    }
+
+    // source symbols of row + two repair symbols
+    if (!members_.resize(sblen + 2) || !sources_.resize(sblen + 2)) {
+        return false;
+    }
+
+    if (!matrix_.build(sblen, rblen, prng_seed_, n1_)) {
+        return false;
+    }
+
+    sblen_ = sblen;
+    rblen_ = rblen;
+    payload_size_ = payload_size;
+
+    return true;
+}
+
+void LdpcStaircaseDecoder::set(size_t index, const core::Slice<uint8_t>& buffer) {
+    roc_panic_if_not(is_valid());
+
+    if (index >= sblen_ + rblen_) {
+        roc_panic("ldpc decoder: index out of bounds: index=%lu size=%lu",
+                  (unsigned long)index, (unsigned long)(sblen_ + rblen_));
+    }
+
+    if (!buffer) {
+        roc_panic("ldpc decoder: null buffer");
+    }
+
+    if (buffer.size() == 0 || buffer.size() != payload_size_) {
+        roc_panic("ldpc decoder: invalid payload size: cur=%lu new=%lu",
+                  (unsigned long)payload_size_, (unsigned long)buffer.size());
+    }
+
+    if (buff_tab_[index]) {
+        roc_panic("ldpc decoder: can't overwrite buffer: index=%lu",
+                  (unsigned long)index);
+    }
+
+    has_new_packets_ = true;
+
+    buff_tab_[index] = buffer;
+    recv_tab_[index] = true;
+}
+
+core::Slice<uint8_t> LdpcStaircaseDecoder::repair(size_t index) {
+    roc_panic_if_not(is_valid());
+
+    if (index >= sblen_ + rblen_) {
+        roc_panic("ldpc decoder: index out of bounds: index=%lu size=%lu",
+                  (unsigned long)index, (unsigned long)(sblen_ + rblen_));
+    }
+
+    if (!buff_tab_[index]) {
+        update_();
+    }
+
+    return buff_tab_[index];
+}
+
+void LdpcStaircaseDecoder::end() {
+    roc_panic_if_not(is_valid());
+
+    report_();
+    reset_tabs_();
+
+    has_new_packets_ = false;
+}
+
+bool LdpcStaircaseDecoder::resize_tabs_(size_t size) {
+    if (!buff_tab_.resize(size)) {
+        return false;
+    }
+    if (!recv_tab_.resize(size)) {
+        return false;
+    }
+    if (!status_.resize(size + 2)) {
+        return false;
+    }
+    if (!sym_unknowns_.resize(size)) {
+        return false;
+    }
+
+    return true;
+}
+
+void LdpcStaircaseDecoder::reset_tabs_() {
+    for (size_t i = 0; i < buff_tab_.size(); ++i) {
+        buff_tab_[i] = core::Slice<uint8_t>();
+        recv_tab_[i] = false;
+    }
+}
+
+void LdpcStaircaseDecoder::update_() {
+    if (!has_new_packets_) {
+        return;
+    }
+
+    has_new_packets_ = false;
+
+    if (count_lost_source_() == 0) {
+        return;
+    }
+
+    decode_iterative_();
+
+    if (count_lost_source_() == 0) {
+        return;
+    }
+
+    // Not enough symbols to solve system of equations.
+    if (count_received_() < sblen_) {
+        return;
+    }
+
+    decode_gaussian_();
+}
+
+size_t LdpcStaircaseDecoder::count_lost_source_() const {
+    size_t n = 0;
+    for (size_t i = 0; i < sblen_; i++) {
+        if (!buff_tab_[i]) {
+            n++;
+        }
+    }
+    return n;
+}
+
+size_t LdpcStaircaseDecoder::count_received_() const {
+    size_t n = 0;
+    for (size_t i = 0; i < sblen_ + rblen_; i++) {
+        if (recv_tab_[i]) {
+            n++;
+        }
+    }
+    return n;
+}
+
+// Get indices of all symbols participating in row, including repair symbols
+// from staircase part of matrix. Indices are stored in members_.
+size_t LdpcStaircaseDecoder::get_row_members_(size_t row) {
+    const size_t row_size = matrix_.row_size(row);
+    const uint32_t* row_entries = matrix_.row_entries(row);
+
+    size_t n = 0;
+
+    for (size_t i = 0; i < row_size; i++) {
+        members_[n++] = row_entries[i];
+    }
+
+    members_[n++] = (uint32_t)(sblen_ + row);
+    if (row > 0) {
+        members_[n++] = (uint32_t)(sblen_ + row - 1);
+    }
+
+    return n;
+}
+
+// Compute sum of all known symbols from members_ and store it to dst.
+void LdpcStaircaseDecoder::sum_known_members_(size_t n_members, uint8_t* dst) {
+    size_t n_sources = 0;
+
+    for (size_t i = 0; i < n_members; i++) {
+        if (buff_tab_[members_[i]]) {
+            sources_[n_sources++] = buff_tab_[members_[i]].data();
+        }
+    }
+
+    if (n_sources == 0) {
+        memset(dst, 0, payload_size_);
+        return;
+    }
+
+    memcpy(dst, sources_[0], payload_size_);
+
+    size_t i = 1;
+    for (; i + 1 < n_sources; i += 2) {
+        symbol_xor2(dst, sources_[i], sources_[i + 1], payload_size_);
+    }
+    if (i < n_sources) {
+        symbol_xor(dst, sources_[i], payload_size_);
+    }
+}
+
+// Repeatedly find rows with exactly one unknown symbol and compute
+// this symbol as a sum of other symbols of the row.
+void LdpcStaircaseDecoder::decode_iterative_() {
+    size_t n_queued = 0;
+
+    for (size_t row = 0; row < rblen_; row++) {
+        const size_t n_members = get_row_members_(row);
+
+        uint32_t n_unknowns = 0;
+        for (size_t i = 0; i < n_members; i++) {
+            if (!buff_tab_[members_[i]]) {
+                n_unknowns++;
+            }
+        }
+
+        row_unknowns_[row] = n_unknowns;
+        if (n_unknowns == 1) {
+            row_queue_[n_queued++] = (uint32_t)row;
+        }
+    }
+
+    while (n_queued != 0) {
+        const size_t row = row_queue_[--n_queued];
+        if (row_unknowns_[row] != 1) {
+            continue;
+        }
+
+        const size_t n_members = get_row_members_(row);
+
+        size_t sym = 0;
+        for (size_t i = 0; i < n_members; i++) {
+            if (!buff_tab_[members_[i]]) {
+                sym = members_[i];
+                break;
+            }
+        }
+
+        core::Slice<uint8_t> buffer = make_buffer_();
+        if (!buffer) {
+            return;
+        }
+
+        sum_known_members_(n_members, buffer.data());
+        buff_tab_[sym] = buffer;
+
+        roc_log(LogTrace, "ldpc decoder: repaired symbol: index=%lu row=%lu",
+                (unsigned long)sym, (unsigned long)row);
+
+        // Update rows in which repaired symbol participates.
+        if (sym < sblen_) {
+            const size_t col_size = matrix_.column_size(sym);
+            const uint32_t* col_entries = matrix_.column_entries(sym);
+
+            for (size_t i = 0; i < col_size; i++) {
+                if (--row_unknowns_[col_entries[i]] == 1) {
+                    row_queue_[n_queued++] = col_entries[i];
+                }
+            }
+        } else {
+            const size_t repair_row = sym - sblen_;
+
+            if (--row_unknowns_[repair_row] == 1) {
+                row_queue_[n_queued++] = (uint32_t)repair_row;
+            }
+            if (repair_row + 1 < rblen_ && --row_unknowns_[repair_row + 1] == 1) {
+                row_queue_[n_queued++] = (uint32_t)(repair_row + 1);
+            }
+        }
+    }
+}
+
+// Solve system of equations formed by rows with unknown symbols using
+// Gauss-Jordan elimination over GF(2).
+void LdpcStaircaseDecoder::decode_gaussian_() {
+    // Number unknown symbols.
+    unknown_syms_.clear();
+
+    for (size_t sym = 0; sym < sblen_ + rblen_; sym++) {
+        if (buff_tab_[sym]) {
+            sym_unknowns_[sym] = NoUnknown;
+            continue;
+        }
+        sym_unknowns_[sym] = (uint32_t)unknown_syms_.size();
+        if (!unknown_syms_.push_back((uint32_t)sym)) {
+            return;
+        }
+    }
+
+    // Select rows with unknown symbols.
+    eq_rows_.clear();
+
+    for (size_t row = 0; row < rblen_; row++) {
+        if (row_unknowns_[row] != 0) {
+            if (!eq_rows_.push_back((uint32_t)row)) {
+                return;
+            }
+        }
+    }
+
+    const size_t n_unknowns = unknown_syms_.size();
+    const size_t n_eqs = eq_rows_.size();
+    const size_t n_words = (n_unknowns + 63) / 64;
+
+    roc_log(LogTrace, "ldpc decoder: starting gaussian elimination: unknowns=%lu eqs=%lu",
+            (unsigned long)n_unknowns, (unsigned long)n_eqs);
+
+    if (!eq_bits_.resize(n_eqs * n_words) || !eq_values_.resize(n_eqs * payload_size_)) {
+        roc_log(LogError, "ldpc decoder: can't allocate memory for gaussian elimination");
+        return;
+    }
+
+    // Build equations: sum of unknown symbols of row equals to sum of known ones.
+    // After that, eq_rows_ is reused to store order of equations.
+    for (size_t eq = 0; eq < n_eqs; eq++) {
+        uint64_t* bits = &eq_bits_[eq * n_words];
+        for (size_t w = 0; w < n_words; w++) {
+            bits[w] = 0;
+        }
+
+        const size_t n_members = get_row_members_(eq_rows_[eq]);
+
+        for (size_t i = 0; i < n_members; i++) {
+            const uint32_t unknown = sym_unknowns_[members_[i]];
+            if (unknown != NoUnknown) {
+                bit_set(bits, unknown);
+            }
+        }
+
+        sum_known_members_(n_members, &eq_values_[eq * payload_size_]);
+
+        eq_rows_[eq] = (uint32_t)eq;
+    }
+
+    // Reduce matrix.
+    size_t rank = 0;
+
+    for (size_t col = 0; col < n_unknowns && rank < n_eqs; col++) {
+        size_t pivot = rank;
+        while (pivot < n_eqs && !bit_get(&eq_bits_[eq_rows_[pivot] * n_words], col)) {
+            pivot++;
+        }
+        if (pivot == n_eqs) {
+            continue;
+        }
+
+        const uint32_t tmp = eq_rows_[rank];
+        eq_rows_[rank] = eq_rows_[pivot];
+        eq_rows_[pivot] = tmp;
+
+        const size_t pivot_eq = eq_rows_[rank];
+        const uint64_t* pivot_bits = &eq_bits_[pivot_eq * n_words];
+        const uint8_t* pivot_value = &eq_values_[pivot_eq * payload_size_];
+
+        for (size_t i = 0; i < n_eqs; i++) {
+            if (i == rank) {
+                continue;
+            }
+
+            uint64_t* bits = &eq_bits_[eq_rows_[i] * n_words];
+            if (!bit_get(bits, col)) {
+                continue;
+            }
+
+            for (size_t w = col / 64; w < n_words; w++) {
+                bits[w] ^= pivot_bits[w];
+            }
+            symbol_xor(&eq_values_[eq_rows_[i] * payload_size_], pivot_value,
+                       payload_size_);
+        }
+
+        rank++;
+    }
+
+    // Symbol is solved if its equation has no other unknowns.
+    for (size_t i = 0; i < rank; i++) {
+        const size_t eq = eq_rows_[i];
+        const uint64_t* bits = &eq_bits_[eq * n_words];
+
+        size_t unknown = NoUnknown;
+        size_t n_bits = 0;
+
+        for (size_t w = 0; w < n_words && n_bits < 2; w++) {
+            for (uint64_t word = bits[w]; word != 0 && n_bits < 2; word &= word - 1) {
+                if (n_bits++ == 0) {
+                    size_t pos = 0;
+                    while (!((word >> pos) & 1)) {
+                        pos++;
+                    }
+                    unknown = w * 64 + pos;
+                }
+            }
+        }
+
+        if (n_bits != 1) {
+            continue;
+        }
+
+        const size_t sym = unknown_syms_[unknown];
+        if (sym >= sblen_) {
+            continue;
+        }
+
+        core::Slice<uint8_t> buffer = make_buffer_();
+        if (!buffer) {
+            return;
+        }
+
+        memcpy(buffer.data(), &eq_values_[eq * payload_size_], payload_size_);
+        buff_tab_[sym] = buffer;
+
+        roc_log(LogTrace, "ldpc decoder: repaired symbol with elimination: index=%lu",
+                (unsigned long)sym);
+    }
+}
+
+core::Slice<uint8_t> LdpcStaircaseDecoder::make_buffer_() {
+    core::Slice<uint8_t> buffer = packet_factory_.new_packet_buffer();
+
+    if (!buffer) {
+        roc_log(LogError, "ldpc decoder: can't allocate buffer");
+        return core::Slice<uint8_t>();
+    }
+
+    if (buffer.capacity() < payload_size_) {
+        roc_log(LogError, "ldpc decoder: packet size too large: size=%lu max=%lu",
+                (unsigned long)payload_size_, (unsigned long)buffer.capacity());
+        return core::Slice<uint8_t>();
+    }
+
+    buffer.reslice(0, payload_size_);
+
+    return buffer;
+}
+
+void LdpcStaircaseDecoder::report_() {
+    const size_t tab_size = sblen_ + rblen_;
+
+    size_t n_lost = 0, n_repaired = 0;
+
+    for (size_t i = 0; i < tab_size; ++i) {
+        char* status = (i < sblen_ ? &status_[i] : &status_[i + 1]);
+
+        if (buff_tab_[i]) {
+            if (recv_tab_[i]) {
+                *status = '.';
+            } else {
+                *status = 'r';
+                n_repaired++;
+                n_lost++;
+            }
+        } else {
+            if (i < sblen_) {
+                *status = 'X';
+            } else {
+                *status = 'x';
+            }
+            n_lost++;
+        }
+    }
+
+    if (n_lost == 0) {
+        return;
+    }
+
+    status_[sblen_] = ' ';
+    status_[tab_size + 1] = '\0';
+
+    roc_log(LogDebug, "ldpc decoder: repaired %u/%u/%u %s", (unsigned)n_repaired,
+            (unsigned)n_lost, (unsigned)tab_size, &status_[0]);
+}
+
+} // namespace fec
+} // namespace roc
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/ldpc_staircase_decoder.h
+//! @brief Built-in LDPC-Staircase decoder.
+
+#ifndef ROC_FEC_LDPC_STAIRCASE_DECODER_H_
+#define ROC_FEC_LDPC_STAIRCASE_DECODER_H_
+
+#include "roc_core/array.h"
+#include "roc_core/iarena.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/slice.h"
+#include "roc_fec/codec_config.h"
+#include "roc_fec/iblock_decoder.h"
+#include "roc_fec/ldpc_staircase_matrix.h"
+#include "roc_packet/packet_factory.h"
+
+namespace roc {
+namespace fec {
+
+//! Built-in LDPC-Staircase decoder.
+//!
+//! Implements RFC 5170 without external dependencies. Compatible with
+//! OpenFEC and LdpcStaircaseEncoder.
+//!
+//! Decoding is performed in two steps:
+//!  - iterative decoding: every row of the parity check matrix with exactly
+//!    one unknown symbol gives the value of this symbol; this is repeated
+//!    while there are such rows;
+//!  - if there are still lost source symbols, and the number of known
+//!    symbols is enough, the remaining system of equations is solved using
+//!    Gaussian elimination over GF(2).
+//!
+//! The second step is slower, but it can repair symbols that iterative
+//! decoding can't, so that decoding is close to maximum likelihood.
+class LdpcStaircaseDecoder : public IBlockDecoder, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit LdpcStaircaseDecoder(const CodecConfig& config,
+                                  packet::PacketFactory& packet_factory,
+                                  core::IArena& arena);
+
+    virtual ~LdpcStaircaseDecoder();
+
+    //! Check if object is successfully constructed.
+    bool is_valid() const;
+
+    //! Get the maximum number of encoding symbols for the scheme being used.
+    virtual size_t max_block_length() const;
+
+    //! Start block.
+    virtual bool begin(size_t sblen, size_t rblen, size_t payload_size);
+
+    //! Store source or repair packet buffer for current block.
+    virtual void set(size_t index, const core::Slice<uint8_t>& buffer);
+
+    //! Repair source packet buffer.
+    virtual core::Slice<uint8_t> repair(size_t index);
+
+    //! Finish block.
+    virtual void end();
+
+private:
+    enum { MaxBlockLength = 50000 };
+
+    bool resize_tabs_(size_t size);
+    void reset_tabs_();
+
+    void update_();
+
+    size_t count_lost_source_() const;
+    size_t count_received_() const;
+
+    size_t get_row_members_(size_t row);
+    void sum_known_members_(size_t n_members, uint8_t* dst);
+
+    void decode_iterative_();
+    void decode_gaussian_();
+
+    core::Slice<uint8_t> make_buffer_();
+
+    void report_();
+
+    size_t sblen_;
+    size_t rblen_;
+
+    size_t payload_size_;
+
+    uint32_t prng_seed_;
+    size_t n1_;
+
+    packet::PacketFactory& packet_factory_;
+
+    LdpcStaircaseMatrix matrix_;
+
+    core::Array<core::Slice<uint8_t> > buff_tab_;
+    core::Array<bool> recv_tab_;
+    core::Array<char> status_;
+
+    // temporary state of iterative decoding
+    core::Array<uint32_t> row_unknowns_;
+    core::Array<uint32_t> row_queue_;
+    core::Array<uint32_t> members_;
+    core::Array<const uint8_t*> sources_;
+
+    // temporary state of gaussian elimination
+    core::Array<uint32_t> unknown_syms_;
+    core::Array<uint32_t> sym_unknowns_;
+    core::Array<uint32_t> eq_rows_;
+    core::Array<uint64_t> eq_bits_;
+    core::Array<uint8_t> eq_values_;
+
+    bool has_new_packets_;
+
+    bool valid_;
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_LDPC_STAIRCASE_DECODER_H_
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_fec/ldpc_staircase_encoder.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_fec/symbol_ops.h"
+
+namespace roc {
+namespace fec {
+
+LdpcStaircaseEncoder::LdpcStaircaseEncoder(const CodecConfig& config,
+                                           packet::PacketFactory&,
+                                           core::IArena& arena)
+    : sblen_(0)
+    , rblen_(0)
+    , payload_size_(0)
+    , prng_seed_((uint32_t)config.ldpc_prng_seed)
+    , n1_(config.ldpc_N1)
+    , matrix_(arena)
+    , buff_tab_(arena)
+    , valid_(false) {
+    if (config.scheme != packet::FEC_LDPC_Staircase) {
+        roc_panic("ldpc encoder: unexpected fec scheme");
+    }
+
+    roc_log(LogDebug, "ldpc encoder: initializing: prng_seed=%ld n1=%d",
+            (long)config.ldpc_prng_seed, (int)config.ldpc_N1);
+
+    if (config.ldpc_prng_seed <= 0 || config.ldpc_prng_seed == 0x7FFFFFFF
+        || config.ldpc_N1 == 0) {
+        roc_log(LogError, "ldpc encoder: invalid parameters: prng_seed=%ld n1=%d",
+                (long)config.ldpc_prng_seed, (int)config.ldpc_N1);
+        return;
+    }
+
+    valid_ = true;
+}
+
+LdpcStaircaseEncoder::~LdpcStaircaseEncoder() {
+}
+
+bool LdpcStaircaseEncoder::is_valid() const {
+    return valid_;
+}
+
+size_t LdpcStaircaseEncoder::alignment() const {
+    return Alignment;
+}
+
+size_t LdpcStaircaseEncoder::max_block_length() const {
+    roc_panic_if_not(is_valid());
+
+    return MaxBlockLength;
+}
+
+bool LdpcStaircaseEncoder::begin(size_t sblen, size_t rblen, size_t payload_size) {
+    roc_panic_if_not(is_valid());
+
+    if (!buff_tab_.resize(sblen + rblen)) {
+        return false;
+    }
+
+    if (!matrix_.build(sblen, rblen, prng_seed_, n1_)) {
+        return false;
+    }
+
+    sblen_ = sblen;
+    rblen_ = rblen;
+    payload_size_ = payload_size;
+
+    return true;
+}
+
+void LdpcStaircaseEncoder::set(size_t index, const core::Slice<uint8_t>& buffer) {
+    roc_panic_if_not(is_valid());
+
+    if (index >= sblen_ + rblen_) {
+        roc_panic("ldpc encoder: can't write more than %lu data buffers",
+                  (unsigned long)(sblen_ + rblen_));
+    }
+
+    if (!buffer) {
+        roc_panic("ldpc encoder: null buffer");
+    }
+
+    if (buffer.size() == 0 || buffer.size() != payload_size_) {
+        roc_panic("ldpc encoder: invalid payload size: cur=%lu new=%lu",
+                  (unsigned long)payload_size_, (unsigned long)buffer.size());
+    }
+
+    if ((uintptr_t)buffer.data() % Alignment != 0) {
+        roc_panic("ldpc encoder: buffer data should be %d-byte aligned: index=%lu",
+                  (int)Alignment, (unsigned long)index);
+    }
+
+    buff_tab_[index] = buffer;
+}
+
+void LdpcStaircaseEncoder::fill() {
+    roc_panic_if_not(is_valid());
+
+    for (size_t i = 0; i < sblen_ + rblen_; i++) {
+        if (!buff_tab_[i]) {
+            roc_panic("ldpc encoder: missing buffer: index=%lu", (unsigned long)i);
+        }
+    }
+
+    for (size_t row = 0; row < rblen_; row++) {
+        uint8_t* repair = buff_tab_[sblen_ + row].data();
+
+        // Staircase: every repair symbol includes the previous one.
+        if (row == 0) {
+            memset(repair, 0, payload_size_);
+        } else {
+            memcpy(repair, buff_tab_[sblen_ + row - 1].data(), payload_size_);
+        }
+
+        const size_t row_size = matrix_.row_size(row);
+        const uint32_t* row_entries = matrix_.row_entries(row);
+
+        size_t n = 0;
+        for (; n + 1 < row_size; n += 2) {
+            symbol_xor2(repair, buff_tab_[row_entries[n]].data(),
+                        buff_tab_[row_entries[n + 1]].data(), payload_size_);
+        }
+        if (n < row_size) {
+            symbol_xor(repair, buff_tab_[row_entries[n]].data(), payload_size_);
+        }
+    }
+}
+
+void LdpcStaircaseEncoder::end() {
+    roc_panic_if_not(is_valid());
+
+    for (size_t i = 0; i < buff_tab_.size(); ++i) {
+        buff_tab_[i] = core::Slice<uint8_t>();
+    }
+}
+
+} // namespace fec
+} // namespace roc
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/ldpc_staircase_encoder.h
+//! @brief Built-in LDPC-Staircase encoder.
+
+#ifndef ROC_FEC_LDPC_STAIRCASE_ENCODER_H_
+#define ROC_FEC_LDPC_STAIRCASE_ENCODER_H_
+
+#include "roc_core/array.h"
+#include "roc_core/iarena.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/slice.h"
+#include "roc_fec/codec_config.h"
+#include "roc_fec/iblock_encoder.h"
+#include "roc_fec/ldpc_staircase_matrix.h"
+#include "roc_packet/packet_factory.h"
+
+namespace roc {
+namespace fec {
+
+//! Built-in LDPC-Staircase encoder.
+//!
+//! Implements RFC 5170 without external dependencies. Produces the same
+//! repair symbols as OpenFEC for the same parameters.
+//!
+//! Repair symbol i is computed as a sum over GF(2) of repair symbol i-1 and
+//! source symbols from row i of the parity check matrix.
+class LdpcStaircaseEncoder : public IBlockEncoder, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit LdpcStaircaseEncoder(const CodecConfig& config,
+                                  packet::PacketFactory& packet_factory,
+                                  core::IArena& arena);
+
+    virtual ~LdpcStaircaseEncoder();
+
+    //! Check if object is successfully constructed.
+    bool is_valid() const;
+
+    //! Get buffer alignment requirement.
+    virtual size_t alignment() const;
+
+    //! Get the maximum number of encoding symbols for the scheme being used.
+    virtual size_t max_block_length() const;
+
+    //! Start block.
+    virtual bool begin(size_t sblen, size_t rblen, size_t payload_size);
+
+    //! Store packet data for current block.
+    virtual void set(size_t index, const core::Slice<uint8_t>& buffer);
+
+    //! Fill repair packets.
+    virtual void fill();
+
+    //! Finish block.
+    virtual void end();
+
+private:
+    enum { Alignment = 8 };
+
+    enum { MaxBlockLength = 50000 };
+
+    size_t sblen_;
+    size_t rblen_;
+
+    size_t payload_size_;
+
+    uint32_t prng_seed_;
+    size_t n1_;
+
+    LdpcStaircaseMatrix matrix_;
+
+    core::Array<core::Slice<uint8_t> > buff_tab_;
+
+    bool valid_;
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_LDPC_STAIRCASE_ENCODER_H_
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_fec/ldpc_staircase_matrix.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace fec {
+
+LdpcStaircaseMatrix::Random::Random(uint32_t seed)
+    : seed_(seed) {
+}
+
+// See RFC 5170, section 5.7.
+uint32_t LdpcStaircaseMatrix::Random::next(uint32_t max_val) {
+    uint32_t lo = 16807 * (seed_ & 0xFFFF);
+    const uint32_t hi = 16807 * (seed_ >> 16);
+
+    lo += (hi & 0x7FFF) << 16;
+    lo += hi >> 15;
+
+    if (lo > 0x7FFFFFFF) {
+        lo -= 0x7FFFFFFF;
+    }
+
+    seed_ = lo;
+
+    // Don't use modulo, because least significant bits are less random.
+    return (uint32_t)((double)lo * (double)max_val / (double)0x7FFFFFFF);
+}
+
+LdpcStaircaseMatrix::LdpcStaircaseMatrix(core::IArena& arena)
+    : n_source_(0)
+    , n_repair_(0)
+    , seed_(0)
+    , n1_(0)
+    , built_(false)
+    , entry_rows_(arena)
+    , entry_cols_(arena)
+    , row_degree_(arena)
+    , row_last_col_(arena)
+    , choices_(arena)
+    , row_offsets_(arena)
+    , row_entries_(arena)
+    , col_offsets_(arena)
+    , col_entries_(arena) {
+}
+
+bool LdpcStaircaseMatrix::build(size_t n_source,
+                                size_t n_repair,
+                                uint32_t seed,
+                                size_t n1) {
+    if (built_ && n_source_ == n_source && n_repair_ == n_repair && seed_ == seed
+        && n1_ == n1) {
+        return true;
+    }
+
+    roc_panic_if_msg(seed == 0 || seed >= 0x7FFFFFFF,
+                     "ldpc staircase matrix: seed should be in range [1; 2^31-2]");
+    roc_panic_if_msg(n1 == 0, "ldpc staircase matrix: n1 should be positive");
+
+    built_ = false;
+
+    n_source_ = n_source;
+    n_repair_ = n_repair;
+    seed_ = seed;
+    n1_ = n1;
+
+    if (!build_left_(seed, n1)) {
+        return false;
+    }
+
+    if (!build_index_()) {
+        return false;
+    }
+
+    roc_log(LogTrace,
+            "ldpc staircase matrix: built matrix: k=%lu n-k=%lu n1=%lu n_entries=%lu",
+            (unsigned long)n_source_, (unsigned long)n_repair_, (unsigned long)n1_,
+            (unsigned long)entry_rows_.size());
+
+    built_ = true;
+    return true;
+}
+
+// Check if column has entry in given row.
+// Only entries inserted starting from col_begin are checked, and they all
+// should belong to column.
+bool LdpcStaircaseMatrix::has_entry_(size_t col_begin, size_t row, size_t col) const {
+    for (size_t n = col_begin; n < entry_rows_.size(); n++) {
+        roc_panic_if(entry_cols_[n] != col);
+        if (entry_rows_[n] == row) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool LdpcStaircaseMatrix::insert_entry_(size_t row, size_t col) {
+    if (!entry_rows_.push_back((uint32_t)row) || !entry_cols_.push_back((uint32_t)col)) {
+        return false;
+    }
+
+    row_degree_[row]++;
+    row_last_col_[row] = (uint32_t)col;
+
+    return true;
+}
+
+// Build left part of matrix, see RFC 5170, section 5.6.
+bool LdpcStaircaseMatrix::build_left_(uint32_t seed, size_t n1) {
+    entry_rows_.clear();
+    entry_cols_.clear();
+
+    if (!row_degree_.resize(n_repair_) || !row_last_col_.resize(n_repair_)) {
+        return false;
+    }
+
+    for (size_t row = 0; row < n_repair_; row++) {
+        row_degree_[row] = 0;
+        row_last_col_[row] = 0;
+    }
+
+    if (n_source_ == 0 || n_repair_ == 0) {
+        return true;
+    }
+
+    // Column can't have more ones than there are rows.
+    // This deviates from RFC 5170, which requires N1 <= n-k. The resulting
+    // matrix is the same as for N1 = n-k, so it's compatible with peers
+    // configured this way.
+    if (n1 > n_repair_) {
+        n1 = n_repair_;
+    }
+
+    const size_t n_choices = n1 * n_source_;
+
+    if (!entry_rows_.grow(n_choices + n_repair_ * 2)
+        || !entry_cols_.grow(n_choices + n_repair_ * 2)) {
+        return false;
+    }
+
+    // Initialize a list of all possible choices in order to guarantee
+    // a homogeneous "1" distribution.
+    if (!choices_.resize(n_choices)) {
+        return false;
+    }
+
+    for (size_t h = 0; h < n_choices; h++) {
+        choices_[h] = (uint32_t)(h % n_repair_);
+    }
+
+    Random rand(seed);
+
+    // Initialize the matrix with n1 "1s" per column, homogeneously.
+    size_t t = 0;
+
+    for (size_t col = 0; col < n_source_; col++) {
+        const size_t col_begin = entry_rows_.size();
+
+        for (size_t h = 0; h < n1; h++) {
+            // Check that valid available choices remain.
+            size_t i = t;
+            while (i < n_choices && has_entry_(col_begin, choices_[i], col)) {
+                i++;
+            }
+
+            if (i < n_choices) {
+                // Choose one index within the list of possible choices.
+                do {
+                    i = t + rand.next((uint32_t)(n_choices - t));
+                } while (has_entry_(col_begin, choices_[i], col));
+
+                if (!insert_entry_(choices_[i], col)) {
+                    return false;
+                }
+
+                // Replace with choices[t] which has never been chosen.
+                choices_[i] = choices_[t];
+                t++;
+            } else {
+                // No choice left, choose one randomly.
+                do {
+                    i = rand.next((uint32_t)n_repair_);
+                } while (has_entry_(col_begin, i, col));
+
+                if (!insert_entry_(i, col)) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    // Add extra bits to avoid rows with less than two "1s".
+    // This is needed when the code rate is smaller than 2/(2+n1).
+    for (size_t row = 0; row < n_repair_; row++) {
+        if (row_degree_[row] == 0) {
+            const size_t col = rand.next((uint32_t)n_source_);
+
+            if (!insert_entry_(row, col)) {
+                return false;
+            }
+        }
+
+        // With one source symbol, there is no second column to choose.
+        if (row_degree_[row] == 1 && n_source_ > 1) {
+            size_t col = 0;
+            do {
+                col = rand.next((uint32_t)n_source_);
+            } while (row_last_col_[row] == col);
+
+            if (!insert_entry_(row, col)) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Group entries by rows and by columns (counting sort).
+bool LdpcStaircaseMatrix::build_index_() {
+    const size_t n_entries = entry_rows_.size();
+
+    if (!row_offsets_.resize(n_repair_ + 1) || !col_offsets_.resize(n_source_ + 1)
+        || !row_entries_.resize(n_entries) || !col_entries_.resize(n_entries)) {
+        return false;
+    }
+
+    for (size_t row = 0; row <= n_repair_; row++) {
+        row_offsets_[row] = 0;
+    }
+    for (size_t col = 0; col <= n_source_; col++) {
+        col_offsets_[col] = 0;
+    }
+
+    for (size_t n = 0; n < n_entries; n++) {
+        row_offsets_[entry_rows_[n] + 1]++;
+        col_offsets_[entry_cols_[n] + 1]++;
+    }
+
+    for (size_t row = 0; row < n_repair_; row++) {
+        row_offsets_[row + 1] += row_offsets_[row];
+    }
+    for (size_t col = 0; col < n_source_; col++) {
+        col_offsets_[col + 1] += col_offsets_[col];
+    }
+
+    // Use row_degree_ and choices_ as insertion cursors, they're not needed
+    // after the left part is built.
+    if (!choices_.resize(n_source_)) {
+        return false;
+    }
+
+    for (size_t row = 0; row < n_repair_; row++) {
+        row_degree_[row] = 0;
+    }
+    for (size_t col = 0; col < n_source_; col++) {
+        choices_[col] = 0;
+    }
+
+    for (size_t n = 0; n < n_entries; n++) {
+        const uint32_t row = entry_rows_[n];
+        const uint32_t col = entry_cols_[n];
+
+        row_entries_[row_offsets_[row] + row_degree_[row]++] = col;
+        col_entries_[col_offsets_[col] + choices_[col]++] = row;
+    }
+
+    return true;
+}
+
+} // namespace fec
+} // namespace roc
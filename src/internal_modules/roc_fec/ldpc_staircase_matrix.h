@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/ldpc_staircase_matrix.h
+//! @brief LDPC-Staircase parity check matrix.
+
+#ifndef ROC_FEC_LDPC_STAIRCASE_MATRIX_H_
+#define ROC_FEC_LDPC_STAIRCASE_MATRIX_H_
+
+#include "roc_core/array.h"
+#include "roc_core/attributes.h"
+#include "roc_core/iarena.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace fec {
+
+//! LDPC-Staircase parity check matrix.
+//!
+//! Parity check matrix H has n-k rows and n columns, where k is the number of
+//! source symbols and n-k is the number of repair symbols. Left n-k x k part
+//! is a sparse pseudo-random matrix, right n-k x n-k part is a "staircase":
+//! row i has ones in columns k+i and k+i-1.
+//!
+//! Left part is built exactly as described in RFC 5170, sections 5.6 and 5.7,
+//! from the PRNG seed and N1 parameter, so that the code is interoperable with
+//! other implementations, e.g. OpenFEC.
+//!
+//! There is one deviation: RFC 5170 requires N1 to be not greater than n-k,
+//! so blocks with fewer repair symbols than N1 are outside of the RFC, and
+//! other implementations may reject them. Instead of failing, the matrix for
+//! such blocks is built with N1 reduced to n-k, which gives exactly the matrix
+//! defined by RFC for N1 = n-k. This allows to protect small blocks with the
+//! default N1; to interoperate with other implementations for such blocks,
+//! the peer should be configured with N1 = n-k.
+//!
+//! Only the left part is stored: for every row, the list of source symbols
+//! that participate in it, and for every source symbol, the list of rows
+//! it participates in.
+//!
+//! Memory is reused when the matrix is rebuilt; it's reallocated only when
+//! the new matrix is larger than any matrix before.
+class LdpcStaircaseMatrix : public core::NonCopyable<> {
+public:
+    //! Initialize empty matrix.
+    explicit LdpcStaircaseMatrix(core::IArena& arena);
+
+    //! Build matrix for given parameters.
+    //! @remarks
+    //!  Does nothing if the matrix was already built for the same parameters.
+    //! @returns
+    //!  false if allocation failed.
+    ROC_ATTR_NODISCARD bool
+    build(size_t n_source, size_t n_repair, uint32_t seed, size_t n1);
+
+    //! Get number of source symbols (k).
+    size_t num_source() const {
+        return n_source_;
+    }
+
+    //! Get number of repair symbols (n-k), which is also the number of rows.
+    size_t num_repair() const {
+        return n_repair_;
+    }
+
+    //! Get number of source symbols in row.
+    size_t row_size(size_t row) const {
+        return row_offsets_[row + 1] - row_offsets_[row];
+    }
+
+    //! Get indices of source symbols in row.
+    const uint32_t* row_entries(size_t row) const {
+        return row_entries_.data() + row_offsets_[row];
+    }
+
+    //! Get number of rows in which source symbol participates.
+    size_t column_size(size_t col) const {
+        return col_offsets_[col + 1] - col_offsets_[col];
+    }
+
+    //! Get indices of rows in which source symbol participates.
+    const uint32_t* column_entries(size_t col) const {
+        return col_entries_.data() + col_offsets_[col];
+    }
+
+private:
+    // Park-Miller "minimal standard" PRNG, as defined in RFC 5170.
+    class Random {
+    public:
+        explicit Random(uint32_t seed);
+
+        // Get random value in range [0; max_val).
+        uint32_t next(uint32_t max_val);
+
+    private:
+        uint32_t seed_;
+    };
+
+    bool has_entry_(size_t col_begin, size_t row, size_t col) const;
+    bool insert_entry_(size_t row, size_t col);
+
+    bool build_left_(uint32_t seed, size_t n1);
+    bool build_index_();
+
+    size_t n_source_;
+    size_t n_repair_;
+    uint32_t seed_;
+    size_t n1_;
+    bool built_;
+
+    // matrix entries in order of insertion
+    core::Array<uint32_t> entry_rows_;
+    core::Array<uint32_t> entry_cols_;
+
+    // number of entries in every row, and last inserted column in every row
+    core::Array<uint32_t> row_degree_;
+    core::Array<uint32_t> row_last_col_;
+
+    // list of choices for homogeneous distribution of ones (u[] in RFC)
+    core::Array<uint32_t> choices_;
+
+    // entries grouped by row and by column
+    core::Array<uint32_t> row_offsets_;
+    core::Array<uint32_t> row_entries_;
+    core::Array<uint32_t> col_offsets_;
+    core::Array<uint32_t> col_entries_;
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_LDPC_STAIRCASE_MATRIX_H_
@@ -36,6 +36,7 @@ Reader::Reader(const ReaderConfig& config,
     , alive_(true)
     , started_(false)
     , can_repair_(false)
+    , repair_enabled_(true)
     , next_packet_(0)
     , cur_sbn_(0)
     , payload_size_(0)
@@ -60,6 +61,18 @@ bool Reader::is_alive() const {
     return alive_;
 }
 
+void Reader::set_repair_enabled(bool enabled) {
+    roc_panic_if_not(is_valid());
+
+    if (repair_enabled_ == enabled) {
+        return;
+    }
+
+    roc_log(LogDebug, "fec reader: %s repair", enabled ? "enabling" : "disabling");
+
+    repair_enabled_ = enabled;
+}
+
 status::StatusCode Reader::read(packet::PacketPtr& pp) {
     roc_panic_if_not(is_valid());
 
@@ -173,7 +186,7 @@ status::StatusCode Reader::get_next_packet_(packet::PacketPtr& ptr) {
         }
     } while (!pp);
 
-    ptr = pp;
+    pp.transfer_to(ptr);
 
     return status::StatusOK;
 }
@@ -202,7 +215,7 @@ void Reader::next_block_() {
 }
 
 void Reader::try_repair_() {
-    if (!can_repair_) {
+    if (!can_repair_ || !repair_enabled_) {
         return;
     }
 
@@ -224,7 +237,14 @@ void Reader::try_repair_() {
         if (!source_block_[n]) {
             continue;
         }
-        decoder_.set(n, source_block_[n]->fec()->payload);
+        const packet::PacketPtr& pp = source_block_[n];
+        if (pp->has_flags(packet::Packet::FlagRestored)) {
+            // Restored during previous attempt in this block, there is no
+            // FEC header, and the whole buffer is the decoded symbol.
+            decoder_.set(n, pp->buffer());
+        } else {
+            decoder_.set(n, pp->fec()->payload);
+        }
     }
 
     for (size_t n = 0; n < repair_block_.size(); n++) {
@@ -332,8 +352,8 @@ void Reader::fill_source_block_() {
             break;
         }
 
-        packet::PacketPtr p;
-        const status::StatusCode code = source_queue_.read(p);
+        // Replaces pp with the same packet, now owned by us instead of queue.
+        const status::StatusCode code = source_queue_.read(pp);
         roc_panic_if_msg(code != status::StatusOK,
                          "failed to read source packet: status=%s",
                          status::code_to_str(code));
@@ -371,7 +391,7 @@ void Reader::fill_source_block_() {
 
         if (!source_block_[p_num]) {
             can_repair_ = true;
-            source_block_[p_num] = pp;
+            pp.transfer_to(source_block_[p_num]);
             n_added++;
         }
     }
@@ -401,8 +421,8 @@ void Reader::fill_repair_block_() {
             break;
         }
 
-        packet::PacketPtr p;
-        const status::StatusCode code = repair_queue_.read(p);
+        // Replaces pp with the same packet, now owned by us instead of queue.
+        const status::StatusCode code = repair_queue_.read(pp);
         roc_panic_if_msg(code != status::StatusOK,
                          "failed to read repair packet: status=%s",
                          status::code_to_str(code));
@@ -441,7 +461,7 @@ void Reader::fill_repair_block_() {
 
         if (!repair_block_[p_num]) {
             can_repair_ = true;
-            repair_block_[p_num] = pp;
+            pp.transfer_to(repair_block_[p_num]);
             n_added++;
         }
     }
@@ -66,6 +66,13 @@ public:
     //! Is decoder alive?
     bool is_alive() const;
 
+    //! Enable or disable repairing lost packets.
+    //! @remarks
+    //!  Repair is enabled by default. When disabled, repair packets are still
+    //!  consumed and dropped, but decoder is not invoked, and lost source
+    //!  packets are skipped. Used to save CPU under overload.
+    void set_repair_enabled(bool enabled);
+
     //! Read packet.
     //! @remarks
     //!  When a packet loss is detected, try to restore it from repair packets.
@@ -126,6 +133,7 @@ private:
     bool alive_;
     bool started_;
     bool can_repair_;
+    bool repair_enabled_;
 
     size_t next_packet_;
     packet::blknum_t cur_sbn_;
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_fec/symbol_ops.h"
+#include "roc_core/cpu_dispatch.h"
+#include "roc_core/macro_helpers.h"
+
+#if defined(ROC_CPU_X86_KERNELS)
+#include <immintrin.h>
+#endif
+
+#if defined(ROC_CPU_NEON_KERNELS)
+#include <arm_neon.h>
+#endif
+
+namespace roc {
+namespace fec {
+
+namespace {
+
+typedef void (*XorFunc)(uint8_t* dst, const uint8_t* src, size_t size);
+typedef void (*Xor2Func)(uint8_t* dst,
+                         const uint8_t* src1,
+                         const uint8_t* src2,
+                         size_t size);
+
+// Number of bytes processed by one iteration of vector loop.
+enum { VectorSize = 64 };
+
+// memcpy() is used for unaligned access, compilers turn it into plain loads and
+// stores where this is allowed.
+void xor_generic(uint8_t* dst, const uint8_t* src, size_t size) {
+    size_t n = 0;
+
+    for (; n + 8 <= size; n += 8) {
+        uint64_t d, s;
+        memcpy(&d, dst + n, 8);
+        memcpy(&s, src + n, 8);
+        d ^= s;
+        memcpy(dst + n, &d, 8);
+    }
+
+    for (; n < size; n++) {
+        dst[n] ^= src[n];
+    }
+}
+
+void xor2_generic(uint8_t* dst, const uint8_t* src1, const uint8_t* src2, size_t size) {
+    size_t n = 0;
+
+    for (; n + 8 <= size; n += 8) {
+        uint64_t d, s1, s2;
+        memcpy(&d, dst + n, 8);
+        memcpy(&s1, src1 + n, 8);
+        memcpy(&s2, src2 + n, 8);
+        d ^= s1 ^ s2;
+        memcpy(dst + n, &d, 8);
+    }
+
+    for (; n < size; n++) {
+        dst[n] ^= src1[n] ^ src2[n];
+    }
+}
+
+#if defined(ROC_CPU_X86_KERNELS)
+
+ROC_ATTR_TARGET("sse2")
+void xor_sse2(uint8_t* dst, const uint8_t* src, size_t size) {
+    size_t n = 0;
+
+    for (; n + VectorSize <= size; n += VectorSize) {
+        for (size_t i = n; i < n + VectorSize; i += 16) {
+            const __m128i d = _mm_loadu_si128((const __m128i*)(dst + i));
+            const __m128i s = _mm_loadu_si128((const __m128i*)(src + i));
+            _mm_storeu_si128((__m128i*)(dst + i), _mm_xor_si128(d, s));
+        }
+    }
+
+    xor_generic(dst + n, src + n, size - n);
+}
+
+ROC_ATTR_TARGET("sse2")
+void xor2_sse2(uint8_t* dst, const uint8_t* src1, const uint8_t* src2, size_t size) {
+    size_t n = 0;
+
+    for (; n + VectorSize <= size; n += VectorSize) {
+        for (size_t i = n; i < n + VectorSize; i += 16) {
+            const __m128i d = _mm_loadu_si128((const __m128i*)(dst + i));
+            const __m128i s1 = _mm_loadu_si128((const __m128i*)(src1 + i));
+            const __m128i s2 = _mm_loadu_si128((const __m128i*)(src2 + i));
+            _mm_storeu_si128((__m128i*)(dst + i),
+                             _mm_xor_si128(d, _mm_xor_si128(s1, s2)));
+        }
+    }
+
+    xor2_generic(dst + n, src1 + n, src2 + n, size - n);
+}
+
+ROC_ATTR_TARGET("avx2")
+void xor_avx2(uint8_t* dst, const uint8_t* src, size_t size) {
+    size_t n = 0;
+
+    for (; n + VectorSize <= size; n += VectorSize) {
+        for (size_t i = n; i < n + VectorSize; i += 32) {
+            const __m256i d = _mm256_loadu_si256((const __m256i*)(dst + i));
+            const __m256i s = _mm256_loadu_si256((const __m256i*)(src + i));
+            _mm256_storeu_si256((__m256i*)(dst + i), _mm256_xor_si256(d, s));
+        }
+    }
+
+    xor_generic(dst + n, src + n, size - n);
+}
+
+ROC_ATTR_TARGET("avx2")
+void xor2_avx2(uint8_t* dst, const uint8_t* src1, const uint8_t* src2, size_t size) {
+    size_t n = 0;
+
+    for (; n + VectorSize <= size; n += VectorSize) {
+        for (size_t i = n; i < n + VectorSize; i += 32) {
+            const __m256i d = _mm256_loadu_si256((const __m256i*)(dst + i));
+            const __m256i s1 = _mm256_loadu_si256((const __m256i*)(src1 + i));
+            const __m256i s2 = _mm256_loadu_si256((const __m256i*)(src2 + i));
+            _mm256_storeu_si256((__m256i*)(dst + i),
+                                _mm256_xor_si256(d, _mm256_xor_si256(s1, s2)));
+        }
+    }
+
+    xor2_generic(dst + n, src1 + n, src2 + n, size - n);
+}
+
+#endif // ROC_CPU_X86_KERNELS
+
+#if defined(ROC_CPU_NEON_KERNELS)
+
+void xor_neon(uint8_t* dst, const uint8_t* src, size_t size) {
+    size_t n = 0;
+
+    for (; n + VectorSize <= size; n += VectorSize) {
+        for (size_t i = n; i < n + VectorSize; i += 16) {
+            vst1q_u8(dst + i, veorq_u8(vld1q_u8(dst + i), vld1q_u8(src + i)));
+        }
+    }
+
+    xor_generic(dst + n, src + n, size - n);
+}
+
+void xor2_neon(uint8_t* dst, const uint8_t* src1, const uint8_t* src2, size_t size) {
+    size_t n = 0;
+
+    for (; n + VectorSize <= size; n += VectorSize) {
+        for (size_t i = n; i < n + VectorSize; i += 16) {
+            vst1q_u8(dst + i,
+                     veorq_u8(vld1q_u8(dst + i),
+                              veorq_u8(vld1q_u8(src1 + i), vld1q_u8(src2 + i))));
+        }
+    }
+
+    xor2_generic(dst + n, src1 + n, src2 + n, size - n);
+}
+
+#endif // ROC_CPU_NEON_KERNELS
+
+const core::CpuKernel<XorFunc> xor_kernels[] = {
+#if defined(ROC_CPU_X86_KERNELS)
+    { core::CpuIsa_AVX2, xor_avx2 },
+    { core::CpuIsa_SSE2, xor_sse2 },
+#endif
+#if defined(ROC_CPU_NEON_KERNELS)
+    { core::CpuIsa_NEON, xor_neon },
+#endif
+    { core::CpuIsa_Generic, xor_generic },
+};
+
+const core::CpuKernel<Xor2Func> xor2_kernels[] = {
+#if defined(ROC_CPU_X86_KERNELS)
+    { core::CpuIsa_AVX2, xor2_avx2 },
+    { core::CpuIsa_SSE2, xor2_sse2 },
+#endif
+#if defined(ROC_CPU_NEON_KERNELS)
+    { core::CpuIsa_NEON, xor2_neon },
+#endif
+    { core::CpuIsa_Generic, xor2_generic },
+};
+
+core::CpuDispatcher<XorFunc>
+    xor_dispatcher("symbol_xor", xor_kernels, ROC_ARRAY_SIZE(xor_kernels));
+
+core::CpuDispatcher<Xor2Func>
+    xor2_dispatcher("symbol_xor2", xor2_kernels, ROC_ARRAY_SIZE(xor2_kernels));
+
+} // namespace
+
+void symbol_xor(uint8_t* dst, const uint8_t* src, size_t size) {
+    xor_dispatcher.get()(dst, src, size);
+}
+
+void symbol_xor2(uint8_t* dst, const uint8_t* src1, const uint8_t* src2, size_t size) {
+    xor2_dispatcher.get()(dst, src1, src2, size);
+}
+
+} // namespace fec
+} // namespace roc
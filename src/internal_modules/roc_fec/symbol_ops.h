@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/symbol_ops.h
+//! @brief Operations on encoding symbols.
+
+#ifndef ROC_FEC_SYMBOL_OPS_H_
+#define ROC_FEC_SYMBOL_OPS_H_
+
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace fec {
+
+//! Add one symbol to another over GF(2).
+//! @remarks
+//!  Computes dst[i] ^= src[i] for every byte. Uses AVX2, SSE2, or NEON when
+//!  supported by CPU (see core::CpuFeatures), and 64-bit words otherwise.
+//!  Buffers don't need to be aligned, but aligned buffers are processed faster.
+void symbol_xor(uint8_t* dst, const uint8_t* src, size_t size);
+
+//! Add two symbols to third one over GF(2).
+//! @remarks
+//!  Computes dst[i] ^= src1[i] ^ src2[i] for every byte. Equivalent to two
+//!  symbol_xor() calls, but passes over @p dst only once.
+void symbol_xor2(uint8_t* dst, const uint8_t* src1, const uint8_t* src2, size_t size);
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_SYMBOL_OPS_H_
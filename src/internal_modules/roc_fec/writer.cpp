@@ -38,6 +38,16 @@ Writer::Writer(const WriterConfig& config,
     , first_packet_(true)
     , cur_packet_(0)
     , fec_scheme_(fec_scheme)
+    , background_(config.enable_background_encoding)
+    , block_a_(arena)
+    , block_b_(arena)
+    , cur_block_(&block_a_)
+    , pending_block_(&block_b_)
+    , pending_state_(Block_Idle)
+    , pending_failed_(false)
+    , stop_(false)
+    , cond_(mutex_)
+    , thread_(*this)
     , valid_(false)
     , alive_(true) {
     cur_sbn_ = (packet::blknum_t)core::fast_random_range(0, packet::blknum_t(-1));
@@ -46,9 +56,16 @@ Writer::Writer(const WriterConfig& config,
     if (!resize(config.n_source_packets, config.n_repair_packets)) {
         return;
     }
+    if (background_ && !start_thread_()) {
+        return;
+    }
     valid_ = true;
 }
 
+Writer::~Writer() {
+    stop_thread_();
+}
+
 bool Writer::is_valid() const {
     return valid_;
 }
@@ -95,6 +112,10 @@ status::StatusCode Writer::write(const packet::PacketPtr& pp) {
     roc_panic_if_not(is_valid());
     roc_panic_if_not(pp);
 
+    if (background_) {
+        collect_block_(false);
+    }
+
     if (!alive_) {
         // TODO(gh-183): return StatusDead
         return status::StatusOK;
@@ -132,6 +153,20 @@ status::StatusCode Writer::write(const packet::PacketPtr& pp) {
     return status::StatusOK;
 }
 
+status::StatusCode Writer::flush() {
+    roc_panic_if_not(is_valid());
+
+    if (background_) {
+        collect_block_(false);
+    }
+
+    return status::StatusOK;
+}
+
+WriterMetrics Writer::metrics() const {
+    return metrics_;
+}
+
 bool Writer::begin_block_(const packet::PacketPtr& pp) {
     if (!apply_sizes_(next_sblen_, next_rblen_, pp->fec()->payload.size())) {
         return false;
@@ -142,6 +177,18 @@ bool Writer::begin_block_(const packet::PacketPtr& pp) {
             (unsigned long)cur_sbn_, (unsigned long)cur_sblen_, (unsigned long)cur_rblen_,
             (unsigned long)cur_payload_size_);
 
+    if (background_) {
+        // encoder is used only by background thread
+        if (!cur_block_->source.resize(cur_sblen_)) {
+            roc_log(LogError,
+                    "fec writer: can't allocate source block memory, shutting down:"
+                    " sblen=%lu",
+                    (unsigned long)cur_sblen_);
+            return (alive_ = false);
+        }
+        return true;
+    }
+
     if (!encoder_.begin(cur_sblen_, cur_rblen_, cur_payload_size_)) {
         roc_log(LogError,
                 "fec writer: can't begin encoder block, shutting down:"
@@ -154,12 +201,19 @@ bool Writer::begin_block_(const packet::PacketPtr& pp) {
 }
 
 void Writer::end_block_() {
+    if (background_) {
+        submit_block_();
+        return;
+    }
+
     make_repair_packets_();
     encode_repair_packets_();
     compose_repair_packets_();
     write_repair_packets_();
 
     encoder_.end();
+
+    metrics_.encoded_blocks++;
 }
 
 void Writer::next_block_() {
@@ -192,7 +246,11 @@ bool Writer::apply_sizes_(size_t sblen, size_t rblen, size_t payload_size) {
 }
 
 status::StatusCode Writer::write_source_packet_(const packet::PacketPtr& pp) {
-    encoder_.set(cur_packet_, pp->fec()->payload);
+    if (background_) {
+        cur_block_->source[cur_packet_] = pp;
+    } else {
+        encoder_.set(cur_packet_, pp->fec()->payload);
+    }
 
     fill_packet_fec_fields_(pp, (packet::seqnum_t)cur_packet_);
 
@@ -340,5 +398,217 @@ bool Writer::validate_source_packet_(const packet::PacketPtr& pp) {
     return true;
 }
 
+Writer::EncoderThread::EncoderThread(Writer& writer)
+    : writer_(writer) {
+}
+
+void Writer::EncoderThread::run() {
+    writer_.run_thread_();
+}
+
+bool Writer::start_thread_() {
+    roc_log(LogDebug, "fec writer: starting background encoding thread");
+
+    if (!thread_.start()) {
+        roc_log(LogError, "fec writer: can't start background encoding thread");
+        return false;
+    }
+
+    return true;
+}
+
+void Writer::stop_thread_() {
+    if (!thread_.is_joinable()) {
+        return;
+    }
+
+    {
+        core::Mutex::Lock lock(mutex_);
+
+        stop_ = true;
+        cond_.broadcast();
+    }
+
+    thread_.join();
+}
+
+void Writer::run_thread_() {
+    for (;;) {
+        Block* block = NULL;
+
+        {
+            core::Mutex::Lock lock(mutex_);
+
+            while (!stop_ && pending_state_ != Block_Encoding) {
+                cond_.wait();
+            }
+
+            if (stop_) {
+                return;
+            }
+
+            block = pending_block_;
+        }
+
+        const core::nanoseconds_t start_time = core::thread_cpu_timestamp();
+        const bool ok = encode_block_(*block);
+        block->encode_cpu_time = core::thread_cpu_timestamp() - start_time;
+
+        {
+            core::Mutex::Lock lock(mutex_);
+
+            pending_failed_ = !ok;
+            pending_state_ = Block_Ready;
+            cond_.broadcast();
+        }
+    }
+}
+
+// Called from write() when current block is complete.
+// Passes block to background thread.
+void Writer::submit_block_() {
+    // Ensure that there is at most one block in flight, which bounds
+    // repair latency and memory usage.
+    collect_block_(true);
+
+    if (!alive_) {
+        return;
+    }
+
+    make_repair_packets_();
+
+    if (!cur_block_->repair.resize(cur_rblen_)) {
+        roc_log(LogError,
+                "fec writer: can't allocate repair block memory, shutting down:"
+                " rblen=%lu",
+                (unsigned long)cur_rblen_);
+        for (size_t i = 0; i < cur_rblen_; i++) {
+            repair_block_[i] = NULL;
+        }
+        alive_ = false;
+        return;
+    }
+
+    for (size_t i = 0; i < cur_rblen_; i++) {
+        repair_block_[i].transfer_to(cur_block_->repair[i]);
+    }
+
+    cur_block_->sblen = cur_sblen_;
+    cur_block_->rblen = cur_rblen_;
+    cur_block_->payload_size = cur_payload_size_;
+    cur_block_->complete_time = core::timestamp(core::ClockMonotonic);
+
+    core::Mutex::Lock lock(mutex_);
+
+    Block* block = pending_block_;
+    pending_block_ = cur_block_;
+    cur_block_ = block;
+
+    pending_state_ = Block_Encoding;
+    cond_.broadcast();
+}
+
+// Called from background thread.
+bool Writer::encode_block_(Block& block) {
+    if (!encoder_.begin(block.sblen, block.rblen, block.payload_size)) {
+        return false;
+    }
+
+    for (size_t i = 0; i < block.sblen; i++) {
+        encoder_.set(i, block.source[i]->fec()->payload);
+    }
+
+    for (size_t i = 0; i < block.rblen; i++) {
+        if (block.repair[i]) {
+            encoder_.set(block.sblen + i, block.repair[i]->fec()->payload);
+        }
+    }
+
+    encoder_.fill();
+
+    for (size_t i = 0; i < block.rblen; i++) {
+        packet::PacketPtr& rp = block.repair[i];
+        if (!rp) {
+            continue;
+        }
+
+        if (!repair_composer_.compose(*rp)) {
+            // TODO(gh-183): return status from composer
+            roc_panic("fec writer: can't compose repair packet");
+        }
+        rp->add_flags(packet::Packet::FlagComposed);
+    }
+
+    encoder_.end();
+
+    return true;
+}
+
+// Write repair packets of block encoded by background thread, if any.
+// If wait is true and block is still being encoded, waits for it.
+void Writer::collect_block_(bool wait) {
+    {
+        core::Mutex::Lock lock(mutex_);
+
+        if (pending_state_ == Block_Encoding) {
+            if (!wait) {
+                return;
+            }
+
+            roc_log(LogTrace, "fec writer: waiting for background encoding");
+            metrics_.encoder_waits++;
+
+            while (pending_state_ == Block_Encoding) {
+                cond_.wait();
+            }
+        }
+
+        if (pending_state_ != Block_Ready) {
+            return;
+        }
+
+        pending_state_ = Block_Idle;
+    }
+
+    Block& block = *pending_block_;
+
+    if (pending_failed_) {
+        roc_log(LogError,
+                "fec writer: can't begin encoder block, shutting down:"
+                " sblen=%lu rblen=%lu",
+                (unsigned long)block.sblen, (unsigned long)block.rblen);
+        alive_ = false;
+    } else {
+        for (size_t i = 0; i < block.rblen; i++) {
+            if (!block.repair[i]) {
+                continue;
+            }
+
+            const status::StatusCode code = writer_.write(block.repair[i]);
+            // TODO(gh-183): forward status
+            roc_panic_if(code != status::StatusOK);
+        }
+
+        const core::nanoseconds_t latency =
+            core::timestamp(core::ClockMonotonic) - block.complete_time;
+
+        metrics_.encoded_blocks++;
+        metrics_.repair_latency = latency;
+        if (metrics_.max_repair_latency < latency) {
+            metrics_.max_repair_latency = latency;
+        }
+        if (block.encode_cpu_time > 0) {
+            metrics_.encoder_cpu_time += block.encode_cpu_time;
+        }
+    }
+
+    for (size_t i = 0; i < block.sblen; i++) {
+        block.source[i] = NULL;
+    }
+    for (size_t i = 0; i < block.rblen; i++) {
+        block.repair[i] = NULL;
+    }
+}
+
 } // namespace fec
 } // namespace roc
@@ -13,9 +13,13 @@
 #define ROC_FEC_WRITER_H_
 
 #include "roc_core/array.h"
+#include "roc_core/cond.h"
 #include "roc_core/iarena.h"
+#include "roc_core/mutex.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/slice.h"
+#include "roc_core/thread.h"
+#include "roc_core/time.h"
 #include "roc_fec/iblock_encoder.h"
 #include "roc_packet/icomposer.h"
 #include "roc_packet/iwriter.h"
@@ -33,9 +37,52 @@ struct WriterConfig {
     //! Number of FEC packets in block.
     size_t n_repair_packets;
 
+    //! Encode repair packets in background thread.
+    //! @remarks
+    //!  If enabled, write() doesn't compute repair packets when a block is
+    //!  complete. Instead, the block is passed to a dedicated thread, and
+    //!  repair packets are written by one of the subsequent write() or flush()
+    //!  calls, as soon as they're ready. Source packets are never delayed.
+    //!  Only one block may be encoded at a time: if the next block is complete
+    //!  before repair packets for the previous one are ready, write() waits for
+    //!  them. Hence repair packets are delayed by at most one block.
+    bool enable_background_encoding;
+
     WriterConfig()
         : n_source_packets(18)
-        , n_repair_packets(10) {
+        , n_repair_packets(10)
+        , enable_background_encoding(false) {
+    }
+};
+
+//! FEC writer metrics.
+struct WriterMetrics {
+    //! Number of blocks for which repair packets were written.
+    uint64_t encoded_blocks;
+
+    //! Delay between writing last source packet of the block and writing
+    //! repair packets of the block, for the most recent block.
+    //! Always zero if background encoding is disabled.
+    core::nanoseconds_t repair_latency;
+
+    //! Maximum value of repair_latency.
+    core::nanoseconds_t max_repair_latency;
+
+    //! Number of times when write() had to wait for background thread
+    //! because encoding of the previous block was not finished yet.
+    uint64_t encoder_waits;
+
+    //! Total CPU time spent by background thread on encoding blocks
+    //! for which repair packets were written.
+    //! Always zero if background encoding is disabled.
+    core::nanoseconds_t encoder_cpu_time;
+
+    WriterMetrics()
+        : encoded_blocks(0)
+        , repair_latency(0)
+        , max_repair_latency(0)
+        , encoder_waits(0)
+        , encoder_cpu_time(0) {
     }
 };
 
@@ -62,6 +109,8 @@ public:
            packet::PacketFactory& packet_factory,
            core::IArena& arena);
 
+    ~Writer();
+
     //! Check if object is successfully constructed.
     bool is_valid() const;
 
@@ -74,10 +123,61 @@ public:
     //! Write packet.
     //! @remarks
     //!  - writes the given source packet to the output writer
-    //!  - generates repair packets and also writes them to the output writer
+    //!  - generates repair packets and also writes them to the output writer;
+    //!    if background encoding is enabled, repair packets are generated
+    //!    asynchronously and written by subsequent write() or flush() calls
     virtual ROC_ATTR_NODISCARD status::StatusCode write(const packet::PacketPtr&);
 
+    //! Write repair packets encoded in background, if they're ready.
+    //! @remarks
+    //!  Never blocks. Does nothing if background encoding is disabled.
+    ROC_ATTR_NODISCARD status::StatusCode flush();
+
+    //! Get metrics.
+    WriterMetrics metrics() const;
+
 private:
+    // Block passed to background thread.
+    struct Block {
+        core::Array<packet::PacketPtr> source;
+        core::Array<packet::PacketPtr> repair;
+
+        size_t sblen;
+        size_t rblen;
+        size_t payload_size;
+
+        core::nanoseconds_t complete_time;
+        core::nanoseconds_t encode_cpu_time;
+
+        explicit Block(core::IArena& arena)
+            : source(arena)
+            , repair(arena)
+            , sblen(0)
+            , rblen(0)
+            , payload_size(0)
+            , complete_time(0)
+            , encode_cpu_time(0) {
+        }
+    };
+
+    enum BlockState {
+        Block_Idle,     // no block is passed to thread
+        Block_Encoding, // thread is encoding block
+        Block_Ready     // repair packets are ready to be written
+    };
+
+    class EncoderThread : public core::Thread {
+    public:
+        explicit EncoderThread(Writer& writer);
+
+    private:
+        virtual void run();
+
+        Writer& writer_;
+    };
+
+    friend class EncoderThread;
+
     bool begin_block_(const packet::PacketPtr& pp);
     void end_block_();
     void next_block_();
@@ -95,6 +195,14 @@ private:
     void validate_fec_packet_(const packet::PacketPtr&);
     bool validate_source_packet_(const packet::PacketPtr&);
 
+    bool start_thread_();
+    void stop_thread_();
+    void run_thread_();
+
+    void submit_block_();
+    bool encode_block_(Block& block);
+    void collect_block_(bool wait);
+
     size_t cur_sblen_;
     size_t next_sblen_;
 
@@ -122,6 +230,21 @@ private:
 
     const packet::FecScheme fec_scheme_;
 
+    // background encoding
+    const bool background_;
+    Block block_a_;
+    Block block_b_;
+    Block* cur_block_;
+    Block* pending_block_;
+    BlockState pending_state_;
+    bool pending_failed_;
+    bool stop_;
+    core::Mutex mutex_;
+    core::Cond cond_;
+    EncoderThread thread_;
+
+    WriterMetrics metrics_;
+
     bool valid_;
     bool alive_;
 };
@@ -379,8 +379,8 @@ void UdpPort::write_sem_cb_(uv_async_t* handle) {
             continue;
         }
 
-        // will be decremented in send_cb_()
-        pp->incref();
+        // reference is passed to libuv and taken back in send_cb_()
+        pp.disown();
     }
 }
 
@@ -389,15 +389,11 @@ void UdpPort::send_cb_(uv_udp_send_t* req, int status) {
 
     UdpPort& self = *(UdpPort*)req->data;
 
-    packet::PacketPtr pp =
-        packet::Packet::container_of(ROC_CONTAINER_OF(req, packet::UDP, request));
+    // take back reference passed to libuv in write_sem_cb_()
+    packet::PacketPtr pp;
+    pp.adopt(packet::Packet::container_of(ROC_CONTAINER_OF(req, packet::UDP, request)));
 
-    // one reference for incref() called from write_sem_cb_()
-    // one reference for the shared pointer above
-    roc_panic_if(pp->getref() < 2);
-
-    // decrement reference counter incremented in write_sem_cb_()
-    pp->decref();
+    roc_panic_if(pp->getref() < 1);
 
     if (status < 0) {
         roc_log(LogError,
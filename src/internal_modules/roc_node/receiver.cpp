@@ -297,15 +297,23 @@ bool Receiver::get_metrics(slot_index_t slot_index,
         }
     }
 
-    pipeline::ReceiverLoop::Tasks::QuerySlot task(
-        slot->handle, slot_metrics_,
-        party_metrics_.size() != 0 ? party_metrics_.data() : NULL, party_metrics_size);
-    if (!pipeline_.schedule_and_wait(task)) {
-        roc_log(LogError,
-                "receiver node:"
-                " can't get metrics of slot %lu: operation failed",
-                (unsigned long)slot_index);
-        return false;
+    pipeline::ReceiverParticipantMetrics* party_metrics =
+        party_metrics_.size() != 0 ? party_metrics_.data() : NULL;
+
+    // Try to get latest snapshot published by pipeline, which doesn't
+    // block pipeline; fall back to querying pipeline directly if
+    // snapshot is not available yet.
+    if (!pipeline_.read_slot_snapshot(slot->handle, slot_metrics_, party_metrics,
+                                      party_metrics_size)) {
+        pipeline::ReceiverLoop::Tasks::QuerySlot task(slot->handle, slot_metrics_,
+                                                      party_metrics, party_metrics_size);
+        if (!pipeline_.schedule_and_wait(task)) {
+            roc_log(LogError,
+                    "receiver node:"
+                    " can't get metrics of slot %lu: operation failed",
+                    (unsigned long)slot_index);
+            return false;
+        }
     }
 
     if (slot_metrics_arg) {
@@ -322,6 +330,31 @@ bool Receiver::get_metrics(slot_index_t slot_index,
     return true;
 }
 
+status::StatusCode Receiver::read_session(slot_index_t slot_index,
+                                          packet::stream_source_t source_id,
+                                          audio::Frame& frame) {
+    core::Mutex::Lock lock(mutex_);
+
+    roc_panic_if_not(is_valid());
+
+    core::SharedPtr<Slot> slot = get_slot_(slot_index, false);
+    if (!slot) {
+        roc_log(LogError,
+                "receiver node:"
+                " can't read session of slot %lu: can't find slot",
+                (unsigned long)slot_index);
+        return status::StatusUnknown;
+    }
+
+    pipeline::ReceiverLoop::Tasks::ReadSession task(slot->handle, source_id, frame);
+    if (!pipeline_.schedule_and_wait(task)) {
+        // Task status tells whether there is no such session or reading failed.
+        return task.get_status();
+    }
+
+    return status::StatusOK;
+}
+
 bool Receiver::has_broken() {
     core::Mutex::Lock lock(mutex_);
 
@@ -337,6 +370,12 @@ bool Receiver::has_broken() {
     return false;
 }
 
+bool Receiver::get_timing_metrics(core::TickerMetrics& metrics) {
+    roc_panic_if_not(is_valid());
+
+    return pipeline_.get_timing_metrics(metrics);
+}
+
 sndio::ISource& Receiver::source() {
     return pipeline_.source();
 }
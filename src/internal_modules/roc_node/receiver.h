@@ -26,6 +26,7 @@
 #include "roc_node/node.h"
 #include "roc_pipeline/ipipeline_task_scheduler.h"
 #include "roc_pipeline/receiver_loop.h"
+#include "roc_status/status_code.h"
 
 namespace roc {
 namespace node {
@@ -75,9 +76,25 @@ public:
                                         size_t* party_metrics_size,
                                         void* party_metrics_arg);
 
+    //! Read frame from a single connection of the slot.
+    //! @remarks
+    //!  Connection is identified by source ID of remote sender.
+    //!  Requires unmixed output to be enabled in pipeline config.
+    //! @returns
+    //!  status::StatusOK if frame was read, status::StatusNoData if there is no
+    //!  such connection, or error code if reading failed.
+    ROC_ATTR_NODISCARD status::StatusCode read_session(slot_index_t slot_index,
+                                                       packet::stream_source_t source_id,
+                                                       audio::Frame& frame);
+
     //! Check if there are broken slots.
     bool has_broken();
 
+    //! Get metrics of internal clock.
+    //! @returns
+    //!  false if internal clock is not used.
+    bool get_timing_metrics(core::TickerMetrics& metrics);
+
     //! Get receiver source.
     sndio::ISource& source();
 
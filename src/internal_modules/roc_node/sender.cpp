@@ -301,15 +301,23 @@ bool Sender::get_metrics(slot_index_t slot_index,
         }
     }
 
-    pipeline::SenderLoop::Tasks::QuerySlot task(
-        slot->handle, slot_metrics_,
-        party_metrics_.size() != 0 ? party_metrics_.data() : NULL, party_metrics_size);
-    if (!pipeline_.schedule_and_wait(task)) {
-        roc_log(LogError,
-                "sender node:"
-                " can't get metrics of slot %lu: operation failed",
-                (unsigned long)slot_index);
-        return false;
+    pipeline::SenderParticipantMetrics* party_metrics =
+        party_metrics_.size() != 0 ? party_metrics_.data() : NULL;
+
+    // Try to get latest snapshot published by pipeline, which doesn't
+    // block pipeline; fall back to querying pipeline directly if
+    // snapshot is not available yet.
+    if (!pipeline_.read_slot_snapshot(slot->handle, slot_metrics_, party_metrics,
+                                      party_metrics_size)) {
+        pipeline::SenderLoop::Tasks::QuerySlot task(slot->handle, slot_metrics_,
+                                                    party_metrics, party_metrics_size);
+        if (!pipeline_.schedule_and_wait(task)) {
+            roc_log(LogError,
+                    "sender node:"
+                    " can't get metrics of slot %lu: operation failed",
+                    (unsigned long)slot_index);
+            return false;
+        }
     }
 
     if (slot_metrics_arg) {
@@ -368,6 +376,12 @@ bool Sender::has_broken() {
     return false;
 }
 
+bool Sender::get_timing_metrics(core::TickerMetrics& metrics) {
+    roc_panic_if_not(is_valid());
+
+    return pipeline_.get_timing_metrics(metrics);
+}
+
 sndio::ISink& Sender::sink() {
     roc_panic_if_not(is_valid());
 
@@ -83,6 +83,11 @@ public:
     //! Check if there are broken slots.
     bool has_broken();
 
+    //! Get metrics of internal clock.
+    //! @returns
+    //!  false if internal clock is not used.
+    bool get_timing_metrics(core::TickerMetrics& metrics);
+
     //! Get sender sink.
     sndio::ISink& sink();
 
@@ -26,11 +26,12 @@ status::StatusCode ConcurrentQueue::read(PacketPtr& ptr) {
         write_sem_->wait();
     }
 
-    ptr = queue_.pop_front_exclusive();
-    if (!ptr) {
+    PacketPtr packet = queue_.pop_front_exclusive();
+    if (!packet) {
         return status::StatusNoData;
     }
 
+    packet.transfer_to(ptr);
     return status::StatusOK;
 }
 
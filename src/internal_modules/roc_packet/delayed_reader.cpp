@@ -42,13 +42,9 @@ bool DelayedReader::is_valid() const {
 status::StatusCode DelayedReader::read(PacketPtr& ptr) {
     roc_panic_if(!valid_);
 
-    if (!started_) {
-        const status::StatusCode code = fetch_packets_();
-        if (code != status::StatusOK) {
-            return code;
-        }
-
-        started_ = true;
+    const status::StatusCode code = start_();
+    if (code != status::StatusOK) {
+        return code;
     }
 
     if (queue_.size() != 0) {
@@ -58,6 +54,20 @@ status::StatusCode DelayedReader::read(PacketPtr& ptr) {
     return reader_.read(ptr);
 }
 
+status::StatusCode DelayedReader::start_() {
+    if (started_) {
+        return status::StatusOK;
+    }
+
+    const status::StatusCode code = fetch_packets_();
+    if (code != status::StatusOK) {
+        return code;
+    }
+
+    started_ = true;
+    return status::StatusOK;
+}
+
 status::StatusCode DelayedReader::fetch_packets_() {
     PacketPtr pp;
     for (;;) {
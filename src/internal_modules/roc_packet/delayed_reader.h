@@ -44,6 +44,7 @@ public:
     virtual ROC_ATTR_NODISCARD status::StatusCode read(PacketPtr&);
 
 private:
+    status::StatusCode start_();
     status::StatusCode fetch_packets_();
     status::StatusCode read_queued_packet_(PacketPtr&);
 
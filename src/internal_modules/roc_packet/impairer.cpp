@@ -0,0 +1,360 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_packet/impairer.h"
+#include "roc_core/fast_random.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace packet {
+
+namespace {
+
+bool is_probability(float p) {
+    return p >= 0 && p <= 1;
+}
+
+} // namespace
+
+Impairer::Impairer(IWriter& writer,
+                   const ImpairerConfig& config,
+                   PacketFactory& packet_factory,
+                   core::IArena& arena)
+    : writer_(writer)
+    , packet_factory_(packet_factory)
+    , config_(config)
+    , heap_(arena)
+    , rng_state_(config.seed)
+    , bad_state_(false)
+    , link_free_time_(0)
+    , order_(0)
+    , valid_(false) {
+    if (rng_state_ == 0) {
+        rng_state_ = core::fast_random();
+    }
+
+    roc_log(LogDebug,
+            "impairer: initializing:"
+            " good_to_bad=%.4f bad_to_good=%.4f good_loss=%.4f bad_loss=%.4f"
+            " delay=%.3fms jitter=%.3fms reorder=%.4f duplicate=%.4f"
+            " max_bitrate=%lu max_backlog=%.3fms seed=%lu",
+            (double)config_.good_to_bad, (double)config_.bad_to_good,
+            (double)config_.good_loss, (double)config_.bad_loss,
+            (double)config_.delay / core::Millisecond,
+            (double)config_.jitter / core::Millisecond, (double)config_.reorder,
+            (double)config_.duplicate, (unsigned long)config_.max_bitrate,
+            (double)config_.max_backlog / core::Millisecond,
+            (unsigned long)rng_state_);
+
+    if (!is_probability(config_.good_to_bad) || !is_probability(config_.bad_to_good)
+        || !is_probability(config_.good_loss) || !is_probability(config_.bad_loss)
+        || !is_probability(config_.reorder) || !is_probability(config_.duplicate)
+        || config_.delay < 0 || config_.jitter < 0 || config_.max_backlog < 0) {
+        roc_log(LogError,
+                "impairer: invalid config:"
+                " probabilities should be in range [0; 1],"
+                " durations should be non-negative");
+        return;
+    }
+
+    valid_ = true;
+}
+
+bool Impairer::is_valid() const {
+    return valid_;
+}
+
+status::StatusCode Impairer::write(const PacketPtr& packet) {
+    roc_panic_if(!is_valid());
+
+    if (!packet) {
+        roc_panic("impairer: unexpected null packet");
+    }
+
+    pending_.push_back(*packet);
+    metrics_.written_packets++;
+
+    return status::StatusOK;
+}
+
+status::StatusCode Impairer::flush(core::nanoseconds_t current_time) {
+    roc_panic_if(!is_valid());
+
+    while (PacketPtr packet = pending_.front()) {
+        pending_.remove(*packet);
+
+        const status::StatusCode code = accept_(packet, current_time);
+        if (code != status::StatusOK) {
+            return code;
+        }
+    }
+
+    while (heap_.size() != 0 && heap_[0].deliver_time <= current_time) {
+        const Entry entry = heap_[0];
+        heap_pop_();
+
+        const status::StatusCode code = writer_.write(entry.packet);
+        if (code != status::StatusOK) {
+            return code;
+        }
+
+        const core::nanoseconds_t delay = entry.deliver_time - entry.accept_time;
+
+        metrics_.delivered_packets++;
+        metrics_.total_delay += delay;
+        if (metrics_.max_delay < delay) {
+            metrics_.max_delay = delay;
+        }
+    }
+
+    return status::StatusOK;
+}
+
+core::nanoseconds_t Impairer::flush_deadline() const {
+    roc_panic_if(!is_valid());
+
+    if (heap_.size() == 0) {
+        return 0;
+    }
+
+    return heap_[0].deliver_time;
+}
+
+ImpairerMetrics Impairer::metrics() const {
+    ImpairerMetrics metrics = metrics_;
+    metrics.queued_packets = pending_.size() + heap_.size();
+
+    return metrics;
+}
+
+// Pass packet through loss model and link, and schedule its delivery.
+status::StatusCode Impairer::accept_(const PacketPtr& packet,
+                                     core::nanoseconds_t current_time) {
+    if (lose_()) {
+        metrics_.lost_packets++;
+        return status::StatusOK;
+    }
+
+    // Packet occupies link for the time needed to transmit it, and waits
+    // while preceding packets are transmitted.
+    core::nanoseconds_t send_time = current_time;
+
+    if (config_.max_bitrate != 0) {
+        if (link_free_time_ > send_time) {
+            send_time = link_free_time_;
+        }
+
+        if (config_.max_backlog != 0 && send_time - current_time > config_.max_backlog) {
+            metrics_.overflow_packets++;
+            return status::StatusOK;
+        }
+
+        link_free_time_ = send_time
+            + core::nanoseconds_t((double)packet->buffer().size() * 8 * core::Second
+                                  / (double)config_.max_bitrate);
+    }
+
+    status::StatusCode code = schedule_(packet, current_time, send_time);
+    if (code != status::StatusOK) {
+        return code;
+    }
+
+    if (random_event_(config_.duplicate)) {
+        PacketPtr dup_packet = duplicate_(*packet);
+        if (!dup_packet) {
+            roc_log(LogError, "impairer: can't allocate duplicate packet");
+            return status::StatusNoMem;
+        }
+
+        code = schedule_(dup_packet, current_time, send_time);
+        if (code != status::StatusOK) {
+            return code;
+        }
+
+        metrics_.duplicated_packets++;
+    }
+
+    return status::StatusOK;
+}
+
+status::StatusCode Impairer::schedule_(const PacketPtr& packet,
+                                       core::nanoseconds_t current_time,
+                                       core::nanoseconds_t send_time) {
+    Entry entry;
+    entry.packet = packet;
+    entry.accept_time = current_time;
+    entry.deliver_time = send_time;
+    entry.order = order_++;
+
+    if (config_.delay != 0 && random_event_(config_.reorder)) {
+        metrics_.reordered_packets++;
+    } else {
+        entry.deliver_time += random_delay_();
+    }
+
+    if (!heap_push_(entry)) {
+        roc_log(LogError, "impairer: can't allocate delivery queue: size=%lu",
+                (unsigned long)heap_.size());
+        return status::StatusNoMem;
+    }
+
+    return status::StatusOK;
+}
+
+// Gilbert-Elliott model.
+bool Impairer::lose_() {
+    if (bad_state_) {
+        if (random_event_(config_.bad_to_good)) {
+            bad_state_ = false;
+        }
+    } else {
+        if (random_event_(config_.good_to_bad)) {
+            bad_state_ = true;
+        }
+    }
+
+    return random_event_(bad_state_ ? config_.bad_loss : config_.good_loss);
+}
+
+core::nanoseconds_t Impairer::random_delay_() {
+    if (config_.jitter == 0) {
+        return config_.delay;
+    }
+
+    double variation = 0;
+
+    switch (config_.jitter_distribution) {
+    case ImpairerJitter_Uniform:
+        variation = (random_unit_() * 2 - 1) * (double)config_.jitter;
+        break;
+
+    case ImpairerJitter_Normal: {
+        // Box-Muller transform, same as in fast_random_gaussian(), but
+        // using our own PRNG state.
+        double u1 = random_unit_();
+        if (u1 == 0) {
+            u1 = 1;
+        }
+        const double u2 = random_unit_();
+        variation = std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * M_PI * u2)
+            * (double)config_.jitter;
+    } break;
+    }
+
+    const core::nanoseconds_t delay =
+        config_.delay + core::nanoseconds_t(variation);
+
+    return delay > 0 ? delay : 0;
+}
+
+// Create packet that shares buffer and headers with given one.
+PacketPtr Impairer::duplicate_(const Packet& packet) {
+    PacketPtr dup_packet = packet_factory_.new_packet();
+    if (!dup_packet) {
+        return NULL;
+    }
+
+    dup_packet->add_flags(packet.flags());
+
+    if (packet.udp()) {
+        *dup_packet->udp() = *packet.udp();
+    }
+    if (packet.rtp()) {
+        *dup_packet->rtp() = *packet.rtp();
+    }
+    if (packet.fec()) {
+        *dup_packet->fec() = *packet.fec();
+    }
+    if (packet.rtcp()) {
+        *dup_packet->rtcp() = *packet.rtcp();
+    }
+
+    dup_packet->set_buffer(packet.buffer());
+
+    return dup_packet;
+}
+
+bool Impairer::random_event_(float probability) {
+    if (probability <= 0) {
+        return false;
+    }
+    if (probability >= 1) {
+        return true;
+    }
+    return random_unit_() < (double)probability;
+}
+
+// Returns random value in range [0; 1).
+double Impairer::random_unit_() {
+    return (double)core::fast_random_seeded(rng_state_) / ((double)UINT32_MAX + 1);
+}
+
+// Append element and restore heap order.
+bool Impairer::heap_push_(const Entry& entry) {
+    if (!heap_.push_back(entry)) {
+        return false;
+    }
+
+    size_t pos = heap_.size() - 1;
+
+    while (pos > 0) {
+        const size_t parent = (pos - 1) / 2;
+        if (!heap_less_(pos, parent)) {
+            break;
+        }
+        std::swap(heap_[pos], heap_[parent]);
+        pos = parent;
+    }
+
+    return true;
+}
+
+// Remove first element and restore heap order.
+void Impairer::heap_pop_() {
+    const size_t last = heap_.size() - 1;
+
+    if (last != 0) {
+        std::swap(heap_[0], heap_[last]);
+    }
+    heap_.pop_back();
+
+    const size_t size = heap_.size();
+    size_t pos = 0;
+
+    for (;;) {
+        const size_t left = pos * 2 + 1;
+        const size_t right = left + 1;
+
+        size_t smallest = pos;
+        if (left < size && heap_less_(left, smallest)) {
+            smallest = left;
+        }
+        if (right < size && heap_less_(right, smallest)) {
+            smallest = right;
+        }
+        if (smallest == pos) {
+            break;
+        }
+
+        std::swap(heap_[pos], heap_[smallest]);
+        pos = smallest;
+    }
+}
+
+// Earlier delivery time goes first; packets with same delivery time are
+// delivered in the order they were scheduled.
+bool Impairer::heap_less_(size_t a, size_t b) const {
+    if (heap_[a].deliver_time != heap_[b].deliver_time) {
+        return heap_[a].deliver_time < heap_[b].deliver_time;
+    }
+    return heap_[a].order < heap_[b].order;
+}
+
+} // namespace packet
+} // namespace roc
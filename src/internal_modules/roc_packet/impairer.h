@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_packet/impairer.h
+//! @brief Network impairment simulator.
+
+#ifndef ROC_PACKET_IMPAIRER_H_
+#define ROC_PACKET_IMPAIRER_H_
+
+#include "roc_core/array.h"
+#include "roc_core/iarena.h"
+#include "roc_core/list.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/time.h"
+#include "roc_packet/iwriter.h"
+#include "roc_packet/packet.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_status/status_code.h"
+
+namespace roc {
+namespace packet {
+
+//! Distribution of packet delay variation.
+enum ImpairerJitter {
+    //! Delay is uniformly distributed in [delay - jitter; delay + jitter].
+    ImpairerJitter_Uniform,
+
+    //! Delay is normally distributed with mean delay and deviation jitter.
+    ImpairerJitter_Normal
+};
+
+//! Impairer parameters.
+//! @remarks
+//!  Losses are simulated using Gilbert-Elliott model: a Markov chain with
+//!  two states, "good" and "bad", each having its own loss probability.
+//!  Before each packet, impairer switches from good to bad state with
+//!  probability good_to_bad, and from bad to good state with probability
+//!  bad_to_good. Mean length of bad period is 1 / bad_to_good packets.
+//!  Setting good_to_bad to zero and good_loss to non-zero gives uniform
+//!  random losses; setting bad_loss to 1 gives Gilbert model.
+struct ImpairerConfig {
+    //! Enable impairment.
+    bool enable;
+
+    //! Probability of switching from good to bad state, in range [0; 1].
+    float good_to_bad;
+
+    //! Probability of switching from bad to good state, in range [0; 1].
+    float bad_to_good;
+
+    //! Probability of packet loss in good state, in range [0; 1].
+    float good_loss;
+
+    //! Probability of packet loss in bad state, in range [0; 1].
+    float bad_loss;
+
+    //! Fixed delay added to every packet.
+    core::nanoseconds_t delay;
+
+    //! Delay variation.
+    //! @remarks
+    //!  Meaning depends on jitter_distribution. Resulting delay is never
+    //!  negative. Independent per-packet delays naturally cause reordering
+    //!  when jitter is larger than packet interval.
+    core::nanoseconds_t jitter;
+
+    //! Distribution of delay variation.
+    ImpairerJitter jitter_distribution;
+
+    //! Probability of packet reordering, in range [0; 1].
+    //! @remarks
+    //!  Reordered packet skips delay and jitter and is delivered immediately,
+    //!  overtaking packets queued before it. Has effect only if delay is set.
+    float reorder;
+
+    //! Probability of packet duplication, in range [0; 1].
+    //! @remarks
+    //!  Duplicate gets its own delay, and thus may arrive before or after
+    //!  the original packet.
+    float duplicate;
+
+    //! Link capacity in bits per second.
+    //! @remarks
+    //!  Zero means unlimited. When set, packets are serialized at this rate,
+    //!  and bursts are spread in time before delay and jitter are applied.
+    uint64_t max_bitrate;
+
+    //! Maximum time packet may wait for link when max_bitrate is set.
+    //! @remarks
+    //!  Zero means unlimited. Packets that would wait longer are dropped,
+    //!  like in a router with limited buffer.
+    core::nanoseconds_t max_backlog;
+
+    //! Seed for random number generator.
+    //! @remarks
+    //!  Same seed produces same sequence of impairments for the same input.
+    //!  Zero means that a random seed is chosen.
+    uint32_t seed;
+
+    ImpairerConfig()
+        : enable(false)
+        , good_to_bad(0)
+        , bad_to_good(1)
+        , good_loss(0)
+        , bad_loss(1)
+        , delay(0)
+        , jitter(0)
+        , jitter_distribution(ImpairerJitter_Uniform)
+        , reorder(0)
+        , duplicate(0)
+        , max_bitrate(0)
+        , max_backlog(0)
+        , seed(0) {
+    }
+};
+
+//! Impairer metrics.
+struct ImpairerMetrics {
+    //! Number of packets written to impairer.
+    uint64_t written_packets;
+
+    //! Number of packets delivered to underlying writer, including duplicates.
+    uint64_t delivered_packets;
+
+    //! Number of packets dropped by loss model.
+    uint64_t lost_packets;
+
+    //! Number of packets dropped because link backlog exceeded max_backlog.
+    uint64_t overflow_packets;
+
+    //! Number of packets delivered out of delay schedule due to reorder.
+    uint64_t reordered_packets;
+
+    //! Number of duplicated packets.
+    uint64_t duplicated_packets;
+
+    //! Sum of delays of delivered packets.
+    //! @remarks
+    //!  Delay is measured from flush() that accepted packet until scheduled
+    //!  delivery time, and includes link backlog, delay, and jitter.
+    core::nanoseconds_t total_delay;
+
+    //! Maximum delay of delivered packet.
+    core::nanoseconds_t max_delay;
+
+    //! Number of packets currently waiting for delivery.
+    size_t queued_packets;
+
+    ImpairerMetrics()
+        : written_packets(0)
+        , delivered_packets(0)
+        , lost_packets(0)
+        , overflow_packets(0)
+        , reordered_packets(0)
+        , duplicated_packets(0)
+        , total_delay(0)
+        , max_delay(0)
+        , queued_packets(0) {
+    }
+};
+
+//! Network impairment simulator.
+//! @remarks
+//!  Simulates an unreliable network link between writer and underlying
+//!  writer: drops, delays, reorders, and duplicates packets, and limits
+//!  link bandwidth, according to config. Intended for soak testing and
+//!  performance characterization of pipelines, e.g. to measure how much
+//!  loss is recovered by FEC and which latency is needed for given jitter.
+//!
+//!  All random decisions are made using a PRNG with its own seed, so that
+//!  a run can be reproduced.
+//!
+//!  Like Pacer, impairer doesn't have its own thread or timer. Packets
+//!  passed to write() are accepted into the simulated link during next
+//!  flush() call, which also sends packets whose delivery time has come.
+//!  The user should periodically invoke flush() with current time, and may
+//!  use flush_deadline() to find out when the next call is needed.
+class Impairer : public IWriter, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @b Parameters
+    //!  - @p writer is used to deliver packets
+    //!  - @p config defines impairment parameters
+    //!  - @p packet_factory is used to allocate duplicated packets
+    //!  - @p arena is used to allocate delivery queue
+    Impairer(IWriter& writer,
+             const ImpairerConfig& config,
+             PacketFactory& packet_factory,
+             core::IArena& arena);
+
+    //! Check if object was constructed successfully.
+    bool is_valid() const;
+
+    //! Add packet to link.
+    //! @remarks
+    //!  Packet will be accepted by link during next flush() call.
+    virtual ROC_ATTR_NODISCARD status::StatusCode write(const PacketPtr& packet);
+
+    //! Accept written packets and deliver packets which are due.
+    //! @remarks
+    //!  @p current_time is current time in nanoseconds, in any clock domain,
+    //!  as long as it's the same for all calls.
+    ROC_ATTR_NODISCARD status::StatusCode flush(core::nanoseconds_t current_time);
+
+    //! Get deadline when flush() should be called next time.
+    //! @returns
+    //!  time in nanoseconds, or zero if there are no queued packets.
+    core::nanoseconds_t flush_deadline() const;
+
+    //! Get metrics.
+    ImpairerMetrics metrics() const;
+
+private:
+    struct Entry {
+        PacketPtr packet;
+        core::nanoseconds_t accept_time;
+        core::nanoseconds_t deliver_time;
+        uint64_t order;
+    };
+
+    status::StatusCode accept_(const PacketPtr& packet, core::nanoseconds_t current_time);
+    status::StatusCode schedule_(const PacketPtr& packet,
+                                 core::nanoseconds_t current_time,
+                                 core::nanoseconds_t send_time);
+
+    bool lose_();
+    core::nanoseconds_t random_delay_();
+    PacketPtr duplicate_(const Packet& packet);
+
+    bool random_event_(float probability);
+    double random_unit_();
+
+    bool heap_push_(const Entry& entry);
+    void heap_pop_();
+    bool heap_less_(size_t a, size_t b) const;
+
+    IWriter& writer_;
+    PacketFactory& packet_factory_;
+
+    const ImpairerConfig config_;
+
+    core::List<Packet> pending_;
+    core::Array<Entry> heap_;
+
+    uint32_t rng_state_;
+    bool bad_state_;
+
+    core::nanoseconds_t link_free_time_;
+    uint64_t order_;
+
+    ImpairerMetrics metrics_;
+
+    bool valid_;
+};
+
+} // namespace packet
+} // namespace roc
+
+#endif // ROC_PACKET_IMPAIRER_H_
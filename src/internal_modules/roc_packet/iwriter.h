@@ -13,6 +13,7 @@
 #define ROC_PACKET_IWRITER_H_
 
 #include "roc_core/attributes.h"
+#include "roc_core/stddefs.h"
 #include "roc_packet/packet.h"
 #include "roc_status/status_code.h"
 
@@ -32,6 +33,22 @@ public:
     //!
     //! @see status::StatusCode.
     virtual ROC_ATTR_NODISCARD status::StatusCode write(const PacketPtr&) = 0;
+
+    //! Write multiple packets.
+    //!
+    //! Writes @p n_packets packets from @p packets array, in order.
+    //!
+    //! Default implementation calls write() for every packet. Writers may
+    //! override it to process packets in bursts.
+    //!
+    //! @returns
+    //!  - If all packets were written, returns status::StatusOK;
+    //!  - Otherwise, returns the code of the first failed write; packets
+    //!    before the failed one are written, and the rest are not.
+    //!
+    //! @see status::StatusCode.
+    virtual ROC_ATTR_NODISCARD status::StatusCode write_batch(const PacketPtr* packets,
+                                                              size_t n_packets);
 };
 
 } // namespace packet
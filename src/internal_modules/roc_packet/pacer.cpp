@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_packet/pacer.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace packet {
+
+Pacer::Pacer(IWriter& writer,
+             const PacerConfig& config,
+             const audio::SampleSpec& sample_spec)
+    : writer_(writer)
+    , config_(config)
+    , sample_spec_(sample_spec)
+    , has_schedule_(false)
+    , schedule_time_(0)
+    , schedule_ts_(0)
+    , last_time_(0)
+    , next_burst_time_(0)
+    , burst_time_(0)
+    , burst_size_(0)
+    , sent_packets_(0)
+    , limited_bursts_(0)
+    , resyncs_(0)
+    , overflows_(0)
+    , valid_(false) {
+    roc_log(LogDebug,
+            "pacer: initializing:"
+            " max_burst=%lu burst_interval=%.3fms max_deviation=%.3fms"
+            " max_queue=%lu",
+            (unsigned long)config_.max_burst,
+            (double)config_.burst_interval / core::Millisecond,
+            (double)config_.max_deviation / core::Millisecond,
+            (unsigned long)config_.max_queue);
+
+    if (config_.max_burst == 0 || config_.burst_interval < 0
+        || config_.max_deviation <= 0 || config_.max_queue == 0) {
+        roc_log(LogError,
+                "pacer: invalid config:"
+                " max_burst=%lu burst_interval=%.3fms max_deviation=%.3fms"
+                " max_queue=%lu",
+                (unsigned long)config_.max_burst,
+                (double)config_.burst_interval / core::Millisecond,
+                (double)config_.max_deviation / core::Millisecond,
+                (unsigned long)config_.max_queue);
+        return;
+    }
+
+    valid_ = true;
+}
+
+bool Pacer::is_valid() const {
+    return valid_;
+}
+
+status::StatusCode Pacer::write(const PacketPtr& packet) {
+    roc_panic_if(!is_valid());
+
+    if (!packet) {
+        roc_panic("pacer: unexpected null packet");
+    }
+
+    if (queue_.size() >= config_.max_queue) {
+        // Queue is full, send oldest packet right now.
+        PacketPtr oldest = queue_.front();
+        queue_.remove(*oldest);
+
+        const status::StatusCode code = writer_.write(oldest);
+        if (code != status::StatusOK) {
+            return code;
+        }
+
+        sent_packets_++;
+        overflows_++;
+    }
+
+    queue_.push_back(*packet);
+
+    return status::StatusOK;
+}
+
+status::StatusCode Pacer::flush(core::nanoseconds_t current_time) {
+    roc_panic_if(!is_valid());
+
+    while (PacketPtr packet = queue_.front()) {
+        bool in_schedule = false;
+        const core::nanoseconds_t packet_time =
+            packet_time_(*packet, current_time, in_schedule);
+
+        // Time when packet is allowed to be sent, taking burst limit into account.
+        // It is computed from schedule, not from time when flush() is invoked,
+        // so if flush() is invoked later than requested, all packets that should
+        // have been sent by now are sent at once.
+        const core::nanoseconds_t send_time = std::max(packet_time, next_burst_time_);
+
+        if (send_time > current_time) {
+            if (packet_time <= current_time) {
+                limited_bursts_++;
+            }
+            break;
+        }
+
+        if (!in_schedule) {
+            // Start new schedule from this packet.
+            if (has_schedule_) {
+                roc_log(LogDebug, "pacer: restarting schedule: queue_size=%lu",
+                        (unsigned long)queue_.size());
+                resyncs_++;
+            }
+            has_schedule_ = true;
+            schedule_time_ = current_time;
+            schedule_ts_ = packet->stream_timestamp();
+        }
+
+        queue_.remove(*packet);
+
+        const status::StatusCode code = writer_.write(packet);
+        if (code != status::StatusOK) {
+            return code;
+        }
+
+        if (burst_size_ == 0 || send_time != burst_time_) {
+            // Start new burst.
+            burst_time_ = send_time;
+            burst_size_ = 0;
+        }
+        if (++burst_size_ == config_.max_burst) {
+            // Burst is full, next packet may be sent only after interval.
+            next_burst_time_ = burst_time_ + config_.burst_interval;
+            burst_size_ = 0;
+        }
+
+        last_time_ = packet_time;
+        sent_packets_++;
+    }
+
+    return status::StatusOK;
+}
+
+core::nanoseconds_t Pacer::flush_deadline(core::nanoseconds_t current_time) const {
+    roc_panic_if(!is_valid());
+
+    const Packet* packet = queue_.front().get();
+    if (!packet) {
+        return 0;
+    }
+
+    bool in_schedule = false;
+    const core::nanoseconds_t packet_time =
+        packet_time_(*packet, current_time, in_schedule);
+
+    return std::max(packet_time, next_burst_time_);
+}
+
+PacerMetrics Pacer::metrics() const {
+    PacerMetrics metrics;
+    metrics.sent_packets = sent_packets_;
+    metrics.limited_bursts = limited_bursts_;
+    metrics.resyncs = resyncs_;
+    metrics.overflows = overflows_;
+    metrics.queued_packets = queue_.size();
+
+    return metrics;
+}
+
+// Get time when packet should be sent.
+// If packet doesn't fit into current schedule, returns current time
+// and sets in_schedule to false.
+core::nanoseconds_t Pacer::packet_time_(const Packet& packet,
+                                        core::nanoseconds_t current_time,
+                                        bool& in_schedule) const {
+    if (!packet.rtp() || packet.has_flags(Packet::FlagRepair)) {
+        // Packets without own timestamp are sent right after preceding packet.
+        in_schedule = true;
+        return has_schedule_ ? last_time_ : current_time;
+    }
+
+    if (!has_schedule_) {
+        in_schedule = false;
+        return current_time;
+    }
+
+    const core::nanoseconds_t packet_time = schedule_time_
+        + sample_spec_.stream_timestamp_delta_2_ns(
+            stream_timestamp_diff(packet.stream_timestamp(), schedule_ts_));
+
+    if (packet_time < current_time - config_.max_deviation
+        || packet_time > current_time + config_.max_deviation) {
+        in_schedule = false;
+        return current_time;
+    }
+
+    in_schedule = true;
+    return packet_time;
+}
+
+} // namespace packet
+} // namespace roc
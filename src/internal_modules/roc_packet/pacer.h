@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_packet/pacer.h
+//! @brief Packet pacer.
+
+#ifndef ROC_PACKET_PACER_H_
+#define ROC_PACKET_PACER_H_
+
+#include "roc_audio/sample_spec.h"
+#include "roc_core/list.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/time.h"
+#include "roc_packet/iwriter.h"
+#include "roc_packet/packet.h"
+#include "roc_packet/units.h"
+#include "roc_status/status_code.h"
+
+namespace roc {
+namespace packet {
+
+//! Pacer parameters.
+struct PacerConfig {
+    //! Enable pacing.
+    bool enable;
+
+    //! Maximum number of packets sent back-to-back.
+    size_t max_burst;
+
+    //! Minimum interval between bursts.
+    //! @remarks
+    //!  When pacer sends max_burst packets, it waits at least this interval
+    //!  before sending more.
+    core::nanoseconds_t burst_interval;
+
+    //! Maximum deviation of packet schedule from actual time.
+    //! @remarks
+    //!  If a packet is scheduled earlier or later than this value from current
+    //!  time, which may happen after a pause in the stream or because of clock
+    //!  drift, pacer restarts schedule from current time.
+    core::nanoseconds_t max_deviation;
+
+    //! Maximum number of packets in queue.
+    //! @remarks
+    //!  If a packet is written when queue is full, the oldest queued packet is
+    //!  sent immediately, ahead of its schedule.
+    size_t max_queue;
+
+    PacerConfig()
+        : enable(false)
+        , max_burst(1)
+        , burst_interval(500 * core::Microsecond)
+        , max_deviation(50 * core::Millisecond)
+        , max_queue(64) {
+    }
+};
+
+//! Pacer metrics.
+struct PacerMetrics {
+    //! Number of packets sent.
+    uint64_t sent_packets;
+
+    //! Number of times when burst limit delayed sending due packets.
+    uint64_t limited_bursts;
+
+    //! Number of times when pacer restarted schedule.
+    uint64_t resyncs;
+
+    //! Number of packets sent ahead of schedule because queue was full.
+    uint64_t overflows;
+
+    //! Number of packets currently waiting in queue.
+    size_t queued_packets;
+
+    PacerMetrics()
+        : sent_packets(0)
+        , limited_bursts(0)
+        , resyncs(0)
+        , overflows(0)
+        , queued_packets(0) {
+    }
+};
+
+//! Packet pacer.
+//! @remarks
+//!  Queues packets written to it, and forwards them to the underlying writer
+//!  evenly spread in time, instead of sending all packets of a frame at once.
+//!
+//!  Each packet is scheduled according to its stream timestamp, relative to
+//!  the first packet. Packets without their own timestamp, e.g. repair packets,
+//!  are scheduled right after the preceding packet. Additionally, pacer never
+//!  sends more than max_burst packets back-to-back.
+//!
+//!  Pacer doesn't have its own thread or timer. The user should periodically
+//!  invoke flush() with current time, and may use flush_deadline() to find out
+//!  when the next call is needed. If flush() is invoked later than requested,
+//!  e.g. only once per frame, all packets which are due by that time are sent
+//!  at once, so that queue doesn't grow; pacing is then only as smooth as
+//!  flush() calls are. Queue size is additionally limited by max_queue.
+class Pacer : public IWriter, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @b Parameters
+    //!  - @p writer is used to send packets
+    //!  - @p config defines pacing parameters
+    //!  - @p sample_spec is the specifications of outgoing packets
+    Pacer(IWriter& writer,
+          const PacerConfig& config,
+          const audio::SampleSpec& sample_spec);
+
+    //! Check if object was constructed successfully.
+    bool is_valid() const;
+
+    //! Add packet to queue.
+    //! @remarks
+    //!  Packet will be sent during one of the following flush() calls.
+    virtual ROC_ATTR_NODISCARD status::StatusCode write(const PacketPtr& packet);
+
+    //! Send packets which are due.
+    //! @remarks
+    //!  @p current_time is current time in nanoseconds since Unix epoch.
+    ROC_ATTR_NODISCARD status::StatusCode flush(core::nanoseconds_t current_time);
+
+    //! Get deadline when flush() should be called next time.
+    //! @returns
+    //!  time in nanoseconds since Unix epoch, or zero if there are no queued packets.
+    core::nanoseconds_t flush_deadline(core::nanoseconds_t current_time) const;
+
+    //! Get metrics.
+    PacerMetrics metrics() const;
+
+private:
+    core::nanoseconds_t packet_time_(const Packet& packet,
+                                     core::nanoseconds_t current_time,
+                                     bool& in_schedule) const;
+
+    IWriter& writer_;
+    core::List<Packet> queue_;
+
+    const PacerConfig config_;
+    const audio::SampleSpec sample_spec_;
+
+    bool has_schedule_;
+    core::nanoseconds_t schedule_time_;
+    stream_timestamp_t schedule_ts_;
+
+    core::nanoseconds_t last_time_;
+    core::nanoseconds_t next_burst_time_;
+
+    core::nanoseconds_t burst_time_;
+    size_t burst_size_;
+
+    uint64_t sent_packets_;
+    uint64_t limited_bursts_;
+    uint64_t resyncs_;
+    uint64_t overflows_;
+
+    bool valid_;
+};
+
+} // namespace packet
+} // namespace roc
+
+#endif // ROC_PACKET_PACER_H_
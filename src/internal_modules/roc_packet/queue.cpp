@@ -13,11 +13,10 @@ namespace roc {
 namespace packet {
 
 status::StatusCode Queue::read(PacketPtr& packet) {
-    packet = list_.front();
-    if (!packet) {
+    if (list_.is_empty()) {
         return status::StatusNoData;
     }
-    list_.remove(*packet);
+    list_.pop_front().transfer_to(packet);
     return status::StatusOK;
 }
 
@@ -53,23 +53,74 @@ status::StatusCode Router::write(const PacketPtr& packet) {
         roc_panic("router: unexpected null packet");
     }
 
-    if (Route* route = find_route_(packet->flags())) {
-        if (allow_route_(*route, *packet)) {
-            if (packet->udp()) {
-                packet->udp()->queue_timestamp = core::timestamp(core::ClockUnix);
+    const core::nanoseconds_t queue_ts =
+        packet->udp() ? core::timestamp(core::ClockUnix) : 0;
+
+    if (Route* route = select_route_(*packet, queue_ts)) {
+        return route->writer->write(packet);
+    }
+
+    // TODO(gh-183): return status
+    return status::StatusOK;
+}
+
+status::StatusCode Router::write_batch(const PacketPtr* packets, size_t n_packets) {
+    // All packets of the batch arrived at the same time.
+    const core::nanoseconds_t queue_ts = core::timestamp(core::ClockUnix);
+
+    Route* run_route = NULL;
+    size_t run_begin = 0;
+
+    for (size_t n = 0; n < n_packets; n++) {
+        if (!packets[n]) {
+            roc_panic("router: unexpected null packet");
+        }
+
+        Route* route = select_route_(*packets[n], queue_ts);
+
+        if (run_route && route != run_route) {
+            const status::StatusCode code =
+                run_route->writer->write_batch(packets + run_begin, n - run_begin);
+            if (code != status::StatusOK) {
+                return code;
             }
+            run_route = NULL;
+        }
 
-            return route->writer->write(packet);
+        if (route && !run_route) {
+            run_route = route;
+            run_begin = n;
         }
     }
 
-    roc_log(LogDebug, "router: can't route packet, dropping: source=%lu flags=%s",
-            (unsigned long)packet->source_id(),
-            packet_flags_to_str(packet->flags()).c_str());
-    // TODO(gh-183): return status
+    if (run_route) {
+        return run_route->writer->write_batch(packets + run_begin,
+                                              n_packets - run_begin);
+    }
+
     return status::StatusOK;
 }
 
+// Find route for the packet and update packet's queue timestamp.
+// Returns NULL if packet should be dropped.
+Router::Route* Router::select_route_(Packet& packet, core::nanoseconds_t queue_ts) {
+    if (Route* route = find_route_(packet.flags())) {
+        if (allow_route_(*route, packet)) {
+            if (packet.udp()) {
+                packet.udp()->queue_timestamp = queue_ts;
+            }
+
+            return route;
+        }
+    }
+
+    roc_log(LogDebug, "router: can't route packet, dropping: source=%lu flags=%s",
+            (unsigned long)packet.source_id(),
+            packet_flags_to_str(packet.flags()).c_str());
+
+    return NULL;
+}
+
 Router::Route* Router::find_route_(unsigned flags) {
     for (size_t n = 0; n < routes_.size(); n++) {
         Route& route = routes_[n];
@@ -17,6 +17,7 @@
 #include "roc_core/iarena.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/stddefs.h"
+#include "roc_core/time.h"
 #include "roc_packet/iwriter.h"
 #include "roc_packet/packet.h"
 #include "roc_packet/units.h"
@@ -62,6 +63,13 @@ public:
     //!  Route @p packet to a writer or drop it if no routes found.
     virtual ROC_ATTR_NODISCARD status::StatusCode write(const PacketPtr& packet);
 
+    //! Write multiple packets.
+    //! @remarks
+    //!  Consecutive packets routed to the same writer are passed to
+    //!  its write_batch() at once.
+    virtual ROC_ATTR_NODISCARD status::StatusCode write_batch(const PacketPtr* packets,
+                                                              size_t n_packets);
+
 private:
     struct Route {
         IWriter* writer;
@@ -79,6 +87,7 @@ private:
         }
     };
 
+    Route* select_route_(Packet& packet, core::nanoseconds_t queue_ts);
     Route* find_route_(unsigned flags);
     bool allow_route_(Route& route, const Packet& packet);
 
@@ -61,10 +61,10 @@ struct RTP {
     //!  On receiver, capture timestamp is assigned an estimation of the same
     //!  value, converted to receiver system clock, i.e. the system time of receiver
     //!  when the first sample in the packet was captured on sender.
-    //!  This field does not directly correspond to anything inside RTP packet.
-    //!  Instead, receiver deduces this value based on "timestamp" field from RTP
-    //!  packet, current NTP time, and mapping of NTP timestamps to RTP timestamps
-    //!  retrieved via RTCP.
+    //!  If sender enables absolute capture time RTP header extension, this field
+    //!  is transferred in every packet. Otherwise, receiver deduces this value
+    //!  based on "timestamp" field from RTP packet, current NTP time, and mapping
+    //!  of NTP timestamps to RTP timestamps retrieved via RTCP.
     core::nanoseconds_t capture_timestamp;
 
     //! Packet marker bit ("m").
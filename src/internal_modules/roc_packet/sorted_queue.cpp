@@ -19,13 +19,12 @@ SortedQueue::SortedQueue(size_t max_size)
 }
 
 status::StatusCode SortedQueue::read(PacketPtr& packet) {
-    packet = list_.back();
-    if (packet) {
-        list_.remove(*packet);
-        return status::StatusOK;
+    if (list_.is_empty()) {
+        return status::StatusNoData;
     }
 
-    return status::StatusNoData;
+    list_.pop_back().transfer_to(packet);
+    return status::StatusOK;
 }
 
 status::StatusCode SortedQueue::write(const PacketPtr& packet) {
@@ -41,10 +40,19 @@ status::StatusCode SortedQueue::write(const PacketPtr& packet) {
         return status::StatusOK;
     }
 
-    if (!latest_ || latest_->compare(*packet) <= 0) {
+    const int latest_cmp = latest_ ? latest_->compare(*packet) : -1;
+
+    if (latest_cmp <= 0) {
         latest_ = packet;
     }
 
+    if (latest_cmp < 0) {
+        // Fast path for in-order packets: packet is newer than any packet seen
+        // before, so it goes to the front without scanning the list.
+        list_.push_front(*packet);
+        return status::StatusOK;
+    }
+
     PacketPtr pos = list_.front();
 
     for (; pos; pos = list_.nextof(*pos)) {
@@ -71,6 +79,17 @@ status::StatusCode SortedQueue::write(const PacketPtr& packet) {
     return status::StatusOK;
 }
 
+status::StatusCode SortedQueue::write_batch(const PacketPtr* packets, size_t n_packets) {
+    for (size_t n = 0; n < n_packets; n++) {
+        const status::StatusCode code = SortedQueue::write(packets[n]);
+        if (code != status::StatusOK) {
+            return code;
+        }
+    }
+
+    return status::StatusOK;
+}
+
 size_t SortedQueue::size() const {
     return list_.size();
 }
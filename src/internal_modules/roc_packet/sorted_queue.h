@@ -38,6 +38,12 @@ public:
     //!  - otherwise, packet is inserted into the queue, keeping the queue sorted
     virtual ROC_ATTR_NODISCARD status::StatusCode write(const PacketPtr& packet);
 
+    //! Add multiple packets to the queue.
+    //! @remarks
+    //!  Same as calling write() for every packet.
+    virtual ROC_ATTR_NODISCARD status::StatusCode write_batch(const PacketPtr* packets,
+                                                              size_t n_packets);
+
     //! Read next packet.
     //!
     //! @remarks
@@ -0,0 +1,619 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_pipeline/batch_transcoder.h"
+#include "roc_audio/frame.h"
+#include "roc_audio/frame_factory.h"
+#include "roc_audio/resampler_map.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace pipeline {
+
+namespace {
+
+size_t align_up(size_t value, size_t align) {
+    return (value + align - 1) / align * align;
+}
+
+} // namespace
+
+BatchTranscoder::BatchTranscoder(const TranscoderConfig& config, core::IArena& arena)
+    : config_(config)
+    , arena_(arena)
+    , in_channels_(0)
+    , out_channels_(0)
+    , segment_frames_(0)
+    , io_frames_(0)
+    , in_period_(0)
+    , out_period_(0)
+    , warmup_frames_(0)
+    , lookahead_frames_(0)
+    , sequential_(false)
+    , input_(arena)
+    , input_capacity_(0)
+    , input_pos_(0)
+    , input_frames_(0)
+    , input_eof_(false)
+    , total_frames_(0)
+    , workers_(arena)
+    , jobs_(arena)
+    , cond_(mutex_)
+    , round_(0)
+    , active_jobs_(0)
+    , pending_jobs_(0)
+    , stop_(false)
+    , failed_(false)
+    , valid_(false) {
+    roc_panic_if_msg(config_.batch.num_workers == 0,
+                     "batch transcoder: number of workers should be non-zero");
+
+    config_.deduce_defaults();
+
+    // Profiler measures realtime performance of single pipeline,
+    // which doesn't make sense for parallel workers.
+    config_.enable_profiling = false;
+
+    const audio::SampleSpec& in_spec = config_.input_sample_spec;
+    const audio::SampleSpec& out_spec = config_.output_sample_spec;
+
+    if (!in_spec.is_valid() || !out_spec.is_valid()) {
+        roc_log(LogError, "batch transcoder: invalid sample specs");
+        return;
+    }
+
+    if (config_.batch.segment_length <= 0 || config_.batch.frame_length <= 0) {
+        roc_log(LogError, "batch transcoder: invalid batch config");
+        return;
+    }
+
+    in_channels_ = in_spec.num_channels();
+    out_channels_ = out_spec.num_channels();
+
+    io_frames_ =
+        std::max((size_t)1, in_spec.ns_2_samples_per_chan(config_.batch.frame_length));
+
+    // Resampler state can be split between segments only if we know
+    // resampler period.
+    sequential_ = !init_period_();
+
+    if (sequential_) {
+        if (!input_.resize(io_frames_ * in_channels_)) {
+            roc_log(LogError, "batch transcoder: can't allocate input buffer");
+            return;
+        }
+
+        roc_log(LogDebug,
+                "batch transcoder: initialized:"
+                " workers=0 io_frames=%lu (sequential, resampler period is unknown)",
+                (unsigned long)io_frames_);
+
+        valid_ = true;
+        return;
+    }
+
+    // Segment boundaries are aligned to resampler period, so that resampler
+    // of every segment starts at the same phase as single resampler would be.
+    segment_frames_ = align_up(
+        std::max(in_spec.ns_2_samples_per_chan(config_.batch.segment_length),
+                 io_frames_),
+        in_period_);
+
+    const size_t num_workers = config_.batch.num_workers;
+
+    // Buffer holds segments of all workers, warm-up before first segment,
+    // lookahead after last segment, and zeros appended at the end of input.
+    // Input is always read by whole frames, so the last read may exceed
+    // capacity by less than one frame.
+    input_capacity_ =
+        warmup_frames_ + segment_frames_ * num_workers + lookahead_frames_;
+
+    if (!input_.resize((input_capacity_ + io_frames_ + lookahead_frames_)
+                       * in_channels_)) {
+        roc_log(LogError, "batch transcoder: can't allocate input buffer");
+        return;
+    }
+
+    if (!jobs_.resize(num_workers)) {
+        roc_log(LogError, "batch transcoder: can't allocate jobs");
+        return;
+    }
+
+    if (!start_workers_()) {
+        return;
+    }
+
+    roc_log(LogDebug,
+            "batch transcoder: initialized:"
+            " workers=%lu segment_frames=%lu io_frames=%lu"
+            " in_period=%lu out_period=%lu warmup=%lu lookahead=%lu",
+            (unsigned long)num_workers, (unsigned long)segment_frames_,
+            (unsigned long)io_frames_, (unsigned long)in_period_,
+            (unsigned long)out_period_, (unsigned long)warmup_frames_,
+            (unsigned long)lookahead_frames_);
+
+    valid_ = true;
+}
+
+BatchTranscoder::~BatchTranscoder() {
+    stop_workers_();
+}
+
+bool BatchTranscoder::is_valid() const {
+    return valid_;
+}
+
+const BatchTranscoderMetrics& BatchTranscoder::metrics() const {
+    return metrics_;
+}
+
+bool BatchTranscoder::run(sndio::ISource& source, audio::IFrameWriter& writer) {
+    roc_panic_if(!is_valid());
+
+    const core::nanoseconds_t start_time = core::timestamp(core::ClockMonotonic);
+
+    metrics_ = BatchTranscoderMetrics();
+
+    input_pos_ = 0;
+    input_frames_ = 0;
+    input_eof_ = false;
+    total_frames_ = 0;
+
+    const bool ok =
+        sequential_ ? run_sequential_(source, writer) : run_parallel_(source, writer);
+    if (!ok) {
+        return false;
+    }
+
+    metrics_.input_duration =
+        config_.input_sample_spec.samples_per_chan_2_ns(total_frames_);
+    metrics_.elapsed_time = core::timestamp(core::ClockMonotonic) - start_time;
+
+    roc_log(LogInfo,
+            "batch transcoder: transcoded %.3fs of input in %.3fs (%.1fx realtime):"
+            " workers=%lu segments=%lu",
+            (double)metrics_.input_duration / core::Second,
+            (double)metrics_.elapsed_time / core::Second, metrics_.realtime_factor(),
+            (unsigned long)workers_.size(), (unsigned long)metrics_.num_segments);
+
+    return true;
+}
+
+bool BatchTranscoder::run_parallel_(sndio::ISource& source,
+                                    audio::IFrameWriter& writer) {
+    // Position of next segment in input.
+    size_t seg_pos = 0;
+
+    for (;;) {
+        fill_input_(source, input_capacity_);
+
+        const size_t end_pos = input_pos_ + input_frames_;
+
+        if (input_eof_) {
+            // Pad input with zeros, so that lookahead of the last segment
+            // is available and resampler can produce output up to the end.
+            memset(input_.data() + input_frames_ * in_channels_, 0,
+                   lookahead_frames_ * in_channels_ * sizeof(audio::sample_t));
+
+            if (seg_pos >= end_pos) {
+                total_frames_ = end_pos;
+                break;
+            }
+        }
+
+        size_t n_jobs = 0;
+
+        while (n_jobs < workers_.size() && seg_pos < end_pos) {
+            size_t seg_end = seg_pos + segment_frames_;
+
+            if (input_eof_) {
+                seg_end = std::min(seg_end, end_pos);
+            } else if (seg_end + lookahead_frames_ > end_pos) {
+                // Lookahead is not read yet.
+                break;
+            }
+
+            const size_t begin_pos = seg_pos - std::min(seg_pos, warmup_frames_);
+
+            Job& job = jobs_[n_jobs++];
+
+            job.in_samples = input_.data() + (begin_pos - input_pos_) * in_channels_;
+            job.in_frames = seg_end + lookahead_frames_ - begin_pos;
+            job.skip_frames = output_frames_(seg_pos) - output_frames_(begin_pos);
+            job.out_frames = output_frames_(seg_end) - output_frames_(seg_pos);
+
+            seg_pos = seg_end;
+        }
+
+        roc_panic_if(n_jobs == 0);
+
+        run_jobs_(n_jobs);
+
+        if (failed_) {
+            roc_log(LogError, "batch transcoder: worker failed");
+            return false;
+        }
+
+        for (size_t n = 0; n < n_jobs; n++) {
+            write_output_(writer, *workers_[n]);
+        }
+
+        metrics_.num_segments += n_jobs;
+
+        if (input_eof_ && seg_pos >= end_pos) {
+            total_frames_ = end_pos;
+            break;
+        }
+
+        // Keep warm-up of next segment and already read lookahead.
+        const size_t keep_pos = seg_pos - std::min(seg_pos, warmup_frames_);
+
+        memmove(input_.data(), input_.data() + (keep_pos - input_pos_) * in_channels_,
+                (end_pos - keep_pos) * in_channels_ * sizeof(audio::sample_t));
+
+        input_pos_ = keep_pos;
+        input_frames_ = end_pos - keep_pos;
+    }
+
+    return true;
+}
+
+bool BatchTranscoder::run_sequential_(sndio::ISource& source,
+                                      audio::IFrameWriter& writer) {
+    core::SlabPool<core::Buffer> buffer_pool(
+        "batch_transcoder_buffer_pool", arena_,
+        sizeof(core::Buffer)
+            + io_frames_ * std::max(in_channels_, out_channels_)
+                * sizeof(audio::sample_t));
+
+    // Single pipeline for the whole input, so that resampler state
+    // is preserved between frames.
+    TranscoderSink transcoder(config_, &writer, buffer_pool, arena_);
+    if (!transcoder.is_valid()) {
+        roc_log(LogError, "batch transcoder: can't create transcoder pipeline");
+        return false;
+    }
+
+    for (;;) {
+        input_frames_ = 0;
+
+        fill_input_(source, io_frames_);
+
+        if (input_frames_ == 0) {
+            break;
+        }
+
+        audio::Frame frame(input_.data(), input_frames_ * in_channels_);
+        frame.set_duration(packet::stream_timestamp_t(input_frames_));
+
+        transcoder.write(frame);
+
+        total_frames_ += input_frames_;
+    }
+
+    metrics_.num_segments = 1;
+
+    return true;
+}
+
+// Find resampler period and window. If rates are equal, there is no resampler,
+// and every input frame produces one output frame.
+bool BatchTranscoder::init_period_() {
+    const audio::SampleSpec& in_spec = config_.input_sample_spec;
+    const audio::SampleSpec& out_spec = config_.output_sample_spec;
+
+    if (in_spec.sample_rate() == out_spec.sample_rate()) {
+        in_period_ = out_period_ = 1;
+        warmup_frames_ = lookahead_frames_ = 0;
+        return true;
+    }
+
+    const audio::SampleSpec from_spec(in_spec.sample_rate(), audio::Sample_RawFormat,
+                                      in_spec.channel_set());
+    const audio::SampleSpec to_spec(out_spec.sample_rate(), audio::Sample_RawFormat,
+                                    in_spec.channel_set());
+
+    // Temporary resampler with the same parameters as in workers' pipelines.
+    core::SlabPool<core::Buffer> buffer_pool(
+        "batch_transcoder_buffer_pool", arena_,
+        sizeof(core::Buffer)
+            + io_frames_ * std::max(in_channels_, out_channels_)
+                * sizeof(audio::sample_t));
+    audio::FrameFactory frame_factory(buffer_pool);
+
+    core::SharedPtr<audio::IResampler> resampler =
+        audio::ResamplerMap::instance().new_resampler(arena_, frame_factory,
+                                                      config_.resampler, from_spec,
+                                                      to_spec);
+    if (!resampler
+        || !resampler->set_scaling(in_spec.sample_rate(), out_spec.sample_rate(),
+                                   1.0f)) {
+        return false;
+    }
+
+    size_t window = 0;
+    if (!resampler->get_period(in_period_, out_period_, window)) {
+        return false;
+    }
+
+    // Very long period would require huge segments.
+    if (in_period_ > in_spec.ns_2_samples_per_chan(config_.batch.segment_length) * 4) {
+        roc_log(LogDebug, "batch transcoder: resampler period is too long: period=%lu",
+                (unsigned long)in_period_);
+        return false;
+    }
+
+    // Warm-up should start at the same phase as segment.
+    warmup_frames_ = align_up(window, in_period_);
+    lookahead_frames_ = window;
+
+    return true;
+}
+
+// Number of output frames produced from given number of input frames.
+size_t BatchTranscoder::output_frames_(size_t input_frames) const {
+    return input_frames / in_period_ * out_period_
+        + (size_t)((uint64_t)(input_frames % in_period_) * out_period_ / in_period_);
+}
+
+// Reads whole frames, the same way as sequential transcoding does, so that
+// zero padding of the last partial frame by source is the same in both modes.
+void BatchTranscoder::fill_input_(sndio::ISource& source, size_t target_frames) {
+    while (!input_eof_ && input_frames_ < target_frames) {
+        const size_t n_frames = io_frames_;
+
+        roc_panic_if((input_frames_ + n_frames) * in_channels_ > input_.size());
+
+        audio::Frame frame(input_.data() + input_frames_ * in_channels_,
+                           n_frames * in_channels_);
+
+        if (!source.read(frame)) {
+            input_eof_ = true;
+            break;
+        }
+
+        input_frames_ += n_frames;
+    }
+}
+
+void BatchTranscoder::write_output_(audio::IFrameWriter& writer, Worker& worker) {
+    audio::sample_t* samples = worker.output();
+    size_t n_samples = worker.output_size();
+
+    while (n_samples != 0) {
+        const size_t n_write = std::min(n_samples, io_frames_ * out_channels_);
+
+        audio::Frame frame(samples, n_write);
+        frame.set_duration(packet::stream_timestamp_t(n_write / out_channels_));
+
+        writer.write(frame);
+
+        samples += n_write;
+        n_samples -= n_write;
+    }
+}
+
+bool BatchTranscoder::start_workers_() {
+    for (size_t n = 0; n < config_.batch.num_workers; n++) {
+        Worker* worker = new (arena_) Worker(*this, n);
+        if (!worker) {
+            roc_log(LogError, "batch transcoder: can't allocate worker");
+            return false;
+        }
+
+        if (!workers_.push_back(worker)) {
+            arena_.destroy_object(*worker);
+            roc_log(LogError, "batch transcoder: can't allocate worker");
+            return false;
+        }
+
+        if (!worker->is_valid()) {
+            return false;
+        }
+
+        if (!worker->start()) {
+            roc_log(LogError, "batch transcoder: can't start worker thread");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void BatchTranscoder::stop_workers_() {
+    {
+        core::Mutex::Lock lock(mutex_);
+
+        stop_ = true;
+        cond_.broadcast();
+    }
+
+    for (size_t n = 0; n < workers_.size(); n++) {
+        if (workers_[n]->is_joinable()) {
+            workers_[n]->join();
+        }
+        arena_.destroy_object(*workers_[n]);
+    }
+
+    workers_.clear();
+}
+
+void BatchTranscoder::run_jobs_(size_t n_jobs) {
+    core::Mutex::Lock lock(mutex_);
+
+    round_++;
+    active_jobs_ = n_jobs;
+    pending_jobs_ = n_jobs;
+    failed_ = false;
+
+    cond_.broadcast();
+
+    while (pending_jobs_ != 0) {
+        cond_.wait();
+    }
+}
+
+BatchTranscoder::Worker::Worker(BatchTranscoder& parent, size_t index)
+    : parent_(parent)
+    , index_(index)
+    , buffer_pool_("batch_transcoder_buffer_pool",
+                   parent.arena_,
+                   sizeof(core::Buffer)
+                       + parent.io_frames_
+                           * std::max(parent.in_channels_, parent.out_channels_)
+                           * sizeof(audio::sample_t))
+    , output_(parent.arena_)
+    , output_offset_(0)
+    , output_size_(0)
+    , output_failed_(false)
+    , valid_(false) {
+    const size_t max_in_frames = parent_.warmup_frames_ + parent_.segment_frames_
+        + parent_.lookahead_frames_;
+
+    if (!output_.resize(
+            (parent_.output_frames_(max_in_frames) + 1) * parent_.out_channels_)) {
+        roc_log(LogError, "batch transcoder: can't allocate output buffer");
+        return;
+    }
+
+    valid_ = true;
+}
+
+BatchTranscoder::Worker::~Worker() {
+}
+
+bool BatchTranscoder::Worker::is_valid() const {
+    return valid_;
+}
+
+audio::sample_t* BatchTranscoder::Worker::output() {
+    return output_.data() + output_offset_;
+}
+
+size_t BatchTranscoder::Worker::output_size() const {
+    return output_size_;
+}
+
+void BatchTranscoder::Worker::run() {
+    size_t last_round = 0;
+
+    for (;;) {
+        Job job;
+        bool has_job = false;
+
+        {
+            core::Mutex::Lock lock(parent_.mutex_);
+
+            while (parent_.round_ == last_round && !parent_.stop_) {
+                parent_.cond_.wait();
+            }
+
+            if (parent_.stop_) {
+                return;
+            }
+
+            last_round = parent_.round_;
+
+            if (index_ < parent_.active_jobs_) {
+                job = parent_.jobs_[index_];
+                has_job = true;
+            }
+        }
+
+        if (!has_job) {
+            continue;
+        }
+
+        const bool ok = process_(job);
+
+        {
+            core::Mutex::Lock lock(parent_.mutex_);
+
+            if (!ok) {
+                parent_.failed_ = true;
+            }
+
+            if (--parent_.pending_jobs_ == 0) {
+                parent_.cond_.broadcast();
+            }
+        }
+    }
+}
+
+bool BatchTranscoder::Worker::process_(const Job& job) {
+    const size_t in_channels = parent_.in_channels_;
+
+    output_offset_ = 0;
+    output_size_ = 0;
+    output_failed_ = false;
+
+    // Every segment is transcoded by a fresh pipeline, so that its output
+    // doesn't depend on what was processed before.
+    transcoder_.reset(new (transcoder_) TranscoderSink(parent_.config_, this,
+                                                       buffer_pool_, parent_.arena_));
+    if (!transcoder_ || !transcoder_->is_valid()) {
+        roc_log(LogError, "batch transcoder: can't create transcoder pipeline");
+        transcoder_.reset();
+        return false;
+    }
+
+    for (size_t pos = 0; pos < job.in_frames;) {
+        const size_t n_frames = std::min(parent_.io_frames_, job.in_frames - pos);
+
+        audio::Frame frame(job.in_samples + pos * in_channels, n_frames * in_channels);
+        frame.set_duration(packet::stream_timestamp_t(n_frames));
+
+        transcoder_->write(frame);
+
+        pos += n_frames;
+    }
+
+    transcoder_.reset();
+
+    if (output_failed_) {
+        roc_log(LogError, "batch transcoder: can't allocate output buffer");
+        return false;
+    }
+
+    const size_t out_channels = parent_.out_channels_;
+
+    if (output_size_ < (job.skip_frames + job.out_frames) * out_channels) {
+        roc_log(LogError,
+                "batch transcoder: not enough output: expected=%lu actual=%lu",
+                (unsigned long)(job.skip_frames + job.out_frames),
+                (unsigned long)(output_size_ / out_channels));
+        return false;
+    }
+
+    // Drop output produced from warm-up and lookahead.
+    output_offset_ = job.skip_frames * out_channels;
+    output_size_ = job.out_frames * out_channels;
+
+    return true;
+}
+
+void BatchTranscoder::Worker::write(audio::Frame& frame) {
+    const size_t n_samples = frame.num_raw_samples();
+
+    if (output_size_ + n_samples > output_.size()) {
+        if (!output_.grow_exp(output_size_ + n_samples)
+            || !output_.resize(output_size_ + n_samples)) {
+            output_failed_ = true;
+            return;
+        }
+    }
+
+    memcpy(output_.data() + output_size_, frame.raw_samples(),
+           n_samples * sizeof(audio::sample_t));
+
+    output_size_ += n_samples;
+}
+
+} // namespace pipeline
+} // namespace roc
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_pipeline/batch_transcoder.h
+//! @brief Parallel batch transcoder.
+
+#ifndef ROC_PIPELINE_BATCH_TRANSCODER_H_
+#define ROC_PIPELINE_BATCH_TRANSCODER_H_
+
+#include "roc_audio/iframe_writer.h"
+#include "roc_audio/sample.h"
+#include "roc_core/array.h"
+#include "roc_core/attributes.h"
+#include "roc_core/buffer.h"
+#include "roc_core/cond.h"
+#include "roc_core/iarena.h"
+#include "roc_core/mutex.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/optional.h"
+#include "roc_core/slab_pool.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/thread.h"
+#include "roc_core/time.h"
+#include "roc_pipeline/config.h"
+#include "roc_pipeline/transcoder_sink.h"
+#include "roc_sndio/isource.h"
+
+namespace roc {
+namespace pipeline {
+
+//! Batch transcoder metrics.
+struct BatchTranscoderMetrics {
+    //! Duration of transcoded input.
+    core::nanoseconds_t input_duration;
+
+    //! Wall clock time spent on transcoding.
+    core::nanoseconds_t elapsed_time;
+
+    //! Number of processed segments.
+    size_t num_segments;
+
+    BatchTranscoderMetrics()
+        : input_duration(0)
+        , elapsed_time(0)
+        , num_segments(0) {
+    }
+
+    //! Get throughput as a multiple of realtime.
+    double realtime_factor() const {
+        if (elapsed_time <= 0) {
+            return 0;
+        }
+        return (double)input_duration / (double)elapsed_time;
+    }
+};
+
+//! Parallel batch transcoder.
+//! @remarks
+//!  Faster-than-realtime alternative to driving TranscoderSink frame by frame,
+//!  intended for offline processing of files.
+//!
+//!  Input is read in large frames and split into segments. Segments are
+//!  transcoded in parallel by worker threads, each having its own pipeline
+//!  (resampler and channel mapper). Output is written in input order.
+//!
+//!  When resampling, every segment is transcoded together with a warm-up part
+//!  before it and a lookahead part after it, both sized from resampler window.
+//!  Segment boundaries are aligned to resampler period, so that resampler of
+//!  every segment has the same phase as if whole input was resampled by one
+//!  resampler. Output of warm-up and lookahead is dropped, and segments are
+//!  stitched exactly. At the end, input is padded with zeros, and output
+//!  length is input length multiplied by resampling ratio.
+//!
+//!  If resampler backend doesn't report its period (see IResampler::get_period),
+//!  segments are not used, and whole input is transcoded sequentially by a
+//!  single pipeline, in large frames.
+class BatchTranscoder : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  config.batch.num_workers should be non-zero.
+    BatchTranscoder(const TranscoderConfig& config, core::IArena& arena);
+
+    ~BatchTranscoder();
+
+    //! Check if the object was successfully constructed.
+    bool is_valid() const;
+
+    //! Transcode whole input.
+    //! @remarks
+    //!  Reads @p source until end of stream and writes transcoded samples
+    //!  to @p writer. Blocks until finished.
+    ROC_ATTR_NODISCARD bool run(sndio::ISource& source, audio::IFrameWriter& writer);
+
+    //! Get metrics of the last run.
+    const BatchTranscoderMetrics& metrics() const;
+
+private:
+    // Portion of input transcoded by one worker.
+    struct Job {
+        // Input samples, including warm-up and lookahead.
+        audio::sample_t* in_samples;
+        size_t in_frames;
+
+        // Output frames to drop (produced from warm-up) and to keep.
+        size_t skip_frames;
+        size_t out_frames;
+
+        Job()
+            : in_samples(NULL)
+            , in_frames(0)
+            , skip_frames(0)
+            , out_frames(0) {
+        }
+    };
+
+    class Worker : public core::Thread, private audio::IFrameWriter {
+    public:
+        Worker(BatchTranscoder& parent, size_t index);
+        virtual ~Worker();
+
+        bool is_valid() const;
+
+        // Output samples of last job.
+        audio::sample_t* output();
+        size_t output_size() const;
+
+    private:
+        virtual void run();
+        virtual void write(audio::Frame& frame);
+
+        bool process_(const Job& job);
+
+        BatchTranscoder& parent_;
+        const size_t index_;
+
+        core::SlabPool<core::Buffer> buffer_pool_;
+        core::Optional<TranscoderSink> transcoder_;
+
+        core::Array<audio::sample_t> output_;
+        size_t output_offset_;
+        size_t output_size_;
+        bool output_failed_;
+
+        bool valid_;
+    };
+
+    friend class Worker;
+
+    bool init_period_();
+    size_t output_frames_(size_t input_frames) const;
+
+    bool start_workers_();
+    void stop_workers_();
+    void run_jobs_(size_t n_jobs);
+
+    bool run_parallel_(sndio::ISource& source, audio::IFrameWriter& writer);
+    bool run_sequential_(sndio::ISource& source, audio::IFrameWriter& writer);
+
+    void fill_input_(sndio::ISource& source, size_t target_frames);
+    void write_output_(audio::IFrameWriter& writer, Worker& worker);
+
+    TranscoderConfig config_;
+    core::IArena& arena_;
+
+    size_t in_channels_;
+    size_t out_channels_;
+
+    // Segment length and I/O frame length, in input frames.
+    size_t segment_frames_;
+    size_t io_frames_;
+
+    // Resampler period: every in_period_ input frames produce
+    // exactly out_period_ output frames.
+    size_t in_period_;
+    size_t out_period_;
+
+    // Input transcoded before and after every segment, in input frames.
+    size_t warmup_frames_;
+    size_t lookahead_frames_;
+
+    // If set, input is transcoded sequentially, without workers.
+    bool sequential_;
+
+    // Input of current round, split into segments, with warm-up part of the
+    // first segment and lookahead part of the last segment.
+    core::Array<audio::sample_t> input_;
+    size_t input_capacity_;
+    size_t input_pos_;
+    size_t input_frames_;
+    bool input_eof_;
+    size_t total_frames_;
+
+    core::Array<Worker*> workers_;
+    core::Array<Job> jobs_;
+
+    core::Mutex mutex_;
+    core::Cond cond_;
+    size_t round_;
+    size_t active_jobs_;
+    size_t pending_jobs_;
+    bool stop_;
+    bool failed_;
+
+    BatchTranscoderMetrics metrics_;
+
+    bool valid_;
+};
+
+} // namespace pipeline
+} // namespace roc
+
+#endif // ROC_PIPELINE_BATCH_TRANSCODER_H_
@@ -38,7 +38,10 @@ ReceiverCommonConfig::ReceiverCommonConfig()
     : output_sample_spec(DefaultSampleSpec)
     , enable_timing(false)
     , enable_auto_reclock(false)
-    , enable_profiling(false) {
+    , enable_profiling(false)
+    , enable_passthrough(false)
+    , enable_unmixed_output(false)
+    , session_pool_size(8) {
 }
 
 void ReceiverCommonConfig::deduce_defaults() {
@@ -70,6 +73,12 @@ ReceiverSlotConfig::ReceiverSlotConfig()
 void ReceiverSlotConfig::deduce_defaults() {
 }
 
+TranscoderBatchConfig::TranscoderBatchConfig()
+    : num_workers(0)
+    , segment_length(10 * core::Second)
+    , frame_length(100 * core::Millisecond) {
+}
+
 TranscoderConfig::TranscoderConfig()
     : input_sample_spec(DefaultSampleSpec)
     , output_sample_spec(DefaultSampleSpec)
@@ -13,20 +13,27 @@
 #define ROC_PIPELINE_CONFIG_H_
 
 #include "roc_address/protocol.h"
+#include "roc_audio/fanout.h"
 #include "roc_audio/feedback_monitor.h"
 #include "roc_audio/latency_tuner.h"
+#include "roc_audio/plc_config.h"
 #include "roc_audio/profiler.h"
 #include "roc_audio/resampler_config.h"
 #include "roc_audio/sample_spec.h"
 #include "roc_audio/watchdog.h"
 #include "roc_core/stddefs.h"
+#include "roc_core/ticker.h"
 #include "roc_core/time.h"
 #include "roc_fec/codec_config.h"
 #include "roc_fec/reader.h"
 #include "roc_fec/writer.h"
+#include "roc_packet/impairer.h"
+#include "roc_packet/pacer.h"
 #include "roc_packet/units.h"
+#include "roc_pipeline/overload_controller.h"
 #include "roc_pipeline/pipeline_loop.h"
 #include "roc_rtcp/config.h"
+#include "roc_rtp/composer.h"
 #include "roc_rtp/filter.h"
 
 namespace roc {
@@ -68,6 +75,11 @@ struct SenderSinkConfig {
     //! Packet length, in nanoseconds.
     core::nanoseconds_t packet_length;
 
+    //! RTP composer parameters.
+    //! If capture time extension is enabled, receiver can start E2E latency
+    //! tuning from the first packet, without waiting for RTCP reports.
+    rtp::ComposerConfig rtp_composer;
+
     //! FEC writer parameters.
     fec::WriterConfig fec_writer;
 
@@ -92,6 +104,11 @@ struct SenderSinkConfig {
     //! Constrain receiver speed using a CPU timer according to the sample rate.
     bool enable_timing;
 
+    //! CPU timer parameters.
+    //! @remarks
+    //!  Used only if enable_timing is set.
+    core::TickerConfig timing;
+
     //! Automatically fill duration of input frames.
     bool enable_auto_duration;
 
@@ -104,6 +121,24 @@ struct SenderSinkConfig {
     //! Interleave packets.
     bool enable_interleaving;
 
+    //! Pacer parameters.
+    //! If pacing is enabled, outgoing packets are spread evenly in time
+    //! instead of being sent in bursts.
+    packet::PacerConfig pacer;
+
+    //! Network impairment parameters.
+    //! If impairment is enabled, outgoing audio and repair packets are dropped,
+    //! delayed, reordered, and duplicated before reaching endpoints, to simulate
+    //! unreliable network in tests and benchmarks. Delayed packets are sent
+    //! from refresh(), which sender loop invokes at impairer deadlines.
+    packet::ImpairerConfig impairer;
+
+    //! Fanout parameters.
+    //! If fanout has worker threads, each frame is processed by all slots
+    //! in parallel, and writing frame to sink completes when all slots are done.
+    //! Useful when there are many slots with expensive encodings or FEC schemes.
+    audio::FanoutConfig fanout;
+
     //! Initialize config.
     SenderSinkConfig();
 
@@ -137,12 +172,52 @@ struct ReceiverCommonConfig {
     //! Constrain receiver speed using a CPU timer according to the sample rate.
     bool enable_timing;
 
+    //! CPU timer parameters.
+    //! @remarks
+    //!  Used only if enable_timing is set.
+    core::TickerConfig timing;
+
     //! Automatically invoke reclock before returning frames with invocation time.
     bool enable_auto_reclock;
 
     //! Profile moving average of frames being written.
     bool enable_profiling;
 
+    //! Deliver samples to output without converting them to raw format and back,
+    //! when possible.
+    //! @remarks
+    //!  Passthrough is used when there is only one session, its encoding has the
+    //!  same rate, channels, and bit depth as output sample spec, and no resampling
+    //!  is needed. In all other cases, receiver automatically falls back to
+    //!  converting, mixing, and resampling raw samples.
+    //!  Since resampler is also used for clock drift compensation, passthrough
+    //!  requires intact latency tuner profile.
+    bool enable_passthrough;
+
+    //! Don't mix sessions, and instead provide frames of each session separately.
+    //! @remarks
+    //!  When enabled, sessions are not added to mixer, and frames read from receiver
+    //!  source are always silent. Instead, frames of every session should be read
+    //!  individually by source ID of its sender (see ReceiverLoop::Tasks::ReadSession).
+    //!  Reading from receiver source is still needed, because it drives pipeline:
+    //!  fetches incoming packets, refreshes sessions, and processes tasks.
+    //!  Requires raw output sample spec.
+    bool enable_unmixed_output;
+
+    //! Maximum number of ended sessions kept for reuse, per slot.
+    //! @remarks
+    //!  When session ends, it is recycled instead of being destroyed, and when
+    //!  new session is created, recycled session is reset and reused. This way
+    //!  sessions can join and leave without allocating memory from arena.
+    //!  Zero disables session reuse.
+    size_t session_pool_size;
+
+    //! Overload controller parameters.
+    //! If overload control is enabled, quality of all sessions is lowered
+    //! when receiver can't keep up with frame deadlines, and is restored
+    //! when there is enough headroom again.
+    OverloadConfig overload;
+
     //! Initialize config.
     ReceiverCommonConfig();
 
@@ -170,6 +245,9 @@ struct ReceiverSessionConfig {
     //! Resampler parameters.
     audio::ResamplerConfig resampler;
 
+    //! Packet loss concealment parameters.
+    audio::PlcConfig plc;
+
     //! Insert weird beeps instead of silence on packet loss.
     bool enable_beeping;
 
@@ -210,6 +288,30 @@ struct ReceiverSlotConfig {
     void deduce_defaults();
 };
 
+//! Parameters of batch transcoding.
+//! @remarks
+//!  In batch mode, input is split into segments which are transcoded in
+//!  parallel by worker threads and then stitched together.
+struct TranscoderBatchConfig {
+    //! Number of worker threads.
+    //! @remarks
+    //!  Zero means that batch mode is disabled.
+    size_t num_workers;
+
+    //! Length of input segment processed by one worker at once.
+    //! @remarks
+    //!  When resampling, rounded up to a multiple of resampler period.
+    //!  Not used if resampler backend doesn't report its period, in this
+    //!  case input is not split.
+    core::nanoseconds_t segment_length;
+
+    //! Length of frames read from input and written to output.
+    core::nanoseconds_t frame_length;
+
+    //! Initialize config.
+    TranscoderBatchConfig();
+};
+
 //! Converter parameters.
 struct TranscoderConfig {
     //! Input sample spec
@@ -224,6 +326,9 @@ struct TranscoderConfig {
     //! Profiler configuration.
     audio::ProfilerConfig profiler;
 
+    //! Batch mode parameters.
+    TranscoderBatchConfig batch;
+
     //! Profile moving average of frames being written.
     bool enable_profiling;
 
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_pipeline/cpu_meter.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace pipeline {
+
+CpuMeter::CpuMeter(size_t window_frames)
+    : window_frames_(window_frames)
+    , depth_(0)
+    , win_frames_(0)
+    , win_sum_total_(0)
+    , win_max_total_(0) {
+    roc_panic_if_msg(window_frames == 0, "cpu meter: window should be non-zero");
+
+    for (size_t n = 0; n < NumSlots; n++) {
+        frame_time_[n] = 0;
+        win_sum_[n] = 0;
+        win_max_[n] = 0;
+    }
+}
+
+const CpuMetrics& CpuMeter::metrics() const {
+    return metrics_;
+}
+
+void CpuMeter::begin_frame() {
+    begin_(FrameSlot);
+}
+
+void CpuMeter::end_frame() {
+    end_(FrameSlot);
+
+    roc_panic_if_msg(depth_ != 0, "cpu meter: frame ended before nested stages");
+
+    core::nanoseconds_t total_time = 0;
+
+    for (size_t n = 0; n < NumSlots; n++) {
+        total_time += frame_time_[n];
+
+        win_sum_[n] += frame_time_[n];
+        win_max_[n] = std::max(win_max_[n], frame_time_[n]);
+
+        frame_time_[n] = 0;
+    }
+
+    win_sum_total_ += total_time;
+    win_max_total_ = std::max(win_max_total_, total_time);
+    win_frames_++;
+
+    metrics_.frame_count++;
+    metrics_.total_time += total_time;
+
+    // Until first window is filled, publish partial results.
+    if (win_frames_ == window_frames_ || metrics_.frame_count < window_frames_) {
+        publish_window_();
+    }
+
+    if (win_frames_ == window_frames_) {
+        win_frames_ = 0;
+        win_sum_total_ = 0;
+        win_max_total_ = 0;
+
+        for (size_t n = 0; n < NumSlots; n++) {
+            win_sum_[n] = 0;
+            win_max_[n] = 0;
+        }
+    }
+}
+
+void CpuMeter::begin_stage(CpuStage stage) {
+    roc_panic_if_not(stage >= 0 && stage < CpuStage_Max);
+
+    begin_((size_t)stage);
+}
+
+void CpuMeter::end_stage(CpuStage stage) {
+    roc_panic_if_not(stage >= 0 && stage < CpuStage_Max);
+
+    end_((size_t)stage);
+}
+
+void CpuMeter::add_stage_time(CpuStage stage, core::nanoseconds_t time) {
+    roc_panic_if_not(stage >= 0 && stage < CpuStage_Max);
+
+    if (time > 0) {
+        frame_time_[stage] += time;
+    }
+}
+
+void CpuMeter::begin_(size_t slot) {
+    roc_panic_if_msg(depth_ == NumSlots, "cpu meter: too many nested stages");
+
+    Level& level = stack_[depth_++];
+
+    level.slot = slot;
+    level.start_time = core::thread_cpu_timestamp();
+    level.nested_time = 0;
+}
+
+void CpuMeter::end_(size_t slot) {
+    roc_panic_if_msg(depth_ == 0 || stack_[depth_ - 1].slot != slot,
+                     "cpu meter: unbalanced begin and end");
+
+    const Level& level = stack_[--depth_];
+
+    core::nanoseconds_t elapsed = core::thread_cpu_timestamp() - level.start_time;
+    if (elapsed < 0) {
+        elapsed = 0;
+    }
+
+    frame_time_[slot] += std::max(elapsed - level.nested_time, (core::nanoseconds_t)0);
+
+    if (depth_ != 0) {
+        stack_[depth_ - 1].nested_time += elapsed;
+    }
+}
+
+void CpuMeter::publish_window_() {
+    if (win_frames_ == 0) {
+        return;
+    }
+
+    const core::nanoseconds_t n_frames = (core::nanoseconds_t)win_frames_;
+
+    metrics_.avg_frame_time = win_sum_total_ / n_frames;
+    metrics_.max_frame_time = win_max_total_;
+
+    for (size_t n = 0; n < CpuStage_Max; n++) {
+        metrics_.avg_stage_time[n] = win_sum_[n] / n_frames;
+        metrics_.max_stage_time[n] = win_max_[n];
+    }
+}
+
+} // namespace pipeline
+} // namespace roc
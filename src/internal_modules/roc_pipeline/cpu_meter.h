@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_pipeline/cpu_meter.h
+//! @brief CPU time meter.
+
+#ifndef ROC_PIPELINE_CPU_METER_H_
+#define ROC_PIPELINE_CPU_METER_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace pipeline {
+
+//! Pipeline stage measured by CpuMeter.
+enum CpuStage {
+    //! Routing incoming packets to session.
+    CpuStage_Packets,
+
+    //! FEC encoding or decoding.
+    CpuStage_Fec,
+
+    //! Packetization or depacketization, including payload encoding or decoding.
+    CpuStage_Codec,
+
+    //! Resampling.
+    CpuStage_Resampler,
+
+    //! Number of stages.
+    CpuStage_Max
+};
+
+//! CPU time metrics.
+//! @remarks
+//!  Averages and maximums are computed over a window of recent frames.
+//!  Time of every stage is included into frame time.
+struct CpuMetrics {
+    //! Number of processed frames.
+    uint64_t frame_count;
+
+    //! Total CPU time spent on all frames.
+    core::nanoseconds_t total_time;
+
+    //! Average CPU time spent per frame.
+    core::nanoseconds_t avg_frame_time;
+
+    //! Maximum CPU time spent per frame.
+    core::nanoseconds_t max_frame_time;
+
+    //! Average CPU time spent per frame in every stage.
+    core::nanoseconds_t avg_stage_time[CpuStage_Max];
+
+    //! Maximum CPU time spent per frame in every stage.
+    core::nanoseconds_t max_stage_time[CpuStage_Max];
+
+    CpuMetrics()
+        : frame_count(0)
+        , total_time(0)
+        , avg_frame_time(0)
+        , max_frame_time(0) {
+        for (size_t n = 0; n < CpuStage_Max; n++) {
+            avg_stage_time[n] = 0;
+            max_stage_time[n] = 0;
+        }
+    }
+};
+
+//! CPU time meter.
+//! @remarks
+//!  Measures how much CPU time is spent by session per frame, and which part
+//!  of it is spent in every stage of the pipeline.
+//!
+//!  Time is measured using CPU clock of the calling thread, so that time when
+//!  thread was preempted or was waiting is not counted, and results are not
+//!  distorted when sessions are processed on different threads.
+//!
+//!  Stages may be nested into frame and into each other, e.g. FEC decoding
+//!  happens inside depacketization. Time of nested stage is not included into
+//!  time of enclosing stage. Stages that happen outside of frame, e.g. packet
+//!  routing, are accounted in the next frame.
+//!
+//!  Averages and maximums are computed over windows of fixed number of frames,
+//!  and are updated when window is filled. Until first window is filled, they
+//!  are updated on every frame.
+//!
+//!  Not thread-safe. All methods should be called from the same thread, or be
+//!  serialized.
+class CpuMeter : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  @p window_frames defines number of frames used to compute averages
+    //!  and maximums.
+    explicit CpuMeter(size_t window_frames);
+
+    //! Get metrics.
+    const CpuMetrics& metrics() const;
+
+    //! Start measuring frame.
+    void begin_frame();
+
+    //! Finish measuring frame and update metrics.
+    void end_frame();
+
+    //! Start measuring stage.
+    void begin_stage(CpuStage stage);
+
+    //! Finish measuring stage.
+    //! @remarks
+    //!  Stages should be finished in reverse order.
+    void end_stage(CpuStage stage);
+
+    //! Add time spent in stage that was measured elsewhere.
+    //! @remarks
+    //!  Used for work done on behalf of session by other threads, e.g.
+    //!  background FEC encoding. Time is accounted in current frame, or
+    //!  in the next frame if called outside of frame.
+    void add_stage_time(CpuStage stage, core::nanoseconds_t time);
+
+private:
+    // Slot used for frame's own time, after all stages.
+    enum { FrameSlot = CpuStage_Max, NumSlots = CpuStage_Max + 1 };
+
+    struct Level {
+        size_t slot;
+        core::nanoseconds_t start_time;
+        core::nanoseconds_t nested_time;
+    };
+
+    void begin_(size_t slot);
+    void end_(size_t slot);
+
+    void publish_window_();
+
+    const size_t window_frames_;
+
+    // Stages in progress.
+    Level stack_[NumSlots];
+    size_t depth_;
+
+    // Own time of every slot in current frame.
+    core::nanoseconds_t frame_time_[NumSlots];
+
+    // Accumulated values for current window.
+    size_t win_frames_;
+    core::nanoseconds_t win_sum_[NumSlots];
+    core::nanoseconds_t win_max_[NumSlots];
+    core::nanoseconds_t win_sum_total_;
+    core::nanoseconds_t win_max_total_;
+
+    CpuMetrics metrics_;
+};
+
+} // namespace pipeline
+} // namespace roc
+
+#endif // ROC_PIPELINE_CPU_METER_H_
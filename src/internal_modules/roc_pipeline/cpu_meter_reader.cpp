@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_pipeline/cpu_meter_reader.h"
+
+namespace roc {
+namespace pipeline {
+
+CpuMeterFrameReader::CpuMeterFrameReader(audio::IFrameReader& reader, CpuMeter& meter)
+    : reader_(reader)
+    , meter_(meter)
+    , stage_(CpuStage_Max)
+    , is_frame_(true) {
+}
+
+CpuMeterFrameReader::CpuMeterFrameReader(audio::IFrameReader& reader,
+                                         CpuMeter& meter,
+                                         CpuStage stage)
+    : reader_(reader)
+    , meter_(meter)
+    , stage_(stage)
+    , is_frame_(false) {
+}
+
+bool CpuMeterFrameReader::read(audio::Frame& frame) {
+    if (is_frame_) {
+        meter_.begin_frame();
+        const bool ret = reader_.read(frame);
+        meter_.end_frame();
+
+        return ret;
+    }
+
+    meter_.begin_stage(stage_);
+    const bool ret = reader_.read(frame);
+    meter_.end_stage(stage_);
+
+    return ret;
+}
+
+CpuMeterPacketReader::CpuMeterPacketReader(packet::IReader& reader,
+                                           CpuMeter& meter,
+                                           CpuStage stage)
+    : reader_(reader)
+    , meter_(meter)
+    , stage_(stage) {
+}
+
+status::StatusCode CpuMeterPacketReader::read(packet::PacketPtr& packet) {
+    meter_.begin_stage(stage_);
+    const status::StatusCode code = reader_.read(packet);
+    meter_.end_stage(stage_);
+
+    return code;
+}
+
+} // namespace pipeline
+} // namespace roc
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_pipeline/cpu_meter_reader.h
+//! @brief Readers measuring CPU time of pipeline stages.
+
+#ifndef ROC_PIPELINE_CPU_METER_READER_H_
+#define ROC_PIPELINE_CPU_METER_READER_H_
+
+#include "roc_audio/iframe_reader.h"
+#include "roc_core/noncopyable.h"
+#include "roc_packet/ireader.h"
+#include "roc_pipeline/cpu_meter.h"
+
+namespace roc {
+namespace pipeline {
+
+//! Frame reader that measures CPU time of nested reader.
+class CpuMeterFrameReader : public audio::IFrameReader, public core::NonCopyable<> {
+public:
+    //! Initialize reader measuring whole frame.
+    //! @remarks
+    //!  Should be the top-level reader of the session.
+    CpuMeterFrameReader(audio::IFrameReader& reader, CpuMeter& meter);
+
+    //! Initialize reader measuring a stage.
+    CpuMeterFrameReader(audio::IFrameReader& reader, CpuMeter& meter, CpuStage stage);
+
+    //! Read frame from nested reader.
+    virtual bool read(audio::Frame& frame);
+
+private:
+    audio::IFrameReader& reader_;
+    CpuMeter& meter_;
+    const CpuStage stage_;
+    const bool is_frame_;
+};
+
+//! Packet reader that measures CPU time of nested reader as a stage.
+class CpuMeterPacketReader : public packet::IReader, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    CpuMeterPacketReader(packet::IReader& reader, CpuMeter& meter, CpuStage stage);
+
+    //! Read packet from nested reader.
+    virtual ROC_ATTR_NODISCARD status::StatusCode read(packet::PacketPtr& packet);
+
+private:
+    packet::IReader& reader_;
+    CpuMeter& meter_;
+    const CpuStage stage_;
+};
+
+} // namespace pipeline
+} // namespace roc
+
+#endif // ROC_PIPELINE_CPU_METER_READER_H_
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_pipeline/cpu_meter_writer.h"
+
+namespace roc {
+namespace pipeline {
+
+CpuMeterFrameWriter::CpuMeterFrameWriter(audio::IFrameWriter& writer,
+                                         CpuMeter& meter,
+                                         CpuStage stage)
+    : writer_(writer)
+    , meter_(meter)
+    , stage_(stage) {
+}
+
+void CpuMeterFrameWriter::write(audio::Frame& frame) {
+    meter_.begin_stage(stage_);
+    writer_.write(frame);
+    meter_.end_stage(stage_);
+}
+
+CpuMeterPacketWriter::CpuMeterPacketWriter(packet::IWriter& writer,
+                                           CpuMeter& meter,
+                                           CpuStage stage)
+    : writer_(writer)
+    , meter_(meter)
+    , stage_(stage) {
+}
+
+status::StatusCode CpuMeterPacketWriter::write(const packet::PacketPtr& packet) {
+    meter_.begin_stage(stage_);
+    const status::StatusCode code = writer_.write(packet);
+    meter_.end_stage(stage_);
+
+    return code;
+}
+
+status::StatusCode CpuMeterPacketWriter::write_batch(const packet::PacketPtr* packets,
+                                                     size_t n_packets) {
+    meter_.begin_stage(stage_);
+    const status::StatusCode code = writer_.write_batch(packets, n_packets);
+    meter_.end_stage(stage_);
+
+    return code;
+}
+
+} // namespace pipeline
+} // namespace roc
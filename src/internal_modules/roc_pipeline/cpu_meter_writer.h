@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_pipeline/cpu_meter_writer.h
+//! @brief Writers measuring CPU time of pipeline stages.
+
+#ifndef ROC_PIPELINE_CPU_METER_WRITER_H_
+#define ROC_PIPELINE_CPU_METER_WRITER_H_
+
+#include "roc_audio/iframe_writer.h"
+#include "roc_core/noncopyable.h"
+#include "roc_packet/iwriter.h"
+#include "roc_pipeline/cpu_meter.h"
+
+namespace roc {
+namespace pipeline {
+
+//! Frame writer that measures CPU time of nested writer as a stage.
+class CpuMeterFrameWriter : public audio::IFrameWriter, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    CpuMeterFrameWriter(audio::IFrameWriter& writer, CpuMeter& meter, CpuStage stage);
+
+    //! Write frame to nested writer.
+    virtual void write(audio::Frame& frame);
+
+private:
+    audio::IFrameWriter& writer_;
+    CpuMeter& meter_;
+    const CpuStage stage_;
+};
+
+//! Packet writer that measures CPU time of nested writer as a stage.
+class CpuMeterPacketWriter : public packet::IWriter, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    CpuMeterPacketWriter(packet::IWriter& writer, CpuMeter& meter, CpuStage stage);
+
+    //! Write packet to nested writer.
+    virtual ROC_ATTR_NODISCARD status::StatusCode write(const packet::PacketPtr& packet);
+
+    //! Write multiple packets to nested writer.
+    virtual ROC_ATTR_NODISCARD status::StatusCode
+    write_batch(const packet::PacketPtr* packets, size_t n_packets);
+
+private:
+    packet::IWriter& writer_;
+    CpuMeter& meter_;
+    const CpuStage stage_;
+};
+
+} // namespace pipeline
+} // namespace roc
+
+#endif // ROC_PIPELINE_CPU_METER_WRITER_H_
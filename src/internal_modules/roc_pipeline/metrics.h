@@ -12,10 +12,17 @@
 #ifndef ROC_PIPELINE_METRICS_H_
 #define ROC_PIPELINE_METRICS_H_
 
+#include "roc_audio/depacketizer_metrics.h"
 #include "roc_audio/latency_tuner.h"
 #include "roc_core/stddefs.h"
+#include "roc_core/time.h"
+#include "roc_fec/writer.h"
 #include "roc_packet/ilink_meter.h"
+#include "roc_packet/impairer.h"
+#include "roc_packet/pacer.h"
 #include "roc_packet/units.h"
+#include "roc_pipeline/cpu_meter.h"
+#include "roc_pipeline/overload_controller.h"
 
 namespace roc {
 namespace pipeline {
@@ -43,22 +50,74 @@ struct SenderSlotMetrics {
     //! Is slot configuration complete (all endpoints bound).
     bool is_complete;
 
+    //! Number of frames written to slot.
+    uint64_t frame_count;
+
+    //! Time spent writing the most recent frame to slot.
+    //! @remarks
+    //!  Includes resampling, packetization, and FEC encoding of the frame.
+    //!  When slots are processed in parallel, measured in the worker thread.
+    core::nanoseconds_t frame_time;
+
+    //! Maximum value of frame_time.
+    core::nanoseconds_t max_frame_time;
+
+    //! Sum of frame_time of all frames.
+    core::nanoseconds_t total_frame_time;
+
+    //! CPU time spent by slot per frame, with breakdown by stages.
+    //! @remarks
+    //!  Unlike frame_time, doesn't include time when thread was preempted.
+    CpuMetrics cpu;
+
+    //! Pacer metrics.
+    //! Filled only if pacing is enabled.
+    packet::PacerMetrics pacer;
+
+    //! Network impairment metrics.
+    //! Filled only if impairment is enabled.
+    packet::ImpairerMetrics impairer;
+
+    //! FEC writer metrics.
+    //! Filled only if FEC is enabled.
+    fec::WriterMetrics fec;
+
     SenderSlotMetrics()
         : source_id(0)
         , num_participants(0)
-        , is_complete(false) {
+        , is_complete(false)
+        , frame_count(0)
+        , frame_time(0)
+        , max_frame_time(0)
+        , total_frame_time(0) {
     }
 };
 
 //! Receiver-side metrics specific to one participant (remote sender).
 struct ReceiverParticipantMetrics {
+    //! Source ID of remote sender.
+    //! @remarks
+    //!  Zero if sender's source ID is not known yet.
+    packet::stream_source_t source_id;
+
     //! Link metrics.
     packet::LinkMetrics link;
 
     //! Latency metrics.
     audio::LatencyMetrics latency;
 
-    ReceiverParticipantMetrics() {
+    //! Depacketizer metrics, including packet loss concealment.
+    audio::DepacketizerMetrics depacketizer;
+
+    //! CPU time spent by session per frame, with breakdown by stages.
+    CpuMetrics cpu;
+
+    //! Quality level currently applied to session.
+    QualityLevel quality_level;
+
+    ReceiverParticipantMetrics()
+        : source_id(0)
+        , quality_level(QualityLevel_Full) {
     }
 };
 
@@ -70,6 +129,10 @@ struct ReceiverSlotMetrics {
     //! Number of participants (remote senders) connected to slot.
     size_t num_participants;
 
+    //! Overload controller metrics.
+    //! Filled only if overload control is enabled.
+    OverloadMetrics overload;
+
     ReceiverSlotMetrics()
         : source_id(0)
         , num_participants(0) {
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_pipeline/metrics_snapshot.h
+//! @brief Lock-free metrics snapshot.
+
+#ifndef ROC_PIPELINE_METRICS_SNAPSHOT_H_
+#define ROC_PIPELINE_METRICS_SNAPSHOT_H_
+
+#include "roc_core/atomic.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/seqlock.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/time.h"
+#include "roc_pipeline/metrics.h"
+
+namespace roc {
+namespace pipeline {
+
+//! Lock-free snapshot of slot and participant metrics.
+//!
+//! Pipeline thread periodically publishes metrics of a slot and its participants,
+//! and any other thread can read the latest published snapshot without touching
+//! pipeline mutexes.
+//!
+//! Snapshot is double-buffered: publisher always writes to the buffer which is
+//! not current, and then switches current buffer. Each buffer is protected by
+//! a seqlock, so that if a reader is preempted for long enough for the publisher
+//! to wrap around and overwrite the buffer being read, the reader will detect it
+//! and retry instead of returning torn data.
+//!
+//! Snapshot holds at most @p MaxParties participants. If a slot has more
+//! participants than that, only first @p MaxParties are stored, and readers
+//! requesting more participants than were stored should fall back to querying
+//! pipeline directly.
+//!
+//! @tparam SlotMetrics defines slot metrics type, should have num_participants field.
+//! @tparam PartyMetrics defines participant metrics type.
+//! @tparam MaxParties defines maximum number of stored participants.
+template <class SlotMetrics, class PartyMetrics, size_t MaxParties>
+class MetricsSnapshot : public core::NonCopyable<> {
+public:
+    //! Snapshot contents.
+    struct Data {
+        //! Slot metrics.
+        SlotMetrics slot_metrics;
+
+        //! Participant metrics.
+        PartyMetrics party_metrics[MaxParties];
+
+        //! Number of elements in party_metrics.
+        size_t party_count;
+
+        Data()
+            : party_count(0) {
+        }
+    };
+
+    //! Initialize.
+    //! @remarks
+    //!  @p publish_interval defines how often publish_due() returns true.
+    explicit MetricsSnapshot(core::nanoseconds_t publish_interval)
+        : publish_interval_(publish_interval)
+        , next_publish_time_(0)
+        , buf0_(Data())
+        , buf1_(Data())
+        , curr_(-1) {
+    }
+
+    //! Maximum number of participants in snapshot.
+    static size_t max_parties() {
+        return MaxParties;
+    }
+
+    //! Check if it's time to publish new snapshot.
+    //! @remarks
+    //!  Should be called only from publishing thread.
+    bool publish_due(core::nanoseconds_t current_time) {
+        if (current_time < next_publish_time_) {
+            return false;
+        }
+        next_publish_time_ = current_time + publish_interval_;
+        return true;
+    }
+
+    //! Get scratch buffer to be filled and passed to publish().
+    //! @remarks
+    //!  Should be called only from publishing thread.
+    Data& scratch() {
+        return scratch_;
+    }
+
+    //! Publish new snapshot.
+    //! @remarks
+    //!  Should be called only from publishing thread. Calls should be serialized.
+    //!  Lock-free and wait-free.
+    void publish(const Data& data) {
+        const int next = (curr_ == 0 ? 1 : 0);
+
+        buffer_(next).exclusive_store(data);
+        curr_ = next;
+    }
+
+    //! Read latest published snapshot.
+    //! @remarks
+    //!  Can be called from any thread. Lock-free.
+    //!  If @p party_metrics and @p party_count are non-NULL, up to @p party_count
+    //!  participants are copied and @p party_count is updated with actual number.
+    //! @returns
+    //!  false if nothing was published yet, if concurrent publishing didn't
+    //!  allow to get consistent snapshot, or if snapshot was truncated and
+    //!  can't provide as many participants as requested.
+    bool read(SlotMetrics& slot_metrics,
+              PartyMetrics* party_metrics,
+              size_t* party_count) const {
+        Data data;
+
+        for (int attempt = 0; attempt < MaxReadAttempts; attempt++) {
+            const int curr = curr_;
+            if (curr < 0) {
+                return false;
+            }
+
+            if (!buffer_(curr).try_load(data)) {
+                continue;
+            }
+
+            return copy_out_(data, slot_metrics, party_metrics, party_count);
+        }
+
+        return false;
+    }
+
+private:
+    enum { MaxReadAttempts = 3 };
+
+    static bool copy_out_(const Data& data,
+                          SlotMetrics& slot_metrics,
+                          PartyMetrics* party_metrics,
+                          size_t* party_count) {
+        if (party_metrics && party_count) {
+            if (*party_count > data.party_count
+                && data.party_count < data.slot_metrics.num_participants) {
+                // Snapshot was truncated and can't satisfy request.
+                return false;
+            }
+
+            *party_count = std::min(*party_count, data.party_count);
+
+            for (size_t n = 0; n < *party_count; n++) {
+                party_metrics[n] = data.party_metrics[n];
+            }
+        } else if (party_count) {
+            *party_count = 0;
+        }
+
+        slot_metrics = data.slot_metrics;
+
+        return true;
+    }
+
+    core::Seqlock<Data>& buffer_(int n) {
+        return n == 0 ? buf0_ : buf1_;
+    }
+
+    const core::Seqlock<Data>& buffer_(int n) const {
+        return n == 0 ? buf0_ : buf1_;
+    }
+
+    const core::nanoseconds_t publish_interval_;
+    core::nanoseconds_t next_publish_time_;
+
+    Data scratch_;
+
+    core::Seqlock<Data> buf0_;
+    core::Seqlock<Data> buf1_;
+
+    core::Atomic<int> curr_;
+};
+
+//! Maximum number of participants in slot metrics snapshot.
+const size_t MaxSnapshotParticipants = 32;
+
+//! Receiver slot metrics snapshot.
+typedef MetricsSnapshot<ReceiverSlotMetrics,
+                        ReceiverParticipantMetrics,
+                        MaxSnapshotParticipants>
+    ReceiverMetricsSnapshot;
+
+//! Sender slot metrics snapshot.
+typedef MetricsSnapshot<SenderSlotMetrics,
+                        SenderParticipantMetrics,
+                        MaxSnapshotParticipants>
+    SenderMetricsSnapshot;
+
+} // namespace pipeline
+} // namespace roc
+
+#endif // ROC_PIPELINE_METRICS_SNAPSHOT_H_
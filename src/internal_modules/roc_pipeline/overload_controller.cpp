@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_pipeline/overload_controller.h"
+#include "roc_audio/resampler_map.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace pipeline {
+
+const char* quality_level_to_str(QualityLevel level) {
+    switch (level) {
+    case QualityLevel_Full:
+        return "full";
+
+    case QualityLevel_Reduced:
+        return "reduced";
+
+    case QualityLevel_Low:
+        return "low";
+
+    case QualityLevel_Fast:
+        return "fast";
+
+    case QualityLevel_NoRepair:
+        return "norepair";
+
+    case QualityLevel_Max:
+        break;
+    }
+
+    return "invalid";
+}
+
+audio::ResamplerConfig degrade_resampler_config(const audio::ResamplerConfig& config,
+                                                QualityLevel level) {
+    audio::ResamplerConfig result = config;
+
+    if (level >= QualityLevel_Reduced && result.profile != audio::ResamplerProfile_Low) {
+        result.profile = audio::ResamplerProfile(result.profile - 1);
+    }
+
+    if (level >= QualityLevel_Low) {
+        result.profile = audio::ResamplerProfile_Low;
+    }
+
+    // Builtin backend is the slowest one. SpeexDec keeps tolerable scaling
+    // precision, which is needed for latency tuning.
+    if (level >= QualityLevel_Fast && result.backend == audio::ResamplerBackend_Builtin
+        && audio::ResamplerMap::instance().is_supported(
+            audio::ResamplerBackend_SpeexDec)) {
+        result.backend = audio::ResamplerBackend_SpeexDec;
+    }
+
+    return result;
+}
+
+bool quality_level_has_repair(QualityLevel level) {
+    return level < QualityLevel_NoRepair;
+}
+
+OverloadController::OverloadController(const OverloadConfig& config,
+                                       const audio::ResamplerConfig& resampler_config)
+    : config_(config)
+    , resampler_config_(resampler_config)
+    , win_duration_(0)
+    , win_processing_time_(0)
+    , overload_duration_(0)
+    , underload_duration_(0) {
+    roc_panic_if_msg(config.window <= 0,
+                     "overload controller: window should be positive");
+
+    roc_panic_if_msg(config.max_level < QualityLevel_Full
+                         || config.max_level >= QualityLevel_Max,
+                     "overload controller: invalid max level");
+
+    roc_log(LogDebug,
+            "overload controller: initializing:"
+            " high_load=%.3f low_load=%.3f window=%.3fms"
+            " step_down_delay=%.3fms step_up_delay=%.3fms max_level=%s",
+            (double)config.high_load, (double)config.low_load,
+            (double)config.window / core::Millisecond,
+            (double)config.step_down_delay / core::Millisecond,
+            (double)config.step_up_delay / core::Millisecond,
+            quality_level_to_str(config.max_level));
+}
+
+QualityLevel OverloadController::level() const {
+    return metrics_.level;
+}
+
+const OverloadMetrics& OverloadController::metrics() const {
+    return metrics_;
+}
+
+bool OverloadController::report_frame(core::nanoseconds_t frame_duration,
+                                      core::nanoseconds_t processing_time) {
+    if (frame_duration <= 0) {
+        return false;
+    }
+
+    win_duration_ += frame_duration;
+    win_processing_time_ += std::max(processing_time, (core::nanoseconds_t)0);
+
+    if (win_duration_ < config_.window) {
+        return false;
+    }
+
+    metrics_.load = float((double)win_processing_time_ / (double)win_duration_);
+
+    update_level_(metrics_.load);
+
+    win_duration_ = 0;
+    win_processing_time_ = 0;
+
+    return true;
+}
+
+void OverloadController::update_level_(float load) {
+    if (load > config_.high_load) {
+        overload_duration_ += win_duration_;
+        underload_duration_ = 0;
+    } else if (load < config_.low_load) {
+        underload_duration_ += win_duration_;
+        overload_duration_ = 0;
+    } else {
+        overload_duration_ = 0;
+        underload_duration_ = 0;
+    }
+
+    if (overload_duration_ >= config_.step_down_delay) {
+        overload_duration_ = 0;
+
+        QualityLevel level = metrics_.level;
+        while (level < config_.max_level) {
+            level = QualityLevel(level + 1);
+            if (has_effect_(level)) {
+                break;
+            }
+        }
+
+        if (level != metrics_.level && has_effect_(level)) {
+            metrics_.level = level;
+            metrics_.step_down_count++;
+
+            roc_log(LogInfo,
+                    "overload controller: stepping quality down: level=%s load=%.3f",
+                    quality_level_to_str(metrics_.level), (double)load);
+        }
+    }
+
+    if (underload_duration_ >= config_.step_up_delay) {
+        underload_duration_ = 0;
+
+        if (metrics_.level > QualityLevel_Full) {
+            QualityLevel level = QualityLevel(metrics_.level - 1);
+            while (!has_effect_(level)) {
+                level = QualityLevel(level - 1);
+            }
+
+            metrics_.level = level;
+            metrics_.step_up_count++;
+
+            roc_log(LogInfo,
+                    "overload controller: stepping quality up: level=%s load=%.3f",
+                    quality_level_to_str(metrics_.level), (double)load);
+        }
+    }
+}
+
+// Check if level degrades anything compared to previous level.
+bool OverloadController::has_effect_(QualityLevel level) const {
+    if (level == QualityLevel_Full) {
+        return true;
+    }
+
+    const QualityLevel prev_level = QualityLevel(level - 1);
+
+    if (quality_level_has_repair(level) != quality_level_has_repair(prev_level)) {
+        return true;
+    }
+
+    const audio::ResamplerConfig config =
+        degrade_resampler_config(resampler_config_, level);
+    const audio::ResamplerConfig prev_config =
+        degrade_resampler_config(resampler_config_, prev_level);
+
+    return config.backend != prev_config.backend
+        || config.profile != prev_config.profile;
+}
+
+} // namespace pipeline
+} // namespace roc
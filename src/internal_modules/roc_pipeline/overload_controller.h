@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_pipeline/overload_controller.h
+//! @brief CPU overload controller.
+
+#ifndef ROC_PIPELINE_OVERLOAD_CONTROLLER_H_
+#define ROC_PIPELINE_OVERLOAD_CONTROLLER_H_
+
+#include "roc_audio/resampler_config.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace pipeline {
+
+//! Quality level of session processing.
+//! @remarks
+//!  Levels are ordered from best to cheapest. Every level includes all
+//!  degradations of previous levels.
+enum QualityLevel {
+    //! Configured quality.
+    QualityLevel_Full,
+
+    //! Resampler profile is lowered by one step.
+    QualityLevel_Reduced,
+
+    //! Resampler profile is lowered to lowest.
+    QualityLevel_Low,
+
+    //! Resampler backend is switched to faster one.
+    QualityLevel_Fast,
+
+    //! FEC repair is skipped.
+    QualityLevel_NoRepair,
+
+    //! Number of levels.
+    QualityLevel_Max
+};
+
+//! Get string name of quality level.
+const char* quality_level_to_str(QualityLevel level);
+
+//! Get resampler config for given quality level.
+//! @remarks
+//!  Returns @p config with profile and backend lowered according to @p level.
+audio::ResamplerConfig degrade_resampler_config(const audio::ResamplerConfig& config,
+                                                QualityLevel level);
+
+//! Check if FEC repair should be performed at given quality level.
+bool quality_level_has_repair(QualityLevel level);
+
+//! Overload controller parameters.
+struct OverloadConfig {
+    //! Enable automatic quality degradation under overload.
+    bool enable;
+
+    //! Load above which quality is stepped down.
+    //! @remarks
+    //!  Load is the ratio of time spent processing frames to their duration,
+    //!  i.e. 1.0 means that processing hits frame deadline.
+    float high_load;
+
+    //! Load below which quality is stepped up.
+    //! @remarks
+    //!  Should be lower than high_load, to avoid oscillation.
+    float low_load;
+
+    //! Period of stream time over which load is averaged.
+    core::nanoseconds_t window;
+
+    //! How long load should stay above high_load before stepping down.
+    core::nanoseconds_t step_down_delay;
+
+    //! How long load should stay below low_load before stepping up.
+    core::nanoseconds_t step_up_delay;
+
+    //! Cheapest quality level that controller can select.
+    QualityLevel max_level;
+
+    OverloadConfig()
+        : enable(false)
+        , high_load(0.75f)
+        , low_load(0.35f)
+        , window(100 * core::Millisecond)
+        , step_down_delay(300 * core::Millisecond)
+        , step_up_delay(5 * core::Second)
+        , max_level(QualityLevel_NoRepair) {
+    }
+};
+
+//! Overload controller metrics.
+struct OverloadMetrics {
+    //! Current quality level.
+    QualityLevel level;
+
+    //! Load averaged over last window.
+    float load;
+
+    //! Number of times quality was stepped down.
+    uint64_t step_down_count;
+
+    //! Number of times quality was stepped up.
+    uint64_t step_up_count;
+
+    OverloadMetrics()
+        : level(QualityLevel_Full)
+        , load(0)
+        , step_down_count(0)
+        , step_up_count(0) {
+    }
+};
+
+//! CPU overload controller.
+//! @remarks
+//!  Watches how much time is spent processing every frame compared to the
+//!  frame duration, which is the deadline for real-time processing. When
+//!  load stays too high, selects cheaper quality level, one step at a time.
+//!  When load stays low long enough, steps quality back up.
+//!
+//!  Hysteresis is provided by separate thresholds for stepping down and up,
+//!  and by separate delays, which are normally much longer for stepping up.
+//!
+//!  Levels that make no difference for sessions resampler config, e.g.
+//!  QualityLevel_Fast when backend is already fast, are skipped in both
+//!  directions, so that every step actually changes processing.
+//!
+//!  Controller only selects level; applying it to sessions is done by caller.
+//!  All durations are measured in stream time, so controller itself doesn't
+//!  depend on clock.
+class OverloadController : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  @p resampler_config defines resampler config of sessions, with
+    //!  defaults already deduced.
+    OverloadController(const OverloadConfig& config,
+                       const audio::ResamplerConfig& resampler_config);
+
+    //! Get current quality level.
+    QualityLevel level() const;
+
+    //! Get metrics.
+    const OverloadMetrics& metrics() const;
+
+    //! Report processed frame.
+    //! @remarks
+    //!  @p frame_duration is duration of the frame, and @p processing_time
+    //!  is how long it took to produce it.
+    //! @returns
+    //!  true if metrics were updated, which happens every window.
+    bool report_frame(core::nanoseconds_t frame_duration,
+                      core::nanoseconds_t processing_time);
+
+private:
+    void update_level_(float load);
+    bool has_effect_(QualityLevel level) const;
+
+    const OverloadConfig config_;
+    const audio::ResamplerConfig resampler_config_;
+
+    core::nanoseconds_t win_duration_;
+    core::nanoseconds_t win_processing_time_;
+
+    core::nanoseconds_t overload_duration_;
+    core::nanoseconds_t underload_duration_;
+
+    OverloadMetrics metrics_;
+};
+
+} // namespace pipeline
+} // namespace roc
+
+#endif // ROC_PIPELINE_OVERLOAD_CONTROLLER_H_
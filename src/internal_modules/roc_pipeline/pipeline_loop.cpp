@@ -277,6 +277,24 @@ bool PipelineLoop::process_subframes_and_tasks_precise_(audio::Frame& frame) {
     return frame_res;
 }
 
+core::nanoseconds_t PipelineLoop::process_refresh(core::nanoseconds_t current_time) {
+    ++pending_frames_;
+
+    cancel_async_task_processing_();
+
+    pipeline_mutex_.lock();
+
+    const core::nanoseconds_t next_deadline = refresh_imp(current_time);
+
+    pipeline_mutex_.unlock();
+
+    if (--pending_frames_ == 0 && pending_tasks_ != 0) {
+        schedule_async_task_processing_();
+    }
+
+    return next_deadline;
+}
+
 void PipelineLoop::schedule_async_task_processing_() {
     core::nanoseconds_t next_frame_deadline;
     if (!next_frame_deadline_.try_load(next_frame_deadline)) {
@@ -296,6 +296,15 @@ protected:
     //! Split frame and process subframes and some of the enqueued tasks.
     bool process_subframes_and_tasks(audio::Frame& frame);
 
+    //! Refresh pipeline between frames.
+    //! @remarks
+    //!  Invokes refresh_imp() with pipeline locked, in the same way as
+    //!  process_subframes_and_tasks() invokes process_subframe_imp().
+    //!  Should be called from the thread that processes frames.
+    //! @returns
+    //!  deadline returned by refresh_imp().
+    core::nanoseconds_t process_refresh(core::nanoseconds_t current_time);
+
     //! Get current time.
     virtual core::nanoseconds_t timestamp_imp() const = 0;
 
@@ -308,6 +317,12 @@ protected:
     //! Process task.
     virtual bool process_task_imp(PipelineTask& task) = 0;
 
+    //! Refresh pipeline.
+    //! @returns
+    //!  deadline (absolute time) when refresh should be invoked again,
+    //!  or zero if there is no deadline.
+    virtual core::nanoseconds_t refresh_imp(core::nanoseconds_t current_time) = 0;
+
 private:
     enum ProcState { ProcNotScheduled, ProcScheduled, ProcRunning };
 
@@ -18,6 +18,13 @@
 namespace roc {
 namespace pipeline {
 
+namespace {
+
+// Maximum number of packets routed to sessions at once.
+const size_t MaxPullBatch = 32;
+
+} // namespace
+
 ReceiverEndpoint::ReceiverEndpoint(address::Protocol proto,
                                    StateTracker& state_tracker,
                                    ReceiverSessionGroup& session_group,
@@ -193,18 +200,43 @@ status::StatusCode ReceiverEndpoint::pull_packets(core::nanoseconds_t current_ti
 
     roc_panic_if(!parser_);
 
-    // Using try_pop_front_exclusive() makes this method lock-free and wait-free.
-    // It may return NULL either if the queue is empty or if the packets in the
-    // queue were added in a very short time or are being added currently. It's
-    // acceptable to consider such packets late and pull them next time.
-    while (packet::PacketPtr packet = inbound_queue_.try_pop_front_exclusive()) {
-        if (!parser_->parse(*packet, packet->buffer())) {
-            roc_log(LogDebug, "receiver endpoint: can't parse packet");
-            continue;
+    packet::PacketPtr batch[MaxPullBatch];
+
+    for (;;) {
+        size_t n_batch = 0;
+
+        // Using try_pop_front_exclusive() makes this method lock-free and wait-free.
+        // It may return NULL either if the queue is empty or if the packets in the
+        // queue were added in a very short time or are being added currently. It's
+        // acceptable to consider such packets late and pull them next time.
+        while (n_batch < MaxPullBatch) {
+            packet::PacketPtr packet = inbound_queue_.try_pop_front_exclusive();
+            if (!packet) {
+                break;
+            }
+
+            if (!parser_->parse(*packet, packet->buffer())) {
+                roc_log(LogDebug, "receiver endpoint: can't parse packet");
+                continue;
+            }
+
+            packet.transfer_to(batch[n_batch++]);
+        }
+
+        if (n_batch == 0) {
+            break;
+        }
+
+        // Route parsed packets in one burst, so that consecutive packets of
+        // the same session pass through session pipeline together.
+        const status::StatusCode code =
+            session_group_.route_packets(batch, n_batch, current_time);
+        state_tracker_.add_pending_packets(-(int)n_batch);
+
+        for (size_t n = 0; n < n_batch; n++) {
+            batch[n] = NULL;
         }
 
-        const status::StatusCode code = session_group_.route_packet(packet, current_time);
-        state_tracker_.add_pending_packets(-1);
         if (code != status::StatusOK) {
             return code;
         }
@@ -24,7 +24,10 @@ ReceiverLoop::Task::Task()
     , outbound_writer_(NULL)
     , slot_metrics_(NULL)
     , party_metrics_(NULL)
-    , party_count_(NULL) {
+    , party_count_(NULL)
+    , source_id_(0)
+    , frame_(NULL)
+    , status_(status::StatusUnknown) {
 }
 
 ReceiverLoop::Tasks::CreateSlot::CreateSlot(const ReceiverSlotConfig& slot_config) {
@@ -62,6 +65,22 @@ ReceiverLoop::Tasks::QuerySlot::QuerySlot(SlotHandle slot,
     party_count_ = party_count;
 }
 
+ReceiverLoop::Tasks::ReadSession::ReadSession(SlotHandle slot,
+                                              packet::stream_source_t source_id,
+                                              audio::Frame& frame) {
+    func_ = &ReceiverLoop::task_read_session_;
+    if (!slot) {
+        roc_panic("receiver loop: slot handle is null");
+    }
+    slot_ = (ReceiverSlot*)slot;
+    source_id_ = source_id;
+    frame_ = &frame;
+}
+
+status::StatusCode ReceiverLoop::Tasks::ReadSession::get_status() const {
+    return status_;
+}
+
 ReceiverLoop::Tasks::AddEndpoint::AddEndpoint(SlotHandle slot,
                                               address::Interface iface,
                                               address::Protocol proto,
@@ -110,7 +129,8 @@ ReceiverLoop::ReceiverLoop(IPipelineTaskScheduler& scheduler,
 
     if (source_config.common.enable_timing) {
         ticker_.reset(new (ticker_) core::Ticker(
-            source_config.common.output_sample_spec.sample_rate()));
+            source_config.common.output_sample_spec.sample_rate(),
+            source_config.common.timing));
         if (!ticker_) {
             return;
         }
@@ -129,6 +149,33 @@ sndio::ISource& ReceiverLoop::source() {
     return *this;
 }
 
+bool ReceiverLoop::get_timing_metrics(core::TickerMetrics& metrics) const {
+    roc_panic_if(!is_valid());
+
+    if (!ticker_) {
+        return false;
+    }
+
+    core::Mutex::Lock lock(ticker_mutex_);
+
+    metrics = ticker_metrics_;
+    return true;
+}
+
+bool ReceiverLoop::read_slot_snapshot(SlotHandle slot,
+                                      ReceiverSlotMetrics& slot_metrics,
+                                      ReceiverParticipantMetrics* party_metrics,
+                                      size_t* party_count) const {
+    roc_panic_if(!is_valid());
+
+    if (!slot) {
+        roc_panic("receiver loop: slot handle is null");
+    }
+
+    return ((const ReceiverSlot*)slot)
+        ->get_metrics_snapshot(slot_metrics, party_metrics, party_count);
+}
+
 sndio::ISink* ReceiverLoop::to_sink() {
     roc_panic_if(!is_valid());
 
@@ -232,6 +279,9 @@ bool ReceiverLoop::read(audio::Frame& frame) {
 
     if (ticker_) {
         ticker_->wait(ticker_ts_);
+
+        core::Mutex::Lock ticker_lock(ticker_mutex_);
+        ticker_metrics_ = ticker_->metrics();
     }
 
     // invokes process_subframe_imp() and process_task_imp()
@@ -270,6 +320,10 @@ bool ReceiverLoop::process_task_imp(PipelineTask& basic_task) {
     return (this->*(task.func_))(task);
 }
 
+core::nanoseconds_t ReceiverLoop::refresh_imp(core::nanoseconds_t current_time) {
+    return source_.refresh(current_time);
+}
+
 bool ReceiverLoop::task_create_slot_(Task& task) {
     task.slot_ = source_.create_slot(task.slot_config_);
     return (bool)task.slot_;
@@ -290,6 +344,14 @@ bool ReceiverLoop::task_query_slot_(Task& task) {
     return true;
 }
 
+bool ReceiverLoop::task_read_session_(Task& task) {
+    roc_panic_if(!task.slot_);
+    roc_panic_if(!task.frame_);
+
+    task.status_ = source_.read_session(task.slot_, task.source_id_, *task.frame_);
+    return task.status_ == status::StatusOK;
+}
+
 bool ReceiverLoop::task_add_endpoint_(Task& task) {
     roc_panic_if(!task.slot_);
 
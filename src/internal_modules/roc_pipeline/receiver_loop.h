@@ -17,11 +17,13 @@
 #include "roc_core/mutex.h"
 #include "roc_core/optional.h"
 #include "roc_core/stddefs.h"
+#include "roc_core/ticker.h"
 #include "roc_pipeline/config.h"
 #include "roc_pipeline/metrics.h"
 #include "roc_pipeline/pipeline_loop.h"
 #include "roc_pipeline/receiver_source.h"
 #include "roc_sndio/isource.h"
+#include "roc_status/status_code.h"
 
 namespace roc {
 namespace pipeline {
@@ -67,6 +69,9 @@ public:
         ReceiverSlotMetrics* slot_metrics_;         //!< Output slot metrics.
         ReceiverParticipantMetrics* party_metrics_; //!< Output participant metrics.
         size_t* party_count_;                       //!< Input/output participant count.
+        packet::stream_source_t source_id_;         //!< Remote sender source ID.
+        audio::Frame* frame_;                       //!< Output frame.
+        status::StatusCode status_;                 //!< Operation status.
     };
 
     //! Subclasses for specific tasks.
@@ -101,6 +106,25 @@ public:
                       size_t* party_count);
         };
 
+        //! Read frame from a single session of the slot.
+        class ReadSession : public Task {
+        public:
+            //! Set task parameters.
+            //! @remarks
+            //!  Reads frame of the session, which remote sender has given source ID,
+            //!  into provided frame. Can be used only if unmixed output is enabled.
+            //!  Source IDs of connected senders can be obtained via QuerySlot.
+            ReadSession(SlotHandle slot,
+                        packet::stream_source_t source_id,
+                        audio::Frame& frame);
+
+            //! Get status of read operation.
+            //! @returns
+            //!  status::StatusOK if frame was read, status::StatusNoData if there
+            //!  is no such session, or error code if reading failed.
+            status::StatusCode get_status() const;
+        };
+
         //! Create endpoint on given interface of the slot.
         class AddEndpoint : public Task {
         public:
@@ -138,6 +162,29 @@ public:
     //!  Samples received from remote peers become available in this source.
     sndio::ISource& source();
 
+    //! Get metrics of CPU timer.
+    //! @remarks
+    //!  Can be used from any thread.
+    //! @returns
+    //!  false if timing is disabled.
+    bool get_timing_metrics(core::TickerMetrics& metrics) const;
+
+    //! Read latest published metrics snapshot of the slot.
+    //! @remarks
+    //!  Unlike QuerySlot task, doesn't acquire pipeline mutexes and never
+    //!  waits for frame processing. Snapshot is updated by pipeline once per
+    //!  RTCP report interval, so returned metrics may be stale by up to that
+    //!  interval (rtcp::Config::report_interval).
+    //!  Can be used from any thread, but caller should ensure that the slot
+    //!  is not deleted concurrently.
+    //! @returns
+    //!  false if snapshot is not available yet or can't provide requested
+    //!  number of participants; QuerySlot task should be used in this case.
+    bool read_slot_snapshot(SlotHandle slot,
+                            ReceiverSlotMetrics& slot_metrics,
+                            ReceiverParticipantMetrics* party_metrics,
+                            size_t* party_count) const;
+
 private:
     // Methods of sndio::ISource
     virtual sndio::ISink* to_sink();
@@ -159,11 +206,13 @@ private:
     virtual uint64_t tid_imp() const;
     virtual bool process_subframe_imp(audio::Frame& frame);
     virtual bool process_task_imp(PipelineTask& task);
+    virtual core::nanoseconds_t refresh_imp(core::nanoseconds_t current_time);
 
     // Methods for tasks
     bool task_create_slot_(Task& task);
     bool task_delete_slot_(Task& task);
     bool task_query_slot_(Task& task);
+    bool task_read_session_(Task& task);
     bool task_add_endpoint_(Task& task);
 
     ReceiverSource source_;
@@ -172,6 +221,11 @@ private:
     core::Optional<core::Ticker> ticker_;
     core::Ticker::ticks_t ticker_ts_;
 
+    // Copy of ticker metrics, updated after every wait, to allow
+    // reading them without waiting for source_mutex_.
+    core::TickerMetrics ticker_metrics_;
+    core::Mutex ticker_mutex_;
+
     const bool auto_reclock_;
 
     bool valid_;
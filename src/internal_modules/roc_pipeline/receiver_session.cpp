@@ -7,6 +7,7 @@
  */
 
 #include "roc_pipeline/receiver_session.h"
+#include "roc_audio/plc_map.h"
 #include "roc_audio/resampler_map.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
@@ -15,6 +16,17 @@
 namespace roc {
 namespace pipeline {
 
+namespace {
+
+// Size of chunks allocated for session components. Most components are
+// stored inline in session, so typical session fits into a single chunk.
+const size_t SessionArenaChunkSize = 4 * 1024;
+
+// Number of frames used to compute CPU time averages and maximums.
+const size_t CpuMeterWindow = 100;
+
+} // namespace
+
 ReceiverSession::ReceiverSession(const ReceiverSessionConfig& session_config,
                                  const ReceiverCommonConfig& common_config,
                                  const rtp::EncodingMap& encoding_map,
@@ -22,17 +34,59 @@ ReceiverSession::ReceiverSession(const ReceiverSessionConfig& session_config,
                                  audio::FrameFactory& frame_factory,
                                  core::IArena& arena)
     : core::RefCounted<ReceiverSession, core::ArenaAllocation>(arena)
+    , session_arena_(arena, SessionArenaChunkSize)
+    , common_config_(common_config)
+    , encoding_map_(encoding_map)
+    , packet_factory_(packet_factory)
+    , frame_factory_(frame_factory)
     , frame_reader_(NULL)
+    , quality_level_(QualityLevel_Full)
+    , passthrough_(false)
     , valid_(false) {
+    valid_ = init_(session_config);
+}
+
+ReceiverSession::~ReceiverSession() {
+    deinit_();
+}
+
+bool ReceiverSession::is_valid() const {
+    return valid_;
+}
+
+void ReceiverSession::recycle() {
+    deinit_();
+    session_arena_.rewind();
+}
+
+bool ReceiverSession::reset(const ReceiverSessionConfig& session_config) {
+    recycle();
+
+    valid_ = init_(session_config);
+    return valid_;
+}
+
+bool ReceiverSession::init_(const ReceiverSessionConfig& session_config) {
+    const ReceiverCommonConfig& common_config = common_config_;
+    const rtp::EncodingMap& encoding_map = encoding_map_;
+    packet::PacketFactory& packet_factory = packet_factory_;
+    audio::FrameFactory& frame_factory = frame_factory_;
+    core::IArena& arena = session_arena_;
+
     const rtp::Encoding* pkt_encoding =
         encoding_map.find_by_pt(session_config.payload_type);
     if (!pkt_encoding) {
-        return;
+        return false;
+    }
+
+    cpu_meter_.reset(new (cpu_meter_) CpuMeter(CpuMeterWindow));
+    if (!cpu_meter_) {
+        return false;
     }
 
     packet_router_.reset(new (packet_router_) packet::Router(arena));
     if (!packet_router_) {
-        return;
+        return false;
     }
 
     // First part of pipeline: chained packet writers from endpoint to queues.
@@ -42,19 +96,19 @@ ReceiverSession::ReceiverSession(const ReceiverSessionConfig& session_config,
 
     source_queue_.reset(new (source_queue_) packet::SortedQueue(0));
     if (!source_queue_) {
-        return;
+        return false;
     }
     pkt_writer = source_queue_.get();
 
     source_meter_.reset(new (source_meter_) rtp::LinkMeter(encoding_map));
     if (!source_meter_) {
-        return;
+        return false;
     }
     source_meter_->set_writer(*pkt_writer);
     pkt_writer = source_meter_.get();
 
     if (!packet_router_->add_route(*pkt_writer, packet::Packet::FlagAudio)) {
-        return;
+        return false;
     }
 
     // Second part of pipeline: chained packet readers from queues to depacketizer.
@@ -65,21 +119,26 @@ ReceiverSession::ReceiverSession(const ReceiverSessionConfig& session_config,
     payload_decoder_.reset(pkt_encoding->new_decoder(arena, pkt_encoding->sample_spec),
                            arena);
     if (!payload_decoder_) {
-        return;
+        return false;
     }
 
     filter_.reset(new (filter_)
                       rtp::Filter(*pkt_reader, *payload_decoder_,
                                   common_config.rtp_filter, pkt_encoding->sample_spec));
     if (!filter_) {
-        return;
+        return false;
     }
     pkt_reader = filter_.get();
 
+    // With fast start, playback begins when start latency is accumulated,
+    // and then latency tuner slowly grows latency up to target.
     delayed_reader_.reset(new (delayed_reader_) packet::DelayedReader(
-        *pkt_reader, session_config.latency.target_latency, pkt_encoding->sample_spec));
+        *pkt_reader,
+        session_config.latency.start_latency > 0 ? session_config.latency.start_latency
+                                                 : session_config.latency.target_latency,
+        pkt_encoding->sample_spec));
     if (!delayed_reader_ || !delayed_reader_->is_valid()) {
-        return;
+        return false;
     }
     pkt_reader = delayed_reader_.get();
 
@@ -89,44 +148,51 @@ ReceiverSession::ReceiverSession(const ReceiverSessionConfig& session_config,
     if (session_config.fec_decoder.scheme != packet::FEC_None) {
         repair_queue_.reset(new (repair_queue_) packet::SortedQueue(0));
         if (!repair_queue_) {
-            return;
+            return false;
         }
 
         repair_meter_.reset(new (repair_meter_) rtp::LinkMeter(encoding_map));
         if (!repair_meter_) {
-            return;
+            return false;
         }
         repair_meter_->set_writer(*repair_queue_);
 
         if (!packet_router_->add_route(*repair_meter_, packet::Packet::FlagRepair)) {
-            return;
+            return false;
         }
 
         fec_decoder_.reset(fec::CodecMap::instance().new_decoder(
                                session_config.fec_decoder, packet_factory, arena),
                            arena);
         if (!fec_decoder_) {
-            return;
+            return false;
         }
 
         fec_parser_.reset(new (fec_parser_) rtp::Parser(encoding_map, NULL));
         if (!fec_parser_) {
-            return;
+            return false;
         }
 
         fec_reader_.reset(new (fec_reader_) fec::Reader(
             session_config.fec_reader, session_config.fec_decoder.scheme, *fec_decoder_,
             *pkt_reader, *repair_queue_, *fec_parser_, packet_factory, arena));
         if (!fec_reader_ || !fec_reader_->is_valid()) {
-            return;
+            return false;
         }
         pkt_reader = fec_reader_.get();
 
+        fec_meter_reader_.reset(new (fec_meter_reader_) CpuMeterPacketReader(
+            *pkt_reader, *cpu_meter_, CpuStage_Fec));
+        if (!fec_meter_reader_) {
+            return false;
+        }
+        pkt_reader = fec_meter_reader_.get();
+
         fec_filter_.reset(new (fec_filter_) rtp::Filter(*pkt_reader, *payload_decoder_,
                                                         common_config.rtp_filter,
                                                         pkt_encoding->sample_spec));
         if (!fec_filter_) {
-            return;
+            return false;
         }
         pkt_reader = fec_filter_.get();
 
@@ -137,7 +203,7 @@ ReceiverSession::ReceiverSession(const ReceiverSessionConfig& session_config,
     timestamp_injector_.reset(new (timestamp_injector_) rtp::TimestampInjector(
         *pkt_reader, pkt_encoding->sample_spec));
     if (!timestamp_injector_) {
-        return;
+        return false;
     }
     pkt_reader = timestamp_injector_.get();
 
@@ -151,19 +217,38 @@ ReceiverSession::ReceiverSession(const ReceiverSessionConfig& session_config,
                                          audio::Sample_RawFormat,
                                          pkt_encoding->sample_spec.channel_set());
 
+        if (session_config.plc.backend != audio::PlcBackend_None) {
+            plc_.reset(
+                audio::PlcMap::instance().new_plc(arena, session_config.plc, out_spec),
+                arena);
+            if (!plc_) {
+                return false;
+            }
+        }
+
         depacketizer_.reset(new (depacketizer_) audio::Depacketizer(
             *pkt_reader, *payload_decoder_, out_spec, session_config.enable_beeping));
         if (!depacketizer_ || !depacketizer_->is_valid()) {
-            return;
+            return false;
+        }
+        if (plc_) {
+            depacketizer_->enable_plc(*plc_);
         }
         frm_reader = depacketizer_.get();
 
+        codec_meter_reader_.reset(new (codec_meter_reader_) CpuMeterFrameReader(
+            *frm_reader, *cpu_meter_, CpuStage_Codec));
+        if (!codec_meter_reader_) {
+            return false;
+        }
+        frm_reader = codec_meter_reader_.get();
+
         if (session_config.watchdog.no_playback_timeout >= 0
             || session_config.watchdog.choppy_playback_timeout >= 0) {
             watchdog_.reset(new (watchdog_) audio::Watchdog(
                 *frm_reader, out_spec, session_config.watchdog, arena));
             if (!watchdog_ || !watchdog_->is_valid()) {
-                return;
+                return false;
             }
             frm_reader = watchdog_.get();
         }
@@ -183,7 +268,7 @@ ReceiverSession::ReceiverSession(const ReceiverSessionConfig& session_config,
             new (channel_mapper_reader_) audio::ChannelMapperReader(
                 *frm_reader, frame_factory, in_spec, out_spec));
         if (!channel_mapper_reader_ || !channel_mapper_reader_->is_valid()) {
-            return;
+            return false;
         }
         frm_reader = channel_mapper_reader_.get();
     }
@@ -202,15 +287,27 @@ ReceiverSession::ReceiverSession(const ReceiverSessionConfig& session_config,
         resampler_.reset(audio::ResamplerMap::instance().new_resampler(
             arena, frame_factory, session_config.resampler, in_spec, out_spec));
         if (!resampler_) {
-            return;
+            return false;
         }
 
+        // Remember parameters to be able to replace resampler later.
+        resampler_config_ = session_config.resampler;
+        resampler_in_spec_ = in_spec;
+        resampler_out_spec_ = out_spec;
+
         resampler_reader_.reset(new (resampler_reader_) audio::ResamplerReader(
             *frm_reader, *resampler_, in_spec, out_spec));
         if (!resampler_reader_ || !resampler_reader_->is_valid()) {
-            return;
+            return false;
         }
         frm_reader = resampler_reader_.get();
+
+        resampler_meter_reader_.reset(new (resampler_meter_reader_) CpuMeterFrameReader(
+            *frm_reader, *cpu_meter_, CpuStage_Resampler));
+        if (!resampler_meter_reader_) {
+            return false;
+        }
+        frm_reader = resampler_meter_reader_.get();
     }
 
     latency_monitor_.reset(new (latency_monitor_) audio::LatencyMonitor(
@@ -218,21 +315,65 @@ ReceiverSession::ReceiverSession(const ReceiverSessionConfig& session_config,
         resampler_reader_.get(), session_config.latency, pkt_encoding->sample_spec,
         common_config.output_sample_spec));
     if (!latency_monitor_ || !latency_monitor_->is_valid()) {
-        return;
+        return false;
     }
     frm_reader = latency_monitor_.get();
 
+    frame_meter_reader_.reset(new (frame_meter_reader_)
+                                  CpuMeterFrameReader(*frm_reader, *cpu_meter_));
+    if (!frame_meter_reader_) {
+        return false;
+    }
+    frm_reader = frame_meter_reader_.get();
+
     if (!frm_reader) {
-        return;
+        return false;
+    }
+
+    if (can_passthrough_(session_config, common_config, pkt_encoding->sample_spec)) {
+        depacketizer_->enable_passthrough(
+            common_config.output_sample_spec.pcm_format());
+        passthrough_ = true;
     }
 
     // Top-level frame reader that is added to mixer.
     frame_reader_ = frm_reader;
-    valid_ = true;
+
+    return true;
 }
 
-bool ReceiverSession::is_valid() const {
-    return valid_;
+void ReceiverSession::deinit_() {
+    valid_ = false;
+    passthrough_ = false;
+    quality_level_ = QualityLevel_Full;
+    frame_reader_ = NULL;
+
+    // Destroy components in reverse order of construction.
+    frame_meter_reader_.reset();
+    latency_monitor_.reset();
+    resampler_meter_reader_.reset();
+    resampler_reader_.reset();
+    resampler_.reset();
+    channel_mapper_reader_.reset();
+    watchdog_.reset();
+    codec_meter_reader_.reset();
+    depacketizer_.reset();
+    plc_.reset();
+    timestamp_injector_.reset();
+    fec_filter_.reset();
+    fec_meter_reader_.reset();
+    fec_reader_.reset();
+    fec_parser_.reset();
+    fec_decoder_.reset();
+    repair_meter_.reset();
+    repair_queue_.reset();
+    delayed_reader_.reset();
+    filter_.reset();
+    payload_decoder_.reset();
+    source_meter_.reset();
+    source_queue_.reset();
+    packet_router_.reset();
+    cpu_meter_.reset();
 }
 
 audio::IFrameReader& ReceiverSession::frame_reader() {
@@ -241,10 +382,31 @@ audio::IFrameReader& ReceiverSession::frame_reader() {
     return *frame_reader_;
 }
 
+bool ReceiverSession::has_passthrough() const {
+    roc_panic_if(!is_valid());
+
+    return passthrough_;
+}
+
 status::StatusCode ReceiverSession::route_packet(const packet::PacketPtr& packet) {
     roc_panic_if(!is_valid());
 
-    return packet_router_->write(packet);
+    cpu_meter_->begin_stage(CpuStage_Packets);
+    const status::StatusCode code = packet_router_->write(packet);
+    cpu_meter_->end_stage(CpuStage_Packets);
+
+    return code;
+}
+
+status::StatusCode ReceiverSession::route_packets(const packet::PacketPtr* packets,
+                                                  size_t n_packets) {
+    roc_panic_if(!is_valid());
+
+    cpu_meter_->begin_stage(CpuStage_Packets);
+    const status::StatusCode code = packet_router_->write_batch(packets, n_packets);
+    cpu_meter_->end_stage(CpuStage_Packets);
+
+    return code;
 }
 
 bool ReceiverSession::refresh(core::nanoseconds_t current_time,
@@ -363,15 +525,124 @@ void ReceiverSession::process_report(const rtcp::SendReport& report) {
     }
 }
 
+void ReceiverSession::set_quality_level(QualityLevel level) {
+    roc_panic_if(!is_valid());
+
+    if (level == quality_level_) {
+        return;
+    }
+
+    roc_log(LogDebug, "receiver session: changing quality level: old=%s new=%s",
+            quality_level_to_str(quality_level_), quality_level_to_str(level));
+
+    if (resampler_reader_) {
+        const audio::ResamplerConfig old_config =
+            degrade_resampler_config(resampler_config_, quality_level_);
+        const audio::ResamplerConfig new_config =
+            degrade_resampler_config(resampler_config_, level);
+
+        if (new_config.backend != old_config.backend
+            || new_config.profile != old_config.profile) {
+            if (!switch_resampler_(new_config)) {
+                roc_log(LogError,
+                        "receiver session: can't switch resampler, keeping old one");
+            }
+        }
+    }
+
+    if (fec_reader_) {
+        fec_reader_->set_repair_enabled(quality_level_has_repair(level));
+    }
+
+    quality_level_ = level;
+}
+
 ReceiverParticipantMetrics ReceiverSession::get_metrics() const {
     roc_panic_if(!is_valid());
 
     ReceiverParticipantMetrics metrics;
+    if (packet_router_->has_source_id(packet::Packet::FlagAudio)) {
+        metrics.source_id = packet_router_->get_source_id(packet::Packet::FlagAudio);
+    }
     metrics.link = source_meter_->metrics();
     metrics.latency = latency_monitor_->metrics();
+    metrics.depacketizer = depacketizer_->metrics();
+    metrics.cpu = cpu_meter_->metrics();
+    metrics.quality_level = quality_level_;
 
     return metrics;
 }
 
+bool ReceiverSession::switch_resampler_(
+    const audio::ResamplerConfig& resampler_config) {
+    roc_log(LogDebug, "receiver session: switching resampler: backend=%s profile=%s",
+            audio::resampler_backend_to_str(resampler_config.backend),
+            audio::resampler_profile_to_str(resampler_config.profile));
+
+    // Resampler may be replaced many times during session lifetime, so it's
+    // allocated from parent arena instead of session arena, which memory is
+    // released only when session is recycled.
+    core::SharedPtr<audio::IResampler> resampler =
+        audio::ResamplerMap::instance().new_resampler(arena(), frame_factory_,
+                                                      resampler_config,
+                                                      resampler_in_spec_,
+                                                      resampler_out_spec_);
+    if (!resampler) {
+        return false;
+    }
+
+    if (!resampler_reader_->set_resampler(*resampler)) {
+        return false;
+    }
+
+    resampler_ = resampler;
+
+    return true;
+}
+
+bool ReceiverSession::can_passthrough_(const ReceiverSessionConfig& session_config,
+                                       const ReceiverCommonConfig& common_config,
+                                       const audio::SampleSpec& encoding_spec) const {
+    if (!common_config.enable_passthrough) {
+        return false;
+    }
+
+    const audio::SampleSpec& output_spec = common_config.output_sample_spec;
+
+    // Passthrough makes sense only if output is not raw, otherwise
+    // regular pipeline doesn't perform any extra conversions.
+    if (output_spec.is_raw()
+        || encoding_spec.sample_format() != audio::SampleFormat_Pcm) {
+        return false;
+    }
+
+    // Frames should reach mixer unchanged.
+    if (channel_mapper_reader_ || resampler_reader_ || plc_
+        || session_config.enable_beeping) {
+        return false;
+    }
+
+    const audio::PcmTraits enc_traits =
+        audio::pcm_format_traits(encoding_spec.pcm_format());
+    const audio::PcmTraits out_traits =
+        audio::pcm_format_traits(output_spec.pcm_format());
+
+    // Passthrough should be bit-exact, so only byte order may differ.
+    if (!enc_traits.is_valid || !out_traits.is_valid
+        || enc_traits.is_integer != out_traits.is_integer
+        || enc_traits.is_signed != out_traits.is_signed
+        || enc_traits.bit_depth != out_traits.bit_depth
+        || enc_traits.bit_width != out_traits.bit_width) {
+        return false;
+    }
+
+    // Depacketizer fills gaps with zero bytes.
+    if (!out_traits.is_signed || out_traits.bit_width % 8 != 0) {
+        return false;
+    }
+
+    return true;
+}
+
 } // namespace pipeline
 } // namespace roc
@@ -18,11 +18,13 @@
 #include "roc_audio/frame_factory.h"
 #include "roc_audio/iframe_decoder.h"
 #include "roc_audio/iframe_reader.h"
+#include "roc_audio/iplc.h"
 #include "roc_audio/iresampler.h"
 #include "roc_audio/latency_monitor.h"
 #include "roc_audio/resampler_reader.h"
 #include "roc_audio/watchdog.h"
 #include "roc_core/iarena.h"
+#include "roc_core/linear_arena.h"
 #include "roc_core/list_node.h"
 #include "roc_core/optional.h"
 #include "roc_core/ref_counted.h"
@@ -39,7 +41,10 @@
 #include "roc_packet/sorted_queue.h"
 #include "roc_packet/units.h"
 #include "roc_pipeline/config.h"
+#include "roc_pipeline/cpu_meter.h"
+#include "roc_pipeline/cpu_meter_reader.h"
 #include "roc_pipeline/metrics.h"
+#include "roc_pipeline/overload_controller.h"
 #include "roc_rtcp/reports.h"
 #include "roc_rtp/encoding_map.h"
 #include "roc_rtp/filter.h"
@@ -55,6 +60,10 @@ namespace pipeline {
 //! Contains:
 //!  - a pipeline for processing packets from single sender and converting
 //!    them into audio frames
+//!
+//! Session can be recycled and reused for another sender without returning
+//! memory to arena: all components are allocated from session's own linear
+//! arena, which is rewound when session is recycled.
 class ReceiverSession : public core::RefCounted<ReceiverSession, core::ArenaAllocation>,
                         public core::ListNode<> {
 public:
@@ -66,9 +75,26 @@ public:
                     audio::FrameFactory& frame_factory,
                     core::IArena& arena);
 
+    ~ReceiverSession();
+
     //! Check if the session was succefully constructed.
     bool is_valid() const;
 
+    //! Destroy session pipeline and prepare session for reuse.
+    //! @remarks
+    //!  Releases all packets and frames held by pipeline. Memory used by
+    //!  pipeline components is kept and reused by subsequent reset().
+    //!  After this call, is_valid() returns false until reset() succeeds.
+    void recycle();
+
+    //! Rebuild session pipeline with new config.
+    //! @remarks
+    //!  Brings session to the same state as if it was just constructed with
+    //!  given config.
+    //! @returns
+    //!  false if initialization failed.
+    bool reset(const ReceiverSessionConfig& session_config);
+
     //! Get frame reader.
     //! @remarks
     //!  This way samples are fetched from the pipeline.
@@ -76,6 +102,14 @@ public:
     //!  clock, happens during the read operation.
     audio::IFrameReader& frame_reader();
 
+    //! Check if the session supports passthrough.
+    //! @remarks
+    //!  If true, frame_reader() can be also used to read frames in output
+    //!  PCM format, when Frame::FlagNotRaw is set on the frame before reading.
+    //!  In this case samples are copied from packets to the frame without
+    //!  conversion to raw format.
+    bool has_passthrough() const;
+
     //! Route a packet to the session.
     //! @remarks
     //!  This way packets from sender reach receiver pipeline.
@@ -83,6 +117,12 @@ public:
     //!  when frame are requested from frame_reader().
     ROC_ATTR_NODISCARD status::StatusCode route_packet(const packet::PacketPtr& packet);
 
+    //! Route multiple packets to the session.
+    //! @remarks
+    //!  Same as route_packet(), but passes packets through pipeline in a burst.
+    ROC_ATTR_NODISCARD status::StatusCode route_packets(const packet::PacketPtr* packets,
+                                                        size_t n_packets);
+
     //! Refresh pipeline according to current time.
     //! @remarks
     //!  writes to @p next_refresh deadline (absolute time) when refresh should
@@ -112,12 +152,38 @@ public:
     //! Process RTCP report obtained from sender.
     void process_report(const rtcp::SendReport& report);
 
+    //! Change quality level of session processing.
+    //! @remarks
+    //!  Lowers or restores resampler profile and backend, and enables or
+    //!  disables FEC repair, according to @p level. Replacing resampler
+    //!  drops a few samples buffered in it. Session starts with full quality.
+    void set_quality_level(QualityLevel level);
+
     //! Get session metrics.
     ReceiverParticipantMetrics get_metrics() const;
 
 private:
+    bool init_(const ReceiverSessionConfig& session_config);
+    void deinit_();
+
+    bool switch_resampler_(const audio::ResamplerConfig& resampler_config);
+
+    bool can_passthrough_(const ReceiverSessionConfig& session_config,
+                          const ReceiverCommonConfig& common_config,
+                          const audio::SampleSpec& encoding_spec) const;
+
+    // Should be declared before components allocated from it.
+    core::LinearArena session_arena_;
+
+    const ReceiverCommonConfig common_config_;
+    const rtp::EncodingMap& encoding_map_;
+    packet::PacketFactory& packet_factory_;
+    audio::FrameFactory& frame_factory_;
+
     audio::IFrameReader* frame_reader_;
 
+    core::Optional<CpuMeter> cpu_meter_;
+
     core::Optional<packet::Router> packet_router_;
 
     core::Optional<packet::SortedQueue> source_queue_;
@@ -135,19 +201,30 @@ private:
     core::Optional<rtp::Parser> fec_parser_;
     core::ScopedPtr<fec::IBlockDecoder> fec_decoder_;
     core::Optional<fec::Reader> fec_reader_;
+    core::Optional<CpuMeterPacketReader> fec_meter_reader_;
     core::Optional<rtp::Filter> fec_filter_;
 
     core::Optional<rtp::TimestampInjector> timestamp_injector_;
 
+    core::ScopedPtr<audio::IPlc> plc_;
     core::Optional<audio::Depacketizer> depacketizer_;
+    core::Optional<CpuMeterFrameReader> codec_meter_reader_;
 
     core::Optional<audio::ChannelMapperReader> channel_mapper_reader_;
 
     core::Optional<audio::ResamplerReader> resampler_reader_;
     core::SharedPtr<audio::IResampler> resampler_;
+    audio::ResamplerConfig resampler_config_;
+    audio::SampleSpec resampler_in_spec_;
+    audio::SampleSpec resampler_out_spec_;
+    core::Optional<CpuMeterFrameReader> resampler_meter_reader_;
 
     core::Optional<audio::LatencyMonitor> latency_monitor_;
+    core::Optional<CpuMeterFrameReader> frame_meter_reader_;
+
+    QualityLevel quality_level_;
 
+    bool passthrough_;
     bool valid_;
 };
 
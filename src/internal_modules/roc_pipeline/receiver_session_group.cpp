@@ -82,6 +82,47 @@ status::StatusCode ReceiverSessionGroup::route_packet(const packet::PacketPtr& p
     return route_transport_packet_(packet);
 }
 
+status::StatusCode
+ReceiverSessionGroup::route_packets(const packet::PacketPtr* packets,
+                                   size_t n_packets,
+                                   core::nanoseconds_t current_time) {
+    roc_panic_if(!is_valid());
+
+    size_t n = 0;
+
+    while (n < n_packets) {
+        core::SharedPtr<ReceiverSession> sess;
+        if (!packets[n]->has_flags(packet::Packet::FlagControl)) {
+            sess = find_session_(packets[n]);
+        }
+
+        status::StatusCode code = status::StatusOK;
+
+        if (sess) {
+            // Collect consecutive packets of the same session.
+            size_t n_run = 1;
+            while (n + n_run < n_packets
+                   && !packets[n + n_run]->has_flags(packet::Packet::FlagControl)
+                   && find_session_(packets[n + n_run]) == sess) {
+                n_run++;
+            }
+
+            code = sess->route_packets(packets + n, n_run);
+            n += n_run;
+        } else {
+            // Control packet, or first packet of a new session.
+            code = route_packet(packets[n], current_time);
+            n++;
+        }
+
+        if (code != status::StatusOK) {
+            return code;
+        }
+    }
+
+    return status::StatusOK;
+}
+
 core::nanoseconds_t
 ReceiverSessionGroup::refresh_sessions(core::nanoseconds_t current_time) {
     roc_panic_if(!is_valid());
@@ -139,17 +180,72 @@ void ReceiverSessionGroup::reclock_sessions(core::nanoseconds_t playback_time) {
     }
 }
 
+void ReceiverSessionGroup::update_overload(const OverloadMetrics& overload_metrics) {
+    roc_panic_if(!is_valid());
+
+    const bool level_changed = overload_metrics.level != overload_metrics_.level;
+
+    overload_metrics_ = overload_metrics;
+
+    if (!level_changed) {
+        return;
+    }
+
+    for (core::SharedPtr<ReceiverSession> sess = sessions_.front(); sess;
+         sess = sessions_.nextof(*sess)) {
+        sess->set_quality_level(overload_metrics_.level);
+    }
+}
+
 size_t ReceiverSessionGroup::num_sessions() const {
     roc_panic_if(!is_valid());
 
     return sessions_.size();
 }
 
+size_t ReceiverSessionGroup::num_pooled_sessions() const {
+    roc_panic_if(!is_valid());
+
+    return session_pool_.size();
+}
+
+audio::IFrameReader* ReceiverSessionGroup::passthrough_reader() {
+    roc_panic_if(!is_valid());
+
+    if (sessions_.size() != 1 || !sessions_.front()->has_passthrough()) {
+        return NULL;
+    }
+
+    return &sessions_.front()->frame_reader();
+}
+
+status::StatusCode ReceiverSessionGroup::read_session(packet::stream_source_t source_id,
+                                                      audio::Frame& frame) {
+    roc_panic_if(!is_valid());
+
+    roc_panic_if_msg(!source_config_.common.enable_unmixed_output,
+                     "session group: can't read session: unmixed output is disabled");
+
+    core::SharedPtr<ReceiverSession> sess = session_router_.find_by_source(source_id);
+    if (!sess) {
+        return status::StatusNoData;
+    }
+
+    if (!sess->frame_reader().read(frame)) {
+        roc_log(LogError, "session group: can't read frame from session: source_id=%lu",
+                (unsigned long)source_id);
+        return status::StatusUnknown;
+    }
+
+    return status::StatusOK;
+}
+
 void ReceiverSessionGroup::get_slot_metrics(ReceiverSlotMetrics& slot_metrics) const {
     roc_panic_if(!is_valid());
 
     slot_metrics.source_id = identity_->ssrc();
     slot_metrics.num_participants = sessions_.size();
+    slot_metrics.overload = overload_metrics_;
 }
 
 void ReceiverSessionGroup::get_participant_metrics(
@@ -277,8 +373,8 @@ void ReceiverSessionGroup::halt_recv_stream(packet::stream_source_t send_source_
     }
 }
 
-status::StatusCode
-ReceiverSessionGroup::route_transport_packet_(const packet::PacketPtr& packet) {
+core::SharedPtr<ReceiverSession>
+ReceiverSessionGroup::find_session_(const packet::PacketPtr& packet) {
     core::SharedPtr<ReceiverSession> sess;
 
     if (slot_config_.enable_routing) {
@@ -313,6 +409,13 @@ ReceiverSessionGroup::route_transport_packet_(const packet::PacketPtr& packet) {
         }
     }
 
+    return sess;
+}
+
+status::StatusCode
+ReceiverSessionGroup::route_transport_packet_(const packet::PacketPtr& packet) {
+    core::SharedPtr<ReceiverSession> sess = find_session_(packet);
+
     if (sess) {
         // Session found, route packet to it.
         return sess->route_packet(packet);
@@ -375,9 +478,7 @@ ReceiverSessionGroup::create_session_(const packet::PacketPtr& packet) {
             address::socket_addr_to_str(src_address).c_str(),
             address::socket_addr_to_str(dst_address).c_str());
 
-    core::SharedPtr<ReceiverSession> sess =
-        new (arena_) ReceiverSession(sess_config, source_config_.common, encoding_map_,
-                                     packet_factory_, frame_factory_, arena_);
+    core::SharedPtr<ReceiverSession> sess = acquire_session_(sess_config);
 
     if (!sess || !sess->is_valid()) {
         roc_log(LogError, "session group: can't create session, initialization failed");
@@ -385,6 +486,8 @@ ReceiverSessionGroup::create_session_(const packet::PacketPtr& packet) {
         return status::StatusOK;
     }
 
+    sess->set_quality_level(overload_metrics_.level);
+
     status::StatusCode code = sess->route_packet(packet);
     if (code != status::StatusOK) {
         roc_log(
@@ -404,7 +507,9 @@ ReceiverSessionGroup::create_session_(const packet::PacketPtr& packet) {
         return status::StatusOK;
     }
 
-    mixer_.add_input(sess->frame_reader());
+    if (!source_config_.common.enable_unmixed_output) {
+        mixer_.add_input(sess->frame_reader());
+    }
     sessions_.push_back(*sess);
 
     state_tracker_.add_active_sessions(+1);
@@ -415,11 +520,15 @@ ReceiverSessionGroup::create_session_(const packet::PacketPtr& packet) {
 void ReceiverSessionGroup::remove_session_(core::SharedPtr<ReceiverSession> sess) {
     roc_log(LogInfo, "session group: removing session");
 
-    mixer_.remove_input(sess->frame_reader());
+    if (!source_config_.common.enable_unmixed_output) {
+        mixer_.remove_input(sess->frame_reader());
+    }
     sessions_.remove(*sess);
 
     session_router_.remove_session(sess);
     state_tracker_.add_active_sessions(-1);
+
+    release_session_(sess);
 }
 
 void ReceiverSessionGroup::remove_all_sessions_() {
@@ -428,6 +537,45 @@ void ReceiverSessionGroup::remove_all_sessions_() {
     while (!sessions_.is_empty()) {
         remove_session_(sessions_.back());
     }
+
+    while (!session_pool_.is_empty()) {
+        session_pool_.remove(*session_pool_.back());
+    }
+}
+
+core::SharedPtr<ReceiverSession>
+ReceiverSessionGroup::acquire_session_(const ReceiverSessionConfig& sess_config) {
+    core::SharedPtr<ReceiverSession> sess = session_pool_.front();
+
+    if (sess) {
+        // Reuse recycled session, which already has memory for its components.
+        session_pool_.remove(*sess);
+
+        if (!sess->reset(sess_config)) {
+            return NULL;
+        }
+
+        roc_log(LogDebug, "session group: reused recycled session: pool_size=%lu",
+                (unsigned long)session_pool_.size());
+
+        return sess;
+    }
+
+    return new (arena_) ReceiverSession(sess_config, source_config_.common,
+                                        encoding_map_, packet_factory_, frame_factory_,
+                                        arena_);
+}
+
+void ReceiverSessionGroup::release_session_(
+    const core::SharedPtr<ReceiverSession>& sess) {
+    if (session_pool_.size() >= source_config_.common.session_pool_size) {
+        // Pool is full, session will be destroyed when last reference is dropped.
+        return;
+    }
+
+    // Release packets and frames held by session, but keep its memory.
+    sess->recycle();
+    session_pool_.push_back(*sess);
 }
 
 ReceiverSessionConfig
@@ -19,6 +19,7 @@
 #include "roc_core/noncopyable.h"
 #include "roc_packet/packet_factory.h"
 #include "roc_pipeline/metrics.h"
+#include "roc_pipeline/overload_controller.h"
 #include "roc_pipeline/receiver_endpoint.h"
 #include "roc_pipeline/receiver_session.h"
 #include "roc_pipeline/receiver_session_router.h"
@@ -74,6 +75,14 @@ public:
     ROC_ATTR_NODISCARD status::StatusCode route_packet(const packet::PacketPtr& packet,
                                                        core::nanoseconds_t current_time);
 
+    //! Route multiple packets to sessions.
+    //! @remarks
+    //!  Consecutive packets that belong to the same session are routed to it
+    //!  in one burst.
+    ROC_ATTR_NODISCARD status::StatusCode route_packets(const packet::PacketPtr* packets,
+                                                        size_t n_packets,
+                                                        core::nanoseconds_t current_time);
+
     //! Refresh pipeline according to current time.
     //! @returns
     //!  deadline (absolute time) when refresh should be invoked again
@@ -86,9 +95,36 @@ public:
     //!  retrieved from pipeline will be actually played on sink
     void reclock_sessions(core::nanoseconds_t playback_time);
 
+    //! Update state of overload controller.
+    //! @remarks
+    //!  If quality level was changed, applies new level to all sessions.
+    //!  Sessions created later start with the most recent level.
+    void update_overload(const OverloadMetrics& overload_metrics);
+
     //! Get number of sessions in group.
     size_t num_sessions() const;
 
+    //! Get number of recycled sessions ready for reuse.
+    size_t num_pooled_sessions() const;
+
+    //! Get frame reader for passthrough.
+    //! @remarks
+    //!  Returns frame reader of the only session in group, if there is exactly
+    //!  one session and it supports passthrough. Otherwise returns NULL.
+    //!  See ReceiverSession::has_passthrough().
+    audio::IFrameReader* passthrough_reader();
+
+    //! Read frame from a single session.
+    //! @remarks
+    //!  Reads next frame of the session, which remote sender has given source ID.
+    //!  Can be used only if unmixed output is enabled in config; otherwise frames
+    //!  of all sessions are read by mixer.
+    //! @returns
+    //!  status::StatusOK if frame was read, status::StatusNoData if there is no
+    //!  such session, or error code if reading failed.
+    ROC_ATTR_NODISCARD status::StatusCode read_session(packet::stream_source_t source_id,
+                                                       audio::Frame& frame);
+
     //! Get slot metrics.
     //! @remarks
     //!  These metrics are for the whole slot.
@@ -121,6 +157,8 @@ private:
                                                   const rtcp::SendReport& send_report);
     virtual void halt_recv_stream(packet::stream_source_t send_source_id);
 
+    core::SharedPtr<ReceiverSession> find_session_(const packet::PacketPtr& packet);
+
     status::StatusCode route_transport_packet_(const packet::PacketPtr& packet);
     status::StatusCode route_control_packet_(const packet::PacketPtr& packet,
                                              core::nanoseconds_t current_time);
@@ -131,6 +169,10 @@ private:
     void remove_session_(core::SharedPtr<ReceiverSession> sess);
     void remove_all_sessions_();
 
+    core::SharedPtr<ReceiverSession>
+    acquire_session_(const ReceiverSessionConfig& sess_config);
+    void release_session_(const core::SharedPtr<ReceiverSession>& sess);
+
     ReceiverSessionConfig make_session_config_(const packet::PacketPtr& packet) const;
 
     const ReceiverSourceConfig source_config_;
@@ -153,6 +195,12 @@ private:
     core::List<ReceiverSession> sessions_;
     ReceiverSessionRouter session_router_;
 
+    // Recycled sessions ready for reuse.
+    core::List<ReceiverSession> session_pool_;
+
+    // Last state reported by overload controller.
+    OverloadMetrics overload_metrics_;
+
     bool valid_;
 };
 
@@ -32,6 +32,7 @@ ReceiverSlot::ReceiverSlot(const ReceiverSourceConfig& source_config,
                      packet_factory,
                      frame_factory,
                      arena)
+    , metrics_snapshot_(source_config.common.rtcp.report_interval)
     , valid_(false) {
     if (!session_group_.is_valid()) {
         return;
@@ -94,7 +95,14 @@ core::nanoseconds_t ReceiverSlot::refresh(core::nanoseconds_t current_time) {
         roc_panic_if(code != status::StatusOK);
     }
 
-    return session_group_.refresh_sessions(current_time);
+    const core::nanoseconds_t next_deadline =
+        session_group_.refresh_sessions(current_time);
+
+    if (metrics_snapshot_.publish_due(current_time)) {
+        publish_metrics_();
+    }
+
+    return next_deadline;
 }
 
 void ReceiverSlot::reclock(core::nanoseconds_t playback_time) {
@@ -103,12 +111,31 @@ void ReceiverSlot::reclock(core::nanoseconds_t playback_time) {
     session_group_.reclock_sessions(playback_time);
 }
 
+void ReceiverSlot::update_overload(const OverloadMetrics& overload_metrics) {
+    roc_panic_if(!is_valid());
+
+    session_group_.update_overload(overload_metrics);
+}
+
 size_t ReceiverSlot::num_sessions() const {
     roc_panic_if(!is_valid());
 
     return session_group_.num_sessions();
 }
 
+audio::IFrameReader* ReceiverSlot::passthrough_reader() {
+    roc_panic_if(!is_valid());
+
+    return session_group_.passthrough_reader();
+}
+
+status::StatusCode ReceiverSlot::read_session(packet::stream_source_t source_id,
+                                              audio::Frame& frame) {
+    roc_panic_if(!is_valid());
+
+    return session_group_.read_session(source_id, frame);
+}
+
 void ReceiverSlot::get_metrics(ReceiverSlotMetrics& slot_metrics,
                                ReceiverParticipantMetrics* party_metrics,
                                size_t* party_count) const {
@@ -121,6 +148,23 @@ void ReceiverSlot::get_metrics(ReceiverSlotMetrics& slot_metrics,
     }
 }
 
+bool ReceiverSlot::get_metrics_snapshot(ReceiverSlotMetrics& slot_metrics,
+                                        ReceiverParticipantMetrics* party_metrics,
+                                        size_t* party_count) const {
+    roc_panic_if(!is_valid());
+
+    return metrics_snapshot_.read(slot_metrics, party_metrics, party_count);
+}
+
+void ReceiverSlot::publish_metrics_() {
+    ReceiverMetricsSnapshot::Data& data = metrics_snapshot_.scratch();
+
+    data.party_count = metrics_snapshot_.max_parties();
+    get_metrics(data.slot_metrics, data.party_metrics, &data.party_count);
+
+    metrics_snapshot_.publish(data);
+}
+
 ReceiverEndpoint*
 ReceiverSlot::create_source_endpoint_(address::Protocol proto,
                                       const address::SocketAddr& inbound_address,
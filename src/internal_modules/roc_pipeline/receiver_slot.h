@@ -21,6 +21,7 @@
 #include "roc_core/ref_counted.h"
 #include "roc_packet/packet_factory.h"
 #include "roc_pipeline/metrics.h"
+#include "roc_pipeline/metrics_snapshot.h"
 #include "roc_pipeline/receiver_endpoint.h"
 #include "roc_pipeline/receiver_session_group.h"
 #include "roc_pipeline/state_tracker.h"
@@ -68,14 +69,39 @@ public:
     //!  retrieved from pipeline will be actually played on sink
     void reclock(core::nanoseconds_t playback_time);
 
+    //! Update state of overload controller.
+    //! @see ReceiverSessionGroup::update_overload().
+    void update_overload(const OverloadMetrics& overload_metrics);
+
     //! Get number of alive sessions.
     size_t num_sessions() const;
 
+    //! Get frame reader for passthrough, if it's possible.
+    //! @see ReceiverSessionGroup::passthrough_reader().
+    audio::IFrameReader* passthrough_reader();
+
+    //! Read frame from a single session of the slot.
+    //! @see ReceiverSessionGroup::read_session().
+    ROC_ATTR_NODISCARD status::StatusCode read_session(packet::stream_source_t source_id,
+                                                       audio::Frame& frame);
+
     //! Get metrics for slot and its participants.
     void get_metrics(ReceiverSlotMetrics& slot_metrics,
                      ReceiverParticipantMetrics* party_metrics,
                      size_t* party_count) const;
 
+    //! Get latest published snapshot of metrics for slot and its participants.
+    //! @remarks
+    //!  Unlike get_metrics(), can be called from any thread, is lock-free, and
+    //!  never waits for pipeline. Snapshot is published by refresh() once per
+    //!  RTCP report interval.
+    //! @returns
+    //!  false if snapshot is not available or can't provide requested number
+    //!  of participants; get_metrics() should be used in this case.
+    bool get_metrics_snapshot(ReceiverSlotMetrics& slot_metrics,
+                              ReceiverParticipantMetrics* party_metrics,
+                              size_t* party_count) const;
+
 private:
     ReceiverEndpoint* create_source_endpoint_(address::Protocol proto,
                                               const address::SocketAddr& inbound_address,
@@ -87,6 +113,8 @@ private:
                                                const address::SocketAddr& inbound_address,
                                                packet::IWriter* outbound_writer);
 
+    void publish_metrics_();
+
     const rtp::EncodingMap& encoding_map_;
 
     StateTracker& state_tracker_;
@@ -96,6 +124,8 @@ private:
     core::Optional<ReceiverEndpoint> repair_endpoint_;
     core::Optional<ReceiverEndpoint> control_endpoint_;
 
+    ReceiverMetricsSnapshot metrics_snapshot_;
+
     bool valid_;
 };
 
@@ -9,6 +9,7 @@
 #include "roc_pipeline/receiver_source.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
+#include "roc_core/time.h"
 
 namespace roc {
 namespace pipeline {
@@ -24,27 +25,35 @@ ReceiverSource::ReceiverSource(const ReceiverSourceConfig& source_config,
     , packet_factory_(packet_pool, packet_buffer_pool)
     , frame_factory_(frame_buffer_pool)
     , arena_(arena)
+    , frame_switch_(*this)
+    , mixed_reader_(NULL)
     , frame_reader_(NULL)
+    , passthrough_(false)
     , valid_(false) {
     source_config_.deduce_defaults();
 
+    if (source_config_.common.enable_unmixed_output
+        && !source_config_.common.output_sample_spec.is_raw()) {
+        roc_log(LogError,
+                "receiver source: unmixed output requires raw output sample spec");
+        return;
+    }
+
     audio::IFrameReader* frm_reader = NULL;
 
-    mixer_.reset(new (mixer_) audio::Mixer(
-        frame_factory_, source_config.common.output_sample_spec, true));
+    const audio::SampleSpec mixer_spec(
+        source_config_.common.output_sample_spec.sample_rate(), audio::Sample_RawFormat,
+        source_config_.common.output_sample_spec.channel_set());
+
+    mixer_.reset(new (mixer_) audio::Mixer(frame_factory_, mixer_spec, true));
     if (!mixer_ || !mixer_->is_valid()) {
         return;
     }
     frm_reader = mixer_.get();
 
     if (!source_config_.common.output_sample_spec.is_raw()) {
-        const audio::SampleSpec in_spec(
-            source_config_.common.output_sample_spec.sample_rate(),
-            audio::Sample_RawFormat,
-            source_config_.common.output_sample_spec.channel_set());
-
         pcm_mapper_.reset(new (pcm_mapper_) audio::PcmMapperReader(
-            *frm_reader, frame_factory_, in_spec,
+            *frm_reader, frame_factory_, mixer_spec,
             source_config_.common.output_sample_spec));
         if (!pcm_mapper_ || !pcm_mapper_->is_valid()) {
             return;
@@ -52,6 +61,9 @@ ReceiverSource::ReceiverSource(const ReceiverSourceConfig& source_config,
         frm_reader = pcm_mapper_.get();
     }
 
+    mixed_reader_ = frm_reader;
+    frm_reader = &frame_switch_;
+
     if (source_config_.common.enable_profiling) {
         profiler_.reset(new (profiler_) audio::ProfilingReader(
             *frm_reader, arena, source_config_.common.output_sample_spec,
@@ -66,6 +78,14 @@ ReceiverSource::ReceiverSource(const ReceiverSourceConfig& source_config,
         return;
     }
 
+    if (source_config_.common.overload.enable) {
+        overload_controller_.reset(new (overload_controller_) OverloadController(
+            source_config_.common.overload, source_config_.session_defaults.resampler));
+        if (!overload_controller_) {
+            return;
+        }
+    }
+
     frame_reader_ = frm_reader;
     valid_ = true;
 }
@@ -88,6 +108,10 @@ ReceiverSlot* ReceiverSource::create_slot(const ReceiverSlotConfig& slot_config)
         return NULL;
     }
 
+    if (overload_controller_) {
+        slot->update_overload(overload_controller_->metrics());
+    }
+
     slots_.push_back(*slot);
     return slot.get();
 }
@@ -104,6 +128,30 @@ size_t ReceiverSource::num_sessions() const {
     return state_tracker_.num_active_sessions();
 }
 
+status::StatusCode ReceiverSource::read_session(ReceiverSlot* slot,
+                                                packet::stream_source_t source_id,
+                                                audio::Frame& frame) {
+    roc_panic_if(!is_valid());
+    roc_panic_if(!slot);
+
+    if (!source_config_.common.enable_unmixed_output) {
+        roc_log(LogError,
+                "receiver source: can't read session: unmixed output is disabled");
+        return status::StatusUnknown;
+    }
+
+    const status::StatusCode code = slot->read_session(source_id, frame);
+    if (code != status::StatusOK) {
+        return code;
+    }
+
+    frame.set_duration(packet::stream_timestamp_t(
+        frame.num_raw_samples()
+        / source_config_.common.output_sample_spec.num_channels()));
+
+    return status::StatusOK;
+}
+
 core::nanoseconds_t ReceiverSource::refresh(core::nanoseconds_t current_time) {
     roc_panic_if(!is_valid());
 
@@ -191,8 +239,87 @@ void ReceiverSource::reclock(core::nanoseconds_t playback_time) {
 bool ReceiverSource::read(audio::Frame& frame) {
     roc_panic_if(!is_valid());
 
+    if (!overload_controller_) {
+        return read_(frame);
+    }
+
+    const core::nanoseconds_t start_time = core::timestamp(core::ClockMonotonic);
+
+    if (!read_(frame)) {
+        return false;
+    }
+
+    report_frame_(frame, core::timestamp(core::ClockMonotonic) - start_time);
+
+    return true;
+}
+
+bool ReceiverSource::read_(audio::Frame& frame) {
     return frame_reader_->read(frame);
 }
 
+bool ReceiverSource::switch_read_(audio::Frame& frame) {
+    audio::IFrameReader* reader = passthrough_reader_();
+
+    if (passthrough_ != !!reader) {
+        roc_log(LogDebug, "receiver source: %s passthrough",
+                reader ? "enabling" : "disabling");
+        passthrough_ = !!reader;
+    }
+
+    if (reader) {
+        // Request frame in output format from session.
+        frame.set_flags(audio::Frame::FlagNotRaw);
+
+        return reader->read(frame);
+    }
+
+    return mixed_reader_->read(frame);
+}
+
+void ReceiverSource::report_frame_(const audio::Frame& frame,
+                                   core::nanoseconds_t processing_time) {
+    const audio::SampleSpec& sample_spec = source_config_.common.output_sample_spec;
+
+    const packet::stream_timestamp_t frame_duration = frame.has_duration()
+        ? frame.duration()
+        : sample_spec.bytes_2_stream_timestamp(frame.num_bytes());
+
+    if (!overload_controller_->report_frame(
+            sample_spec.stream_timestamp_2_ns(frame_duration), processing_time)) {
+        return;
+    }
+
+    for (core::SharedPtr<ReceiverSlot> slot = slots_.front(); slot;
+         slot = slots_.nextof(*slot)) {
+        slot->update_overload(overload_controller_->metrics());
+    }
+}
+
+ReceiverSource::FrameSwitch::FrameSwitch(ReceiverSource& source)
+    : source_(source) {
+}
+
+bool ReceiverSource::FrameSwitch::read(audio::Frame& frame) {
+    return source_.switch_read_(frame);
+}
+
+audio::IFrameReader* ReceiverSource::passthrough_reader_() {
+    if (!source_config_.common.enable_passthrough) {
+        return NULL;
+    }
+
+    if (source_config_.common.enable_unmixed_output) {
+        return NULL;
+    }
+
+    // Passthrough is possible only if there's no mixing.
+    if (slots_.size() != 1) {
+        return NULL;
+    }
+
+    return slots_.front()->passthrough_reader();
+}
+
 } // namespace pipeline
 } // namespace roc
@@ -22,6 +22,7 @@
 #include "roc_core/stddefs.h"
 #include "roc_packet/packet_factory.h"
 #include "roc_pipeline/config.h"
+#include "roc_pipeline/overload_controller.h"
 #include "roc_pipeline/receiver_endpoint.h"
 #include "roc_pipeline/receiver_slot.h"
 #include "roc_pipeline/state_tracker.h"
@@ -37,6 +38,17 @@ namespace pipeline {
 //!  - one or more receiver slots
 //!  - mixer, to mix audio from all slots
 //!
+//! If passthrough is enabled and there is only one session which supports it,
+//! frames are read directly from that session in output format, bypassing mixer
+//! and conversion to and from raw samples.
+//!
+//! If unmixed output is enabled, sessions are not mixed at all, and frames of
+//! each session are read separately using read_session().
+//!
+//! If overload control is enabled, time spent reading every frame is reported
+//! to overload controller, and quality level selected by it is passed to all
+//! slots and their sessions.
+//!
 //! Pipeline:
 //!  - input: packets
 //!  - output: frames
@@ -62,6 +74,18 @@ public:
     //! Get number of active sessions.
     size_t num_sessions() const;
 
+    //! Read frame from a single session.
+    //! @remarks
+    //!  Reads next frame of the session of given slot, which remote sender has
+    //!  given source ID. Frame is in output sample spec, which is always raw in
+    //!  this mode. Can be used only if unmixed output is enabled.
+    //! @returns
+    //!  status::StatusOK if frame was read, status::StatusNoData if there is no
+    //!  such session, or error code if reading failed.
+    ROC_ATTR_NODISCARD status::StatusCode read_session(ReceiverSlot* slot,
+                                                       packet::stream_source_t source_id,
+                                                       audio::Frame& frame);
+
     //! Pull packets and refresh pipeline according to current time.
     //! @remarks
     //!  Should be invoked before reading each frame.
@@ -115,6 +139,26 @@ public:
     virtual bool read(audio::Frame&);
 
 private:
+    // Reads frame either from passthrough session or from mixer.
+    // Placed before profiler, so that both paths are profiled.
+    class FrameSwitch : public audio::IFrameReader, public core::NonCopyable<> {
+    public:
+        explicit FrameSwitch(ReceiverSource& source);
+
+        virtual bool read(audio::Frame& frame);
+
+    private:
+        ReceiverSource& source_;
+    };
+
+    friend class FrameSwitch;
+
+    bool read_(audio::Frame& frame);
+    bool switch_read_(audio::Frame& frame);
+    void report_frame_(const audio::Frame& frame, core::nanoseconds_t processing_time);
+
+    audio::IFrameReader* passthrough_reader_();
+
     ReceiverSourceConfig source_config_;
 
     const rtp::EncodingMap& encoding_map_;
@@ -129,9 +173,15 @@ private:
     core::Optional<audio::ProfilingReader> profiler_;
     core::Optional<audio::PcmMapperReader> pcm_mapper_;
 
+    core::Optional<OverloadController> overload_controller_;
+
     core::List<ReceiverSlot> slots_;
 
+    FrameSwitch frame_switch_;
+
+    audio::IFrameReader* mixed_reader_;
     audio::IFrameReader* frame_reader_;
+    bool passthrough_;
 
     bool valid_;
 };
@@ -19,6 +19,7 @@ namespace roc {
 namespace pipeline {
 
 SenderEndpoint::SenderEndpoint(address::Protocol proto,
+                               const SenderSinkConfig& sink_config,
                                StateTracker& state_tracker,
                                SenderSession& sender_session,
                                const address::SocketAddr& outbound_address,
@@ -37,7 +38,8 @@ SenderEndpoint::SenderEndpoint(address::Protocol proto,
     case address::Proto_RTP:
     case address::Proto_RTP_LDPC_Source:
     case address::Proto_RTP_RS8M_Source:
-        rtp_composer_.reset(new (rtp_composer_) rtp::Composer(NULL));
+        rtp_composer_.reset(new (rtp_composer_)
+                                rtp::Composer(NULL, sink_config.rtp_composer));
         if (!rtp_composer_) {
             return;
         }
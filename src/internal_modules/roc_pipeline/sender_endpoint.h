@@ -23,6 +23,7 @@
 #include "roc_packet/iparser.h"
 #include "roc_packet/iwriter.h"
 #include "roc_packet/shipper.h"
+#include "roc_pipeline/config.h"
 #include "roc_pipeline/state_tracker.h"
 #include "roc_rtcp/composer.h"
 #include "roc_rtcp/parser.h"
@@ -40,11 +41,13 @@ class SenderSession;
 class SenderEndpoint : public core::NonCopyable<>, private packet::IWriter {
 public:
     //! Initialize.
+    //!  - @p sink_config defines parameters of composers
     //!  - @p outbound_address specifies destination address that is assigned to the
     //!    outgoing packets in the end of endpoint pipeline
     //!  - @p outbound_writer specifies destination writer to which packets are sent
     //!    in the end of endpoint pipeline
     SenderEndpoint(address::Protocol proto,
+                   const SenderSinkConfig& sink_config,
                    StateTracker& state_tracker,
                    SenderSession& sender_session,
                    const address::SocketAddr& outbound_address,
@@ -101,6 +101,7 @@ SenderLoop::SenderLoop(IPipelineTaskScheduler& scheduler,
             frame_buffer_pool,
             arena)
     , ticker_ts_(0)
+    , refresh_deadline_(0)
     , auto_duration_(sink_config.enable_auto_duration)
     , auto_cts_(sink_config.enable_auto_cts)
     , sample_spec_(sink_config.input_sample_spec)
@@ -110,8 +111,8 @@ SenderLoop::SenderLoop(IPipelineTaskScheduler& scheduler,
     }
 
     if (sink_config.enable_timing) {
-        ticker_.reset(new (ticker_)
-                          core::Ticker(sink_config.input_sample_spec.sample_rate()));
+        ticker_.reset(new (ticker_) core::Ticker(
+            sink_config.input_sample_spec.sample_rate(), sink_config.timing));
         if (!ticker_) {
             return;
         }
@@ -130,6 +131,33 @@ sndio::ISink& SenderLoop::sink() {
     return *this;
 }
 
+bool SenderLoop::get_timing_metrics(core::TickerMetrics& metrics) const {
+    roc_panic_if(!is_valid());
+
+    if (!ticker_) {
+        return false;
+    }
+
+    core::Mutex::Lock lock(ticker_mutex_);
+
+    metrics = ticker_metrics_;
+    return true;
+}
+
+bool SenderLoop::read_slot_snapshot(SlotHandle slot,
+                                    SenderSlotMetrics& slot_metrics,
+                                    SenderParticipantMetrics* party_metrics,
+                                    size_t* party_count) const {
+    roc_panic_if(!is_valid());
+
+    if (!slot) {
+        roc_panic("sender loop: slot handle is null");
+    }
+
+    return ((const SenderSlot*)slot)
+        ->get_metrics_snapshot(slot_metrics, party_metrics, party_count);
+}
+
 sndio::ISink* SenderLoop::to_sink() {
     roc_panic_if(!is_valid());
 
@@ -234,7 +262,10 @@ void SenderLoop::write(audio::Frame& frame) {
     core::Mutex::Lock lock(sink_mutex_);
 
     if (ticker_) {
-        ticker_->wait(ticker_ts_);
+        wait_ticker_();
+
+        core::Mutex::Lock ticker_lock(ticker_mutex_);
+        ticker_metrics_ = ticker_->metrics();
         ticker_ts_ += frame.duration();
     }
 
@@ -255,8 +286,7 @@ uint64_t SenderLoop::tid_imp() const {
 bool SenderLoop::process_subframe_imp(audio::Frame& frame) {
     sink_.write(frame);
 
-    // TODO: handle returned deadline and schedule refresh
-    sink_.refresh(core::timestamp(core::ClockUnix));
+    refresh_deadline_ = sink_.refresh(core::timestamp(core::ClockUnix));
 
     return true;
 }
@@ -268,6 +298,39 @@ bool SenderLoop::process_task_imp(PipelineTask& basic_task) {
     return (this->*(task.func_))(task);
 }
 
+core::nanoseconds_t SenderLoop::refresh_imp(core::nanoseconds_t current_time) {
+    return sink_.refresh(current_time);
+}
+
+// Wait until it's time to process next frame. While waiting, refresh sink
+// at deadlines requested by it, so that pacer and impairer can send queued
+// packets in time, instead of waiting for next frame.
+void SenderLoop::wait_ticker_() {
+    while (refresh_deadline_ != 0) {
+        const core::nanoseconds_t now = core::timestamp(core::ClockUnix);
+
+        if (refresh_deadline_ > now) {
+            const core::Ticker::ticks_t elapsed = ticker_->elapsed();
+            if (elapsed >= ticker_ts_) {
+                break;
+            }
+
+            const core::nanoseconds_t frame_time =
+                now + sample_spec_.samples_per_chan_2_ns((size_t)(ticker_ts_ - elapsed));
+            if (refresh_deadline_ >= frame_time) {
+                break;
+            }
+
+            core::sleep_until(core::ClockUnix, refresh_deadline_);
+        }
+
+        // invokes refresh_imp()
+        refresh_deadline_ = process_refresh(core::timestamp(core::ClockUnix));
+    }
+
+    ticker_->wait(ticker_ts_);
+}
+
 bool SenderLoop::task_create_slot_(Task& task) {
     task.slot_ = sink_.create_slot(task.slot_config_);
     return (bool)task.slot_;
@@ -136,6 +136,29 @@ public:
     //!  Samples written to the sink are sent to remote peers.
     sndio::ISink& sink();
 
+    //! Get metrics of CPU timer.
+    //! @remarks
+    //!  Can be used from any thread.
+    //! @returns
+    //!  false if timing is disabled.
+    bool get_timing_metrics(core::TickerMetrics& metrics) const;
+
+    //! Read latest published metrics snapshot of the slot.
+    //! @remarks
+    //!  Unlike QuerySlot task, doesn't acquire pipeline mutexes and never
+    //!  waits for frame processing. Snapshot is updated by pipeline once per
+    //!  RTCP report interval, so returned metrics may be stale by up to that
+    //!  interval (rtcp::Config::report_interval).
+    //!  Can be used from any thread, but caller should ensure that the slot
+    //!  is not deleted concurrently.
+    //! @returns
+    //!  false if snapshot is not available yet or can't provide requested
+    //!  number of participants; QuerySlot task should be used in this case.
+    bool read_slot_snapshot(SlotHandle slot,
+                            SenderSlotMetrics& slot_metrics,
+                            SenderParticipantMetrics* party_metrics,
+                            size_t* party_count) const;
+
 private:
     // Methods of sndio::ISink
     virtual sndio::ISink* to_sink();
@@ -156,6 +179,9 @@ private:
     virtual uint64_t tid_imp() const;
     virtual bool process_subframe_imp(audio::Frame&);
     virtual bool process_task_imp(PipelineTask&);
+    virtual core::nanoseconds_t refresh_imp(core::nanoseconds_t current_time);
+
+    void wait_ticker_();
 
     // Methods for tasks
     bool task_create_slot_(Task&);
@@ -169,6 +195,14 @@ private:
     core::Optional<core::Ticker> ticker_;
     core::Ticker::ticks_t ticker_ts_;
 
+    // When sink wants to be refreshed next time, returned by last refresh.
+    core::nanoseconds_t refresh_deadline_;
+
+    // Copy of ticker metrics, updated after every wait, to allow
+    // reading them without waiting for sink_mutex_.
+    core::TickerMetrics ticker_metrics_;
+    core::Mutex ticker_mutex_;
+
     const bool auto_duration_;
     const bool auto_cts_;
 
@@ -15,6 +15,13 @@
 namespace roc {
 namespace pipeline {
 
+namespace {
+
+// Number of frames used to compute CPU time averages and maximums.
+const size_t CpuMeterWindow = 100;
+
+} // namespace
+
 SenderSession::SenderSession(const SenderSinkConfig& sink_config,
                              const rtp::EncodingMap& encoding_map,
                              packet::PacketFactory& packet_factory,
@@ -26,6 +33,12 @@ SenderSession::SenderSession(const SenderSinkConfig& sink_config,
     , packet_factory_(packet_factory)
     , frame_factory_(frame_factory)
     , frame_writer_(NULL)
+    , cpu_meter_(CpuMeterWindow)
+    , fec_encoder_cpu_time_(0)
+    , frame_count_(0)
+    , last_frame_time_(0)
+    , max_frame_time_(0)
+    , total_frame_time_(0)
     , valid_(false) {
     identity_.reset(new (identity_) rtp::Identity());
     if (!identity_ || !identity_->is_valid()) {
@@ -68,6 +81,24 @@ bool SenderSession::create_transport_pipeline(SenderEndpoint* source_endpoint,
         return false;
     }
 
+    if (sink_config_.impairer.enable) {
+        impairer_.reset(new (impairer_) packet::Impairer(
+            *pkt_writer, sink_config_.impairer, packet_factory_, arena_));
+        if (!impairer_ || !impairer_->is_valid()) {
+            return false;
+        }
+        pkt_writer = impairer_.get();
+    }
+
+    if (sink_config_.pacer.enable) {
+        pacer_.reset(new (pacer_) packet::Pacer(*pkt_writer, sink_config_.pacer,
+                                                pkt_encoding->sample_spec));
+        if (!pacer_ || !pacer_->is_valid()) {
+            return false;
+        }
+        pkt_writer = pacer_.get();
+    }
+
     if (repair_endpoint) {
         if (!router_->add_route(repair_endpoint->outbound_writer(),
                                 packet::Packet::FlagRepair)) {
@@ -100,6 +131,13 @@ bool SenderSession::create_transport_pipeline(SenderEndpoint* source_endpoint,
             return false;
         }
         pkt_writer = fec_writer_.get();
+
+        fec_meter_writer_.reset(new (fec_meter_writer_) CpuMeterPacketWriter(
+            *pkt_writer, cpu_meter_, CpuStage_Fec));
+        if (!fec_meter_writer_) {
+            return false;
+        }
+        pkt_writer = fec_meter_writer_.get();
     }
 
     timestamp_extractor_.reset(new (timestamp_extractor_) rtp::TimestampExtractor(
@@ -138,6 +176,13 @@ bool SenderSession::create_transport_pipeline(SenderEndpoint* source_endpoint,
             return false;
         }
         frm_writer = packetizer_.get();
+
+        codec_meter_writer_.reset(new (codec_meter_writer_) CpuMeterFrameWriter(
+            *frm_writer, cpu_meter_, CpuStage_Codec));
+        if (!codec_meter_writer_) {
+            return false;
+        }
+        frm_writer = codec_meter_writer_.get();
     }
 
     if (pkt_encoding->sample_spec.channel_set()
@@ -184,6 +229,13 @@ bool SenderSession::create_transport_pipeline(SenderEndpoint* source_endpoint,
             return false;
         }
         frm_writer = resampler_writer_.get();
+
+        resampler_meter_writer_.reset(new (resampler_meter_writer_) CpuMeterFrameWriter(
+            *frm_writer, cpu_meter_, CpuStage_Resampler));
+        if (!resampler_meter_writer_) {
+            return false;
+        }
+        frm_writer = resampler_meter_writer_.get();
     }
 
     feedback_monitor_.reset(new (feedback_monitor_) audio::FeedbackMonitor(
@@ -227,10 +279,14 @@ bool SenderSession::create_control_pipeline(SenderEndpoint* control_endpoint) {
     return true;
 }
 
-audio::IFrameWriter* SenderSession::frame_writer() const {
+audio::IFrameWriter* SenderSession::frame_writer() {
     roc_panic_if(!is_valid());
 
-    return frame_writer_;
+    if (!frame_writer_) {
+        return NULL;
+    }
+
+    return this;
 }
 
 status::StatusCode SenderSession::route_packet(const packet::PacketPtr& packet,
@@ -247,6 +303,38 @@ status::StatusCode SenderSession::route_packet(const packet::PacketPtr& packet,
 core::nanoseconds_t SenderSession::refresh(core::nanoseconds_t current_time) {
     roc_panic_if(!is_valid());
 
+    core::nanoseconds_t next_deadline = 0;
+
+    if (fec_writer_) {
+        // write repair packets encoded in background, if any
+        cpu_meter_.begin_stage(CpuStage_Fec);
+        const status::StatusCode code = fec_writer_->flush();
+        cpu_meter_.end_stage(CpuStage_Fec);
+        // TODO(gh-183): forward status
+        roc_panic_if(code != status::StatusOK);
+    }
+
+    if (pacer_) {
+        const status::StatusCode code = pacer_->flush(current_time);
+        // TODO(gh-183): forward status
+        roc_panic_if(code != status::StatusOK);
+
+        next_deadline = pacer_->flush_deadline(current_time);
+    }
+
+    if (impairer_) {
+        const status::StatusCode code = impairer_->flush(current_time);
+        // TODO(gh-183): forward status
+        roc_panic_if(code != status::StatusOK);
+
+        const core::nanoseconds_t impairer_deadline = impairer_->flush_deadline();
+
+        if (next_deadline == 0
+            || (impairer_deadline != 0 && impairer_deadline < next_deadline)) {
+            next_deadline = impairer_deadline;
+        }
+    }
+
     if (rtcp_communicator_) {
         if (has_send_stream()) {
             const status::StatusCode code =
@@ -255,10 +343,15 @@ core::nanoseconds_t SenderSession::refresh(core::nanoseconds_t current_time) {
             roc_panic_if(code != status::StatusOK);
         }
 
-        return rtcp_communicator_->generation_deadline(current_time);
+        const core::nanoseconds_t rtcp_deadline =
+            rtcp_communicator_->generation_deadline(current_time);
+
+        if (next_deadline == 0 || (rtcp_deadline != 0 && rtcp_deadline < next_deadline)) {
+            next_deadline = rtcp_deadline;
+        }
     }
 
-    return 0;
+    return next_deadline;
 }
 
 void SenderSession::get_slot_metrics(SenderSlotMetrics& slot_metrics) const {
@@ -268,6 +361,24 @@ void SenderSession::get_slot_metrics(SenderSlotMetrics& slot_metrics) const {
     slot_metrics.num_participants =
         feedback_monitor_ ? feedback_monitor_->num_participants() : 0;
     slot_metrics.is_complete = (frame_writer_ != NULL);
+
+    slot_metrics.frame_count = frame_count_;
+    slot_metrics.frame_time = last_frame_time_;
+    slot_metrics.max_frame_time = max_frame_time_;
+    slot_metrics.total_frame_time = total_frame_time_;
+    slot_metrics.cpu = cpu_meter_.metrics();
+
+    if (pacer_) {
+        slot_metrics.pacer = pacer_->metrics();
+    }
+
+    if (impairer_) {
+        slot_metrics.impairer = impairer_->metrics();
+    }
+
+    if (fec_writer_) {
+        slot_metrics.fec = fec_writer_->metrics();
+    }
 }
 
 void SenderSession::get_participant_metrics(SenderParticipantMetrics* party_metrics,
@@ -287,6 +398,32 @@ void SenderSession::get_participant_metrics(SenderParticipantMetrics* party_metr
     }
 }
 
+void SenderSession::write(audio::Frame& frame) {
+    roc_panic_if(!frame_writer_);
+
+    const core::nanoseconds_t start_time = core::timestamp(core::ClockMonotonic);
+
+    cpu_meter_.begin_frame();
+    frame_writer_->write(frame);
+    if (fec_writer_) {
+        // account time spent by background encoder thread, if any
+        const core::nanoseconds_t encoder_time = fec_writer_->metrics().encoder_cpu_time;
+        cpu_meter_.add_stage_time(CpuStage_Fec, encoder_time - fec_encoder_cpu_time_);
+        fec_encoder_cpu_time_ = encoder_time;
+    }
+    cpu_meter_.end_frame();
+
+    const core::nanoseconds_t frame_time =
+        core::timestamp(core::ClockMonotonic) - start_time;
+
+    frame_count_++;
+    last_frame_time_ = frame_time;
+    total_frame_time_ += frame_time;
+    if (max_frame_time_ < frame_time) {
+        max_frame_time_ = frame_time;
+    }
+}
+
 rtcp::ParticipantInfo SenderSession::participant_info() {
     rtcp::ParticipantInfo part_info;
 
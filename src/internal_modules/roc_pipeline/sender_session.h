@@ -27,9 +27,13 @@
 #include "roc_fec/iblock_encoder.h"
 #include "roc_fec/writer.h"
 #include "roc_packet/interleaver.h"
+#include "roc_packet/impairer.h"
+#include "roc_packet/pacer.h"
 #include "roc_packet/packet_factory.h"
 #include "roc_packet/router.h"
 #include "roc_pipeline/config.h"
+#include "roc_pipeline/cpu_meter.h"
+#include "roc_pipeline/cpu_meter_writer.h"
 #include "roc_pipeline/metrics.h"
 #include "roc_pipeline/sender_endpoint.h"
 #include "roc_rtcp/communicator.h"
@@ -49,7 +53,9 @@ namespace pipeline {
 //! Contains:
 //!  - a pipeline for processing audio frames from single sender and converting
 //!    them into packets
-class SenderSession : public core::NonCopyable<>, private rtcp::IParticipant {
+class SenderSession : public core::NonCopyable<>,
+                      private audio::IFrameWriter,
+                      private rtcp::IParticipant {
 public:
     //! Initialize.
     SenderSession(const SenderSinkConfig& sink_config,
@@ -73,7 +79,8 @@ public:
     //!  This way samples reach the pipeline.
     //!  Most of the processing, like encoding packets, generating redundancy packets,
     //!  etc, happens during the write operation.
-    audio::IFrameWriter* frame_writer() const;
+    //!  Returns NULL until transport sub-pipeline is created.
+    audio::IFrameWriter* frame_writer();
 
     //! Route a packet to the session.
     //! @remarks
@@ -109,6 +116,10 @@ public:
                                  size_t* party_count) const;
 
 private:
+    // Implementation of audio::IFrameWriter interface.
+    // Passes frame to the pipeline and measures processing time.
+    virtual void write(audio::Frame& frame);
+
     // Implementation of rtcp::IParticipant interface.
     // These methods are invoked by rtcp::Communicator.
     virtual rtcp::ParticipantInfo participant_info();
@@ -137,20 +148,27 @@ private:
 
     core::Optional<packet::Router> router_;
 
+    core::Optional<packet::Impairer> impairer_;
+
+    core::Optional<packet::Pacer> pacer_;
+
     core::Optional<packet::Interleaver> interleaver_;
 
     core::ScopedPtr<fec::IBlockEncoder> fec_encoder_;
     core::Optional<fec::Writer> fec_writer_;
+    core::Optional<CpuMeterPacketWriter> fec_meter_writer_;
 
     core::Optional<rtp::TimestampExtractor> timestamp_extractor_;
 
     core::ScopedPtr<audio::IFrameEncoder> payload_encoder_;
     core::Optional<audio::Packetizer> packetizer_;
+    core::Optional<CpuMeterFrameWriter> codec_meter_writer_;
 
     core::Optional<audio::ChannelMapperWriter> channel_mapper_writer_;
 
     core::Optional<audio::ResamplerWriter> resampler_writer_;
     core::SharedPtr<audio::IResampler> resampler_;
+    core::Optional<CpuMeterFrameWriter> resampler_meter_writer_;
 
     core::Optional<audio::FeedbackMonitor> feedback_monitor_;
 
@@ -159,6 +177,14 @@ private:
 
     audio::IFrameWriter* frame_writer_;
 
+    CpuMeter cpu_meter_;
+    core::nanoseconds_t fec_encoder_cpu_time_;
+
+    uint64_t frame_count_;
+    core::nanoseconds_t last_frame_time_;
+    core::nanoseconds_t max_frame_time_;
+    core::nanoseconds_t total_frame_time_;
+
     bool valid_;
 };
 
@@ -25,10 +25,15 @@ SenderSink::SenderSink(const SenderSinkConfig& sink_config,
     , packet_factory_(packet_pool, packet_buffer_pool)
     , frame_factory_(frame_buffer_pool)
     , arena_(arena)
+    , fanout_(sink_config.fanout, arena)
     , frame_writer_(NULL)
     , valid_(false) {
     sink_config_.deduce_defaults();
 
+    if (!fanout_.is_valid()) {
+        return;
+    }
+
     audio::IFrameWriter* frm_writer = &fanout_;
 
     if (!sink_config_.input_sample_spec.is_raw()) {
@@ -35,7 +35,7 @@ namespace pipeline {
 //!
 //! Contains:
 //!  - one or more sender slots
-//!  - fanout, to duplicate audio to all slots
+//!  - fanout, to duplicate audio to all slots, optionally in parallel
 //!
 //! Pipeline:
 //!  - input: frames
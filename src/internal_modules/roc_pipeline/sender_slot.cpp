@@ -27,6 +27,7 @@ SenderSlot::SenderSlot(const SenderSinkConfig& sink_config,
     , fanout_(fanout)
     , state_tracker_(state_tracker)
     , session_(sink_config, encoding_map, packet_factory, frame_factory, arena)
+    , metrics_snapshot_(sink_config.rtcp.report_interval)
     , valid_(false) {
     if (!session_.is_valid()) {
         return;
@@ -139,7 +140,13 @@ core::nanoseconds_t SenderSlot::refresh(core::nanoseconds_t current_time) {
         roc_panic_if(code != status::StatusOK);
     }
 
-    return session_.refresh(current_time);
+    const core::nanoseconds_t next_deadline = session_.refresh(current_time);
+
+    if (metrics_snapshot_.publish_due(current_time)) {
+        publish_metrics_();
+    }
+
+    return next_deadline;
 }
 
 void SenderSlot::get_metrics(SenderSlotMetrics& slot_metrics,
@@ -154,6 +161,23 @@ void SenderSlot::get_metrics(SenderSlotMetrics& slot_metrics,
     }
 }
 
+bool SenderSlot::get_metrics_snapshot(SenderSlotMetrics& slot_metrics,
+                                      SenderParticipantMetrics* party_metrics,
+                                      size_t* party_count) const {
+    roc_panic_if(!is_valid());
+
+    return metrics_snapshot_.read(slot_metrics, party_metrics, party_count);
+}
+
+void SenderSlot::publish_metrics_() {
+    SenderMetricsSnapshot::Data& data = metrics_snapshot_.scratch();
+
+    data.party_count = metrics_snapshot_.max_parties();
+    get_metrics(data.slot_metrics, data.party_metrics, &data.party_count);
+
+    metrics_snapshot_.publish(data);
+}
+
 SenderEndpoint*
 SenderSlot::create_source_endpoint_(address::Protocol proto,
                                     const address::SocketAddr& outbound_address,
@@ -179,7 +203,8 @@ SenderSlot::create_source_endpoint_(address::Protocol proto,
     }
 
     source_endpoint_.reset(new (source_endpoint_) SenderEndpoint(
-        proto, state_tracker_, session_, outbound_address, outbound_writer, arena()));
+        proto, sink_config_, state_tracker_, session_, outbound_address,
+        outbound_writer, arena()));
     if (!source_endpoint_ || !source_endpoint_->is_valid()) {
         roc_log(LogError, "sender slot: can't create source endpoint");
         source_endpoint_.reset(NULL);
@@ -214,7 +239,8 @@ SenderSlot::create_repair_endpoint_(address::Protocol proto,
     }
 
     repair_endpoint_.reset(new (repair_endpoint_) SenderEndpoint(
-        proto, state_tracker_, session_, outbound_address, outbound_writer, arena()));
+        proto, sink_config_, state_tracker_, session_, outbound_address,
+        outbound_writer, arena()));
     if (!repair_endpoint_ || !repair_endpoint_->is_valid()) {
         roc_log(LogError, "sender slot: can't create repair endpoint");
         repair_endpoint_.reset(NULL);
@@ -238,7 +264,8 @@ SenderSlot::create_control_endpoint_(address::Protocol proto,
     }
 
     control_endpoint_.reset(new (control_endpoint_) SenderEndpoint(
-        proto, state_tracker_, session_, outbound_address, outbound_writer, arena()));
+        proto, sink_config_, state_tracker_, session_, outbound_address,
+        outbound_writer, arena()));
     if (!control_endpoint_ || !control_endpoint_->is_valid()) {
         roc_log(LogError, "sender slot: can't create control endpoint");
         control_endpoint_.reset(NULL);
@@ -23,6 +23,7 @@
 #include "roc_packet/packet_factory.h"
 #include "roc_pipeline/config.h"
 #include "roc_pipeline/metrics.h"
+#include "roc_pipeline/metrics_snapshot.h"
 #include "roc_pipeline/sender_endpoint.h"
 #include "roc_pipeline/sender_session.h"
 #include "roc_pipeline/state_tracker.h"
@@ -70,6 +71,18 @@ public:
                      SenderParticipantMetrics* party_metrics,
                      size_t* party_count) const;
 
+    //! Get latest published snapshot of metrics for slot and its participants.
+    //! @remarks
+    //!  Unlike get_metrics(), can be called from any thread, is lock-free, and
+    //!  never waits for pipeline. Snapshot is published by refresh() once per
+    //!  RTCP report interval.
+    //! @returns
+    //!  false if snapshot is not available or can't provide requested number
+    //!  of participants; get_metrics() should be used in this case.
+    bool get_metrics_snapshot(SenderSlotMetrics& slot_metrics,
+                              SenderParticipantMetrics* party_metrics,
+                              size_t* party_count) const;
+
 private:
     SenderEndpoint* create_source_endpoint_(address::Protocol proto,
                                             const address::SocketAddr& outbound_address,
@@ -81,6 +94,8 @@ private:
                                              const address::SocketAddr& outbound_address,
                                              packet::IWriter& outbound_writer);
 
+    void publish_metrics_();
+
     const SenderSinkConfig sink_config_;
 
     audio::Fanout& fanout_;
@@ -92,6 +107,8 @@ private:
     StateTracker& state_tracker_;
     SenderSession session_;
 
+    SenderMetricsSnapshot metrics_snapshot_;
+
     bool valid_;
 };
 
@@ -37,6 +37,7 @@ Communicator::Communicator(const Config& config,
     , config_(config)
     , reporter_(config, participant, arena)
     , next_deadline_(0)
+    , interval_computer_(config)
     , dest_addr_count_(0)
     , dest_addr_index_(0)
     , send_stream_count_(0)
@@ -69,6 +70,10 @@ size_t Communicator::total_streams() const {
     return reporter_.total_streams();
 }
 
+size_t Communicator::total_senders() const {
+    return reporter_.num_sending_participants();
+}
+
 status::StatusCode Communicator::process_packet(const packet::PacketPtr& packet,
                                                 core::nanoseconds_t current_time) {
     roc_panic_if(!is_valid());
@@ -82,6 +87,10 @@ status::StatusCode Communicator::process_packet(const packet::PacketPtr& packet,
 
     processed_packet_count_++;
 
+    if (config_.enable_interval_scaling) {
+        interval_computer_.add_packet(packet->rtcp()->payload.size());
+    }
+
     Traverser traverser(packet->rtcp()->payload);
     if (!traverser.parse()) {
         roc_log(LogTrace, "rtcp communicator: error when parsing compound packet");
@@ -117,6 +126,10 @@ status::StatusCode Communicator::process_packet(const packet::PacketPtr& packet,
         return status;
     }
 
+    if (config_.enable_interval_scaling) {
+        update_interval_(current_time);
+    }
+
     return status::StatusOK;
 }
 
@@ -337,6 +350,10 @@ core::nanoseconds_t Communicator::generation_deadline(core::nanoseconds_t curren
                      " expected positive value, got %lld",
                      (long long)current_time);
 
+    if (config_.enable_interval_scaling) {
+        return interval_computer_.deadline(current_time);
+    }
+
     if (next_deadline_ == 0) {
         // Until generate_packets() is called first time, report that
         // we're ready immediately.
@@ -354,17 +371,32 @@ status::StatusCode Communicator::generate_reports(core::nanoseconds_t current_ti
                      " expected positive value, got %lld",
                      (long long)current_time);
 
-    if (next_deadline_ == 0) {
-        next_deadline_ = current_time;
-    }
+    if (config_.enable_interval_scaling) {
+        if (interval_computer_.deadline(current_time) > current_time) {
+            return status::StatusOK;
+        }
 
-    if (next_deadline_ > current_time) {
-        return status::StatusOK;
-    }
+        update_interval_(current_time);
+
+        // Timer reconsideration: if group grew since last report, interval
+        // may become larger and report is postponed.
+        if (!interval_computer_.reconsider(current_time)) {
+            return status::StatusOK;
+        }
 
-    // TODO(gh-674): use IntervalComputer
-    next_deadline_ = current_time + config_.report_interval
-        - ((current_time - next_deadline_) % config_.report_interval);
+        interval_computer_.report_sent(current_time);
+    } else {
+        if (next_deadline_ == 0) {
+            next_deadline_ = current_time;
+        }
+
+        if (next_deadline_ > current_time) {
+            return status::StatusOK;
+        }
+
+        next_deadline_ = current_time + config_.report_interval
+            - ((current_time - next_deadline_) % config_.report_interval);
+    }
 
     roc_log(LogTrace, "rtcp communicator: generating report packets");
 
@@ -501,6 +533,10 @@ bool Communicator::continue_packet_generation_() {
 
 status::StatusCode
 Communicator::write_generated_packet_(const packet::PacketPtr& packet) {
+    if (config_.enable_interval_scaling) {
+        interval_computer_.add_packet(packet->rtcp()->payload.size());
+    }
+
     const status::StatusCode status = packet_writer_.write(packet);
     roc_log(LogTrace,
             "rtcp communicator: wrote packet:"
@@ -841,6 +877,12 @@ void Communicator::generate_goodbye_(Builder& bld) {
     bld.end_bye();
 }
 
+void Communicator::update_interval_(core::nanoseconds_t current_time) {
+    interval_computer_.update_members(reporter_.num_participants(),
+                                      reporter_.num_sending_participants(),
+                                      reporter_.is_sending(), current_time);
+}
+
 void Communicator::log_stats_() {
     if (!log_limiter_.allow()) {
         return;
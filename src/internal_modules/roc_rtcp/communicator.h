@@ -23,6 +23,7 @@
 #include "roc_packet/packet_factory.h"
 #include "roc_rtcp/builder.h"
 #include "roc_rtcp/config.h"
+#include "roc_rtcp/interval_computer.h"
 #include "roc_rtcp/iparticipant.h"
 #include "roc_rtcp/reporter.h"
 #include "roc_rtcp/traverser.h"
@@ -72,6 +73,9 @@ public:
     //! Get number of tracked streams, for testing.
     size_t total_streams() const;
 
+    //! Get number of known sending participants, including ourselves, for testing.
+    size_t total_senders() const;
+
     //! Parse and process incoming packet.
     //! Invokes IParticipant methods during processing.
     ROC_ATTR_NODISCARD status::StatusCode
@@ -135,6 +139,8 @@ private:
     void generate_description_(Builder& bld);
     void generate_goodbye_(Builder& bld);
 
+    void update_interval_(core::nanoseconds_t current_time);
+
     void log_stats_();
 
     packet::PacketFactory& packet_factory_;
@@ -148,6 +154,9 @@ private:
     // When generation_deadline() should be called next time.
     core::nanoseconds_t next_deadline_;
 
+    // Computes report interval, if interval scaling is enabled.
+    IntervalComputer interval_computer_;
+
     size_t dest_addr_count_; // Total count of destination addresses.
     size_t dest_addr_index_; // Index of current destination address.
 
@@ -23,8 +23,15 @@ namespace rtcp {
 //! RTCP config.
 struct Config {
     //! Interval between reports.
+    //! @remarks
+    //!  If enable_interval_scaling is set, this is minimum interval.
     core::nanoseconds_t report_interval;
 
+    //! Bandwidth available for RTCP traffic of the whole group, bytes per second.
+    //! @remarks
+    //!  Used only if enable_interval_scaling is set.
+    size_t report_bandwidth;
+
     //! Timeout to remove inactive streams.
     core::nanoseconds_t inactivity_timeout;
 
@@ -40,12 +47,21 @@ struct Config {
     //! Enable generation of SDES packets.
     bool enable_sdes;
 
+    //! Enable scaling of report interval with the number of participants.
+    //! @remarks
+    //!  If enabled, report interval is computed according to RFC 3550,
+    //!  section 6.3, so that RTCP traffic stays within report_bandwidth.
+    //!  If disabled, reports are sent every report_interval.
+    bool enable_interval_scaling;
+
     Config()
         : report_interval(core::Millisecond * 200)
+        , report_bandwidth(8820)
         , inactivity_timeout(core::Second * 5)
         , enable_sr_rr(true)
         , enable_xr(true)
-        , enable_sdes(true) {
+        , enable_sdes(true)
+        , enable_interval_scaling(false) {
     }
 };
 
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_rtcp/interval_computer.h"
+#include "roc_core/fast_random.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace rtcp {
+
+namespace {
+
+// Size of IPv4 + UDP headers, added to every packet as required by RFC.
+const size_t LowerLayerHeaderSize = 28;
+
+// Initial estimate of average packet size.
+const double InitialPacketSize = 128;
+
+// Compensation for timer reconsideration, which converges to a value
+// below intended average (RFC 3550, appendix A.7).
+const double Compensation = 2.71828 - 1.5;
+
+} // namespace
+
+IntervalComputer::IntervalComputer(const Config& config)
+    : min_interval_(config.report_interval)
+    , bandwidth_((double)config.report_bandwidth)
+    , members_(1)
+    , pmembers_(1)
+    , senders_(0)
+    , we_sent_(false)
+    , avg_packet_size_(InitialPacketSize)
+    , tp_(0)
+    , tn_(0) {
+}
+
+void IntervalComputer::add_packet(size_t packet_size) {
+    avg_packet_size_ +=
+        ((double)(packet_size + LowerLayerHeaderSize) - avg_packet_size_) / 16;
+}
+
+void IntervalComputer::update_members(size_t members,
+                                      size_t senders,
+                                      bool we_sent,
+                                      core::nanoseconds_t current_time) {
+    roc_panic_if_msg(members == 0 || senders > members,
+                     "rtcp interval computer: invalid members: members=%lu senders=%lu",
+                     (unsigned long)members, (unsigned long)senders);
+
+    members_ = members;
+    senders_ = senders;
+    we_sent_ = we_sent;
+
+    if (members_ < pmembers_ && tn_ != 0) {
+        // Reverse reconsideration.
+        const double ratio = (double)members_ / pmembers_;
+
+        if (tn_ > current_time) {
+            tn_ = current_time + core::nanoseconds_t((tn_ - current_time) * ratio);
+        }
+        if (tp_ < current_time) {
+            tp_ = current_time - core::nanoseconds_t((current_time - tp_) * ratio);
+        }
+
+        pmembers_ = members_;
+    }
+}
+
+core::nanoseconds_t IntervalComputer::deadline(core::nanoseconds_t current_time) const {
+    if (tn_ == 0) {
+        return current_time;
+    }
+    return tn_;
+}
+
+bool IntervalComputer::reconsider(core::nanoseconds_t current_time) {
+    if (tp_ == 0) {
+        // First report is sent immediately.
+        return true;
+    }
+
+    const core::nanoseconds_t new_tn = tp_ + compute_interval_();
+
+    if (new_tn <= current_time) {
+        return true;
+    }
+
+    roc_log(LogTrace,
+            "rtcp interval computer: postponing report:"
+            " members=%lu senders=%lu delay=%.3fms",
+            (unsigned long)members_, (unsigned long)senders_,
+            (double)(new_tn - current_time) / core::Millisecond);
+
+    tn_ = new_tn;
+    return false;
+}
+
+void IntervalComputer::report_sent(core::nanoseconds_t current_time) {
+    tp_ = current_time;
+    tn_ = current_time + compute_interval_();
+
+    pmembers_ = members_;
+}
+
+core::nanoseconds_t IntervalComputer::deterministic_interval() const {
+    double bandwidth = bandwidth_;
+    double n = (double)members_;
+
+    // If senders are less than 1/4 of members, they share 1/4 of bandwidth,
+    // and receivers share the rest.
+    if ((double)senders_ <= (double)members_ * 0.25) {
+        if (we_sent_) {
+            bandwidth *= 0.25;
+            n = (double)senders_;
+        } else {
+            bandwidth *= 0.75;
+            n = (double)(members_ - senders_);
+        }
+    }
+
+    if (bandwidth <= 0 || n <= 0) {
+        return min_interval_;
+    }
+
+    core::nanoseconds_t interval =
+        core::nanoseconds_t(avg_packet_size_ * n / bandwidth * core::Second);
+
+    if (interval < min_interval_) {
+        interval = min_interval_;
+    }
+
+    return interval;
+}
+
+double IntervalComputer::avg_packet_size() const {
+    return avg_packet_size_;
+}
+
+core::nanoseconds_t IntervalComputer::compute_interval_() const {
+    const double random = (double)core::fast_random() / (double)UINT32_MAX + 0.5;
+
+    return core::nanoseconds_t((double)deterministic_interval() * random / Compensation);
+}
+
+} // namespace rtcp
+} // namespace roc
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_rtcp/interval_computer.h
+//! @brief RTCP report interval computer.
+
+#ifndef ROC_RTCP_INTERVAL_COMPUTER_H_
+#define ROC_RTCP_INTERVAL_COMPUTER_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/time.h"
+#include "roc_rtcp/config.h"
+
+namespace roc {
+namespace rtcp {
+
+//! Computes interval between RTCP reports.
+//!
+//! Implements algorithm from RFC 3550, section 6.3 and appendix A.7:
+//!
+//!  - interval grows linearly with the number of participants, so that total
+//!    RTCP traffic of the group fits into configured bandwidth
+//!
+//!  - 1/4 of bandwidth is shared by senders and 3/4 by receivers, if senders
+//!    are less than 1/4 of participants
+//!
+//!  - interval is randomized in range [0.5, 1.5] to avoid synchronization
+//!    of participants, and then divided by e-3/2 to compensate for timer
+//!    reconsideration
+//!
+//!  - timer reconsideration: when deadline expires, interval is recomputed
+//!    and if it became larger (e.g. new participants joined), sending is
+//!    postponed
+//!
+//!  - reverse reconsideration: when participants leave, scheduled deadline
+//!    is moved closer proportionally
+//!
+//! Config::report_interval is used as minimum interval.
+class IntervalComputer : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit IntervalComputer(const Config& config);
+
+    //! Update average RTCP packet size.
+    //! @remarks
+    //!  Should be called for every sent and received RTCP packet.
+    //!  @p packet_size is size of RTCP payload, lower-layer headers are
+    //!  added automatically.
+    void add_packet(size_t packet_size);
+
+    //! Update group size.
+    //! @remarks
+    //!  @p members is number of participants including ourselves,
+    //!  @p senders is number of sending participants including ourselves,
+    //!  @p we_sent is true if we're sending.
+    //!  If number of members decreased, performs reverse reconsideration.
+    void update_members(size_t members,
+                        size_t senders,
+                        bool we_sent,
+                        core::nanoseconds_t current_time);
+
+    //! Get absolute time when report should be sent.
+    //! @remarks
+    //!  Returns @p current_time until first report is sent.
+    core::nanoseconds_t deadline(core::nanoseconds_t current_time) const;
+
+    //! Perform timer reconsideration.
+    //! @remarks
+    //!  Should be called when deadline expires.
+    //! @returns
+    //!  true if report should be sent now, or false if it was postponed
+    //!  and deadline was updated.
+    bool reconsider(core::nanoseconds_t current_time);
+
+    //! Notify that report was sent and schedule next one.
+    void report_sent(core::nanoseconds_t current_time);
+
+    //! Get deterministic (non-randomized) interval for current state.
+    core::nanoseconds_t deterministic_interval() const;
+
+    //! Get average RTCP packet size, including lower-layer headers.
+    double avg_packet_size() const;
+
+private:
+    core::nanoseconds_t compute_interval_() const;
+
+    const core::nanoseconds_t min_interval_;
+    const double bandwidth_;
+
+    size_t members_;
+    size_t pmembers_;
+    size_t senders_;
+    bool we_sent_;
+
+    double avg_packet_size_;
+
+    // Time of last sent report.
+    core::nanoseconds_t tp_;
+    // Time of next scheduled report.
+    core::nanoseconds_t tn_;
+};
+
+} // namespace rtcp
+} // namespace roc
+
+#endif // ROC_RTCP_INTERVAL_COMPUTER_H_
@@ -30,6 +30,7 @@ Reporter::Reporter(const Config& config, IParticipant& participant, core::IArena
     , local_recv_reports_(arena)
     , stream_pool_("stream_pool", arena)
     , stream_map_(arena)
+    , num_remote_senders_(0)
     , address_pool_("address_pool", arena)
     , address_map_(arena)
     , address_index_(arena)
@@ -104,6 +105,18 @@ size_t Reporter::total_streams() const {
     return stream_map_.size();
 }
 
+size_t Reporter::num_participants() const {
+    roc_panic_if(!is_valid());
+
+    return stream_map_.size() + 1;
+}
+
+size_t Reporter::num_sending_participants() const {
+    roc_panic_if(!is_valid());
+
+    return num_remote_senders_ + (is_sending() ? 1 : 0);
+}
+
 status::StatusCode Reporter::begin_processing(const address::SocketAddr& report_addr,
                                               core::nanoseconds_t report_time) {
     roc_panic_if(!is_valid());
@@ -209,6 +222,7 @@ void Reporter::process_sr(const header::SenderReportPacket& sr) {
 
     if (!stream->has_remote_send_report) {
         stream->has_remote_send_report = true;
+        num_remote_senders_++;
         need_rebuild_index_ = true;
     }
 
@@ -1422,6 +1436,11 @@ void Reporter::remove_stream_(Stream& stream) {
     roc_log(LogDebug, "rtcp reporter: removing stream: ssrc=%lu",
             (unsigned long)stream.source_id);
 
+    if (stream.has_remote_send_report) {
+        roc_panic_if(num_remote_senders_ == 0);
+        num_remote_senders_--;
+    }
+
     stream_lru_.remove(stream);
     stream_map_.remove(stream);
 
@@ -108,6 +108,12 @@ public:
     //! Get number of tracked streams, for testing.
     size_t total_streams() const;
 
+    //! Get number of known participants, including ourselves.
+    size_t num_participants() const;
+
+    //! Get number of known sending participants, including ourselves.
+    size_t num_sending_participants() const;
+
     //! @name Report processing
     //! @{
 
@@ -444,6 +450,10 @@ private:
     // This list always contains all existing streams.
     core::List<Stream, core::NoOwnership> stream_lru_;
 
+    // Number of streams (from stream map) with has_remote_send_report set.
+    // Maintained incrementally to avoid walking all streams per packet.
+    size_t num_remote_senders_;
+
     // Map of all destination addresses.
     // In Report_ToAddress mode, there will be only one address.
     // In Report_Back mode, addresses will be allocated as we discover
@@ -19,6 +19,11 @@ Composer::Composer(packet::IComposer* inner_composer)
     : inner_composer_(inner_composer) {
 }
 
+Composer::Composer(packet::IComposer* inner_composer, const ComposerConfig& config)
+    : inner_composer_(inner_composer)
+    , config_(config) {
+}
+
 bool Composer::align(core::Slice<uint8_t>& buffer,
                      size_t header_size,
                      size_t payload_alignment) {
@@ -26,7 +31,7 @@ bool Composer::align(core::Slice<uint8_t>& buffer,
         roc_panic("rtp composer: unexpected non-aligned buffer");
     }
 
-    header_size += sizeof(Header);
+    header_size += header_size_();
 
     if (inner_composer_ == NULL) {
         const size_t padding = core::AlignOps::pad_as(header_size, payload_alignment);
@@ -50,13 +55,13 @@ bool Composer::prepare(packet::Packet& packet,
                        size_t payload_size) {
     core::Slice<uint8_t> header = buffer.subslice(0, 0);
 
-    if (header.capacity() < sizeof(Header)) {
+    if (header.capacity() < header_size_()) {
         roc_log(LogDebug,
                 "rtp composer: not enough space for rtp header: size=%lu cap=%lu",
-                (unsigned long)sizeof(Header), (unsigned long)header.capacity());
+                (unsigned long)header_size_(), (unsigned long)header.capacity());
         return false;
     }
-    header.reslice(0, sizeof(Header));
+    header.reslice(0, header_size_());
 
     core::Slice<uint8_t> payload = header.subslice(header.size(), header.size());
 
@@ -122,7 +127,7 @@ bool Composer::compose(packet::Packet& packet) {
         roc_panic("rtp composer: unexpected non-rtp packet");
     }
 
-    if (rtp->header.size() != sizeof(Header)) {
+    if (rtp->header.size() != header_size_()) {
         roc_panic("rtp composer: unexpected rtp header size");
     }
 
@@ -136,6 +141,22 @@ bool Composer::compose(packet::Packet& packet) {
     header.set_marker(rtp->marker);
     header.set_payload_type(PayloadType(rtp->payload_type));
 
+    if (config_.enable_capture_time) {
+        header.set_extension(true);
+
+        CaptureTimeExtension& extension =
+            *(CaptureTimeExtension*)(rtp->header.data() + sizeof(Header));
+
+        extension.clear();
+        extension.init();
+
+        // Header size is fixed, so if there is no capture timestamp,
+        // element is left zeroed, which is interpreted as padding.
+        if (rtp->capture_timestamp > 0) {
+            extension.set_ntp_timestamp(packet::unix_2_ntp(rtp->capture_timestamp));
+        }
+    }
+
     if (rtp->padding.size() > 0) {
         header.set_padding(true);
 
@@ -163,5 +184,15 @@ bool Composer::compose(packet::Packet& packet) {
     return true;
 }
 
+size_t Composer::header_size_() const {
+    size_t size = sizeof(Header);
+
+    if (config_.enable_capture_time) {
+        size += sizeof(CaptureTimeExtension);
+    }
+
+    return size;
+}
+
 } // namespace rtp
 } // namespace roc
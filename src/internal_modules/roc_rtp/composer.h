@@ -18,6 +18,22 @@
 namespace roc {
 namespace rtp {
 
+//! RTP composer parameters.
+struct ComposerConfig {
+    //! Add absolute capture time header extension to every packet.
+    //! @remarks
+    //!  If enabled, every packet carries NTP time when its first sample was
+    //!  captured, in RFC 8285 header extension. This allows receiver to know
+    //!  capture time of packets without waiting for RTCP sender reports.
+    //!  If packet has no capture timestamp, extension element is replaced
+    //!  with padding, so that all packets have same header size.
+    bool enable_capture_time;
+
+    ComposerConfig()
+        : enable_capture_time(false) {
+    }
+};
+
 //! RTP packet composer.
 class Composer : public packet::IComposer, public core::NonCopyable<> {
 public:
@@ -26,6 +42,9 @@ public:
     //!  If @p inner_composer is not NULL, it is used to compose the packet payload.
     Composer(packet::IComposer* inner_composer);
 
+    //! Initialization with custom parameters.
+    Composer(packet::IComposer* inner_composer, const ComposerConfig& config);
+
     //! Adjust buffer to align payload.
     virtual bool
     align(core::Slice<uint8_t>& buffer, size_t header_size, size_t payload_alignment);
@@ -41,7 +60,10 @@ public:
     virtual bool compose(packet::Packet& packet);
 
 private:
+    size_t header_size_() const;
+
     packet::IComposer* inner_composer_;
+    const ComposerConfig config_;
 };
 
 } // namespace rtp
@@ -38,7 +38,7 @@ status::StatusCode Filter::read(packet::PacketPtr& result_packet) {
 
     populate_(next_packet);
 
-    result_packet = next_packet;
+    next_packet.transfer_to(result_packet);
     return status::StatusOK;
 }
 
@@ -59,7 +59,7 @@ bool Filter::validate_(const packet::PacketPtr& packet) {
 
     if (!has_prev_packet_ || prev_packet_rtp_.compare(*packet->rtp()) < 0) {
         has_prev_packet_ = true;
-        prev_packet_rtp_ = *packet->rtp();
+        remember_packet_(*packet->rtp());
     }
 
     return true;
@@ -73,6 +73,18 @@ void Filter::populate_(const packet::PacketPtr& packet) {
     }
 }
 
+// Copy only header fields. Copying slices would acquire and release packet
+// buffers on every packet, and would keep previous buffer alive.
+void Filter::remember_packet_(const packet::RTP& rtp) {
+    prev_packet_rtp_.source_id = rtp.source_id;
+    prev_packet_rtp_.seqnum = rtp.seqnum;
+    prev_packet_rtp_.stream_timestamp = rtp.stream_timestamp;
+    prev_packet_rtp_.duration = rtp.duration;
+    prev_packet_rtp_.capture_timestamp = rtp.capture_timestamp;
+    prev_packet_rtp_.marker = rtp.marker;
+    prev_packet_rtp_.payload_type = rtp.payload_type;
+}
+
 bool Filter::validate_sequence_(const packet::RTP& prev, const packet::RTP& next) const {
     if (prev.source_id != next.source_id) {
         roc_log(LogDebug, "rtp filter: source id jump: prev=%lu next=%lu",
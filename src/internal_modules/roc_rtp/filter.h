@@ -67,6 +67,7 @@ public:
 private:
     bool validate_(const packet::PacketPtr& packet);
     void populate_(const packet::PacketPtr& packet);
+    void remember_packet_(const packet::RTP& rtp);
 
     bool validate_sequence_(const packet::RTP& prev, const packet::RTP& next) const;
 
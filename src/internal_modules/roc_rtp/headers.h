@@ -16,6 +16,7 @@
 #include "roc_core/endian.h"
 #include "roc_core/panic.h"
 #include "roc_core/stddefs.h"
+#include "roc_packet/ntp.h"
 #include "roc_packet/units.h"
 
 namespace roc {
@@ -155,6 +156,12 @@ public:
         return (flags_ & (Flag_ExtensionMask << Flag_ExtensionShift));
     }
 
+    //! Set extension flag.
+    void set_extension(bool v) {
+        flags_ &= (uint8_t) ~(Flag_ExtensionMask << Flag_ExtensionShift);
+        flags_ |= ((v ? 1 : 0) << Flag_ExtensionShift);
+    }
+
     //! Get payload type.
     uint8_t payload_type() const {
         return ((mpt_ >> MPT_PayloadTypeShift) & MPT_PayloadTypeMask);
@@ -251,10 +258,110 @@ public:
         return core::ntoh16u(type_);
     }
 
+    //! Set extension type.
+    void set_type(uint16_t t) {
+        type_ = core::hton16u(t);
+    }
+
     //! Get extension data size in bytes (without extension header itself).
     uint32_t data_size() const {
         return (uint32_t(core::ntoh16u(len_)) << 2);
     }
+
+    //! Set extension data size in bytes (without extension header itself).
+    //! @remarks
+    //!  Size should be multiple of 4.
+    void set_data_size(uint32_t size) {
+        roc_panic_if((size & 0x3) != 0 || (size >> 2) > (uint16_t)-1);
+        len_ = core::hton16u(uint16_t(size >> 2));
+    }
+} ROC_ATTR_PACKED_END;
+
+//! Types of extension header used for RFC 8285 header extensions.
+//! @remarks
+//!  RFC 8285 defines two formats of extension data, with one-byte and two-byte
+//!  headers of extension elements. Extension type identifies which one is used.
+enum ExtensionType {
+    //! One-byte element headers.
+    ExtensionType_OneByte = 0xBEDE,
+
+    //! Two-byte element headers.
+    //! @remarks
+    //!  Lower 4 bits of extension type are application-dependent.
+    ExtensionType_TwoByte = 0x1000,
+
+    //! Mask to check for two-byte element headers.
+    ExtensionType_TwoByteMask = 0xFFF0
+};
+
+//! Identifiers of RFC 8285 header extension elements.
+//! @remarks
+//!  RFC 8285 expects identifiers to be negotiated out of band, e.g. via SDP.
+//!  There is no such negotiation between roc sender and receiver, so fixed
+//!  identifiers are used.
+enum ExtensionId {
+    //! Absolute capture time.
+    //! @remarks
+    //!  Data is 64-bit NTP timestamp of capture time of the first sample in
+    //!  packet, optionally followed by 64-bit estimated capture clock offset,
+    //!  which is ignored. See "abs-capture-time" extension, defined at
+    //!  http://www.webrtc.org/experiments/rtp-hdrext/abs-capture-time
+    ExtensionId_AbsCaptureTime = 1
+};
+
+//! RFC 8285 header extension with one-byte header containing absolute
+//! capture time element.
+//!
+//! RFC 8285 4.2: "One-Byte Header"
+//!
+//! @code
+//!    0             1               2               3               4
+//!    0 1 2 3 4 5 6 7 0 1 2 3 4 5 6 7 0 1 2 3 4 5 6 7 0 1 2 3 4 5 6 7
+//!   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//!   |       0xBE    |    0xDE       |           length=3            |
+//!   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//!   |  ID   | L=7   |      absolute capture timestamp (NTP) ...     |
+//!   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//!   |                              ...                              |
+//!   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//!   |      ...      |    padding    |    padding    |    padding    |
+//!   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//! @endcode
+ROC_ATTR_PACKED_BEGIN class CaptureTimeExtension {
+private:
+    //! Extension header.
+    ExtentionHeader header_;
+
+    //! Element ID and length.
+    uint8_t id_len_;
+
+    //! NTP timestamp.
+    uint8_t ntp_[8];
+
+    //! Padding up to 32-bit boundary.
+    uint8_t padding_[3];
+
+public:
+    //! Clear extension.
+    void clear() {
+        memset(this, 0, sizeof(*this));
+    }
+
+    //! Fill extension header.
+    //! @remarks
+    //!  Until timestamp is set, element bytes are zero, which means padding.
+    void init() {
+        header_.set_type(ExtensionType_OneByte);
+        header_.set_data_size(sizeof(*this) - sizeof(ExtentionHeader));
+    }
+
+    //! Fill element header and NTP timestamp.
+    void set_ntp_timestamp(packet::ntp_timestamp_t ts) {
+        id_len_ = uint8_t((ExtensionId_AbsCaptureTime << 4) | (sizeof(ntp_) - 1));
+
+        const uint64_t ts_be = core::hton64u(ts);
+        memcpy(ntp_, &ts_be, sizeof(ntp_));
+    }
 } ROC_ATTR_PACKED_END;
 
 } // namespace rtp
@@ -60,20 +60,26 @@ status::StatusCode LinkMeter::write(const packet::PacketPtr& packet) {
         roc_panic("link meter: null packet");
     }
 
-    // When we create LinkMeter, we don't know yet if RTP is used (e.g.
-    // for repair packets), so we should be ready for non-rtp packets.
-    if (packet->rtp()) {
-        // Since we don't know packet type in-before, we also determine
-        // encoding dynamically.
-        if (!encoding_ || encoding_->payload_type != packet->rtp()->payload_type) {
-            encoding_ = encoding_map_.find_by_pt(packet->rtp()->payload_type);
-        }
-        if (encoding_) {
-            update_metrics_(*packet);
+    handle_packet_(*packet);
+
+    return writer_->write(packet);
+}
+
+status::StatusCode LinkMeter::write_batch(const packet::PacketPtr* packets,
+                                          size_t n_packets) {
+    if (!writer_) {
+        roc_panic("link meter: forgot to call set_writer()");
+    }
+
+    for (size_t n = 0; n < n_packets; n++) {
+        if (!packets[n]) {
+            roc_panic("link meter: null packet");
         }
+
+        handle_packet_(*packets[n]);
     }
 
-    return writer_->write(packet);
+    return writer_->write_batch(packets, n_packets);
 }
 
 status::StatusCode LinkMeter::read(packet::PacketPtr& packet) {
@@ -97,6 +103,21 @@ void LinkMeter::set_reader(packet::IReader& reader) {
     reader_ = &reader;
 }
 
+void LinkMeter::handle_packet_(const packet::Packet& packet) {
+    // When we create LinkMeter, we don't know yet if RTP is used (e.g.
+    // for repair packets), so we should be ready for non-rtp packets.
+    if (packet.rtp()) {
+        // Since we don't know packet type in-before, we also determine
+        // encoding dynamically.
+        if (!encoding_ || encoding_->payload_type != packet.rtp()->payload_type) {
+            encoding_ = encoding_map_.find_by_pt(packet.rtp()->payload_type);
+        }
+        if (encoding_) {
+            update_metrics_(packet);
+        }
+    }
+}
+
 void LinkMeter::update_metrics_(const packet::Packet& packet) {
     const packet::seqnum_t pkt_seqnum = packet.rtp()->seqnum;
 
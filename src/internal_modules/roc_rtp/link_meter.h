@@ -72,6 +72,10 @@ public:
     //!  Invoked early in pipeline right after the packet is received.
     virtual ROC_ATTR_NODISCARD status::StatusCode write(const packet::PacketPtr& packet);
 
+    //! Write multiple packets and update metrics.
+    virtual ROC_ATTR_NODISCARD status::StatusCode
+    write_batch(const packet::PacketPtr* packets, size_t n_packets);
+
     //! Read packet and update metrics.
     //! @remarks
     //!  Invoked late in pipeline right before the packet is decoded.
@@ -88,6 +92,7 @@ public:
     void set_reader(packet::IReader& reader);
 
 private:
+    void handle_packet_(const packet::Packet& packet);
     void update_metrics_(const packet::Packet& packet);
 
     const EncodingMap& encoding_map_;
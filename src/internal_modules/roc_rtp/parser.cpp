@@ -13,6 +13,74 @@
 namespace roc {
 namespace rtp {
 
+namespace {
+
+// Find absolute capture time element in RFC 8285 extension data.
+// Returns zero if there is no such element or extension format is unknown.
+core::nanoseconds_t
+parse_capture_time(uint16_t ext_type, const uint8_t* data, size_t size) {
+    size_t elem_header_size = 0;
+
+    if (ext_type == ExtensionType_OneByte) {
+        elem_header_size = 1;
+    } else if ((ext_type & ExtensionType_TwoByteMask) == ExtensionType_TwoByte) {
+        elem_header_size = 2;
+    } else {
+        return 0;
+    }
+
+    size_t pos = 0;
+
+    while (pos < size) {
+        if (data[pos] == 0) {
+            // padding
+            pos++;
+            continue;
+        }
+
+        if (pos + elem_header_size > size) {
+            break;
+        }
+
+        size_t elem_id = 0, elem_len = 0;
+
+        if (elem_header_size == 1) {
+            elem_id = data[pos] >> 4;
+            elem_len = (data[pos] & 0xf) + 1u;
+
+            if (elem_id == 15) {
+                // reserved id, parsing should stop
+                break;
+            }
+        } else {
+            elem_id = data[pos];
+            elem_len = data[pos + 1];
+        }
+
+        pos += elem_header_size;
+
+        if (pos + elem_len > size) {
+            roc_log(LogDebug, "rtp parser: bad extension element: id=%lu len=%lu",
+                    (unsigned long)elem_id, (unsigned long)elem_len);
+            break;
+        }
+
+        if (elem_id == ExtensionId_AbsCaptureTime && (elem_len == 8 || elem_len == 16)) {
+            uint64_t ntp_ts = 0;
+            memcpy(&ntp_ts, data + pos, sizeof(ntp_ts));
+
+            const core::nanoseconds_t unix_ts = packet::ntp_2_unix(core::ntoh64u(ntp_ts));
+            return unix_ts > 0 ? unix_ts : 0;
+        }
+
+        pos += elem_len;
+    }
+
+    return 0;
+}
+
+} // namespace
+
 Parser::Parser(const EncodingMap& encoding_map, packet::IParser* inner_parser)
     : encoding_map_(encoding_map)
     , inner_parser_(inner_parser) {
@@ -45,11 +113,20 @@ bool Parser::parse(packet::Packet& packet, const core::Slice<uint8_t>& buffer) {
         return false;
     }
 
+    core::nanoseconds_t capture_ts = 0;
+
     if (header.has_extension()) {
         const ExtentionHeader& extension =
             *(const ExtentionHeader*)(buffer.data() + header.header_size());
 
         header_size += extension.data_size();
+
+        if (buffer.size() >= header_size) {
+            capture_ts = parse_capture_time(
+                extension.type(),
+                buffer.data() + header.header_size() + sizeof(ExtentionHeader),
+                extension.data_size());
+        }
     }
 
     if (buffer.size() < header_size) {
@@ -96,6 +173,7 @@ bool Parser::parse(packet::Packet& packet, const core::Slice<uint8_t>& buffer) {
     rtp.stream_timestamp = header.timestamp();
     rtp.marker = header.marker();
     rtp.payload_type = header.payload_type();
+    rtp.capture_timestamp = capture_ts;
     rtp.header = buffer.subslice(0, header_size);
     rtp.payload = buffer.subslice(payload_begin, payload_end);
 
@@ -40,22 +40,7 @@ status::StatusCode TimestampInjector::read(packet::PacketPtr& pkt) {
         return code;
     }
 
-    if (!pkt->rtp()) {
-        roc_panic("timestamp injector: unexpected non-rtp packet");
-    }
-
-    if (pkt->rtp()->capture_timestamp != 0) {
-        roc_panic("timestamp injector: unexpected non-zero cts in packet: %lld",
-                  (long long)pkt->rtp()->capture_timestamp);
-    }
-
-    if (has_ts_) {
-        const packet::stream_timestamp_diff_t rtp_dn =
-            packet::stream_timestamp_diff(pkt->rtp()->stream_timestamp, rtp_ts_);
-
-        pkt->rtp()->capture_timestamp =
-            capt_ts_ + sample_spec_.stream_timestamp_delta_2_ns(rtp_dn);
-    }
+    inject_(*pkt);
 
     return status::StatusOK;
 }
@@ -81,5 +66,25 @@ void TimestampInjector::update_mapping(core::nanoseconds_t capture_ts,
     has_ts_ = true;
 }
 
+void TimestampInjector::inject_(packet::Packet& pkt) {
+    if (!pkt.rtp()) {
+        roc_panic("timestamp injector: unexpected non-rtp packet");
+    }
+
+    if (pkt.rtp()->capture_timestamp != 0) {
+        // Capture timestamp was delivered in packet itself (via RTP header
+        // extension), it's more precise than our estimation.
+        return;
+    }
+
+    if (has_ts_) {
+        const packet::stream_timestamp_diff_t rtp_dn =
+            packet::stream_timestamp_diff(pkt.rtp()->stream_timestamp, rtp_ts_);
+
+        pkt.rtp()->capture_timestamp =
+            capt_ts_ + sample_spec_.stream_timestamp_delta_2_ns(rtp_dn);
+    }
+}
+
 } // namespace rtp
 } // namespace roc
@@ -25,6 +25,8 @@ namespace rtp {
 //! @remarks
 //!  Gets a pair of a reference unix-time stamp (in ns) and correspondent rtp timestamp,
 //!  and approximates this dependency to a passing packet.
+//!  Packets that already have capture timestamp, retrieved by parser from RTP
+//!  header extension, are passed as is.
 class TimestampInjector : public packet::IReader, public core::NonCopyable<> {
 public:
     //! Initialize.
@@ -35,7 +37,8 @@ public:
 
     //! Get packet with filled capture ts field.
     //! @remarks
-    //!  If update_mapping has not been called yet, capture timestamp will be 0.
+    //!  If update_mapping has not been called yet, and packet doesn't have
+    //!  capture timestamp, it will remain 0.
     virtual ROC_ATTR_NODISCARD status::StatusCode read(packet::PacketPtr&);
 
     //! Get a pair of a reference timestamps.
@@ -43,6 +46,8 @@ public:
                         packet::stream_timestamp_t rtp_ts);
 
 private:
+    void inject_(packet::Packet& pkt);
+
     bool has_ts_;
     core::nanoseconds_t capt_ts_;
     packet::stream_timestamp_t rtp_ts_;
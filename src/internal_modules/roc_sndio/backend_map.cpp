@@ -55,6 +55,11 @@ void BackendMap::register_backends_() {
     add_backend_(pulseaudio_backend_.get());
 #endif // ROC_TARGET_PULSEAUDIO
 
+#ifdef ROC_TARGET_ALSA_NATIVE
+    alsa_backend_.reset(new (alsa_backend_) AlsaBackend);
+    add_backend_(alsa_backend_.get());
+#endif // ROC_TARGET_ALSA_NATIVE
+
 #ifdef ROC_TARGET_SNDFILE
     sndfile_backend_.reset(new (sndfile_backend_) SndfileBackend);
     add_backend_(sndfile_backend_.get());
@@ -22,6 +22,10 @@
 #include "roc_sndio/pulseaudio_backend.h"
 #endif // ROC_TARGET_PULSEAUDIO
 
+#ifdef ROC_TARGET_ALSA_NATIVE
+#include "roc_sndio/alsa_backend.h"
+#endif // ROC_TARGET_ALSA_NATIVE
+
 #ifdef ROC_TARGET_SNDFILE
 #include "roc_sndio/sndfile_backend.h"
 #endif // ROC_TARGET_SNDFILE
@@ -73,6 +77,10 @@ private:
     core::Optional<PulseaudioBackend> pulseaudio_backend_;
 #endif // ROC_TARGET_PULSEAUDIO
 
+#ifdef ROC_TARGET_ALSA_NATIVE
+    core::Optional<AlsaBackend> alsa_backend_;
+#endif // ROC_TARGET_ALSA_NATIVE
+
 #ifdef ROC_TARGET_SNDFILE
     core::Optional<SndfileBackend> sndfile_backend_;
 #endif // ROC_TARGET_SNDFILE
@@ -27,20 +27,21 @@ Pump::Pump(core::IPool& buffer_pool,
     , n_bufs_(0)
     , oneshot_(mode == ModeOneshot)
     , stop_(0) {
-    size_t frame_size = sample_spec_.ns_2_samples_overall(frame_length);
+    // Frame size in bytes, so that both raw and non-raw formats are supported.
+    size_t frame_size = sample_spec_.ns_2_bytes(frame_length);
     if (frame_size == 0) {
         roc_log(LogError, "pump: frame size cannot be 0");
         return;
     }
 
-    if (frame_factory_.raw_buffer_size() < frame_size) {
+    if (frame_factory_.byte_buffer_size() < frame_size) {
         roc_log(LogError, "pump: buffer size is too small: required=%lu actual=%lu",
                 (unsigned long)frame_size,
-                (unsigned long)frame_factory_.raw_buffer_size());
+                (unsigned long)frame_factory_.byte_buffer_size());
         return;
     }
 
-    frame_buffer_ = frame_factory_.new_raw_buffer();
+    frame_buffer_ = frame_factory_.new_byte_buffer();
     if (!frame_buffer_) {
         roc_log(LogError, "pump: can't allocate frame buffer");
         return;
@@ -114,6 +115,9 @@ bool Pump::run() {
 
 bool Pump::transfer_frame_(ISource& current_source) {
     audio::Frame frame(frame_buffer_.data(), frame_buffer_.size());
+    if (!sample_spec_.is_raw()) {
+        frame.set_flags(audio::Frame::FlagNotRaw);
+    }
 
     // if source has clock, here we block on it
     if (!current_source.read(frame)) {
@@ -76,7 +76,7 @@ private:
 
     audio::SampleSpec sample_spec_;
 
-    core::Slice<audio::sample_t> frame_buffer_;
+    core::Slice<uint8_t> frame_buffer_;
 
     size_t n_bufs_;
     const bool oneshot_;
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_sndio/alsa_backend.h"
+#include "roc_core/log.h"
+#include "roc_core/scoped_ptr.h"
+#include "roc_core/stddefs.h"
+#include "roc_sndio/alsa_device.h"
+#include "roc_sndio/driver.h"
+
+namespace roc {
+namespace sndio {
+
+AlsaBackend::AlsaBackend() {
+}
+
+void AlsaBackend::discover_drivers(core::Array<DriverInfo, MaxDrivers>& driver_list) {
+    if (!driver_list.push_back(DriverInfo("alsa", DriverType_Device,
+                                          DriverFlag_IsDefault | DriverFlag_SupportsSink
+                                              | DriverFlag_SupportsSource,
+                                          this))) {
+        roc_panic("alsa backend: can't add driver");
+    }
+}
+
+IDevice* AlsaBackend::open_device(DeviceType device_type,
+                                  DriverType driver_type,
+                                  const char* driver,
+                                  const char* path,
+                                  const Config& config,
+                                  core::IArena& arena) {
+    if (driver_type != DriverType_Device) {
+        return NULL;
+    }
+
+    if (driver && strcmp(driver, "alsa") != 0) {
+        return NULL;
+    }
+
+    core::ScopedPtr<AlsaDevice> device(new (arena) AlsaDevice(arena, config, device_type),
+                                       arena);
+
+    if (!device) {
+        roc_log(LogDebug, "alsa backend: can't construct device: path=%s", path);
+        return NULL;
+    }
+
+    if (!device->open(path)) {
+        roc_log(LogDebug, "alsa backend: can't open device: path=%s", path);
+        return NULL;
+    }
+
+    return device.release();
+}
+
+const char* AlsaBackend::name() const {
+    return "alsa";
+}
+
+} // namespace sndio
+} // namespace roc
@@ -0,0 +1,693 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+
+#include "roc_sndio/alsa_device.h"
+#include "roc_audio/channel_defs.h"
+#include "roc_audio/sample.h"
+#include "roc_audio/sample_format.h"
+#include "roc_audio/sample_spec_to_str.h"
+#include "roc_core/log.h"
+#include "roc_core/macro_helpers.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace sndio {
+
+namespace {
+
+const core::nanoseconds_t ReportInterval = 10 * core::Second;
+
+// Without sound server in between, latency can be lower than
+// with pulseaudio backend; 40ms works with most sound cards.
+const core::nanoseconds_t DefaultLatency = core::Millisecond * 40;
+
+// Used when neither user nor device specified sample rate.
+const unsigned int DefaultRate = 48000;
+
+// Used when channel count is not specified.
+const unsigned int DefaultChannels = 2;
+
+const core::nanoseconds_t MinTimeout = core::Millisecond * 50;
+const core::nanoseconds_t MaxTimeout = core::Second * 2;
+
+// Device formats in order of preference.
+// Float format doesn't need conversion at all.
+const snd_pcm_format_t SupportedFormats[] = {
+    SND_PCM_FORMAT_FLOAT,
+    SND_PCM_FORMAT_S32,
+    SND_PCM_FORMAT_S16,
+};
+
+audio::PcmFormat map_format(snd_pcm_format_t format) {
+    switch (format) {
+    case SND_PCM_FORMAT_FLOAT:
+        return audio::PcmFormat_Float32;
+    case SND_PCM_FORMAT_S32:
+        return audio::PcmFormat_SInt32;
+    case SND_PCM_FORMAT_S16:
+        return audio::PcmFormat_SInt16;
+    default:
+        break;
+    }
+    return audio::PcmFormat_Invalid;
+}
+
+} // namespace
+
+AlsaDevice::AlsaDevice(core::IArena& arena,
+                       const Config& config,
+                       DeviceType device_type)
+    : device_type_(device_type)
+    , device_(arena)
+    , sample_spec_(config.sample_spec)
+    , frame_len_ns_(config.frame_length)
+    , target_latency_ns_(config.latency)
+    , timeout_ns_(0)
+    , pcm_(NULL)
+    , pcm_format_(SND_PCM_FORMAT_UNKNOWN)
+    , pcm_sample_bytes_(0)
+    , period_size_(0)
+    , buffer_size_(0)
+    , paused_(false)
+    , rate_limiter_(ReportInterval) {
+    if (frame_len_ns_ == 0) {
+        frame_len_ns_ = DefaultFrameLength;
+    }
+    if (target_latency_ns_ == 0) {
+        target_latency_ns_ = DefaultLatency;
+    }
+    timeout_ns_ = target_latency_ns_ * 2;
+    if (timeout_ns_ < MinTimeout) {
+        timeout_ns_ = MinTimeout;
+    }
+    if (timeout_ns_ > MaxTimeout) {
+        timeout_ns_ = MaxTimeout;
+    }
+}
+
+AlsaDevice::~AlsaDevice() {
+    roc_log(LogDebug, "alsa %s: closing device", device_type_to_str(device_type_));
+
+    close_pcm_();
+}
+
+bool AlsaDevice::open(const char* device) {
+    if (pcm_) {
+        roc_panic("alsa %s: can't call open() twice", device_type_to_str(device_type_));
+    }
+
+    if (!device_.assign(device ? device : "default")) {
+        roc_log(LogError, "alsa %s: can't allocate string",
+                device_type_to_str(device_type_));
+        return false;
+    }
+
+    roc_log(LogDebug, "alsa %s: opening device: device=%s",
+            device_type_to_str(device_type_), device_.c_str());
+
+    if (!open_pcm_()) {
+        close_pcm_();
+        return false;
+    }
+
+    return true;
+}
+
+ISink* AlsaDevice::to_sink() {
+    return device_type_ == DeviceType_Sink ? this : NULL;
+}
+
+ISource* AlsaDevice::to_source() {
+    return device_type_ == DeviceType_Source ? this : NULL;
+}
+
+DeviceType AlsaDevice::type() const {
+    return device_type_;
+}
+
+DeviceState AlsaDevice::state() const {
+    return paused_ ? DeviceState_Paused : DeviceState_Active;
+}
+
+void AlsaDevice::pause() {
+    roc_panic_if(!pcm_);
+
+    if (paused_) {
+        return;
+    }
+
+    if (int err = snd_pcm_drop(pcm_)) {
+        roc_log(LogError, "alsa %s: snd_pcm_drop(): %s",
+                device_type_to_str(device_type_), snd_strerror(err));
+    }
+
+    paused_ = true;
+}
+
+bool AlsaDevice::resume() {
+    roc_panic_if(!pcm_);
+
+    if (!paused_) {
+        return true;
+    }
+
+    if (int err = snd_pcm_prepare(pcm_)) {
+        roc_log(LogError, "alsa %s: snd_pcm_prepare(): %s",
+                device_type_to_str(device_type_), snd_strerror(err));
+        return false;
+    }
+
+    paused_ = false;
+
+    if (device_type_ == DeviceType_Source) {
+        return start_pcm_();
+    }
+
+    return true;
+}
+
+bool AlsaDevice::restart() {
+    pause();
+
+    return resume();
+}
+
+audio::SampleSpec AlsaDevice::sample_spec() const {
+    return sample_spec_;
+}
+
+core::nanoseconds_t AlsaDevice::latency() const {
+    core::nanoseconds_t latency = 0;
+
+    if (!get_latency_(latency)) {
+        // until device is started, assume that actual latency
+        // is equal to target latency
+        latency = target_latency_ns_;
+    }
+
+    return latency;
+}
+
+bool AlsaDevice::has_latency() const {
+    return true;
+}
+
+bool AlsaDevice::has_clock() const {
+    return true;
+}
+
+void AlsaDevice::reclock(core::nanoseconds_t timestamp) {
+    // no-op
+}
+
+void AlsaDevice::write(audio::Frame& frame) {
+    roc_panic_if(device_type_ != DeviceType_Sink);
+
+    transfer_(frame.raw_samples(), frame.num_raw_samples() / sample_spec_.num_channels());
+}
+
+bool AlsaDevice::read(audio::Frame& frame) {
+    roc_panic_if(device_type_ != DeviceType_Source);
+
+    return transfer_(frame.raw_samples(),
+                     frame.num_raw_samples() / sample_spec_.num_channels());
+}
+
+bool AlsaDevice::open_pcm_() {
+    const snd_pcm_stream_t stream = device_type_ == DeviceType_Sink
+        ? SND_PCM_STREAM_PLAYBACK
+        : SND_PCM_STREAM_CAPTURE;
+
+    if (int err = snd_pcm_open(&pcm_, device_.c_str(), stream, 0)) {
+        roc_log(LogError, "alsa %s: snd_pcm_open(): device=%s: %s",
+                device_type_to_str(device_type_), device_.c_str(), snd_strerror(err));
+        pcm_ = NULL;
+        return false;
+    }
+
+    snd_pcm_hw_params_t* hw_params = NULL;
+    if (int err = snd_pcm_hw_params_malloc(&hw_params)) {
+        roc_log(LogError, "alsa %s: snd_pcm_hw_params_malloc(): %s",
+                device_type_to_str(device_type_), snd_strerror(err));
+        return false;
+    }
+
+    const bool hw_ok = set_hw_params_(hw_params);
+    snd_pcm_hw_params_free(hw_params);
+
+    if (!hw_ok) {
+        return false;
+    }
+
+    snd_pcm_sw_params_t* sw_params = NULL;
+    if (int err = snd_pcm_sw_params_malloc(&sw_params)) {
+        roc_log(LogError, "alsa %s: snd_pcm_sw_params_malloc(): %s",
+                device_type_to_str(device_type_), snd_strerror(err));
+        return false;
+    }
+
+    const bool sw_ok = set_sw_params_(sw_params);
+    snd_pcm_sw_params_free(sw_params);
+
+    if (!sw_ok) {
+        return false;
+    }
+
+    roc_log(LogInfo,
+            "alsa %s: opened device: device=%s format=%s period_size=%lu(%.3fms)"
+            " buffer_size=%lu(%.3fms) sample_spec=%s",
+            device_type_to_str(device_type_), device_.c_str(),
+            snd_pcm_format_name(pcm_format_), (unsigned long)period_size_,
+            (double)sample_spec_.samples_per_chan_2_ns(period_size_) / core::Millisecond,
+            (unsigned long)buffer_size_,
+            (double)sample_spec_.samples_per_chan_2_ns(buffer_size_) / core::Millisecond,
+            audio::sample_spec_to_str(sample_spec_).c_str());
+
+    // Playback is started automatically when ring buffer is filled.
+    if (device_type_ == DeviceType_Source) {
+        return start_pcm_();
+    }
+
+    return true;
+}
+
+void AlsaDevice::close_pcm_() {
+    if (!pcm_) {
+        return;
+    }
+
+    // Let device play what is already in ring buffer.
+    if (device_type_ == DeviceType_Sink && !paused_
+        && (snd_pcm_state(pcm_) == SND_PCM_STATE_RUNNING
+            || snd_pcm_state(pcm_) == SND_PCM_STATE_PREPARED)) {
+        if (int err = snd_pcm_drain(pcm_)) {
+            roc_log(LogDebug, "alsa %s: snd_pcm_drain(): %s",
+                    device_type_to_str(device_type_), snd_strerror(err));
+        }
+    }
+
+    if (int err = snd_pcm_close(pcm_)) {
+        roc_log(LogError, "alsa %s: snd_pcm_close(): %s",
+                device_type_to_str(device_type_), snd_strerror(err));
+    }
+
+    pcm_ = NULL;
+}
+
+bool AlsaDevice::set_hw_params_(snd_pcm_hw_params_t* hw_params) {
+    int err = 0;
+
+    if ((err = snd_pcm_hw_params_any(pcm_, hw_params)) < 0) {
+        roc_log(LogError, "alsa %s: snd_pcm_hw_params_any(): %s",
+                device_type_to_str(device_type_), snd_strerror(err));
+        return false;
+    }
+
+    if ((err = snd_pcm_hw_params_set_access(pcm_, hw_params,
+                                            SND_PCM_ACCESS_MMAP_INTERLEAVED))
+        < 0) {
+        roc_log(LogError,
+                "alsa %s: device doesn't support interleaved mmap access:"
+                " device=%s: %s (try \"plug:\" device instead)",
+                device_type_to_str(device_type_), device_.c_str(), snd_strerror(err));
+        return false;
+    }
+
+    if (!choose_format_(hw_params)) {
+        return false;
+    }
+
+    // Channels.
+    const bool has_channels = sample_spec_.channel_set().is_valid();
+
+    unsigned int n_channels =
+        has_channels ? (unsigned int)sample_spec_.num_channels() : DefaultChannels;
+
+    if ((err = snd_pcm_hw_params_set_channels_near(pcm_, hw_params, &n_channels)) < 0) {
+        roc_log(LogError, "alsa %s: snd_pcm_hw_params_set_channels_near(): %s",
+                device_type_to_str(device_type_), snd_strerror(err));
+        return false;
+    }
+
+    if (has_channels && n_channels != sample_spec_.num_channels()) {
+        roc_log(LogError,
+                "alsa %s: device doesn't support requested channel count:"
+                " requested=%lu supported=%u",
+                device_type_to_str(device_type_),
+                (unsigned long)sample_spec_.num_channels(), n_channels);
+        return false;
+    }
+
+    // Sample rate.
+    // Resampling is done by our pipeline, don't let ALSA do it.
+    if ((err = snd_pcm_hw_params_set_rate_resample(pcm_, hw_params, 0)) < 0) {
+        roc_log(LogDebug, "alsa %s: snd_pcm_hw_params_set_rate_resample(): %s",
+                device_type_to_str(device_type_), snd_strerror(err));
+    }
+
+    const bool has_rate = sample_spec_.sample_rate() != 0;
+
+    unsigned int rate = has_rate ? (unsigned int)sample_spec_.sample_rate() : DefaultRate;
+
+    if ((err = snd_pcm_hw_params_set_rate_near(pcm_, hw_params, &rate, NULL)) < 0) {
+        roc_log(LogError, "alsa %s: snd_pcm_hw_params_set_rate_near(): %s",
+                device_type_to_str(device_type_), snd_strerror(err));
+        return false;
+    }
+
+    if (has_rate && rate != sample_spec_.sample_rate()) {
+        roc_log(LogError,
+                "alsa %s: device doesn't support requested sample rate:"
+                " requested=%lu supported=%u",
+                device_type_to_str(device_type_),
+                (unsigned long)sample_spec_.sample_rate(), rate);
+        return false;
+    }
+
+    sample_spec_.set_sample_format(audio::SampleFormat_Pcm);
+    sample_spec_.set_pcm_format(audio::Sample_RawFormat);
+    sample_spec_.set_sample_rate(rate);
+
+    if (!has_channels) {
+        sample_spec_.channel_set().set_layout(audio::ChanLayout_Surround);
+        sample_spec_.channel_set().set_order(audio::ChanOrder_Smpte);
+        sample_spec_.channel_set().set_count(n_channels);
+    }
+
+    if (!sample_spec_.is_valid()) {
+        roc_log(LogError, "alsa %s: can't determine device sample spec: sample_spec=%s",
+                device_type_to_str(device_type_),
+                audio::sample_spec_to_str(sample_spec_).c_str());
+        return false;
+    }
+
+    // Period is the unit of wakeups, and should match our frame size.
+    // Ring buffer holds target latency, and at least two periods.
+    period_size_ = sample_spec_.ns_2_samples_per_chan(frame_len_ns_);
+    buffer_size_ = sample_spec_.ns_2_samples_per_chan(target_latency_ns_);
+
+    if (period_size_ == 0) {
+        roc_log(LogError, "alsa %s: frame size must be > 0: frame_len=%.3fms",
+                device_type_to_str(device_type_),
+                (double)frame_len_ns_ / core::Millisecond);
+        return false;
+    }
+
+    if (buffer_size_ < period_size_ * 2) {
+        buffer_size_ = period_size_ * 2;
+    }
+
+    if ((err = snd_pcm_hw_params_set_period_size_near(pcm_, hw_params, &period_size_,
+                                                      NULL))
+        < 0) {
+        roc_log(LogError, "alsa %s: snd_pcm_hw_params_set_period_size_near(): %s",
+                device_type_to_str(device_type_), snd_strerror(err));
+        return false;
+    }
+
+    if ((err = snd_pcm_hw_params_set_buffer_size_near(pcm_, hw_params, &buffer_size_))
+        < 0) {
+        roc_log(LogError, "alsa %s: snd_pcm_hw_params_set_buffer_size_near(): %s",
+                device_type_to_str(device_type_), snd_strerror(err));
+        return false;
+    }
+
+    if ((err = snd_pcm_hw_params(pcm_, hw_params)) < 0) {
+        roc_log(LogError, "alsa %s: snd_pcm_hw_params(): %s",
+                device_type_to_str(device_type_), snd_strerror(err));
+        return false;
+    }
+
+    // Device may have adjusted sizes.
+    if ((err = snd_pcm_hw_params_get_period_size(hw_params, &period_size_, NULL)) < 0
+        || (err = snd_pcm_hw_params_get_buffer_size(hw_params, &buffer_size_)) < 0) {
+        roc_log(LogError, "alsa %s: can't get period and buffer size: %s",
+                device_type_to_str(device_type_), snd_strerror(err));
+        return false;
+    }
+
+    return true;
+}
+
+bool AlsaDevice::set_sw_params_(snd_pcm_sw_params_t* sw_params) {
+    int err = 0;
+
+    if ((err = snd_pcm_sw_params_current(pcm_, sw_params)) < 0) {
+        roc_log(LogError, "alsa %s: snd_pcm_sw_params_current(): %s",
+                device_type_to_str(device_type_), snd_strerror(err));
+        return false;
+    }
+
+    // Start playback when ring buffer is full, so that actual latency
+    // matches buffer size. Capture is started explicitly.
+    const snd_pcm_uframes_t start_threshold =
+        device_type_ == DeviceType_Sink ? buffer_size_ : 1;
+
+    if ((err = snd_pcm_sw_params_set_start_threshold(pcm_, sw_params, start_threshold))
+        < 0) {
+        roc_log(LogError, "alsa %s: snd_pcm_sw_params_set_start_threshold(): %s",
+                device_type_to_str(device_type_), snd_strerror(err));
+        return false;
+    }
+
+    // Wake up when at least one period can be transferred.
+    if ((err = snd_pcm_sw_params_set_avail_min(pcm_, sw_params, period_size_)) < 0) {
+        roc_log(LogError, "alsa %s: snd_pcm_sw_params_set_avail_min(): %s",
+                device_type_to_str(device_type_), snd_strerror(err));
+        return false;
+    }
+
+    if ((err = snd_pcm_sw_params(pcm_, sw_params)) < 0) {
+        roc_log(LogError, "alsa %s: snd_pcm_sw_params(): %s",
+                device_type_to_str(device_type_), snd_strerror(err));
+        return false;
+    }
+
+    return true;
+}
+
+bool AlsaDevice::choose_format_(snd_pcm_hw_params_t* hw_params) {
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(SupportedFormats); n++) {
+        if (snd_pcm_hw_params_test_format(pcm_, hw_params, SupportedFormats[n]) == 0) {
+            pcm_format_ = SupportedFormats[n];
+            break;
+        }
+    }
+
+    if (pcm_format_ == SND_PCM_FORMAT_UNKNOWN) {
+        roc_log(LogError,
+                "alsa %s: device doesn't support any of float32, sint32, sint16 formats:"
+                " device=%s",
+                device_type_to_str(device_type_), device_.c_str());
+        return false;
+    }
+
+    if (int err = snd_pcm_hw_params_set_format(pcm_, hw_params, pcm_format_)) {
+        roc_log(LogError, "alsa %s: snd_pcm_hw_params_set_format(): %s",
+                device_type_to_str(device_type_), snd_strerror(err));
+        return false;
+    }
+
+    const audio::PcmFormat device_format = map_format(pcm_format_);
+
+    if (device_format != audio::Sample_RawFormat) {
+        if (device_type_ == DeviceType_Sink) {
+            mapper_.reset(new (mapper_)
+                              audio::PcmMapper(audio::Sample_RawFormat, device_format));
+            pcm_sample_bytes_ = mapper_->output_byte_count(1);
+        } else {
+            mapper_.reset(new (mapper_)
+                              audio::PcmMapper(device_format, audio::Sample_RawFormat));
+            pcm_sample_bytes_ = mapper_->input_byte_count(1);
+        }
+    } else {
+        pcm_sample_bytes_ = sizeof(audio::sample_t);
+    }
+
+    return true;
+}
+
+bool AlsaDevice::start_pcm_() {
+    if (snd_pcm_state(pcm_) != SND_PCM_STATE_PREPARED) {
+        return true;
+    }
+
+    if (int err = snd_pcm_start(pcm_)) {
+        roc_log(LogError, "alsa %s: snd_pcm_start(): %s",
+                device_type_to_str(device_type_), snd_strerror(err));
+        return false;
+    }
+
+    return true;
+}
+
+bool AlsaDevice::recover_pcm_(int err) {
+    roc_log(LogInfo, "alsa %s: recovering stream: %s", device_type_to_str(device_type_),
+            snd_strerror(err));
+
+    if ((err = snd_pcm_recover(pcm_, err, 1)) < 0) {
+        roc_log(LogError, "alsa %s: snd_pcm_recover(): %s",
+                device_type_to_str(device_type_), snd_strerror(err));
+        return false;
+    }
+
+    if (device_type_ == DeviceType_Source) {
+        return start_pcm_();
+    }
+
+    return true;
+}
+
+bool AlsaDevice::wait_pcm_() {
+    // Ring buffer is full but playback is not started yet.
+    if (device_type_ == DeviceType_Sink && !start_pcm_()) {
+        return false;
+    }
+
+    const int err = snd_pcm_wait(pcm_, (int)(timeout_ns_ / core::Millisecond));
+
+    if (err == 0) {
+        roc_log(LogError, "alsa %s: timeout waiting for device",
+                device_type_to_str(device_type_));
+        return recover_pcm_(-EIO);
+    }
+
+    if (err < 0) {
+        return recover_pcm_(err);
+    }
+
+    return true;
+}
+
+bool AlsaDevice::transfer_(audio::sample_t* samples, size_t n_frames) {
+    roc_panic_if(!pcm_);
+
+    const size_t n_channels = sample_spec_.num_channels();
+
+    while (n_frames > 0) {
+        if (paused_) {
+            return false;
+        }
+
+        const snd_pcm_sframes_t avail = snd_pcm_avail_update(pcm_);
+
+        if (avail < 0) {
+            if (!recover_pcm_((int)avail)) {
+                return false;
+            }
+            continue;
+        }
+
+        if ((snd_pcm_uframes_t)avail < period_size_ && (size_t)avail < n_frames) {
+            if (!wait_pcm_()) {
+                return false;
+            }
+            continue;
+        }
+
+        const snd_pcm_channel_area_t* areas = NULL;
+        snd_pcm_uframes_t offset = 0;
+        snd_pcm_uframes_t frames = (snd_pcm_uframes_t)n_frames;
+
+        if (int err = snd_pcm_mmap_begin(pcm_, &areas, &offset, &frames)) {
+            if (!recover_pcm_(err)) {
+                return false;
+            }
+            continue;
+        }
+
+        // Interleaved access: all channels share one area,
+        // first channel starts at frame boundary.
+        uint8_t* ring =
+            (uint8_t*)areas[0].addr + (areas[0].first + offset * areas[0].step) / 8;
+
+        copy_(samples, ring, frames);
+
+        const snd_pcm_sframes_t committed = snd_pcm_mmap_commit(pcm_, offset, frames);
+
+        if (committed < 0 || (snd_pcm_uframes_t)committed != frames) {
+            if (!recover_pcm_(committed >= 0 ? -EPIPE : (int)committed)) {
+                return false;
+            }
+            continue;
+        }
+
+        samples += frames * n_channels;
+        n_frames -= frames;
+    }
+
+    report_latency_();
+
+    return true;
+}
+
+void AlsaDevice::copy_(audio::sample_t* samples, uint8_t* ring, size_t n_frames) {
+    const size_t n_samples = n_frames * sample_spec_.num_channels();
+    const size_t n_bytes = n_samples * pcm_sample_bytes_;
+
+    if (!mapper_) {
+        if (device_type_ == DeviceType_Sink) {
+            memcpy(ring, samples, n_bytes);
+        } else {
+            memcpy(samples, ring, n_bytes);
+        }
+        return;
+    }
+
+    size_t in_bit_off = 0;
+    size_t out_bit_off = 0;
+
+    if (device_type_ == DeviceType_Sink) {
+        mapper_->map(samples, n_samples * sizeof(audio::sample_t), in_bit_off, ring,
+                     n_bytes, out_bit_off, n_samples);
+    } else {
+        mapper_->map(ring, n_bytes, in_bit_off, samples,
+                     n_samples * sizeof(audio::sample_t), out_bit_off, n_samples);
+    }
+}
+
+bool AlsaDevice::get_latency_(core::nanoseconds_t& latency) const {
+    if (!pcm_ || paused_) {
+        return false;
+    }
+
+    const snd_pcm_state_t state = snd_pcm_state(pcm_);
+    if (state != SND_PCM_STATE_RUNNING) {
+        return false;
+    }
+
+    snd_pcm_sframes_t delay = 0;
+    if (snd_pcm_delay(pcm_, &delay) < 0 || delay < 0) {
+        return false;
+    }
+
+    latency = sample_spec_.samples_per_chan_2_ns((size_t)delay);
+    return true;
+}
+
+void AlsaDevice::report_latency_() {
+    if (!rate_limiter_.allow()) {
+        return;
+    }
+
+    core::nanoseconds_t latency = 0;
+
+    if (!get_latency_(latency)) {
+        return;
+    }
+
+    roc_log(LogDebug, "alsa %s: io_latency=%ld(%.3fms)",
+            device_type_to_str(device_type_),
+            (long)sample_spec_.ns_2_stream_timestamp_delta(latency),
+            (double)latency / core::Millisecond);
+}
+
+} // namespace sndio
+} // namespace roc
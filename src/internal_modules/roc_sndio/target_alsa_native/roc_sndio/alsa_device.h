@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_sndio/target_alsa_native/roc_sndio/alsa_device.h
+//! @brief ALSA device.
+
+#ifndef ROC_SNDIO_ALSA_DEVICE_H_
+#define ROC_SNDIO_ALSA_DEVICE_H_
+
+#include <alsa/asoundlib.h>
+
+#include "roc_audio/frame.h"
+#include "roc_audio/pcm_mapper.h"
+#include "roc_core/iarena.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/optional.h"
+#include "roc_core/rate_limiter.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/string_buffer.h"
+#include "roc_core/time.h"
+#include "roc_sndio/config.h"
+#include "roc_sndio/isink.h"
+#include "roc_sndio/isource.h"
+
+namespace roc {
+namespace sndio {
+
+//! ALSA device.
+//! Can be either source or sink depending on constructor parameter.
+//! @remarks
+//!  Uses mmap access mode: samples are converted directly into (or from)
+//!  the hardware ring buffer, without intermediate buffering.
+//!  Period size is derived from frame length, and buffer size is derived
+//!  from requested latency.
+class AlsaDevice : public ISink, public ISource, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    AlsaDevice(core::IArena& arena, const Config& config, DeviceType device_type);
+    ~AlsaDevice();
+
+    //! Open device.
+    //! @remarks
+    //!  @p device is ALSA PCM name, e.g. "hw:0,0", or NULL for default device.
+    bool open(const char* device);
+
+    //! Cast IDevice to ISink.
+    virtual ISink* to_sink();
+
+    //! Cast IDevice to ISink.
+    virtual ISource* to_source();
+
+    //! Get device type.
+    virtual DeviceType type() const;
+
+    //! Get device state.
+    virtual DeviceState state() const;
+
+    //! Pause reading.
+    virtual void pause();
+
+    //! Resume paused reading.
+    virtual bool resume();
+
+    //! Restart reading from the beginning.
+    virtual bool restart();
+
+    //! Get sample specification of the device.
+    virtual audio::SampleSpec sample_spec() const;
+
+    //! Get latency of the device.
+    //! @remarks
+    //!  Reports number of samples queued in device ring buffer and hardware,
+    //!  as returned by snd_pcm_delay().
+    virtual core::nanoseconds_t latency() const;
+
+    //! Check if the device supports latency reports.
+    virtual bool has_latency() const;
+
+    //! Check if the device has own clock.
+    virtual bool has_clock() const;
+
+    //! Adjust source clock to match consumer clock.
+    virtual void reclock(core::nanoseconds_t timestamp);
+
+    //! Write audio frame.
+    virtual void write(audio::Frame& frame);
+
+    //! Read audio frame.
+    virtual bool read(audio::Frame& frame);
+
+private:
+    bool open_pcm_();
+    void close_pcm_();
+
+    bool set_hw_params_(snd_pcm_hw_params_t* hw_params);
+    bool set_sw_params_(snd_pcm_sw_params_t* sw_params);
+    bool choose_format_(snd_pcm_hw_params_t* hw_params);
+
+    bool start_pcm_();
+    bool recover_pcm_(int err);
+    bool wait_pcm_();
+
+    bool transfer_(audio::sample_t* samples, size_t n_frames);
+    void copy_(audio::sample_t* samples, uint8_t* ring, size_t n_frames);
+
+    bool get_latency_(core::nanoseconds_t& latency) const;
+    void report_latency_();
+
+    const DeviceType device_type_;
+    core::StringBuffer device_;
+
+    audio::SampleSpec sample_spec_;
+
+    core::nanoseconds_t frame_len_ns_;
+    core::nanoseconds_t target_latency_ns_;
+    core::nanoseconds_t timeout_ns_;
+
+    snd_pcm_t* pcm_;
+    snd_pcm_format_t pcm_format_;
+    size_t pcm_sample_bytes_;
+
+    snd_pcm_uframes_t period_size_;
+    snd_pcm_uframes_t buffer_size_;
+
+    // Converts between raw samples and device format if they differ.
+    core::Optional<audio::PcmMapper> mapper_;
+
+    bool paused_;
+
+    core::RateLimiter rate_limiter_;
+};
+
+} // namespace sndio
+} // namespace roc
+
+#endif // ROC_SNDIO_ALSA_DEVICE_H_
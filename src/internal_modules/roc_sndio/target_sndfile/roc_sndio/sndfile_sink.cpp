@@ -7,6 +7,7 @@
  */
 
 #include "roc_sndio/sndfile_sink.h"
+#include "roc_audio/pcm_format.h"
 #include "roc_audio/sample_spec_to_str.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
@@ -149,6 +150,12 @@ SndfileSink::SndfileSink(core::IArena& arena, const Config& config)
                               audio::ChanOrder_Smpte, audio::ChanMask_Surround_Stereo,
                               44100);
 
+    if (!sample_spec_.is_raw()) {
+        roc_log(LogError, "sndfile sink: sample format can be only \"-\" or \"%s\"",
+                audio::pcm_format_to_str(audio::Sample_RawFormat));
+        return;
+    }
+
     memset(&file_info_, 0, sizeof(file_info_));
 
     // TODO(gh-696): map format from sample_spec
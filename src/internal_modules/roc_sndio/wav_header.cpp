@@ -14,13 +14,15 @@ namespace sndio {
 
 WavHeader::WavHeader(uint16_t num_channels,
                      uint32_t sample_rate,
-                     uint16_t bits_per_sample)
+                     uint16_t bits_per_sample,
+                     bool is_float)
     : data_(
         core::EndianOps::swap_native_be<uint32_t>(0x52494646), // {'R','I','F','F'}
         core::EndianOps::swap_native_be<uint32_t>(0x57415645), // {'W','A','V','E'}
         core::EndianOps::swap_native_be<uint32_t>(0x666d7420), // {'f','m','t',' '}
         core::EndianOps::swap_native_le<uint16_t>(0x10),       // 16
-        core::EndianOps::swap_native_le<uint16_t>(0x3),        // IEEE Float
+        core::EndianOps::swap_native_le<uint16_t>(is_float ? 0x3   // IEEE Float
+                                                           : 0x1), // PCM
         core::EndianOps::swap_native_le(num_channels),
         core::EndianOps::swap_native_le<uint32_t>(sample_rate),
         core::EndianOps::swap_native_le<uint32_t>(sample_rate * num_channels
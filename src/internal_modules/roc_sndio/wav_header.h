@@ -70,7 +70,13 @@ public:
     } ROC_ATTR_PACKED_END;
 
     //! Initialize
-    WavHeader(uint16_t num_channels, uint32_t sample_rate, uint16_t bits_per_sample);
+    //! @remarks
+    //!  If @p is_float is true, samples are IEEE floats, otherwise they're
+    //!  signed integers.
+    WavHeader(uint16_t num_channels,
+              uint32_t sample_rate,
+              uint16_t bits_per_sample,
+              bool is_float);
 
     //! Get number of channels
     uint16_t num_channels() const;
@@ -16,8 +16,18 @@
 namespace roc {
 namespace sndio {
 
+namespace {
+
+// Size of block accumulated before writing to file and updating header.
+// Keep in sync with WavSink class documentation.
+const size_t BlockSize = 256 * 1024;
+
+} // namespace
+
 WavSink::WavSink(core::IArena& arena, const Config& config)
     : output_file_(NULL)
+    , block_(arena)
+    , block_pos_(0)
     , valid_(false) {
     if (config.latency != 0) {
         roc_log(LogError, "wav sink: setting io latency not supported");
@@ -30,15 +40,30 @@ WavSink::WavSink(core::IArena& arena, const Config& config)
                               audio::ChanOrder_Smpte, audio::ChanMask_Surround_Stereo,
                               44100);
 
-    if (!sample_spec_.is_raw()) {
-        roc_log(LogError, "wav sink: sample format can be only \"-\" or \"%s\"",
-                audio::pcm_format_to_str(audio::Sample_RawFormat));
+    // Besides raw samples, 16-bit integers can be written as is, which
+    // allows receiver to deliver them without conversion.
+    if (!sample_spec_.is_raw()
+        && sample_spec_.pcm_format() != audio::PcmFormat_SInt16_Le) {
+        roc_log(LogError,
+                "wav sink: sample format can be only \"-\", \"%s\", or \"%s\"",
+                audio::pcm_format_to_str(audio::Sample_RawFormat),
+                audio::pcm_format_to_str(audio::PcmFormat_SInt16_Le));
         return;
     }
 
-    header_.reset(new (header_)
-                      WavHeader(sample_spec_.num_channels(), sample_spec_.sample_rate(),
-                                sizeof(audio::sample_t) * 8));
+    header_.reset(new (header_) WavHeader(
+        sample_spec_.num_channels(), sample_spec_.sample_rate(),
+        (uint16_t)(sample_spec_.stream_timestamp_2_bytes(1) * 8
+                   / sample_spec_.num_channels()),
+        sample_spec_.is_raw()));
+
+    // Block holds whole number of samples for all channels.
+    const size_t frame_bytes = sample_spec_.stream_timestamp_2_bytes(1);
+
+    if (!block_.resize(BlockSize / frame_bytes * frame_bytes)) {
+        roc_log(LogError, "wav sink: can't allocate block buffer");
+        return;
+    }
 
     valid_ = true;
 }
@@ -114,37 +139,20 @@ void WavSink::write(audio::Frame& frame) {
         roc_panic("wav sink: not opened");
     }
 
-    const audio::sample_t* samples = frame.raw_samples();
-    size_t n_samples = frame.num_raw_samples();
+    const uint8_t* bytes = frame.bytes();
+    size_t n_bytes = frame.num_bytes();
 
-    if (n_samples > 0) {
-        if (fseek(output_file_, 0, SEEK_SET)) {
-            roc_log(LogError, "wav sink: failed to seek to the beginning of the file: %s",
-                    core::errno_to_str(errno).c_str());
-        }
+    while (n_bytes > 0) {
+        const size_t n_copy = std::min(n_bytes, block_.size() - block_pos_);
 
-        const WavHeader::WavHeaderData& wav_header =
-            header_->update_and_get_header(n_samples);
-        if (fwrite(&wav_header, sizeof(wav_header), 1, output_file_) != 1) {
-            roc_log(LogError, "wav sink: failed to write header: %s",
-                    core::errno_to_str(errno).c_str());
-        }
-
-        if (fseek(output_file_, 0, SEEK_END)) {
-            roc_log(LogError,
-                    "wav sink: failed to seek to append position of the file: %s",
-                    core::errno_to_str(errno).c_str());
-        }
+        memcpy(block_.data() + block_pos_, bytes, n_copy);
 
-        if (fwrite(samples, sizeof(audio::sample_t), n_samples, output_file_)
-            != n_samples) {
-            roc_log(LogError, "wav sink: failed to write samples: %s",
-                    core::errno_to_str(errno).c_str());
-        }
+        block_pos_ += n_copy;
+        bytes += n_copy;
+        n_bytes -= n_copy;
 
-        if (fflush(output_file_)) {
-            roc_log(LogError, "wav sink: failed to flush data to the file: %s",
-                    core::errno_to_str(errno).c_str());
+        if (block_pos_ == block_.size()) {
+            flush_block_();
         }
     }
 }
@@ -161,6 +169,18 @@ bool WavSink::open_(const char* path) {
         return false;
     }
 
+    // Blocks are written at once, no need for extra copy into stdio buffer.
+    if (setvbuf(output_file_, NULL, _IONBF, 0)) {
+        roc_log(LogDebug, "wav sink: can't disable output buffering: %s",
+                core::errno_to_str(errno).c_str());
+    }
+
+    if (!write_header_()) {
+        fclose(output_file_);
+        output_file_ = NULL;
+        return false;
+    }
+
     roc_log(LogInfo,
             "wav sink: opened output file:"
             " path=%s out_bits=%lu out_rate=%lu out_ch=%lu",
@@ -178,6 +198,8 @@ void WavSink::close_() {
 
     roc_log(LogDebug, "wav sink: closing output file");
 
+    flush_block_();
+
     if (fclose(output_file_)) {
         roc_panic("wav sink: can't close output file: %s",
                   core::errno_to_str(errno).c_str());
@@ -186,5 +208,45 @@ void WavSink::close_() {
     output_file_ = NULL;
 }
 
+bool WavSink::write_header_() {
+    if (fseek(output_file_, 0, SEEK_SET)) {
+        roc_log(LogError, "wav sink: failed to seek to the beginning of the file: %s",
+                core::errno_to_str(errno).c_str());
+        return false;
+    }
+
+    const WavHeader::WavHeaderData& wav_header = header_->update_and_get_header(0);
+    if (fwrite(&wav_header, sizeof(wav_header), 1, output_file_) != 1) {
+        roc_log(LogError, "wav sink: failed to write header: %s",
+                core::errno_to_str(errno).c_str());
+        return false;
+    }
+
+    if (fseek(output_file_, 0, SEEK_END)) {
+        roc_log(LogError, "wav sink: failed to seek to append position of the file: %s",
+                core::errno_to_str(errno).c_str());
+        return false;
+    }
+
+    return true;
+}
+
+void WavSink::flush_block_() {
+    if (block_pos_ == 0) {
+        return;
+    }
+
+    if (fwrite(block_.data(), 1, block_pos_, output_file_) != block_pos_) {
+        roc_log(LogError, "wav sink: failed to write samples: %s",
+                core::errno_to_str(errno).c_str());
+    }
+
+    header_->update_and_get_header(
+        uint32_t(block_pos_ / sample_spec_.stream_timestamp_2_bytes(1)));
+    block_pos_ = 0;
+
+    (void)write_header_();
+}
+
 } // namespace sndio
 } // namespace roc
@@ -29,7 +29,17 @@ namespace sndio {
 
 //! WAV sink.
 //! @remarks
-//!  Writes samples to output file.
+//!  Writes samples to output file. Samples are written either as 32-bit
+//!  floats (raw format), or as 16-bit integers, if requested by config.
+//!  Samples are accumulated in a preallocated block and written to the file
+//!  when the block becomes full, followed by WAV header update. This keeps the
+//!  number of I/O calls low when frames are small.
+//!
+//!  The block is 256KB, and it is also written when the sink is closed (i.e.
+//!  destroyed). Until then, up to 256KB of last samples are kept in memory,
+//!  and the header in the file doesn't account for them. If the process is
+//!  terminated without closing the sink, these samples are lost; if the file
+//!  is read while it's being written, it looks shorter than it is.
 class WavSink : public ISink, public core::NonCopyable<> {
 public:
     //! Initialize.
@@ -89,11 +99,17 @@ private:
     bool open_(const char* path);
     void close_();
 
+    bool write_header_();
+    void flush_block_();
+
     audio::SampleSpec sample_spec_;
 
     FILE* output_file_;
     core::Optional<WavHeader> header_;
 
+    core::Array<uint8_t> block_;
+    size_t block_pos_;
+
     bool valid_;
 };
 
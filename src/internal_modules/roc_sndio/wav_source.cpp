@@ -13,9 +13,62 @@
 namespace roc {
 namespace sndio {
 
+namespace {
+
+// How much data to ask the kernel to read ahead of current position.
+const size_t ReadAheadSize = 1024 * 1024;
+
+// Get PCM format of WAV samples that can be mapped directly.
+bool map_wav_format(const drwav& wav, audio::PcmFormat& fmt) {
+    switch (wav.translatedFormatTag) {
+    case DR_WAVE_FORMAT_PCM:
+        switch (wav.bitsPerSample) {
+        case 8:
+            fmt = audio::PcmFormat_UInt8;
+            return true;
+        case 16:
+            fmt = audio::PcmFormat_SInt16_Le;
+            return true;
+        case 24:
+            fmt = audio::PcmFormat_SInt24_Le;
+            return true;
+        case 32:
+            fmt = audio::PcmFormat_SInt32_Le;
+            return true;
+        default:
+            break;
+        }
+        break;
+
+    case DR_WAVE_FORMAT_IEEE_FLOAT:
+        switch (wav.bitsPerSample) {
+        case 32:
+            fmt = audio::PcmFormat_Float32_Le;
+            return true;
+        case 64:
+            fmt = audio::PcmFormat_Float64_Le;
+            return true;
+        default:
+            break;
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    return false;
+}
+
+} // namespace
+
 WavSource::WavSource(core::IArena& arena, const Config& config)
     : file_opened_(false)
     , eof_(false)
+    , data_begin_(0)
+    , data_end_(0)
+    , data_pos_(0)
+    , read_ahead_pos_(0)
     , valid_(false) {
     if (config.latency != 0) {
         roc_log(LogError, "wav source: setting io latency not supported");
@@ -79,7 +132,10 @@ bool WavSource::restart() {
 
     roc_log(LogDebug, "wav source: restarting");
 
-    if (!drwav_seek_to_pcm_frame(&wav_, 0)) {
+    if (mapped_file_.is_open()) {
+        data_pos_ = data_begin_;
+        read_ahead_pos_ = data_begin_;
+    } else if (!drwav_seek_to_pcm_frame(&wav_, 0)) {
         roc_log(LogError, "wav source: seek failed when restarting");
         return false;
     }
@@ -128,6 +184,54 @@ bool WavSource::read(audio::Frame& frame) {
         return false;
     }
 
+    if (mapped_file_.is_open()) {
+        return read_mapped_(frame);
+    }
+
+    return read_decoded_(frame);
+}
+
+bool WavSource::read_mapped_(audio::Frame& frame) {
+    const size_t n_channels = wav_.channels;
+
+    audio::sample_t* frame_data = frame.raw_samples();
+    const size_t frame_size = frame.num_raw_samples();
+
+    size_t n_samples = mapper_->input_sample_count(data_end_ - data_pos_);
+    n_samples -= n_samples % n_channels;
+    if (n_samples > frame_size) {
+        n_samples = frame_size;
+    }
+
+    if (n_samples == 0) {
+        roc_log(LogDebug, "wav source: got eof from input file");
+        eof_ = true;
+        return false;
+    }
+
+    if (data_pos_ + ReadAheadSize / 2 >= read_ahead_pos_) {
+        mapped_file_.read_ahead(read_ahead_pos_, ReadAheadSize);
+        read_ahead_pos_ += ReadAheadSize;
+    }
+
+    size_t in_bit_off = 0;
+    size_t out_bit_off = 0;
+
+    n_samples = mapper_->map(mapped_file_.data() + data_pos_, data_end_ - data_pos_,
+                             in_bit_off, frame_data, frame_size * sizeof(audio::sample_t),
+                             out_bit_off, n_samples);
+
+    data_pos_ += in_bit_off / 8;
+
+    if (n_samples < frame_size) {
+        memset(frame_data + n_samples, 0,
+               (frame_size - n_samples) * sizeof(audio::sample_t));
+    }
+
+    return true;
+}
+
+bool WavSource::read_decoded_(audio::Frame& frame) {
     audio::sample_t* frame_data = frame.raw_samples();
     size_t frame_left = frame.num_raw_samples();
 
@@ -170,22 +274,54 @@ bool WavSource::open_(const char* path) {
         return false;
     }
 
+    const bool mapped = map_(path);
+
     roc_log(LogInfo,
             "wav source: opened input file:"
-            " path=%s in_bits=%lu in_rate=%lu in_ch=%lu",
+            " path=%s in_bits=%lu in_rate=%lu in_ch=%lu mapped=%d",
             path, (unsigned long)wav_.bitsPerSample, (unsigned long)wav_.sampleRate,
-            (unsigned long)wav_.channels);
+            (unsigned long)wav_.channels, (int)mapped);
 
     file_opened_ = true;
     return true;
 }
 
+bool WavSource::map_(const char* path) {
+    audio::PcmFormat in_format = audio::PcmFormat_Invalid;
+    if (wav_.channels == 0 || !map_wav_format(wav_, in_format)) {
+        roc_log(LogDebug, "wav source: sample format can't be mapped, using decoder");
+        return false;
+    }
+
+    if (!mapped_file_.open(path)) {
+        roc_log(LogDebug, "wav source: file can't be mapped, using decoder");
+        return false;
+    }
+
+    mapper_.reset(new (mapper_) audio::PcmMapper(in_format, audio::Sample_RawFormat));
+
+    const uint64_t data_size = wav_.totalPCMFrameCount * wav_.channels
+        * (uint64_t)mapper_->input_byte_count(1);
+
+    // File may be truncated, don't trust header.
+    data_begin_ = (size_t)std::min((uint64_t)wav_.dataChunkDataPos,
+                                   (uint64_t)mapped_file_.size());
+    data_end_ = (size_t)std::min((uint64_t)data_begin_ + data_size,
+                                 (uint64_t)mapped_file_.size());
+
+    data_pos_ = data_begin_;
+    read_ahead_pos_ = data_begin_;
+
+    return true;
+}
+
 void WavSource::close_() {
     if (!file_opened_) {
         return;
     }
 
     file_opened_ = false;
+    mapped_file_.close();
     drwav_uninit(&wav_);
 }
 
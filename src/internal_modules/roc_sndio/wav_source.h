@@ -14,10 +14,13 @@
 
 #include <dr_wav.h>
 
+#include "roc_audio/pcm_mapper.h"
 #include "roc_audio/sample_spec.h"
 #include "roc_core/array.h"
 #include "roc_core/iarena.h"
+#include "roc_core/mapped_file.h"
 #include "roc_core/noncopyable.h"
+#include "roc_core/optional.h"
 #include "roc_core/stddefs.h"
 #include "roc_core/string_buffer.h"
 #include "roc_packet/units.h"
@@ -28,6 +31,10 @@ namespace roc {
 namespace sndio {
 
 //! WAV source.
+//! @remarks
+//!  If input is a regular file with integer or float PCM samples, the file is
+//!  memory-mapped and samples are converted by PcmMapper directly from the
+//!  mapping into frame buffer. Otherwise, samples are decoded by dr_wav.
 class WavSource : public ISource, private core::NonCopyable<> {
 public:
     //! Initialize.
@@ -88,12 +95,23 @@ public:
 
 private:
     bool open_(const char* path);
+    bool map_(const char* path);
     void close_();
 
+    bool read_mapped_(audio::Frame& frame);
+    bool read_decoded_(audio::Frame& frame);
+
     drwav wav_;
     bool file_opened_;
     bool eof_;
 
+    core::MappedFile mapped_file_;
+    core::Optional<audio::PcmMapper> mapper_;
+    size_t data_begin_;
+    size_t data_end_;
+    size_t data_pos_;
+    size_t read_ahead_pos_;
+
     bool valid_;
 };
 
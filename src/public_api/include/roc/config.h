@@ -323,7 +323,17 @@ typedef enum roc_format {
      * Uncompressed samples coded as 32-bit native-endian floats in range [-1; 1].
      * Channels are interleaved, e.g. two channels are encoded as "L R L R ...".
      */
-    ROC_FORMAT_PCM_FLOAT32 = 1
+    ROC_FORMAT_PCM_FLOAT32 = 1,
+
+    /** PCM 16-bit integers.
+     * Uncompressed samples coded as 16-bit native-endian signed integers.
+     * Channels are interleaved, e.g. two channels are encoded as "L R L R ...".
+     *
+     * Can be used only as frame encoding. Allows receiver to deliver samples from
+     * 16-bit packet encodings without conversion, see \c passthrough field of
+     * \ref roc_receiver_config.
+     */
+    ROC_FORMAT_PCM_SINT16 = 2
 } roc_format;
 
 /** Channel layout.
@@ -600,6 +610,27 @@ typedef enum roc_resampler_profile {
     ROC_RESAMPLER_PROFILE_LOW = 3
 } roc_resampler_profile;
 
+/** Packet loss concealment backend.
+ * Defines how receiver fills gaps caused by lost or late packets.
+ */
+typedef enum roc_plc_backend {
+    /** Default backend.
+     * Current default is \c ROC_PLC_BACKEND_NONE.
+     */
+    ROC_PLC_BACKEND_DEFAULT = 0,
+
+    /** No concealment.
+     * Gaps are filled with silence.
+     */
+    ROC_PLC_BACKEND_NONE = 1,
+
+    /** Waveform-similarity overlap-add extrapolation.
+     * Gaps are filled with pitch-periodic continuation of recent signal, which
+     * fades out on long gaps. Works best on speech and tonal music.
+     */
+    ROC_PLC_BACKEND_WSOLA = 2
+} roc_plc_backend;
+
 /** Context configuration.
  *
  * It is safe to memset() this struct with zeros to get a default config. It is also
@@ -793,6 +824,40 @@ typedef struct roc_sender_config {
      * If zero, default value is used (if latency tuning is enabled on sender).
      */
     unsigned long long latency_tolerance;
+
+    /** RTCP bandwidth, in bytes per second.
+     *
+     * If non-zero, RTCP report interval is scaled with the number of participants
+     * in the session, as described in RFC 3550, section 6.3, so that RTCP traffic
+     * of all participants together stays within this bandwidth. This is useful
+     * for large multicast sessions.
+     *
+     * If zero, reports are sent at fixed interval regardless of the number of
+     * participants.
+     */
+    unsigned int rtcp_bandwidth;
+
+    /** Precise timing of internal clock.
+     *
+     * Used only if \c clock_source is \ref ROC_CLOCK_SOURCE_INTERNAL.
+     *
+     * If non-zero, write operation sleeps until shortly before it's time to process
+     * next frame, and then busy-waits until the exact time. This reduces wakeup
+     * jitter at the cost of extra CPU usage.
+     */
+    unsigned int precise_timing;
+
+    /** Timer slack of internal clock, in nanoseconds.
+     *
+     * Used only if \c clock_source is \ref ROC_CLOCK_SOURCE_INTERNAL.
+     *
+     * If non-zero, timer slack of the thread that invokes write operation is set
+     * to this value while it waits for internal clock, and restored after that.
+     * Smaller slack gives more accurate wakeups. Supported only on Linux.
+     *
+     * If zero, thread's own timer slack is used.
+     */
+    unsigned long long timer_slack;
 } roc_sender_config;
 
 /** Receiver configuration.
@@ -910,6 +975,99 @@ typedef struct roc_receiver_config {
      * If zero, default value is used. If negative, the check is disabled.
      */
     long long choppy_playback_timeout;
+
+    /** Enable adaptive target latency.
+     *
+     * If non-zero, receiver periodically recomputes target latency of every
+     * connection based on network jitter and losses, within the range from half
+     * to double of \c target_latency. Current target is reported in
+     * \ref roc_connection_metrics.
+     *
+     * Requires latency tuning on receiver (\c latency_tuner_profile should not be
+     * \ref ROC_LATENCY_TUNER_PROFILE_INTACT).
+     */
+    unsigned int adaptive_latency;
+
+    /** Packet loss concealment backend.
+     * Defines how gaps caused by lost or late packets are filled.
+     *
+     * Number of missing and concealed samples is reported in
+     * \ref roc_connection_metrics.
+     *
+     * If zero, default backend is used (\ref ROC_PLC_BACKEND_DEFAULT).
+     */
+    roc_plc_backend plc_backend;
+
+    /** Enable unmixed output.
+     *
+     * If non-zero, receiver doesn't mix connections, and frames of each connection
+     * should be read separately using roc_receiver_read_session().
+     */
+    unsigned int unmixed_output;
+
+    /** Enable passthrough.
+     *
+     * If non-zero, receiver copies samples from packets directly to output frames,
+     * without converting them to floats, mixing, and converting back, whenever it
+     * is possible. This makes output bit-exact and reduces CPU usage.
+     *
+     * Passthrough is used only when all of the following is true:
+     *  - there is exactly one connection;
+     *  - \c frame_encoding is an integer PCM format (like \ref ROC_FORMAT_PCM_SINT16)
+     *    with the same sample size, rate, and channels as packet encoding;
+     *  - no resampling is needed; since clock drift compensation is done using
+     *    resampler, this means that \c latency_tuner_profile should be
+     *    \ref ROC_LATENCY_TUNER_PROFILE_INTACT.
+     *
+     * When any of these conditions stops being true, e.g. when the second connection
+     * appears, receiver falls back to regular processing automatically.
+     */
+    unsigned int passthrough;
+
+    /** Enable automatic quality degradation under CPU overload.
+     *
+     * If non-zero, receiver measures how much time it spends producing every frame
+     * compared to frame duration. When it can't keep up, it gradually lowers
+     * resampler quality and eventually disables FEC repair for all connections.
+     * When there is enough headroom again, quality is gradually restored.
+     *
+     * Current degradation level is reported in \ref roc_receiver_metrics.
+     */
+    unsigned int overload_control;
+
+    /** RTCP bandwidth, in bytes per second.
+     *
+     * If non-zero, RTCP report interval is scaled with the number of participants
+     * in the session, as described in RFC 3550, section 6.3, so that RTCP traffic
+     * of all participants together stays within this bandwidth. This is useful
+     * for large multicast sessions.
+     *
+     * If zero, reports are sent at fixed interval regardless of the number of
+     * participants.
+     */
+    unsigned int rtcp_bandwidth;
+
+    /** Precise timing of internal clock.
+     *
+     * Used only if \c clock_source is \ref ROC_CLOCK_SOURCE_INTERNAL.
+     *
+     * If non-zero, read operation sleeps until shortly before it's time to process
+     * next frame, and then busy-waits until the exact time. This reduces wakeup
+     * jitter at the cost of extra CPU usage.
+     */
+    unsigned int precise_timing;
+
+    /** Timer slack of internal clock, in nanoseconds.
+     *
+     * Used only if \c clock_source is \ref ROC_CLOCK_SOURCE_INTERNAL.
+     *
+     * If non-zero, timer slack of the thread that invokes read operation is set
+     * to this value while it waits for internal clock, and restored after that.
+     * Smaller slack gives more accurate wakeups. Supported only on Linux.
+     *
+     * If zero, thread's own timer slack is used.
+     */
+    unsigned long long timer_slack;
 } roc_receiver_config;
 
 /** Interface configuration.
@@ -43,6 +43,76 @@ typedef struct roc_connection_metrics {
      * May be zero initially, until enough statistics is accumulated.
      */
     unsigned long long e2e_latency;
+
+    /** Current target latency, in nanoseconds.
+     *
+     * Equals to \c target_latency from \ref roc_receiver_config, unless
+     * \c adaptive_latency is enabled, in which case it's the target currently
+     * chosen by receiver based on network jitter and losses.
+     *
+     * Filled only on receiver. Zero until first packet is processed.
+     */
+    unsigned long long target_latency;
+
+    /** Source ID of remote sender.
+     *
+     * Identifies connection on receiver. Can be passed to roc_receiver_read_session()
+     * when unmixed output is enabled.
+     *
+     * Filled only on receiver. May be zero initially, until first packet is processed.
+     */
+    unsigned int source_id;
+
+    /** Average CPU time spent on processing one frame, in nanoseconds.
+     *
+     * Defines how expensive is this connection for receiver. Includes packet
+     * routing, FEC decoding, payload decoding, resampling, and other processing.
+     * Measured using CPU clock of processing thread and averaged over recent frames.
+     *
+     * Filled only on receiver. Zero until first frame is processed.
+     */
+    unsigned long long cpu_time;
+
+    /** Maximum CPU time spent on processing one frame, in nanoseconds.
+     *
+     * Computed over the same recent frames as \c cpu_time.
+     *
+     * Filled only on receiver.
+     */
+    unsigned long long max_cpu_time;
+
+    /** Part of \c cpu_time spent on FEC decoding, in nanoseconds.
+     *
+     * Filled only on receiver. Zero if FEC is not used.
+     */
+    unsigned long long fec_cpu_time;
+
+    /** Part of \c cpu_time spent on depacketization and payload decoding,
+     * in nanoseconds.
+     *
+     * Filled only on receiver.
+     */
+    unsigned long long codec_cpu_time;
+
+    /** Part of \c cpu_time spent on resampling, in nanoseconds.
+     *
+     * Filled only on receiver. Zero if resampler is not used.
+     */
+    unsigned long long resampler_cpu_time;
+
+    /** Cumulative count of samples (per channel) missing because of lost or late
+     * packets.
+     *
+     * Filled only on receiver.
+     */
+    unsigned long long missing_samples;
+
+    /** Cumulative count of missing samples (per channel) which were synthesized by
+     * packet loss concealment instead of being filled with silence.
+     *
+     * Filled only on receiver. Zero if packet loss concealment is not used.
+     */
+    unsigned long long concealed_samples;
 } roc_connection_metrics;
 
 /** Receiver metrics.
@@ -57,6 +127,37 @@ typedef struct roc_receiver_metrics {
      * When there are no connections, receiver produces silence.
      */
     unsigned int connection_count;
+
+    /** Current quality degradation level.
+     *
+     * Zero means that configured quality is used. Every next level is cheaper
+     * and lower quality than previous one. Levels that would change nothing for
+     * configured resampler are skipped, so the value may jump by more than one.
+     *
+     * Always zero if \c overload_control is disabled in \ref roc_receiver_config.
+     */
+    unsigned int degradation_level;
+
+    /** Number of times internal clock woke up to process next frame.
+     *
+     * Zero if \c clock_source is not \ref ROC_CLOCK_SOURCE_INTERNAL. Internal clock
+     * is shared by all slots, so this and following fields are the same for all
+     * slots.
+     */
+    unsigned long long clock_wakeups;
+
+    /** Number of times when it was already time to process next frame when
+     * read operation was invoked, so there was no wait.
+     */
+    unsigned long long clock_overruns;
+
+    /** Average delay of internal clock wakeups after deadline, in nanoseconds.
+     */
+    unsigned long long avg_clock_error;
+
+    /** Maximum delay of internal clock wakeups after deadline, in nanoseconds.
+     */
+    unsigned long long max_clock_error;
 } roc_receiver_metrics;
 
 /** Sender metrics.
@@ -78,6 +179,64 @@ typedef struct roc_sender_metrics {
      * connections, one per each discovered receiver.
      */
     unsigned int connection_count;
+
+    /** Average CPU time spent on processing one frame, in nanoseconds.
+     *
+     * Includes resampling, payload encoding, packetization, FEC encoding, and
+     * other processing. Measured using CPU clock of processing thread (and of FEC
+     * encoding thread, if encoding is done in background) and averaged over recent
+     * frames.
+     *
+     * Zero until first frame is processed.
+     */
+    unsigned long long cpu_time;
+
+    /** Maximum CPU time spent on processing one frame, in nanoseconds.
+     *
+     * Computed over the same recent frames as \c cpu_time.
+     */
+    unsigned long long max_cpu_time;
+
+    /** Part of \c cpu_time spent on FEC encoding, in nanoseconds.
+     *
+     * If FEC encoding is done in background thread, its time is accounted in
+     * the frame during which repair packets of the block were written.
+     *
+     * Zero if FEC is not used.
+     */
+    unsigned long long fec_cpu_time;
+
+    /** Part of \c cpu_time spent on payload encoding and packetization,
+     * in nanoseconds.
+     */
+    unsigned long long codec_cpu_time;
+
+    /** Part of \c cpu_time spent on resampling, in nanoseconds.
+     *
+     * Zero if resampler is not used.
+     */
+    unsigned long long resampler_cpu_time;
+
+    /** Number of times internal clock woke up to process next frame.
+     *
+     * Zero if \c clock_source is not \ref ROC_CLOCK_SOURCE_INTERNAL. Internal clock
+     * is shared by all slots, so this and following fields are the same for all
+     * slots.
+     */
+    unsigned long long clock_wakeups;
+
+    /** Number of times when it was already time to process next frame when
+     * write operation was invoked, so there was no wait.
+     */
+    unsigned long long clock_overruns;
+
+    /** Average delay of internal clock wakeups after deadline, in nanoseconds.
+     */
+    unsigned long long avg_clock_error;
+
+    /** Maximum delay of internal clock wakeups after deadline, in nanoseconds.
+     */
+    unsigned long long max_clock_error;
 } roc_sender_metrics;
 
 #ifdef __cplusplus
@@ -137,6 +137,15 @@ extern "C" {
  * Connections can be added and removed from the output stream at any time, probably in
  * the middle of a frame.
  *
+ * If \c unmixed_output is enabled in \ref roc_receiver_config, receiver doesn't mix
+ * connections. Instead, the user reads frames of every connection separately using
+ * roc_receiver_read_session(), identifying connection by \c source_id field of
+ * \ref roc_connection_metrics returned by roc_receiver_query(). This allows a single
+ * receiver to serve many independent streams, e.g. to record each sender to its own
+ * file, using one set of threads and resources. In this mode roc_receiver_read() still
+ * should be called periodically: it fetches incoming packets and drives connections,
+ * but always produces silence.
+ *
  * **Transcoding**
  *
  * Every connection may have a different sample rate, channel layout, and encoding.
@@ -299,6 +308,12 @@ ROC_API int roc_receiver_bind(roc_receiver* receiver,
  * Actual number of connections (regardless of the array size) is also written to
  * \c connection_count field of \ref roc_receiver_metrics.
  *
+ * Metrics are not collected on every call. Instead, the receiver periodically publishes
+ * a snapshot of its metrics, every 200ms, and this function returns the latest
+ * snapshot. Hence, returned metrics may be up to 200ms stale. Metrics are collected on
+ * the spot only when there is no snapshot yet (right after the slot was created), or
+ * when the snapshot can't hold as many connections as requested.
+ *
  * **Parameters**
  *  - \p receiver should point to an opened receiver
  *  - \p slot specifies the receiver slot (if in doubt, use \c ROC_SLOT_DEFAULT)
@@ -369,6 +384,41 @@ ROC_API int roc_receiver_unlink(roc_receiver* receiver, roc_slot slot);
  */
 ROC_API int roc_receiver_read(roc_receiver* receiver, roc_frame* frame);
 
+/** Read samples of a single connection from the receiver.
+ *
+ * Works like roc_receiver_read(), but instead of mixing all connections, reads samples
+ * only from the connection with the given sender source ID. Can be used only if
+ * \c unmixed_output is enabled in \ref roc_receiver_config.
+ *
+ * Source IDs of active connections can be obtained using roc_receiver_query().
+ *
+ * This function never blocks on clock. Typically, the user calls roc_receiver_read()
+ * once per frame to advance receiver, and then calls this function once for each
+ * active connection with a frame of the same size.
+ *
+ * **Parameters**
+ *  - \p receiver should point to an opened receiver
+ *  - \p slot specifies the receiver slot (if in doubt, use \c ROC_SLOT_DEFAULT)
+ *  - \p source_id specifies the connection, as reported in \ref roc_connection_metrics
+ *  - \p frame should point to an initialized frame; it should contain pointer to
+ *    a buffer and it's size; the buffer is fully filled with data from connection
+ *
+ * **Returns**
+ *  - returns zero if all samples were successfully decoded
+ *  - returns a negative value if there is no such connection (e.g. it was terminated)
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value if the slot does not exist
+ *  - returns a negative value if unmixed output is disabled
+ *
+ * **Ownership**
+ *  - doesn't take or share the ownership of \p frame; it may be safely deallocated
+ *    after the function returns
+ */
+ROC_API int roc_receiver_read_session(roc_receiver* receiver,
+                                      roc_slot slot,
+                                      unsigned int source_id,
+                                      roc_frame* frame);
+
 /** Close the receiver.
  *
  * Deinitializes and deallocates the receiver, and detaches it from the context. The user
@@ -271,6 +271,12 @@ ROC_API int roc_sender_connect(roc_sender* sender,
  * Actual number of connections (regardless of the array size) is also written to
  * \c connection_count field of \ref roc_sender_metrics.
  *
+ * Metrics are not collected on every call. Instead, the sender periodically publishes
+ * a snapshot of its metrics, every 200ms, and this function returns the latest
+ * snapshot. Hence, returned metrics may be up to 200ms stale. Metrics are collected on
+ * the spot only when there is no snapshot yet (right after the slot was created), or
+ * when the snapshot can't hold as many connections as requested.
+ *
  * **Parameters**
  *  - \p sender should point to an opened sender
  *  - \p slot specifies the sender slot (if in doubt, use \c ROC_SLOT_DEFAULT)
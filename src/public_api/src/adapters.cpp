@@ -108,6 +108,11 @@ bool sender_config_from_user(node::Context& context,
 
     out.enable_interleaving = in.packet_interleaving;
 
+    if (in.rtcp_bandwidth != 0) {
+        out.rtcp.report_bandwidth = in.rtcp_bandwidth;
+        out.rtcp.enable_interval_scaling = true;
+    }
+
     if (!fec_encoding_from_user(out.fec_encoder.scheme, in.fec_encoding)) {
         roc_log(LogError,
                 "bad configuration: invalid roc_sender_config.fec_encoding:"
@@ -127,6 +132,12 @@ bool sender_config_from_user(node::Context& context,
         return false;
     }
 
+    out.timing.enable_precise = in.precise_timing != 0;
+
+    if (in.timer_slack != 0) {
+        out.timing.timer_slack = (core::nanoseconds_t)in.timer_slack;
+    }
+
     if (!latency_tuner_backend_from_user(out.latency.tuner_backend,
                                          in.latency_tuner_backend)) {
         roc_log(LogError,
@@ -174,6 +185,8 @@ bool receiver_config_from_user(node::Context&,
             (core::nanoseconds_t)in.latency_tolerance;
     }
 
+    out.session_defaults.latency.enable_adaptive_target = in.adaptive_latency != 0;
+
     if (in.no_playback_timeout != 0) {
         out.session_defaults.watchdog.no_playback_timeout = in.no_playback_timeout;
     }
@@ -185,6 +198,14 @@ bool receiver_config_from_user(node::Context&,
 
     out.common.enable_timing = false;
     out.common.enable_auto_reclock = true;
+    out.common.enable_unmixed_output = in.unmixed_output;
+    out.common.enable_passthrough = in.passthrough != 0;
+    out.common.overload.enable = in.overload_control != 0;
+
+    if (in.rtcp_bandwidth != 0) {
+        out.common.rtcp.report_bandwidth = in.rtcp_bandwidth;
+        out.common.rtcp.enable_interval_scaling = true;
+    }
 
     if (!sample_spec_from_user(out.common.output_sample_spec, in.frame_encoding, false)) {
         roc_log(LogError,
@@ -199,6 +220,12 @@ bool receiver_config_from_user(node::Context&,
         return false;
     }
 
+    out.common.timing.enable_precise = in.precise_timing != 0;
+
+    if (in.timer_slack != 0) {
+        out.common.timing.timer_slack = (core::nanoseconds_t)in.timer_slack;
+    }
+
     if (!latency_tuner_backend_from_user(out.session_defaults.latency.tuner_backend,
                                          in.latency_tuner_backend)) {
         roc_log(LogError,
@@ -231,6 +258,13 @@ bool receiver_config_from_user(node::Context&,
         return false;
     }
 
+    if (!plc_backend_from_user(out.session_defaults.plc.backend, in.plc_backend)) {
+        roc_log(LogError,
+                "bad configuration: invalid roc_receiver_config.plc_backend:"
+                " should be valid enum value");
+        return false;
+    }
+
     return true;
 }
 
@@ -340,6 +374,14 @@ bool sample_format_from_user(audio::SampleSpec& out, roc_format in, bool is_netw
         out.set_pcm_format(is_network ? audio::PcmFormat_SInt16_Be
                                       : audio::PcmFormat_Float32);
         return true;
+
+    case ROC_FORMAT_PCM_SINT16:
+        if (is_network) {
+            break;
+        }
+        out.set_sample_format(audio::SampleFormat_Pcm);
+        out.set_pcm_format(audio::PcmFormat_SInt16);
+        return true;
     }
 
     return false;
@@ -473,6 +515,22 @@ bool resampler_profile_from_user(audio::ResamplerProfile& out, roc_resampler_pro
     return false;
 }
 
+ROC_ATTR_NO_SANITIZE_UB
+bool plc_backend_from_user(audio::PlcBackend& out, roc_plc_backend in) {
+    switch (enum_from_user(in)) {
+    case ROC_PLC_BACKEND_DEFAULT:
+    case ROC_PLC_BACKEND_NONE:
+        out = audio::PlcBackend_None;
+        return true;
+
+    case ROC_PLC_BACKEND_WSOLA:
+        out = audio::PlcBackend_Wsola;
+        return true;
+    }
+
+    return false;
+}
+
 ROC_ATTR_NO_SANITIZE_UB
 bool packet_encoding_from_user(unsigned& out_pt, roc_packet_encoding in) {
     switch (enum_from_user(in)) {
@@ -612,6 +670,21 @@ void receiver_slot_metrics_to_user(const pipeline::ReceiverSlotMetrics& slot_met
     memset(&out, 0, sizeof(out));
 
     out.connection_count = (unsigned)slot_metrics.num_participants;
+    out.degradation_level = (unsigned)slot_metrics.overload.level;
+}
+
+ROC_ATTR_NO_SANITIZE_UB
+void receiver_timing_metrics_to_user(const core::TickerMetrics& timing_metrics,
+                                     roc_receiver_metrics& out) {
+    out.clock_wakeups = (unsigned long long)timing_metrics.wakeups;
+    out.clock_overruns = (unsigned long long)timing_metrics.overruns;
+
+    if (timing_metrics.wakeups > 0) {
+        out.avg_clock_error =
+            (unsigned long long)(timing_metrics.total_wakeup_error
+                                 / (core::nanoseconds_t)timing_metrics.wakeups);
+    }
+    out.max_clock_error = (unsigned long long)timing_metrics.max_wakeup_error;
 }
 
 ROC_ATTR_NO_SANITIZE_UB
@@ -626,6 +699,27 @@ void receiver_participant_metrics_to_user(
     if (party_metrics.latency.e2e_latency > 0) {
         out.e2e_latency = (unsigned long long)party_metrics.latency.e2e_latency;
     }
+
+    if (party_metrics.latency.target_latency > 0) {
+        out.target_latency = (unsigned long long)party_metrics.latency.target_latency;
+    }
+
+    out.source_id = (unsigned int)party_metrics.source_id;
+
+    const pipeline::CpuMetrics& cpu = party_metrics.cpu;
+
+    out.cpu_time = (unsigned long long)cpu.avg_frame_time;
+    out.max_cpu_time = (unsigned long long)cpu.max_frame_time;
+    out.fec_cpu_time = (unsigned long long)cpu.avg_stage_time[pipeline::CpuStage_Fec];
+    out.codec_cpu_time =
+        (unsigned long long)cpu.avg_stage_time[pipeline::CpuStage_Codec];
+    out.resampler_cpu_time =
+        (unsigned long long)cpu.avg_stage_time[pipeline::CpuStage_Resampler];
+
+    out.missing_samples =
+        (unsigned long long)party_metrics.depacketizer.missing_samples;
+    out.concealed_samples =
+        (unsigned long long)party_metrics.depacketizer.concealed_samples;
 }
 
 ROC_ATTR_NO_SANITIZE_UB
@@ -636,6 +730,30 @@ void sender_slot_metrics_to_user(const pipeline::SenderSlotMetrics& slot_metrics
     memset(&out, 0, sizeof(out));
 
     out.connection_count = (unsigned)slot_metrics.num_participants;
+
+    const pipeline::CpuMetrics& cpu = slot_metrics.cpu;
+
+    out.cpu_time = (unsigned long long)cpu.avg_frame_time;
+    out.max_cpu_time = (unsigned long long)cpu.max_frame_time;
+    out.fec_cpu_time = (unsigned long long)cpu.avg_stage_time[pipeline::CpuStage_Fec];
+    out.codec_cpu_time =
+        (unsigned long long)cpu.avg_stage_time[pipeline::CpuStage_Codec];
+    out.resampler_cpu_time =
+        (unsigned long long)cpu.avg_stage_time[pipeline::CpuStage_Resampler];
+}
+
+ROC_ATTR_NO_SANITIZE_UB
+void sender_timing_metrics_to_user(const core::TickerMetrics& timing_metrics,
+                                   roc_sender_metrics& out) {
+    out.clock_wakeups = (unsigned long long)timing_metrics.wakeups;
+    out.clock_overruns = (unsigned long long)timing_metrics.overruns;
+
+    if (timing_metrics.wakeups > 0) {
+        out.avg_clock_error =
+            (unsigned long long)(timing_metrics.total_wakeup_error
+                                 / (core::nanoseconds_t)timing_metrics.wakeups);
+    }
+    out.max_clock_error = (unsigned long long)timing_metrics.max_wakeup_error;
 }
 
 ROC_ATTR_NO_SANITIZE_UB
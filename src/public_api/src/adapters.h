@@ -53,6 +53,8 @@ bool latency_tuner_profile_from_user(audio::LatencyTunerProfile& out,
 bool resampler_backend_from_user(audio::ResamplerBackend& out, roc_resampler_backend in);
 bool resampler_profile_from_user(audio::ResamplerProfile& out, roc_resampler_profile in);
 
+bool plc_backend_from_user(audio::PlcBackend& out, roc_plc_backend in);
+
 bool packet_encoding_from_user(unsigned& out_pt, roc_packet_encoding in);
 bool fec_encoding_from_user(packet::FecScheme& out, roc_fec_encoding in);
 
@@ -63,6 +65,8 @@ bool proto_to_user(roc_protocol& out, address::Protocol in);
 
 void receiver_slot_metrics_to_user(const pipeline::ReceiverSlotMetrics& slot_metrics,
                                    void* slot_arg);
+void receiver_timing_metrics_to_user(const core::TickerMetrics& timing_metrics,
+                                     roc_receiver_metrics& out);
 void receiver_participant_metrics_to_user(
     const pipeline::ReceiverParticipantMetrics& party_metrics,
     size_t party_index,
@@ -70,6 +74,8 @@ void receiver_participant_metrics_to_user(
 
 void sender_slot_metrics_to_user(const pipeline::SenderSlotMetrics& slot_metrics,
                                  void* slot_arg);
+void sender_timing_metrics_to_user(const core::TickerMetrics& timing_metrics,
+                                   roc_sender_metrics& out);
 void sender_participant_metrics_to_user(
     const pipeline::SenderParticipantMetrics& party_metrics,
     size_t party_index,
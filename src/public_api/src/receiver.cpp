@@ -13,6 +13,7 @@
 #include "roc_core/log.h"
 #include "roc_core/scoped_ptr.h"
 #include "roc_node/receiver.h"
+#include "roc_status/code_to_str.h"
 
 using namespace roc;
 
@@ -173,6 +174,11 @@ int roc_receiver_query(roc_receiver* receiver,
         return -1;
     }
 
+    core::TickerMetrics timing_metrics;
+    if (slot_metrics && imp_receiver->get_timing_metrics(timing_metrics)) {
+        api::receiver_timing_metrics_to_user(timing_metrics, *slot_metrics);
+    }
+
     return 0;
 }
 
@@ -195,7 +201,7 @@ int roc_receiver_read(roc_receiver* receiver, roc_frame* frame) {
         return 0;
     }
 
-    const size_t factor = imp_source.sample_spec().num_channels() * sizeof(float);
+    const size_t factor = imp_source.sample_spec().stream_timestamp_2_bytes(1);
 
     if (frame->samples_size % factor != 0) {
         roc_log(LogError,
@@ -211,7 +217,10 @@ int roc_receiver_read(roc_receiver* receiver, roc_frame* frame) {
         return -1;
     }
 
-    audio::Frame imp_frame((float*)frame->samples, frame->samples_size / sizeof(float));
+    audio::Frame imp_frame((uint8_t*)frame->samples, frame->samples_size);
+    if (!imp_source.sample_spec().is_raw()) {
+        imp_frame.set_flags(audio::Frame::FlagNotRaw);
+    }
 
     if (!imp_source.read(imp_frame)) {
         roc_log(LogError, "roc_receiver_read(): got unexpected eof from source");
@@ -221,6 +230,71 @@ int roc_receiver_read(roc_receiver* receiver, roc_frame* frame) {
     return 0;
 }
 
+int roc_receiver_read_session(roc_receiver* receiver,
+                              roc_slot slot,
+                              unsigned int source_id,
+                              roc_frame* frame) {
+    if (!receiver) {
+        roc_log(LogError,
+                "roc_receiver_read_session(): invalid arguments: receiver is null");
+        return -1;
+    }
+
+    node::Receiver* imp_receiver = (node::Receiver*)receiver;
+
+    sndio::ISource& imp_source = imp_receiver->source();
+
+    if (!frame) {
+        roc_log(LogError,
+                "roc_receiver_read_session(): invalid arguments: frame is null");
+        return -1;
+    }
+
+    if (frame->samples_size == 0) {
+        return 0;
+    }
+
+    const size_t factor = imp_source.sample_spec().stream_timestamp_2_bytes(1);
+
+    if (frame->samples_size % factor != 0) {
+        roc_log(LogError,
+                "roc_receiver_read_session(): invalid arguments:"
+                " # of samples should be multiple of %u",
+                (unsigned)factor);
+        return -1;
+    }
+
+    if (!frame->samples) {
+        roc_log(LogError,
+                "roc_receiver_read_session(): invalid arguments:"
+                " frame samples buffer is null");
+        return -1;
+    }
+
+    audio::Frame imp_frame((uint8_t*)frame->samples, frame->samples_size);
+    if (!imp_source.sample_spec().is_raw()) {
+        imp_frame.set_flags(audio::Frame::FlagNotRaw);
+    }
+
+    const status::StatusCode code =
+        imp_receiver->read_session(slot, (packet::stream_source_t)source_id, imp_frame);
+
+    if (code == status::StatusNoData) {
+        roc_log(LogDebug,
+                "roc_receiver_read_session(): connection not found: source_id=%u",
+                source_id);
+        return -1;
+    }
+
+    if (code != status::StatusOK) {
+        roc_log(LogError, "roc_receiver_read_session(): operation failed: status=%s",
+                status::code_to_str(code));
+        return -1;
+    }
+
+    return 0;
+}
+
 int roc_receiver_close(roc_receiver* receiver) {
     if (!receiver) {
         roc_log(LogError, "roc_receiver_close(): invalid arguments: receiver is null");
@@ -309,7 +309,7 @@ int roc_receiver_decoder_pop_frame(roc_receiver_decoder* decoder, roc_frame* fra
         return 0;
     }
 
-    const size_t factor = imp_source.sample_spec().num_channels() * sizeof(float);
+    const size_t factor = imp_source.sample_spec().stream_timestamp_2_bytes(1);
 
     if (frame->samples_size % factor != 0) {
         roc_log(LogError,
@@ -326,7 +326,10 @@ int roc_receiver_decoder_pop_frame(roc_receiver_decoder* decoder, roc_frame* fra
         return -1;
     }
 
-    audio::Frame imp_frame((float*)frame->samples, frame->samples_size / sizeof(float));
+    audio::Frame imp_frame((uint8_t*)frame->samples, frame->samples_size);
+    if (!imp_source.sample_spec().is_raw()) {
+        imp_frame.set_flags(audio::Frame::FlagNotRaw);
+    }
 
     if (!imp_source.read(imp_frame)) {
         roc_log(LogError,
@@ -156,6 +156,11 @@ int roc_sender_query(roc_sender* sender,
         return -1;
     }
 
+    core::TickerMetrics timing_metrics;
+    if (slot_metrics && imp_sender->get_timing_metrics(timing_metrics)) {
+        api::sender_timing_metrics_to_user(timing_metrics, *slot_metrics);
+    }
+
     return 0;
 }
 
@@ -194,7 +199,7 @@ int roc_sender_write(roc_sender* sender, const roc_frame* frame) {
         return 0;
     }
 
-    const size_t factor = imp_sink.sample_spec().num_channels() * sizeof(float);
+    const size_t factor = imp_sink.sample_spec().stream_timestamp_2_bytes(1);
 
     if (frame->samples_size % factor != 0) {
         roc_log(LogError,
@@ -210,7 +215,10 @@ int roc_sender_write(roc_sender* sender, const roc_frame* frame) {
         return -1;
     }
 
-    audio::Frame imp_frame((float*)frame->samples, frame->samples_size / sizeof(float));
+    audio::Frame imp_frame((uint8_t*)frame->samples, frame->samples_size);
+    if (!imp_sink.sample_spec().is_raw()) {
+        imp_frame.set_flags(audio::Frame::FlagNotRaw);
+    }
     imp_sink.write(imp_frame);
 
     return 0;
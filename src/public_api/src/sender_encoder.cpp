@@ -157,7 +157,7 @@ int roc_sender_encoder_push_frame(roc_sender_encoder* encoder, const roc_frame*
         return 0;
     }
 
-    const size_t factor = imp_sink.sample_spec().num_channels() * sizeof(float);
+    const size_t factor = imp_sink.sample_spec().stream_timestamp_2_bytes(1);
 
     if (frame->samples_size % factor != 0) {
         roc_log(LogError,
@@ -174,7 +174,10 @@ int roc_sender_encoder_push_frame(roc_sender_encoder* encoder, const roc_frame*
         return -1;
     }
 
-    audio::Frame imp_frame((float*)frame->samples, frame->samples_size / sizeof(float));
+    audio::Frame imp_frame((uint8_t*)frame->samples, frame->samples_size);
+    if (!imp_sink.sample_spec().is_raw()) {
+        imp_frame.set_flags(audio::Frame::FlagNotRaw);
+    }
     imp_sink.write(imp_frame);
 
     return 0;
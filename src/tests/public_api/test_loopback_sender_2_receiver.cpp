@@ -591,6 +591,15 @@ TEST(loopback_sender_2_receiver, metrics_measurements) {
             continue;
         }
 
+        if (receiver.conn_metrics(0).cpu_time == 0) {
+            continue;
+        }
+
+        const roc_connection_metrics& recv_conn = receiver.conn_metrics(0);
+
+        CHECK(recv_conn.max_cpu_time >= recv_conn.cpu_time);
+        CHECK(recv_conn.codec_cpu_time <= recv_conn.cpu_time);
+
         sender.query_metrics(MaxSess);
 
         if (sender.send_metrics().connection_count == 0) {
@@ -604,6 +613,13 @@ TEST(loopback_sender_2_receiver, metrics_measurements) {
             continue;
         }
 
+        if (sender.send_metrics().cpu_time == 0) {
+            continue;
+        }
+
+        CHECK(sender.send_metrics().max_cpu_time >= sender.send_metrics().cpu_time);
+        CHECK(sender.send_metrics().codec_cpu_time <= sender.send_metrics().cpu_time);
+
         break;
     }
 
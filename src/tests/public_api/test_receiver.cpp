@@ -615,5 +615,136 @@ TEST(receiver, read_args) {
     LONGS_EQUAL(0, roc_receiver_close(receiver));
 }
 
+TEST(receiver, read_sint16) {
+    receiver_config.frame_encoding.format = ROC_FORMAT_PCM_SINT16;
+    receiver_config.passthrough = 1;
+
+    roc_receiver* receiver = NULL;
+    CHECK(roc_receiver_open(context, &receiver_config, &receiver) == 0);
+
+    int16_t samples[16];
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(samples); n++) {
+        samples[n] = 123;
+    }
+
+    { // all good, silence
+        roc_frame frame;
+        frame.samples = samples;
+        frame.samples_size = sizeof(samples);
+        CHECK(roc_receiver_read(receiver, &frame) == 0);
+
+        for (size_t n = 0; n < ROC_ARRAY_SIZE(samples); n++) {
+            LONGS_EQUAL(0, samples[n]);
+        }
+    }
+
+    { // not multiple of two 16-bit samples
+        roc_frame frame;
+        frame.samples = samples;
+        frame.samples_size = sizeof(int16_t);
+        CHECK(roc_receiver_read(receiver, &frame) == -1);
+    }
+
+    LONGS_EQUAL(0, roc_receiver_close(receiver));
+}
+
+TEST(receiver, read_session_args) {
+    receiver_config.unmixed_output = 1;
+
+    roc_receiver* receiver = NULL;
+    CHECK(roc_receiver_open(context, &receiver_config, &receiver) == 0);
+
+    float samples[16] = {};
+
+    roc_endpoint* source_endpoint = NULL;
+    CHECK(roc_endpoint_allocate(&source_endpoint) == 0);
+    CHECK(roc_endpoint_set_uri(source_endpoint, "rtp://127.0.0.1:0") == 0);
+
+    CHECK(roc_receiver_bind(receiver, ROC_SLOT_DEFAULT, ROC_INTERFACE_AUDIO_SOURCE,
+                            source_endpoint)
+          == 0);
+
+    { // mixed output is still readable
+        roc_frame frame;
+        frame.samples = samples;
+        frame.samples_size = ROC_ARRAY_SIZE(samples);
+        CHECK(roc_receiver_read(receiver, &frame) == 0);
+    }
+
+    { // no such connection
+        roc_frame frame;
+        frame.samples = samples;
+        frame.samples_size = ROC_ARRAY_SIZE(samples);
+        CHECK(roc_receiver_read_session(receiver, ROC_SLOT_DEFAULT, 123, &frame) == -1);
+    }
+
+    { // no such slot
+        roc_frame frame;
+        frame.samples = samples;
+        frame.samples_size = ROC_ARRAY_SIZE(samples);
+        CHECK(roc_receiver_read_session(receiver, 100, 123, &frame) == -1);
+    }
+
+    { // null receiver
+        roc_frame frame;
+        frame.samples = samples;
+        frame.samples_size = ROC_ARRAY_SIZE(samples);
+        CHECK(roc_receiver_read_session(NULL, ROC_SLOT_DEFAULT, 123, &frame) == -1);
+    }
+
+    { // null frame
+        CHECK(roc_receiver_read_session(receiver, ROC_SLOT_DEFAULT, 123, NULL) == -1);
+    }
+
+    { // null samples, zero sample count
+        roc_frame frame;
+        frame.samples = NULL;
+        frame.samples_size = 0;
+        CHECK(roc_receiver_read_session(receiver, ROC_SLOT_DEFAULT, 123, &frame) == 0);
+    }
+
+    { // null samples, non-zero sample count
+        roc_frame frame;
+        frame.samples = NULL;
+        frame.samples_size = ROC_ARRAY_SIZE(samples);
+        CHECK(roc_receiver_read_session(receiver, ROC_SLOT_DEFAULT, 123, &frame) == -1);
+    }
+
+    { // uneven sample count
+        roc_frame frame;
+        frame.samples = samples;
+        frame.samples_size = 1;
+        CHECK(roc_receiver_read_session(receiver, ROC_SLOT_DEFAULT, 123, &frame) == -1);
+    }
+
+    CHECK(roc_endpoint_deallocate(source_endpoint) == 0);
+    LONGS_EQUAL(0, roc_receiver_close(receiver));
+}
+
+TEST(receiver, read_session_mixed) {
+    roc_receiver* receiver = NULL;
+    CHECK(roc_receiver_open(context, &receiver_config, &receiver) == 0);
+
+    roc_endpoint* source_endpoint = NULL;
+    CHECK(roc_endpoint_allocate(&source_endpoint) == 0);
+    CHECK(roc_endpoint_set_uri(source_endpoint, "rtp://127.0.0.1:0") == 0);
+
+    CHECK(roc_receiver_bind(receiver, ROC_SLOT_DEFAULT, ROC_INTERFACE_AUDIO_SOURCE,
+                            source_endpoint)
+          == 0);
+
+    float samples[16] = {};
+
+    roc_frame frame;
+    frame.samples = samples;
+    frame.samples_size = ROC_ARRAY_SIZE(samples);
+
+    // unmixed output is disabled
+    CHECK(roc_receiver_read_session(receiver, ROC_SLOT_DEFAULT, 123, &frame) == -1);
+
+    CHECK(roc_endpoint_deallocate(source_endpoint) == 0);
+    LONGS_EQUAL(0, roc_receiver_close(receiver));
+}
+
 } // namespace api
 } // namespace roc
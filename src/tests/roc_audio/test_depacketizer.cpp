@@ -12,6 +12,7 @@
 #include "roc_audio/frame_factory.h"
 #include "roc_audio/iframe_decoder.h"
 #include "roc_audio/iframe_encoder.h"
+#include "roc_audio/iplc.h"
 #include "roc_audio/pcm_decoder.h"
 #include "roc_audio/pcm_encoder.h"
 #include "roc_core/heap_arena.h"
@@ -129,6 +130,29 @@ void expect_flags(Depacketizer& depacketizer,
     }
 }
 
+void expect_pcm_output(Depacketizer& depacketizer,
+                       size_t sz,
+                       size_t sample_size,
+                       const uint8_t* sample_bytes,
+                       unsigned int flags) {
+    uint8_t buf[MaxBufSize];
+    CHECK(sz * frame_spec.num_channels() * sample_size <= MaxBufSize);
+
+    Frame frame(buf, sz * frame_spec.num_channels() * sample_size);
+    frame.set_flags(Frame::FlagNotRaw);
+
+    CHECK(depacketizer.read(frame));
+
+    UNSIGNED_LONGS_EQUAL(flags, frame.flags());
+    UNSIGNED_LONGS_EQUAL(sz, frame.duration());
+
+    for (size_t n = 0; n < sz * frame_spec.num_channels(); n++) {
+        for (size_t b = 0; b < sample_size; b++) {
+            UNSIGNED_LONGS_EQUAL(sample_bytes[b], buf[n * sample_size + b]);
+        }
+    }
+}
+
 class TestReader : public packet::IReader {
 public:
     explicit TestReader(packet::IReader& reader)
@@ -172,6 +196,45 @@ private:
     status::StatusCode code_;
 };
 
+// Fills gaps with constant value.
+class TestPlc : public IPlc {
+public:
+    explicit TestPlc(sample_t value)
+        : value_(value)
+        , history_samples_(0)
+        , loss_samples_(0) {
+    }
+
+    virtual bool is_valid() const {
+        return true;
+    }
+
+    virtual void process_history(sample_t* samples, size_t n_samples) {
+        history_samples_ += n_samples;
+    }
+
+    virtual size_t process_loss(sample_t* samples, size_t n_samples) {
+        for (size_t n = 0; n < n_samples; n++) {
+            samples[n] = value_;
+        }
+        loss_samples_ += n_samples;
+        return n_samples;
+    }
+
+    size_t history_samples() const {
+        return history_samples_;
+    }
+
+    size_t loss_samples() const {
+        return loss_samples_;
+    }
+
+private:
+    sample_t value_;
+    size_t history_samples_;
+    size_t loss_samples_;
+};
+
 } // namespace
 
 TEST_GROUP(depacketizer) {};
@@ -766,5 +829,124 @@ TEST(depacketizer, read_after_error) {
     }
 }
 
+TEST(depacketizer, passthrough) {
+    PcmEncoder encoder(packet_spec);
+    PcmDecoder decoder(packet_spec);
+
+    packet::Queue queue;
+    Depacketizer dp(queue, decoder, frame_spec, false);
+    CHECK(dp.is_valid());
+
+    dp.enable_passthrough(PcmFormat_SInt16_Be);
+
+    LONGS_EQUAL(status::StatusOK, queue.write(new_packet(encoder, 0, 0.5f, Now)));
+    LONGS_EQUAL(status::StatusOK,
+                queue.write(new_packet(encoder, SamplesPerPacket * 2, 0.25f,
+                                       Now + NsPerPacket * 2)));
+
+    const uint8_t packet1_bytes[] = { 0x40, 0x00 };
+    const uint8_t missing_bytes[] = { 0x00, 0x00 };
+    const uint8_t packet2_bytes[] = { 0x20, 0x00 };
+
+    expect_pcm_output(dp, SamplesPerPacket, 2, packet1_bytes,
+                      Frame::FlagNotRaw | Frame::FlagNotBlank);
+    expect_pcm_output(dp, SamplesPerPacket, 2, missing_bytes,
+                      Frame::FlagNotRaw | Frame::FlagNotComplete);
+    expect_pcm_output(dp, SamplesPerPacket, 2, packet2_bytes,
+                      Frame::FlagNotRaw | Frame::FlagNotBlank);
+    expect_pcm_output(dp, SamplesPerPacket, 2, missing_bytes,
+                      Frame::FlagNotRaw | Frame::FlagNotComplete);
+}
+
+TEST(depacketizer, passthrough_interleaved_with_raw) {
+    enum { NumPackets = 4, FramesPerPacket = 4 };
+
+    PcmEncoder encoder(packet_spec);
+    PcmDecoder decoder(packet_spec);
+
+    packet::Queue queue;
+    Depacketizer dp(queue, decoder, frame_spec, false);
+    CHECK(dp.is_valid());
+
+    // differs from packet format in byte order
+    dp.enable_passthrough(PcmFormat_SInt16_Le);
+
+    for (size_t n = 0; n < NumPackets; n++) {
+        const packet::stream_timestamp_t ts =
+            packet::stream_timestamp_t(n * SamplesPerPacket);
+        const core::nanoseconds_t capt_ts = Now + NsPerPacket * (core::nanoseconds_t)n;
+
+        LONGS_EQUAL(status::StatusOK,
+                    queue.write(new_packet(encoder, ts, 0.5f, capt_ts)));
+    }
+
+    const uint8_t sample_bytes[] = { 0x00, 0x40 };
+
+    for (size_t n = 0; n < NumPackets * FramesPerPacket; n++) {
+        if (n % 2 == 0) {
+            expect_pcm_output(dp, SamplesPerPacket / FramesPerPacket, 2, sample_bytes,
+                              Frame::FlagNotRaw | Frame::FlagNotBlank);
+        } else {
+            expect_output(
+                dp, SamplesPerPacket / FramesPerPacket, 0.5f,
+                Now + NsPerPacket * (core::nanoseconds_t)n / FramesPerPacket);
+        }
+    }
+}
+
+TEST(depacketizer, plc) {
+    PcmEncoder encoder(packet_spec);
+    PcmDecoder decoder(packet_spec);
+
+    packet::Queue queue;
+    Depacketizer dp(queue, decoder, frame_spec, false);
+    CHECK(dp.is_valid());
+
+    TestPlc plc(0.77f);
+    dp.enable_plc(plc);
+
+    LONGS_EQUAL(status::StatusOK,
+                queue.write(new_packet(encoder, 1 * SamplesPerPacket, 0.11f, Now)));
+    LONGS_EQUAL(status::StatusOK,
+                queue.write(new_packet(encoder, 3 * SamplesPerPacket, 0.33f,
+                                       Now + NsPerPacket * 2)));
+
+    expect_output(dp, SamplesPerPacket, 0.11f, Now);
+    // gap is filled by plc
+    expect_output(dp, SamplesPerPacket, 0.77f, Now + NsPerPacket);
+    expect_output(dp, SamplesPerPacket, 0.33f, Now + 2 * NsPerPacket);
+
+    UNSIGNED_LONGS_EQUAL(SamplesSize * 2, plc.history_samples());
+    UNSIGNED_LONGS_EQUAL(SamplesSize, plc.loss_samples());
+
+    UNSIGNED_LONGS_EQUAL(SamplesPerPacket, dp.metrics().missing_samples);
+    UNSIGNED_LONGS_EQUAL(SamplesPerPacket, dp.metrics().concealed_samples);
+}
+
+TEST(depacketizer, plc_output) {
+    PcmEncoder encoder(packet_spec);
+    PcmDecoder decoder(packet_spec);
+
+    packet::Queue queue;
+    Depacketizer dp(queue, decoder, frame_spec, false);
+    CHECK(dp.is_valid());
+
+    TestPlc plc(0.77f);
+    dp.enable_plc(plc);
+
+    // no packets yet, plc is not used
+    expect_output(dp, SamplesPerPacket, 0.00f, 0);
+    UNSIGNED_LONGS_EQUAL(0, plc.loss_samples());
+
+    LONGS_EQUAL(status::StatusOK, queue.write(new_packet(encoder, 0, 0.11f, Now)));
+
+    expect_output(dp, SamplesPerPacket, 0.11f, Now);
+    // no next packet, gap is filled by plc
+    expect_output(dp, SamplesPerPacket, 0.77f, Now + NsPerPacket);
+
+    UNSIGNED_LONGS_EQUAL(SamplesPerPacket, dp.metrics().missing_samples);
+    UNSIGNED_LONGS_EQUAL(SamplesPerPacket, dp.metrics().concealed_samples);
+}
+
 } // namespace audio
 } // namespace roc
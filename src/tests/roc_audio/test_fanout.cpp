@@ -130,5 +130,77 @@ TEST(fanout, has_output) {
     CHECK(!fanout.has_output(writer));
 }
 
+TEST(fanout, parallel_outputs) {
+    enum { NumOutputs = 5, NumFrames = 20 };
+
+    test::MockWriter writers[NumOutputs];
+
+    FanoutConfig config;
+    config.num_threads = 2;
+
+    Fanout fanout(config, arena);
+    CHECK(fanout.is_valid());
+
+    for (size_t n = 0; n < NumOutputs; n++) {
+        fanout.add_output(writers[n]);
+    }
+
+    for (size_t nf = 0; nf < NumFrames; nf++) {
+        write_frame(fanout, BufSz, sample_t(nf + 1) * 0.01f);
+
+        // write() returns only when all outputs got the frame
+        for (size_t n = 0; n < NumOutputs; n++) {
+            UNSIGNED_LONGS_EQUAL(nf + 1, writers[n].n_writes());
+        }
+    }
+
+    for (size_t n = 0; n < NumOutputs; n++) {
+        CHECK(writers[n].num_unread() == BufSz * NumFrames);
+
+        for (size_t nf = 0; nf < NumFrames; nf++) {
+            expect_written(writers[n], BufSz, sample_t(nf + 1) * 0.01f);
+        }
+    }
+}
+
+TEST(fanout, parallel_remove_output) {
+    test::MockWriter writer1;
+    test::MockWriter writer2;
+    test::MockWriter writer3;
+
+    FanoutConfig config;
+    config.num_threads = 2;
+
+    Fanout fanout(config, arena);
+    CHECK(fanout.is_valid());
+
+    fanout.add_output(writer1);
+    fanout.add_output(writer2);
+    fanout.add_output(writer3);
+
+    write_frame(fanout, BufSz, 0.11f);
+
+    CHECK(writer1.num_unread() == BufSz);
+    CHECK(writer2.num_unread() == BufSz);
+    CHECK(writer3.num_unread() == BufSz);
+
+    fanout.remove_output(writer2);
+
+    write_frame(fanout, BufSz, 0.22f);
+
+    CHECK(writer1.num_unread() == BufSz * 2);
+    CHECK(writer2.num_unread() == BufSz);
+    CHECK(writer3.num_unread() == BufSz * 2);
+
+    fanout.remove_output(writer1);
+    fanout.remove_output(writer3);
+
+    write_frame(fanout, BufSz, 0.33f);
+
+    CHECK(writer1.num_unread() == BufSz * 2);
+    CHECK(writer2.num_unread() == BufSz);
+    CHECK(writer3.num_unread() == BufSz * 2);
+}
+
 } // namespace audio
 } // namespace roc
@@ -69,5 +69,56 @@ TEST(freq_estimator, small_queue_size) {
     }
 }
 
+TEST(freq_estimator, change_target) {
+    for (size_t p = 0; p < ROC_ARRAY_SIZE(Profiles); p++) {
+        FreqEstimator fe(Profiles[p], Target);
+
+        for (size_t n = 0; n < 1000; n++) {
+            fe.update(Target);
+        }
+        DOUBLES_EQUAL(1.0, (double)fe.freq_coeff(), Epsilon);
+
+        // queue is now smaller than new target
+        fe.update_target_latency(Target * 2);
+
+        do {
+            fe.update(Target);
+        } while (fe.freq_coeff() > 0.99f);
+
+        // queue is now larger than new target
+        fe.update_target_latency(Target / 2);
+
+        do {
+            fe.update(Target);
+        } while (fe.freq_coeff() < 1.01f);
+    }
+}
+
+TEST(freq_estimator, track) {
+    for (size_t p = 0; p < ROC_ARRAY_SIZE(Profiles); p++) {
+        FreqEstimator tracked_fe(Profiles[p], Target);
+        FreqEstimator updated_fe(Profiles[p], Target);
+
+        // latency grows from Target/2 to Target, e.g. during fast start
+        for (size_t n = 0; n < 1000; n++) {
+            tracked_fe.track(Target / 2 + Target / 2 * n / 1000);
+            updated_fe.update(Target / 2 + Target / 2 * n / 1000);
+        }
+
+        // tracking doesn't change coefficient
+        DOUBLES_EQUAL(1.0, (double)tracked_fe.freq_coeff(), Epsilon);
+        CHECK(updated_fe.freq_coeff() < 1.0f);
+
+        for (size_t n = 0; n < 100; n++) {
+            tracked_fe.update(Target);
+            updated_fe.update(Target);
+        }
+
+        // tracking doesn't accumulate error in integrator
+        CHECK(std::abs(tracked_fe.freq_coeff() - 1.0f)
+              < std::abs(updated_fe.freq_coeff() - 1.0f));
+    }
+}
+
 } // namespace audio
 } // namespace roc
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_audio/latency_tuner.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace audio {
+
+namespace {
+
+enum { SampleRate = 10000, FrameSize = 100 };
+
+const SampleSpec sample_spec(SampleRate,
+                             Sample_RawFormat,
+                             ChanLayout_Surround,
+                             ChanOrder_Smpte,
+                             ChanMask_Surround_Mono);
+
+const core::nanoseconds_t Target = 100 * core::Millisecond;
+const core::nanoseconds_t MinTarget = 40 * core::Millisecond;
+const core::nanoseconds_t MaxTarget = 200 * core::Millisecond;
+
+LatencyConfig make_config() {
+    LatencyConfig config;
+    config.tuner_backend = LatencyTunerBackend_Niq;
+    config.tuner_profile = LatencyTunerProfile_Gradual;
+    config.target_latency = Target;
+    config.enable_adaptive_target = true;
+    config.min_target_latency = MinTarget;
+    config.max_target_latency = MaxTarget;
+    config.deduce_defaults(Target, true);
+    return config;
+}
+
+// Run tuner for given duration, reporting niq latency equal to current target,
+// and given jitter and losses.
+void run_tuner(LatencyTuner& tuner,
+               core::nanoseconds_t duration,
+               core::nanoseconds_t jitter,
+               double loss_ratio,
+               packet::LinkMetrics& link_metrics) {
+    const size_t n_frames =
+        (size_t)sample_spec.ns_2_stream_timestamp(duration) / FrameSize;
+
+    for (size_t n = 0; n < n_frames; n++) {
+        link_metrics.jitter = jitter;
+        link_metrics.total_packets += 100;
+        link_metrics.lost_packets += (int64_t)(loss_ratio * 100);
+
+        LatencyMetrics latency_metrics;
+        latency_metrics.niq_latency = tuner.target_latency();
+
+        tuner.write_metrics(latency_metrics, link_metrics);
+        CHECK(tuner.update_stream());
+        tuner.advance_stream(FrameSize);
+    }
+}
+
+// Run tuner for given duration, simulating receiver queue: every frame,
+// FrameSize samples are added to queue, and FrameSize * scaling samples
+// are played from it.
+void run_queue(LatencyTuner& tuner,
+               core::nanoseconds_t duration,
+               double& latency,
+               float& scaling,
+               float& min_scaling,
+               float& max_scaling) {
+    const size_t n_frames =
+        (size_t)sample_spec.ns_2_stream_timestamp(duration) / FrameSize;
+
+    for (size_t n = 0; n < n_frames; n++) {
+        LatencyMetrics latency_metrics;
+        latency_metrics.niq_latency =
+            sample_spec.samples_per_chan_2_ns((size_t)(latency + 0.5));
+
+        tuner.write_metrics(latency_metrics, packet::LinkMetrics());
+        CHECK(tuner.update_stream());
+
+        const float new_scaling = tuner.fetch_scaling();
+        if (new_scaling > 0) {
+            scaling = new_scaling;
+        }
+        min_scaling = std::min(min_scaling, scaling);
+        max_scaling = std::max(max_scaling, scaling);
+
+        latency += FrameSize * (1 - (double)scaling);
+        tuner.advance_stream(FrameSize);
+    }
+}
+
+} // namespace
+
+TEST_GROUP(latency_tuner) {};
+
+TEST(latency_tuner, fixed_target) {
+    LatencyConfig config = make_config();
+    config.enable_adaptive_target = false;
+
+    LatencyTuner tuner(config, sample_spec);
+    CHECK(tuner.is_valid());
+
+    packet::LinkMetrics link_metrics;
+    run_tuner(tuner, 30 * core::Second, 50 * core::Millisecond, 0.1, link_metrics);
+
+    LONGS_EQUAL(Target, tuner.target_latency());
+}
+
+TEST(latency_tuner, adaptive_shrink) {
+    LatencyTuner tuner(make_config(), sample_spec);
+    CHECK(tuner.is_valid());
+
+    LONGS_EQUAL(Target, tuner.target_latency());
+
+    // stable link: target shrinks towards floor, but not below it
+    packet::LinkMetrics link_metrics;
+    run_tuner(tuner, 60 * core::Second, core::Millisecond, 0, link_metrics);
+
+    CHECK(tuner.target_latency() >= MinTarget);
+    CHECK(tuner.target_latency() <= MinTarget * 11 / 10);
+}
+
+TEST(latency_tuner, adaptive_grow) {
+    LatencyTuner tuner(make_config(), sample_spec);
+    CHECK(tuner.is_valid());
+
+    packet::LinkMetrics link_metrics;
+
+    // moderate jitter: target grows, but not above what jitter requires
+    run_tuner(tuner, 10 * core::Second, 35 * core::Millisecond, 0, link_metrics);
+
+    CHECK(tuner.target_latency() > Target);
+    CHECK(tuner.target_latency() < MaxTarget);
+
+    // high jitter: target grows up to ceiling, but not above it
+    run_tuner(tuner, 10 * core::Second, 100 * core::Millisecond, 0, link_metrics);
+
+    LONGS_EQUAL(MaxTarget, tuner.target_latency());
+}
+
+TEST(latency_tuner, adaptive_losses) {
+    LatencyTuner tuner_no_loss(make_config(), sample_spec);
+    LatencyTuner tuner_loss(make_config(), sample_spec);
+
+    packet::LinkMetrics link_metrics_no_loss;
+    packet::LinkMetrics link_metrics_loss;
+
+    run_tuner(tuner_no_loss, 30 * core::Second, 20 * core::Millisecond, 0,
+              link_metrics_no_loss);
+    run_tuner(tuner_loss, 30 * core::Second, 20 * core::Millisecond, 0.05,
+              link_metrics_loss);
+
+    // losses make target larger
+    CHECK(tuner_loss.target_latency() > tuner_no_loss.target_latency());
+}
+
+TEST(latency_tuner, adaptive_jitter_decay) {
+    LatencyTuner tuner(make_config(), sample_spec);
+
+    packet::LinkMetrics link_metrics;
+
+    run_tuner(tuner, 10 * core::Second, 50 * core::Millisecond, 0, link_metrics);
+    const core::nanoseconds_t grown_target = tuner.target_latency();
+
+    // short period of calm doesn't shrink target immediately
+    run_tuner(tuner, 2 * core::Second, core::Millisecond, 0, link_metrics);
+    CHECK(tuner.target_latency() > grown_target * 9 / 10);
+
+    // long period of calm does
+    run_tuner(tuner, 60 * core::Second, core::Millisecond, 0, link_metrics);
+    CHECK(tuner.target_latency() < grown_target / 2);
+}
+
+TEST(latency_tuner, adaptive_invalid_range) {
+    {
+        LatencyConfig config = make_config();
+        config.min_target_latency = Target * 2;
+
+        LatencyTuner tuner(config, sample_spec);
+        CHECK(!tuner.is_valid());
+    }
+    {
+        LatencyConfig config = make_config();
+        config.max_target_latency = Target / 2;
+
+        LatencyTuner tuner(config, sample_spec);
+        CHECK(!tuner.is_valid());
+    }
+    {
+        LatencyConfig config = make_config();
+        config.tuner_profile = LatencyTunerProfile_Intact;
+
+        LatencyTuner tuner(config, sample_spec);
+        CHECK(!tuner.is_valid());
+    }
+}
+
+TEST(latency_tuner, fast_start) {
+    const core::nanoseconds_t StartLatency = 20 * core::Millisecond;
+
+    LatencyConfig config = make_config();
+    config.enable_adaptive_target = false;
+    config.latency_tolerance = 30 * core::Millisecond;
+    config.start_latency = StartLatency;
+    config.deduce_defaults(Target, true);
+
+    CHECK(config.start_scaling_tolerance > config.scaling_tolerance);
+    CHECK(config.start_scaling_tolerance <= 0.01f);
+
+    LatencyTuner tuner(config, sample_spec);
+    CHECK(tuner.is_valid());
+    CHECK(tuner.is_starting());
+
+    double latency = (double)sample_spec.ns_2_stream_timestamp(StartLatency);
+    float scaling = 1, min_scaling = 1, max_scaling = 1;
+
+    // latency is below lower bound, but session is not terminated, and
+    // playback is slowed down to maximum allowed amount
+    run_queue(tuner, core::Second, latency, scaling, min_scaling, max_scaling);
+
+    CHECK(tuner.is_starting());
+    DOUBLES_EQUAL(1 - config.start_scaling_tolerance, min_scaling, 1e-6);
+    DOUBLES_EQUAL(1, max_scaling, 1e-6);
+    // by default, one second of playback adds 1% of a second to latency
+    DOUBLES_EQUAL((double)(StartLatency + 10 * core::Millisecond),
+                  (double)sample_spec.samples_per_chan_2_ns((size_t)latency),
+                  (double)core::Millisecond);
+
+    // latency reaches target, and tuner switches to regular tuning
+    run_queue(tuner, 10 * core::Second, latency, scaling, min_scaling, max_scaling);
+
+    CHECK(!tuner.is_starting());
+    DOUBLES_EQUAL((double)Target,
+                  (double)sample_spec.samples_per_chan_2_ns((size_t)latency),
+                  (double)core::Millisecond * 5);
+
+    // after fast start, scaling is within regular bounds
+    min_scaling = max_scaling = scaling;
+    run_queue(tuner, 10 * core::Second, latency, scaling, min_scaling, max_scaling);
+
+    CHECK(min_scaling >= 1 - config.scaling_tolerance - 1e-6f);
+    CHECK(max_scaling <= 1 + config.scaling_tolerance + 1e-6f);
+    DOUBLES_EQUAL((double)Target,
+                  (double)sample_spec.samples_per_chan_2_ns((size_t)latency),
+                  (double)core::Millisecond * 5);
+}
+
+TEST(latency_tuner, fast_start_disabled) {
+    LatencyConfig config = make_config();
+    config.enable_adaptive_target = false;
+    config.latency_tolerance = 30 * core::Millisecond;
+
+    LatencyTuner tuner(config, sample_spec);
+    CHECK(tuner.is_valid());
+    CHECK(!tuner.is_starting());
+
+    // without fast start, latency below lower bound terminates session
+    LatencyMetrics latency_metrics;
+    latency_metrics.niq_latency = 20 * core::Millisecond;
+
+    tuner.write_metrics(latency_metrics, packet::LinkMetrics());
+    CHECK(!tuner.update_stream());
+}
+
+TEST(latency_tuner, fast_start_invalid) {
+    { // start latency larger than target
+        LatencyConfig config = make_config();
+        config.start_latency = Target * 2;
+        config.deduce_defaults(Target, true);
+
+        LatencyTuner tuner(config, sample_spec);
+        CHECK(!tuner.is_valid());
+    }
+    { // negative start latency
+        LatencyConfig config = make_config();
+        config.start_latency = -1;
+        config.deduce_defaults(Target, true);
+
+        LatencyTuner tuner(config, sample_spec);
+        CHECK(!tuner.is_valid());
+    }
+    { // latency tuning disabled
+        LatencyConfig config = make_config();
+        config.enable_adaptive_target = false;
+        config.tuner_profile = LatencyTunerProfile_Intact;
+        config.start_latency = Target / 2;
+        config.start_scaling_tolerance = 0.05f;
+
+        LatencyTuner tuner(config, sample_spec);
+        CHECK(!tuner.is_valid());
+    }
+}
+
+} // namespace audio
+} // namespace roc
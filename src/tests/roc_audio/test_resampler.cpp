@@ -768,6 +768,62 @@ TEST(resampler, reader_timestamp_passthrough) {
     }
 }
 
+// Tests that resampler reader continues reading stream after its resampler is
+// replaced with another one, with another backend and profile.
+TEST(resampler, reader_switch_resampler) {
+    enum { ChMask = 0x3, FrameLen = 178, NumIterations = 20 };
+
+    const SampleSpec in_spec(44100, Sample_RawFormat, ChanLayout_Surround,
+                             ChanOrder_Smpte, ChMask);
+    const SampleSpec out_spec(48000, Sample_RawFormat, ChanLayout_Surround,
+                              ChanOrder_Smpte, ChMask);
+
+    for (size_t n_back1 = 0; n_back1 < ResamplerMap::instance().num_backends();
+         n_back1++) {
+        for (size_t n_back2 = 0; n_back2 < ResamplerMap::instance().num_backends();
+             n_back2++) {
+            core::SharedPtr<IResampler> resampler1 =
+                ResamplerMap::instance().new_resampler(
+                    arena, frame_factory,
+                    make_config(ResamplerMap::instance().nth_backend(n_back1),
+                                ResamplerProfile_High),
+                    in_spec, out_spec);
+            CHECK(resampler1);
+
+            core::SharedPtr<IResampler> resampler2 =
+                ResamplerMap::instance().new_resampler(
+                    arena, frame_factory,
+                    make_config(ResamplerMap::instance().nth_backend(n_back2),
+                                ResamplerProfile_Low),
+                    in_spec, out_spec);
+            CHECK(resampler2);
+
+            test::MockReader input_reader;
+            input_reader.enable_timestamps(1691499037871419405, in_spec);
+            input_reader.add_zero_samples();
+
+            ResamplerReader rreader(input_reader, *resampler1, in_spec, out_spec);
+            CHECK(rreader.is_valid());
+            CHECK(rreader.set_scaling(0.99f));
+
+            sample_t samples[FrameLen] = {};
+            core::nanoseconds_t last_cts = 0;
+
+            for (size_t i = 0; i < NumIterations * 2; i++) {
+                if (i == NumIterations) {
+                    CHECK(rreader.set_resampler(*resampler2));
+                }
+
+                Frame frame(samples, ROC_ARRAY_SIZE(samples));
+                CHECK(rreader.read(frame));
+
+                CHECK(frame.capture_timestamp() > last_cts);
+                last_cts = frame.capture_timestamp();
+            }
+        }
+    }
+}
+
 // Tests resampler writer ability to pass through capture timestamps of frames.
 // It copies the method from the same test for resampler reader.
 TEST(resampler, writer_timestamp_passthrough) {
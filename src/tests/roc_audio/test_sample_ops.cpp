@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_audio/sample_ops.h"
+#include "roc_core/cpu_features.h"
+#include "roc_core/fast_random.h"
+
+namespace roc {
+namespace audio {
+
+namespace {
+
+enum { MaxSize = 100, MaxOffset = 8 };
+
+const double Epsilon = 1e-6;
+
+sample_t random_sample() {
+    // cover range wider than [-1; 1] to check saturation
+    return (sample_t)core::fast_random_range(0, 3000) / 1000.f - 1.5f;
+}
+
+} // namespace
+
+TEST_GROUP(sample_ops) {
+    core::CpuIsa saved_isa;
+
+    void setup() {
+        saved_isa = core::CpuFeatures::instance().max_isa();
+    }
+
+    void teardown() {
+        core::CpuFeatures::instance().set_max_isa(saved_isa);
+    }
+};
+
+TEST(sample_ops, mix_samples) {
+    sample_t src[MaxSize + MaxOffset];
+    sample_t dst[MaxSize + MaxOffset];
+    sample_t expected[MaxSize + MaxOffset];
+
+    core::CpuFeatures& cpu_features = core::CpuFeatures::instance();
+
+    // check every kernel supported by CPU
+    for (int isa = 0; isa < core::CpuIsa_Max; isa++) {
+        if (!cpu_features.is_detected((core::CpuIsa)isa)) {
+            continue;
+        }
+        cpu_features.set_max_isa((core::CpuIsa)isa);
+
+        for (size_t size = 0; size <= MaxSize; size += 3) {
+            for (size_t offset = 0; offset < MaxOffset; offset += 3) {
+                for (size_t i = 0; i < MaxSize + MaxOffset; i++) {
+                    src[i] = random_sample();
+                    dst[i] = expected[i] = random_sample();
+                }
+                for (size_t i = 0; i < size; i++) {
+                    expected[offset + i] += src[i];
+                    expected[offset + i] = std::min(expected[offset + i], Sample_Max);
+                    expected[offset + i] = std::max(expected[offset + i], Sample_Min);
+                }
+
+                mix_samples(dst + offset, src, size);
+
+                for (size_t i = 0; i < MaxSize + MaxOffset; i++) {
+                    DOUBLES_EQUAL(expected[i], dst[i], Epsilon);
+                }
+            }
+        }
+    }
+}
+
+} // namespace audio
+} // namespace roc
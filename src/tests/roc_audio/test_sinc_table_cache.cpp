@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_audio/builtin_resampler.h"
+#include "roc_audio/frame_factory.h"
+#include "roc_audio/sinc_table.h"
+#include "roc_audio/sinc_table_cache.h"
+#include "roc_core/heap_arena.h"
+
+namespace roc {
+namespace audio {
+
+namespace {
+
+enum { MaxBufSize = 4000 };
+
+core::HeapArena arena;
+FrameFactory frame_factory(arena, MaxBufSize * sizeof(sample_t));
+
+} // namespace
+
+TEST_GROUP(sinc_table_cache) {};
+
+TEST(sinc_table_cache, table_contents) {
+    enum { WindowSize = 4, WindowInterp = 8 };
+
+    core::SharedPtr<SincTable> table_ptr =
+        new (arena) SincTable(arena, WindowSize, WindowInterp);
+    CHECK(table_ptr);
+    CHECK(table_ptr->is_valid());
+
+    const SincTable& table = *table_ptr;
+
+    UNSIGNED_LONGS_EQUAL(WindowSize * WindowInterp + 2, table.size());
+    UNSIGNED_LONGS_EQUAL(0, (size_t)table.data() % 64);
+
+    DOUBLES_EQUAL(1.0, (double)table.data()[0], 0.0);
+
+    // sinc(n) is zero for integer n
+    for (size_t n = 1; n < WindowSize; n++) {
+        DOUBLES_EQUAL(0.0, (double)table.data()[n * WindowInterp], 1e-6);
+    }
+
+    DOUBLES_EQUAL(0.0, (double)table.data()[table.size() - 2], 0.0);
+    DOUBLES_EQUAL(0.0, (double)table.data()[table.size() - 1], 0.0);
+}
+
+TEST(sinc_table_cache, same_params) {
+    core::SharedPtr<SincTable> table1 = SincTableCache::instance().get_table(16, 64);
+    core::SharedPtr<SincTable> table2 = SincTableCache::instance().get_table(16, 64);
+
+    CHECK(table1);
+    CHECK(table2);
+    CHECK(table1 == table2);
+
+    UNSIGNED_LONGS_EQUAL(16, table1->window_size());
+    UNSIGNED_LONGS_EQUAL(64, table1->window_interp());
+}
+
+TEST(sinc_table_cache, different_params) {
+    core::SharedPtr<SincTable> table1 = SincTableCache::instance().get_table(16, 64);
+    core::SharedPtr<SincTable> table2 = SincTableCache::instance().get_table(32, 64);
+    core::SharedPtr<SincTable> table3 = SincTableCache::instance().get_table(16, 128);
+
+    CHECK(table1);
+    CHECK(table2);
+    CHECK(table3);
+
+    CHECK(table1 != table2);
+    CHECK(table1 != table3);
+    CHECK(table2 != table3);
+}
+
+TEST(sinc_table_cache, eviction) {
+    enum { NumIters = 100 };
+
+    // tables not used by anyone are evicted when cache is full
+    for (size_t n = 0; n < NumIters; n++) {
+        core::SharedPtr<SincTable> table =
+            SincTableCache::instance().get_table(2, 1 << (n % 10));
+        CHECK(table);
+    }
+}
+
+TEST(sinc_table_cache, shared_by_resamplers) {
+    const SampleSpec in_spec(44100, Sample_RawFormat, ChanLayout_Surround,
+                             ChanOrder_Smpte, ChanMask_Surround_Stereo);
+    const SampleSpec out_spec(48000, Sample_RawFormat, ChanLayout_Surround,
+                              ChanOrder_Smpte, ChanMask_Surround_Stereo);
+
+    BuiltinResampler resampler1(arena, frame_factory, ResamplerProfile_Medium, in_spec,
+                                out_spec);
+    CHECK(resampler1.is_valid());
+
+    const size_t num_tables = SincTableCache::instance().num_tables();
+
+    BuiltinResampler resampler2(arena, frame_factory, ResamplerProfile_Medium, in_spec,
+                                out_spec);
+    CHECK(resampler2.is_valid());
+
+    UNSIGNED_LONGS_EQUAL(num_tables, SincTableCache::instance().num_tables());
+}
+
+} // namespace audio
+} // namespace roc
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_audio/plc_map.h"
+#include "roc_audio/wsola_plc.h"
+#include "roc_core/scoped_ptr.h"
+#include "roc_core/heap_arena.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace audio {
+
+namespace {
+
+enum {
+    SampleRate = 48000,
+    NumCh = 2,
+    ChMask = 0x3,
+
+    // 10ms
+    FrameSize = 480,
+
+    // 200 Hz
+    SinePeriod = SampleRate / 200
+};
+
+const SampleSpec sample_spec(
+    SampleRate, Sample_RawFormat, ChanLayout_Surround, ChanOrder_Smpte, ChMask);
+
+core::HeapArena arena;
+
+sample_t sine(size_t pos) {
+    return (sample_t)(0.5 * std::sin(2 * M_PI * (double)pos / SinePeriod));
+}
+
+// Fill frame with sine, starting from given position.
+void fill_sine(sample_t* buf, size_t pos, size_t n_frames) {
+    for (size_t n = 0; n < n_frames; n++) {
+        for (size_t c = 0; c < NumCh; c++) {
+            buf[n * NumCh + c] = sine(pos + n);
+        }
+    }
+}
+
+double max_abs(const sample_t* buf, size_t n_frames) {
+    double ret = 0;
+    for (size_t n = 0; n < n_frames * NumCh; n++) {
+        ret = std::max(ret, std::fabs((double)buf[n]));
+    }
+    return ret;
+}
+
+// Feed PLC with given number of frames of sine.
+void feed_sine(WsolaPlc& plc, size_t& pos, size_t n_frames) {
+    sample_t buf[FrameSize * NumCh];
+
+    for (size_t n = 0; n < n_frames; n++) {
+        fill_sine(buf, pos, FrameSize);
+        plc.process_history(buf, FrameSize * NumCh);
+        pos += FrameSize;
+    }
+}
+
+} // namespace
+
+TEST_GROUP(wsola_plc) {};
+
+TEST(wsola_plc, no_history) {
+    WsolaPlc plc(sample_spec, arena);
+    CHECK(plc.is_valid());
+
+    sample_t buf[FrameSize * NumCh];
+    for (size_t n = 0; n < FrameSize * NumCh; n++) {
+        buf[n] = 1;
+    }
+
+    // not enough history, gap is filled with silence
+    UNSIGNED_LONGS_EQUAL(0, plc.process_loss(buf, FrameSize * NumCh));
+    DOUBLES_EQUAL(0, max_abs(buf, FrameSize), 0);
+}
+
+TEST(wsola_plc, periodic_continuation) {
+    WsolaPlc plc(sample_spec, arena);
+    CHECK(plc.is_valid());
+
+    size_t pos = 0;
+    feed_sine(plc, pos, 10);
+
+    // first 10ms of gap is at full volume and close to real continuation
+    sample_t buf[FrameSize * NumCh];
+    UNSIGNED_LONGS_EQUAL(FrameSize * NumCh, plc.process_loss(buf, FrameSize * NumCh));
+
+    for (size_t n = 0; n < FrameSize; n++) {
+        for (size_t c = 0; c < NumCh; c++) {
+            DOUBLES_EQUAL((double)sine(pos + n), (double)buf[n * NumCh + c], 0.01);
+        }
+    }
+}
+
+TEST(wsola_plc, fade_out) {
+    WsolaPlc plc(sample_spec, arena);
+    CHECK(plc.is_valid());
+
+    size_t pos = 0;
+    feed_sine(plc, pos, 10);
+
+    sample_t buf[FrameSize * NumCh];
+    double prev_level = 1;
+
+    // gap is faded out during first 60ms
+    for (size_t n = 0; n < 6; n++) {
+        UNSIGNED_LONGS_EQUAL(FrameSize * NumCh, plc.process_loss(buf, FrameSize * NumCh));
+
+        const double level = max_abs(buf, FrameSize);
+        CHECK(level > 0);
+        CHECK(level <= prev_level);
+        prev_level = level;
+    }
+
+    // and then is filled with silence
+    for (size_t n = 0; n < 3; n++) {
+        UNSIGNED_LONGS_EQUAL(0, plc.process_loss(buf, FrameSize * NumCh));
+        DOUBLES_EQUAL(0, max_abs(buf, FrameSize), 0);
+    }
+}
+
+TEST(wsola_plc, cross_fade) {
+    WsolaPlc plc(sample_spec, arena);
+    CHECK(plc.is_valid());
+
+    size_t pos = 0;
+    feed_sine(plc, pos, 10);
+
+    // short gap
+    sample_t buf[FrameSize * NumCh];
+    plc.process_loss(buf, FrameSize * NumCh);
+    pos += FrameSize;
+
+    // real signal after gap: inverted sine
+    for (size_t n = 0; n < FrameSize; n++) {
+        for (size_t c = 0; c < NumCh; c++) {
+            buf[n * NumCh + c] = -sine(pos + n);
+        }
+    }
+    plc.process_history(buf, FrameSize * NumCh);
+
+    // beginning is cross-faded with continuation of synthesized signal,
+    // so there is no jump from synthesized to inverted signal
+    CHECK(std::fabs((double)buf[0] - (double)sine(pos)) < 0.05);
+
+    // after cross-fade (4ms), real signal is not modified
+    for (size_t n = SampleRate / 250; n < FrameSize; n++) {
+        for (size_t c = 0; c < NumCh; c++) {
+            DOUBLES_EQUAL(-(double)sine(pos + n), (double)buf[n * NumCh + c], 0);
+        }
+    }
+}
+
+TEST(wsola_plc, silence) {
+    WsolaPlc plc(sample_spec, arena);
+    CHECK(plc.is_valid());
+
+    sample_t buf[FrameSize * NumCh] = {};
+    for (size_t n = 0; n < 10; n++) {
+        plc.process_history(buf, FrameSize * NumCh);
+    }
+
+    // silence is continued with silence
+    plc.process_loss(buf, FrameSize * NumCh);
+    DOUBLES_EQUAL(0, max_abs(buf, FrameSize), 0);
+}
+
+TEST(wsola_plc, plc_map) {
+    CHECK(PlcMap::instance().is_supported(PlcBackend_Wsola));
+    CHECK(!PlcMap::instance().is_supported(PlcBackend_None));
+
+    PlcConfig config;
+    config.backend = PlcBackend_Wsola;
+
+    core::ScopedPtr<IPlc> plc(PlcMap::instance().new_plc(arena, config, sample_spec),
+                              arena);
+    CHECK(plc);
+    CHECK(plc->is_valid());
+
+    size_t pos = 0;
+    sample_t buf[FrameSize * NumCh];
+
+    for (size_t n = 0; n < 10; n++) {
+        fill_sine(buf, pos, FrameSize);
+        plc->process_history(buf, FrameSize * NumCh);
+        pos += FrameSize;
+    }
+
+    // enough history, gap is synthesized
+    UNSIGNED_LONGS_EQUAL(FrameSize * NumCh, plc->process_loss(buf, FrameSize * NumCh));
+}
+
+} // namespace audio
+} // namespace roc
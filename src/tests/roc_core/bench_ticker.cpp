@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "roc_core/atomic.h"
+#include "roc_core/cpu_instructions.h"
+#include "roc_core/thread.h"
+#include "roc_core/ticker.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace core {
+namespace {
+
+// Measures how precisely ticker wakes up at frame boundaries, with and without
+// precise mode, while other threads are hogging CPU.
+//
+// Arguments:
+//  precise - 0 to use regular sleep, 1 to use sleep + spin
+//  threads - number of background threads burning CPU
+//
+// Output columns:
+//  avg_err_us - average delay of wakeup after deadline, in microseconds
+//  max_err_us - maximum delay of wakeup after deadline, in microseconds
+//  over_64us  - fraction of wakeups delayed by 64us or more
+
+enum { Freq = 1000, NumIterations = 2000, MaxThreads = 4 };
+
+class BusyThread : public Thread {
+public:
+    BusyThread()
+        : stop_(0) {
+    }
+
+    void stop() {
+        stop_ = 1;
+    }
+
+private:
+    virtual void run() {
+        while (!stop_) {
+            cpu_relax();
+        }
+    }
+
+    Atomic<int> stop_;
+};
+
+void BM_Ticker_Jitter(benchmark::State& state) {
+    const bool precise = state.range(0) != 0;
+    const size_t n_threads = (size_t)state.range(1);
+
+    BusyThread threads[MaxThreads];
+    for (size_t n = 0; n < n_threads; n++) {
+        roc_panic_if(!threads[n].start());
+    }
+
+    TickerConfig config;
+    config.enable_precise = precise;
+    if (precise) {
+        config.timer_slack = Microsecond;
+    }
+
+    Ticker ticker(Freq, config);
+    Ticker::ticks_t ts = 0;
+
+    while (state.KeepRunning()) {
+        ticker.wait(ts);
+        ts++;
+    }
+
+    for (size_t n = 0; n < n_threads; n++) {
+        threads[n].stop();
+        threads[n].join();
+    }
+
+    const TickerMetrics& metrics = ticker.metrics();
+
+    uint64_t n_over_64us = 0;
+    for (size_t n = 7; n < TickerMetrics::NumBuckets; n++) {
+        n_over_64us += metrics.wakeup_error_histogram[n];
+    }
+
+    const double n_wakeups = metrics.wakeups ? (double)metrics.wakeups : 1.;
+
+    state.counters["avg_err_us"] =
+        (double)metrics.total_wakeup_error / n_wakeups / Microsecond;
+    state.counters["max_err_us"] = (double)metrics.max_wakeup_error / Microsecond;
+    state.counters["over_64us"] = (double)n_over_64us / n_wakeups;
+}
+
+BENCHMARK(BM_Ticker_Jitter)
+    ->ArgPair(0, 0)
+    ->ArgPair(1, 0)
+    ->ArgPair(0, 2)
+    ->ArgPair(1, 2)
+    ->ArgPair(0, 4)
+    ->ArgPair(1, 4)
+    ->Iterations(NumIterations)
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace
+} // namespace core
+} // namespace roc
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/cpu_dispatch.h"
+#include "roc_core/cpu_features.h"
+#include "roc_core/macro_helpers.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+typedef int (*TestFunc)();
+
+int func_generic() {
+    return 1;
+}
+
+int func_sse2() {
+    return 2;
+}
+
+int func_avx2() {
+    return 3;
+}
+
+int func_neon() {
+    return 4;
+}
+
+const CpuKernel<TestFunc> test_kernels[] = {
+    { CpuIsa_AVX2, func_avx2 },
+    { CpuIsa_SSE2, func_sse2 },
+    { CpuIsa_NEON, func_neon },
+    { CpuIsa_Generic, func_generic },
+};
+
+bool is_x86(int isa) {
+    return isa >= CpuIsa_SSE2 && isa <= CpuIsa_AVX2;
+}
+
+// Limit applies only to levels of the same architecture.
+bool is_allowed(int isa, int max_isa) {
+    if (isa == CpuIsa_Generic) {
+        return true;
+    }
+    if (max_isa == CpuIsa_Generic) {
+        return false;
+    }
+    if (is_x86(isa) != is_x86(max_isa)) {
+        return true;
+    }
+    return isa <= max_isa;
+}
+
+int expected_func(CpuIsa max_isa) {
+    CpuFeatures& features = CpuFeatures::instance();
+
+    if (features.is_detected(CpuIsa_AVX2) && is_allowed(CpuIsa_AVX2, max_isa)) {
+        return 3;
+    }
+    if (features.is_detected(CpuIsa_SSE2) && is_allowed(CpuIsa_SSE2, max_isa)) {
+        return 2;
+    }
+    if (features.is_detected(CpuIsa_NEON) && is_allowed(CpuIsa_NEON, max_isa)) {
+        return 4;
+    }
+    return 1;
+}
+
+} // namespace
+
+TEST_GROUP(cpu_features) {
+    CpuIsa saved_isa;
+
+    void setup() {
+        saved_isa = CpuFeatures::instance().max_isa();
+    }
+
+    void teardown() {
+        CpuFeatures::instance().set_max_isa(saved_isa);
+    }
+};
+
+TEST(cpu_features, isa_names) {
+    for (int n = 0; n < CpuIsa_Max; n++) {
+        CpuIsa isa = CpuIsa_Max;
+        CHECK(parse_cpu_isa(cpu_isa_to_str((CpuIsa)n), isa));
+        LONGS_EQUAL(n, isa);
+    }
+
+    STRCMP_EQUAL("generic", cpu_isa_to_str(CpuIsa_Generic));
+    STRCMP_EQUAL("sse4.1", cpu_isa_to_str(CpuIsa_SSE41));
+    STRCMP_EQUAL("<invalid>", cpu_isa_to_str(CpuIsa_Max));
+
+    CpuIsa isa = CpuIsa_AVX;
+    CHECK(!parse_cpu_isa("", isa));
+    CHECK(!parse_cpu_isa("avx512", isa));
+    CHECK(!parse_cpu_isa(NULL, isa));
+    LONGS_EQUAL(CpuIsa_AVX, isa);
+}
+
+TEST(cpu_features, generic) {
+    CpuFeatures& features = CpuFeatures::instance();
+
+    CHECK(features.is_detected(CpuIsa_Generic));
+    CHECK(features.is_enabled(CpuIsa_Generic));
+
+    features.set_max_isa(CpuIsa_Generic);
+
+    LONGS_EQUAL(CpuIsa_Generic, features.max_isa());
+    CHECK(features.is_enabled(CpuIsa_Generic));
+
+    for (int n = CpuIsa_Generic + 1; n < CpuIsa_Max; n++) {
+        CHECK(!features.is_enabled((CpuIsa)n));
+    }
+}
+
+TEST(cpu_features, max_isa) {
+    CpuFeatures& features = CpuFeatures::instance();
+
+    for (int max = 0; max < CpuIsa_Max; max++) {
+        features.set_max_isa((CpuIsa)max);
+
+        for (int n = 0; n < CpuIsa_Max; n++) {
+            CHECK_EQUAL(features.is_detected((CpuIsa)n) && is_allowed(n, max),
+                        features.is_enabled((CpuIsa)n));
+        }
+    }
+}
+
+TEST(cpu_features, other_arch) {
+    CpuFeatures& features = CpuFeatures::instance();
+
+    // x86 limit doesn't affect ARM levels
+    features.set_max_isa(CpuIsa_SSE2);
+
+    CHECK_EQUAL(features.is_detected(CpuIsa_NEON), features.is_enabled(CpuIsa_NEON));
+    CHECK(!features.is_enabled(CpuIsa_AVX2));
+
+    // ARM limit doesn't affect x86 levels
+    features.set_max_isa(CpuIsa_NEON);
+
+    for (int n = CpuIsa_SSE2; n <= CpuIsa_AVX2; n++) {
+        CHECK_EQUAL(features.is_detected((CpuIsa)n), features.is_enabled((CpuIsa)n));
+    }
+}
+
+TEST(cpu_features, generation) {
+    CpuFeatures& features = CpuFeatures::instance();
+
+    features.set_max_isa(CpuIsa_NEON);
+    const unsigned gen = features.generation();
+
+    // same value, no change
+    features.set_max_isa(CpuIsa_NEON);
+    UNSIGNED_LONGS_EQUAL(gen, features.generation());
+
+    features.set_max_isa(CpuIsa_Generic);
+    UNSIGNED_LONGS_EQUAL(gen + 1, features.generation());
+
+    features.set_max_isa(CpuIsa_NEON);
+    UNSIGNED_LONGS_EQUAL(gen + 2, features.generation());
+}
+
+TEST(cpu_features, dispatch) {
+    CpuFeatures& features = CpuFeatures::instance();
+
+    CpuDispatcher<TestFunc> dispatcher("test", test_kernels,
+                                       ROC_ARRAY_SIZE(test_kernels));
+
+    // go down and up, kernel should be re-selected every time
+    const CpuIsa isa_list[] = {
+        CpuIsa_NEON, CpuIsa_AVX2, CpuIsa_AVX, CpuIsa_SSE2,
+        CpuIsa_Generic, CpuIsa_SSE41, CpuIsa_NEON,
+    };
+
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(isa_list); n++) {
+        features.set_max_isa(isa_list[n]);
+
+        LONGS_EQUAL(expected_func(isa_list[n]), dispatcher.get()());
+        LONGS_EQUAL(expected_func(isa_list[n]), dispatcher.get()());
+
+        CHECK(features.is_enabled(dispatcher.isa()));
+    }
+
+    features.set_max_isa(CpuIsa_Generic);
+
+    LONGS_EQUAL(1, dispatcher.get()());
+    LONGS_EQUAL(CpuIsa_Generic, dispatcher.isa());
+}
+
+} // namespace core
+} // namespace roc
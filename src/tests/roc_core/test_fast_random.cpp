@@ -38,5 +38,29 @@ TEST(fast_random, limits) {
     CHECK(1 <= res && res <= 100);
 }
 
+TEST(fast_random, seeded) {
+    uint32_t state1 = 123;
+    uint32_t state2 = 123;
+    uint32_t state3 = 456;
+
+    bool all_same = true;
+
+    for (size_t n = 0; n < 100; n++) {
+        const uint32_t res1 = fast_random_seeded(state1);
+        const uint32_t res2 = fast_random_seeded(state2);
+        const uint32_t res3 = fast_random_seeded(state3);
+
+        // same seed produces same sequence
+        UNSIGNED_LONGS_EQUAL(res1, res2);
+
+        if (res1 != res3) {
+            all_same = false;
+        }
+    }
+
+    // different seed produces different sequence
+    CHECK(!all_same);
+}
+
 } // namespace core
 } // namespace roc
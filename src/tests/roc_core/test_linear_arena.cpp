@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/align_ops.h"
+#include "roc_core/heap_arena.h"
+#include "roc_core/linear_arena.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+enum { ChunkSize = 1024 };
+
+bool is_aligned(void* ptr) {
+    return (size_t)ptr % AlignOps::max_alignment() == 0;
+}
+
+} // namespace
+
+TEST_GROUP(linear_arena) {};
+
+TEST(linear_arena, allocate_deallocate) {
+    HeapArena heap_arena;
+
+    {
+        LinearArena arena(heap_arena, ChunkSize);
+
+        void* ptr1 = arena.allocate(10);
+        void* ptr2 = arena.allocate(100);
+
+        CHECK(ptr1);
+        CHECK(ptr2);
+        CHECK(ptr1 != ptr2);
+
+        CHECK(is_aligned(ptr1));
+        CHECK(is_aligned(ptr2));
+
+        CHECK_EQUAL(2, arena.num_allocations());
+        CHECK_EQUAL(1, arena.num_chunks());
+        CHECK_EQUAL(1, heap_arena.num_allocations());
+
+        arena.deallocate(ptr1);
+        arena.deallocate(ptr2);
+
+        CHECK_EQUAL(0, arena.num_allocations());
+        CHECK_EQUAL(1, arena.num_chunks());
+    }
+
+    CHECK_EQUAL(0, heap_arena.num_allocations());
+}
+
+TEST(linear_arena, allocated_size) {
+    HeapArena heap_arena;
+    LinearArena arena(heap_arena, ChunkSize);
+
+    void* ptr = arena.allocate(100);
+    CHECK(ptr);
+
+    CHECK(arena.compute_allocated_size(100) >= 100);
+    CHECK_EQUAL(arena.compute_allocated_size(100), arena.allocated_size(ptr));
+
+    arena.deallocate(ptr);
+}
+
+TEST(linear_arena, multiple_chunks) {
+    HeapArena heap_arena;
+    LinearArena arena(heap_arena, ChunkSize);
+
+    void* ptrs[10];
+
+    for (size_t n = 0; n < 10; n++) {
+        ptrs[n] = arena.allocate(ChunkSize / 2);
+        CHECK(ptrs[n]);
+        CHECK(is_aligned(ptrs[n]));
+    }
+
+    CHECK_EQUAL(10, arena.num_chunks());
+    CHECK_EQUAL(10, heap_arena.num_allocations());
+
+    for (size_t n = 0; n < 10; n++) {
+        arena.deallocate(ptrs[n]);
+    }
+}
+
+TEST(linear_arena, large_block) {
+    HeapArena heap_arena;
+    LinearArena arena(heap_arena, ChunkSize);
+
+    void* ptr = arena.allocate(ChunkSize * 4);
+    CHECK(ptr);
+
+    CHECK_EQUAL(1, arena.num_chunks());
+
+    arena.deallocate(ptr);
+}
+
+TEST(linear_arena, rewind) {
+    HeapArena heap_arena;
+    LinearArena arena(heap_arena, ChunkSize);
+
+    void* ptrs[10];
+
+    for (size_t n = 0; n < 10; n++) {
+        ptrs[n] = arena.allocate(ChunkSize / 2);
+        CHECK(ptrs[n]);
+    }
+    for (size_t n = 0; n < 10; n++) {
+        arena.deallocate(ptrs[n]);
+    }
+
+    CHECK_EQUAL(10, arena.num_chunks());
+
+    for (size_t iter = 0; iter < 5; iter++) {
+        arena.rewind();
+
+        // Same allocations reuse same chunks and memory.
+        for (size_t n = 0; n < 10; n++) {
+            void* ptr = arena.allocate(ChunkSize / 2);
+            CHECK(ptr == ptrs[n]);
+        }
+        for (size_t n = 0; n < 10; n++) {
+            arena.deallocate(ptrs[n]);
+        }
+
+        CHECK_EQUAL(10, arena.num_chunks());
+        CHECK_EQUAL(10, heap_arena.num_allocations());
+    }
+}
+
+TEST(linear_arena, rewind_and_grow) {
+    HeapArena heap_arena;
+    LinearArena arena(heap_arena, ChunkSize);
+
+    void* ptr = arena.allocate(ChunkSize / 2);
+    CHECK(ptr);
+    arena.deallocate(ptr);
+
+    CHECK_EQUAL(1, arena.num_chunks());
+
+    arena.rewind();
+
+    // Doesn't fit into existing chunk.
+    ptr = arena.allocate(ChunkSize * 2);
+    CHECK(ptr);
+    arena.deallocate(ptr);
+
+    CHECK_EQUAL(2, arena.num_chunks());
+
+    arena.rewind();
+
+    // Fits into first chunk.
+    ptr = arena.allocate(ChunkSize / 2);
+    CHECK(ptr);
+    arena.deallocate(ptr);
+
+    CHECK_EQUAL(2, arena.num_chunks());
+}
+
+} // namespace core
+} // namespace roc
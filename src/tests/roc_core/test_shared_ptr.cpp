@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/list.h"
+#include "roc_core/mpsc_queue.h"
+#include "roc_core/ref_counted.h"
+#include "roc_core/shared_ptr.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+struct NoAllocation {
+    template <class T> void destroy(T&) {
+    }
+};
+
+struct Object : RefCounted<Object, NoAllocation>, ListNode<>, MpscQueueNode<> {};
+
+typedef SharedPtr<Object> ObjectPtr;
+
+} // namespace
+
+TEST_GROUP(shared_ptr) {};
+
+TEST(shared_ptr, copy) {
+    Object obj;
+
+    {
+        ObjectPtr a(&obj);
+        LONGS_EQUAL(1, obj.getref());
+
+        ObjectPtr b(a);
+        LONGS_EQUAL(2, obj.getref());
+
+        b = NULL;
+        LONGS_EQUAL(1, obj.getref());
+    }
+
+    LONGS_EQUAL(0, obj.getref());
+}
+
+TEST(shared_ptr, swap) {
+    Object obj1;
+    Object obj2;
+
+    ObjectPtr a(&obj1);
+    ObjectPtr b(&obj2);
+
+    a.swap(b);
+
+    POINTERS_EQUAL(&obj2, a.get());
+    POINTERS_EQUAL(&obj1, b.get());
+
+    LONGS_EQUAL(1, obj1.getref());
+    LONGS_EQUAL(1, obj2.getref());
+}
+
+TEST(shared_ptr, transfer_to) {
+    { // to empty pointer
+        Object obj;
+
+        ObjectPtr a(&obj);
+        ObjectPtr b;
+
+        a.transfer_to(b);
+
+        CHECK(!a);
+        POINTERS_EQUAL(&obj, b.get());
+        LONGS_EQUAL(1, obj.getref());
+    }
+    { // to non-empty pointer
+        Object obj1;
+        Object obj2;
+
+        ObjectPtr a(&obj1);
+        ObjectPtr b(&obj2);
+
+        a.transfer_to(b);
+
+        CHECK(!a);
+        POINTERS_EQUAL(&obj1, b.get());
+        LONGS_EQUAL(1, obj1.getref());
+        LONGS_EQUAL(0, obj2.getref());
+    }
+    { // to pointer to same object
+        Object obj;
+
+        ObjectPtr a(&obj);
+        ObjectPtr b(&obj);
+        LONGS_EQUAL(2, obj.getref());
+
+        a.transfer_to(b);
+
+        CHECK(!a);
+        POINTERS_EQUAL(&obj, b.get());
+        LONGS_EQUAL(1, obj.getref());
+    }
+    { // to itself
+        Object obj;
+
+        ObjectPtr a(&obj);
+
+        a.transfer_to(a);
+
+        POINTERS_EQUAL(&obj, a.get());
+        LONGS_EQUAL(1, obj.getref());
+    }
+    { // from empty pointer
+        Object obj;
+
+        ObjectPtr a;
+        ObjectPtr b(&obj);
+
+        a.transfer_to(b);
+
+        CHECK(!a);
+        CHECK(!b);
+        LONGS_EQUAL(0, obj.getref());
+    }
+}
+
+TEST(shared_ptr, adopt_disown) {
+    Object obj;
+
+    ObjectPtr a(&obj);
+    LONGS_EQUAL(1, obj.getref());
+
+    Object* raw = a.disown();
+
+    CHECK(!a);
+    POINTERS_EQUAL(&obj, raw);
+    LONGS_EQUAL(1, obj.getref());
+
+    ObjectPtr b;
+    b.adopt(raw);
+
+    POINTERS_EQUAL(&obj, b.get());
+    LONGS_EQUAL(1, obj.getref());
+
+    b.adopt(NULL);
+
+    CHECK(!b);
+    LONGS_EQUAL(0, obj.getref());
+}
+
+TEST(shared_ptr, list_pop) {
+    Object obj1;
+    Object obj2;
+
+    List<Object> list;
+
+    list.push_back(obj1);
+    list.push_back(obj2);
+
+    LONGS_EQUAL(1, obj1.getref());
+    LONGS_EQUAL(1, obj2.getref());
+
+    {
+        // Reference held by list is passed to pointer.
+        ObjectPtr a = list.pop_front();
+        POINTERS_EQUAL(&obj1, a.get());
+        LONGS_EQUAL(1, obj1.getref());
+
+        ObjectPtr b = list.pop_back();
+        POINTERS_EQUAL(&obj2, b.get());
+        LONGS_EQUAL(1, obj2.getref());
+
+        CHECK(list.is_empty());
+    }
+
+    LONGS_EQUAL(0, obj1.getref());
+    LONGS_EQUAL(0, obj2.getref());
+}
+
+TEST(shared_ptr, mpsc_queue_pop) {
+    Object obj;
+
+    MpscQueue<Object> queue;
+
+    queue.push_back(obj);
+    LONGS_EQUAL(1, obj.getref());
+
+    {
+        // Reference held by queue is passed to pointer.
+        ObjectPtr a = queue.pop_front_exclusive();
+        POINTERS_EQUAL(&obj, a.get());
+        LONGS_EQUAL(1, obj.getref());
+
+        CHECK(!queue.pop_front_exclusive());
+    }
+
+    LONGS_EQUAL(0, obj.getref());
+}
+
+} // namespace core
+} // namespace roc
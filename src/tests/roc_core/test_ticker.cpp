@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/thread.h"
+#include "roc_core/ticker.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+enum { Freq = 1000, NumWaits = 20 };
+
+uint64_t histogram_sum(const TickerMetrics& metrics) {
+    uint64_t sum = 0;
+    for (size_t n = 0; n < TickerMetrics::NumBuckets; n++) {
+        sum += metrics.wakeup_error_histogram[n];
+    }
+    return sum;
+}
+
+void check_waits(Ticker& ticker) {
+    const nanoseconds_t start = timestamp(ClockMonotonic);
+
+    for (Ticker::ticks_t ts = 1; ts <= NumWaits; ts++) {
+        ticker.wait(ts);
+
+        // never wakes up before deadline
+        CHECK(timestamp(ClockMonotonic) - start
+              >= nanoseconds_t(ts) * (Second / Freq) - Millisecond);
+    }
+
+    CHECK(ticker.elapsed() >= NumWaits);
+}
+
+} // namespace
+
+TEST_GROUP(ticker) {};
+
+TEST(ticker, wait) {
+    Ticker ticker(Freq);
+
+    check_waits(ticker);
+
+    const TickerMetrics& metrics = ticker.metrics();
+
+    UNSIGNED_LONGS_EQUAL(NumWaits, metrics.wakeups + metrics.overruns);
+    UNSIGNED_LONGS_EQUAL(metrics.wakeups, histogram_sum(metrics));
+    CHECK(metrics.max_wakeup_error >= 0);
+    CHECK(metrics.total_wakeup_error >= metrics.max_wakeup_error);
+}
+
+TEST(ticker, wait_precise) {
+    TickerConfig config;
+    config.enable_precise = true;
+    config.spin_window = 500 * Microsecond;
+    config.timer_slack = Microsecond;
+
+    const nanoseconds_t thread_slack = Thread::get_timer_slack();
+
+    Ticker ticker(Freq, config);
+
+    check_waits(ticker);
+
+    // slack of the calling thread is not changed
+    LONGS_EQUAL(thread_slack, Thread::get_timer_slack());
+
+    const TickerMetrics& metrics = ticker.metrics();
+
+    UNSIGNED_LONGS_EQUAL(NumWaits, metrics.wakeups + metrics.overruns);
+    UNSIGNED_LONGS_EQUAL(metrics.wakeups, histogram_sum(metrics));
+    CHECK(metrics.total_wakeup_error >= metrics.max_wakeup_error);
+}
+
+TEST(ticker, overrun) {
+    Ticker ticker(Freq);
+
+    ticker.start();
+    sleep_for(ClockMonotonic, 5 * Millisecond);
+
+    // deadlines already passed, no sleep
+    ticker.wait(1);
+    ticker.wait(2);
+
+    UNSIGNED_LONGS_EQUAL(0, ticker.metrics().wakeups);
+    UNSIGNED_LONGS_EQUAL(2, ticker.metrics().overruns);
+    UNSIGNED_LONGS_EQUAL(0, histogram_sum(ticker.metrics()));
+}
+
+} // namespace core
+} // namespace roc
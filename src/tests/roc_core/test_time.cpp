@@ -61,5 +61,15 @@ TEST(time, sleep_for) {
     }
 }
 
+TEST(time, thread_cpu_timestamp) {
+    const nanoseconds_t ts = thread_cpu_timestamp();
+
+    while (thread_cpu_timestamp() < ts + Millisecond) {
+        // spin until one millisecond of CPU time is consumed
+    }
+
+    CHECK(thread_cpu_timestamp() >= ts + Millisecond);
+}
+
 } // namespace core
 } // namespace roc
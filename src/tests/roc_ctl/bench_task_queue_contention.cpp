@@ -25,6 +25,14 @@ enum {
 
 const core::nanoseconds_t MaxDelay = 100 * core::Millisecond;
 
+// Far enough to ensure that sleeping tasks are not executed during benchmark.
+const core::nanoseconds_t FarDelay = core::Hour;
+
+core::nanoseconds_t random_far_deadline(core::nanoseconds_t now) {
+    return now + FarDelay
+        + core::fast_random_range(0, FarDelay / core::Millisecond) * core::Millisecond;
+}
+
 class NoopExecutor : public ControlTaskExecutor<NoopExecutor> {
 public:
     class Task : public ControlTask {
@@ -105,6 +113,42 @@ BENCHMARK_REGISTER_F(BM_QueueContention, ScheduleAt)
     ->Iterations(NumScheduleAfterIterations)
     ->Unit(benchmark::kMicrosecond);
 
+// Reschedule sleeping tasks when there are many of them in queue.
+// Measures cost of maintaining sleeping tasks ordered by deadline.
+BENCHMARK_DEFINE_F(BM_QueueContention, RescheduleMany)(benchmark::State& state) {
+    const size_t num_tasks = (size_t)state.range(0);
+
+    NoopExecutor::Task* tasks = new NoopExecutor::Task[num_tasks];
+
+    const core::nanoseconds_t now = core::timestamp(core::ClockMonotonic);
+
+    for (size_t n = 0; n < num_tasks; n++) {
+        queue.schedule_at(tasks[n], random_far_deadline(now), executor, &completer);
+    }
+
+    while (state.KeepRunning()) {
+        const size_t n = core::fast_random_range(0, (uint32_t)num_tasks - 1);
+
+        queue.schedule_at(tasks[n], random_far_deadline(now), executor, &completer);
+    }
+
+    for (size_t n = 0; n < num_tasks; n++) {
+        queue.async_cancel(tasks[n]);
+    }
+    for (size_t n = 0; n < num_tasks; n++) {
+        queue.wait(tasks[n]);
+    }
+
+    delete[] tasks;
+}
+
+BENCHMARK_REGISTER_F(BM_QueueContention, RescheduleMany)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(50000)
+    ->Unit(benchmark::kNanosecond);
+
 } // namespace
 } // namespace ctl
 } // namespace roc
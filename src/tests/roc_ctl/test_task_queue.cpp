@@ -756,6 +756,76 @@ TEST(task_queue, schedule_at_same_deadline) {
     executor.check_all_unblocked();
 }
 
+TEST(task_queue, schedule_at_reschedule_and_cancel_many) {
+    enum { NumTasks = 40 };
+
+    TestExecutor executor;
+
+    ControlTaskQueue queue;
+    CHECK(queue.is_valid());
+
+    UNSIGNED_LONGS_EQUAL(0, executor.num_tasks());
+
+    TestExecutor::Task tasks[NumTasks];
+    core::nanoseconds_t deadlines[NumTasks];
+    bool cancelled[NumTasks];
+
+    for (size_t n = 0; n < NumTasks; n++) {
+        executor.set_nth_result(n, true);
+    }
+
+    const core::nanoseconds_t now = core::timestamp(core::ClockMonotonic);
+    const core::nanoseconds_t base = now + core::Millisecond * 50;
+
+    // schedule in shuffled order
+    for (size_t n = 0; n < NumTasks; n++) {
+        deadlines[n] =
+            base + core::Millisecond * (core::nanoseconds_t)((n * 7) % NumTasks);
+        cancelled[n] = false;
+        queue.schedule_at(tasks[n], deadlines[n], executor, NULL);
+    }
+
+    // move some tasks to the end, and cancel some other
+    for (size_t n = 0; n < NumTasks; n++) {
+        if (n % 5 == 0) {
+            deadlines[n] = base + core::Millisecond * (core::nanoseconds_t)(NumTasks + n);
+            queue.schedule_at(tasks[n], deadlines[n], executor, NULL);
+        } else if (n % 5 == 1) {
+            cancelled[n] = true;
+            queue.async_cancel(tasks[n]);
+        }
+    }
+
+    for (size_t n = 0; n < NumTasks; n++) {
+        queue.wait(tasks[n]);
+    }
+
+    // build expected order of execution
+    size_t expected[NumTasks];
+    size_t n_expected = 0;
+
+    for (size_t n = 0; n < NumTasks; n++) {
+        if (cancelled[n]) {
+            CHECK(tasks[n].cancelled());
+            continue;
+        }
+        CHECK(tasks[n].succeeded());
+
+        size_t pos = n_expected++;
+        while (pos > 0 && deadlines[expected[pos - 1]] > deadlines[n]) {
+            expected[pos] = expected[pos - 1];
+            pos--;
+        }
+        expected[pos] = n;
+    }
+
+    UNSIGNED_LONGS_EQUAL(n_expected, executor.num_tasks());
+
+    for (size_t n = 0; n < n_expected; n++) {
+        CHECK(executor.nth_task(n) == &tasks[expected[n]]);
+    }
+}
+
 TEST(task_queue, schedule_at_and_schedule) {
     TestExecutor executor;
 
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "roc_core/heap_arena.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/panic.h"
+#include "roc_core/scoped_ptr.h"
+#include "roc_fec/codec_map.h"
+#include "roc_fec/composer.h"
+#include "roc_fec/headers.h"
+#include "roc_fec/parser.h"
+#include "roc_fec/reader.h"
+#include "roc_fec/writer.h"
+#include "roc_packet/impairer.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_packet/sorted_queue.h"
+#include "roc_rtp/composer.h"
+#include "roc_rtp/encoding_map.h"
+#include "roc_rtp/headers.h"
+#include "roc_rtp/parser.h"
+
+namespace roc {
+namespace fec {
+namespace {
+
+// Measures how much loss is recovered by FEC, and which network delay
+// packets experience, as a function of network impairment.
+//
+// Sender writes one source packet per tick through FEC writer into impairer,
+// which simulates network. Receiver plays source packets from FEC reader at
+// fixed latency after they were sent; packets that are neither received nor
+// restored by their playback time are counted as lost. Time is simulated,
+// so results don't depend on machine speed.
+//
+// Arguments:
+//  profile   - loss profile, see make_config()
+//  jitter_ms - deviation of normally distributed delay, in milliseconds
+//
+// Output columns:
+//  loss      - fraction of source packets not received in time
+//  recovered - fraction of not received packets restored by FEC
+//  residual  - fraction of source packets lost after FEC
+//  delay_ms  - average network delay
+//  max_ms    - maximum network delay
+
+enum {
+    NumSource = 20,
+    NumRepair = 10,
+    NumPackets = 20000,
+    PayloadSize = 200,
+    MaxBufSize = 500,
+    LatencyTicks = 40
+};
+
+const core::nanoseconds_t Tick = 5 * core::Millisecond;
+const core::nanoseconds_t BaseDelay = 20 * core::Millisecond;
+
+core::HeapArena arena;
+packet::PacketFactory packet_factory(arena, MaxBufSize);
+
+rtp::EncodingMap encoding_map(arena);
+rtp::Parser rtp_parser(encoding_map, NULL);
+rtp::Composer rtp_composer(NULL);
+
+Parser<LDPC_Source_PayloadID, Source, Footer> source_parser(&rtp_parser);
+Parser<LDPC_Repair_PayloadID, Repair, Header> repair_parser(NULL);
+Composer<LDPC_Source_PayloadID, Source, Footer> source_composer(&rtp_composer);
+Composer<LDPC_Repair_PayloadID, Repair, Header> repair_composer(NULL);
+
+packet::ImpairerConfig make_config(int profile, int jitter_ms) {
+    packet::ImpairerConfig config;
+    config.enable = true;
+    config.delay = BaseDelay;
+    config.jitter = jitter_ms * core::Millisecond;
+    config.jitter_distribution = packet::ImpairerJitter_Normal;
+    config.seed = 1;
+
+    switch (profile) {
+    case 0:
+        // no losses
+        break;
+    case 1:
+        // 1% random losses
+        config.good_loss = 0.01f;
+        break;
+    case 2:
+        // 5% random losses
+        config.good_loss = 0.05f;
+        break;
+    case 3:
+        // ~6% losses in bursts of ~3 packets
+        config.good_to_bad = 0.02f;
+        config.bad_to_good = 0.3f;
+        break;
+    case 4:
+        // ~20% losses in bursts of ~5 packets
+        config.good_to_bad = 0.05f;
+        config.bad_to_good = 0.2f;
+        break;
+    default:
+        roc_panic("bench: unknown profile");
+    }
+
+    return config;
+}
+
+// Receives packets from impairer, as if from network, and sorts them
+// into source and repair queues for FEC reader.
+class Receiver : public packet::IWriter, public core::NonCopyable<> {
+public:
+    Receiver()
+        : source_queue_(0)
+        , repair_queue_(0) {
+    }
+
+    virtual ROC_ATTR_NODISCARD status::StatusCode write(const packet::PacketPtr& pp) {
+        const bool is_repair = pp->has_flags(packet::Packet::FlagRepair);
+
+        packet::IParser& parser = is_repair ? (packet::IParser&)repair_parser
+                                            : (packet::IParser&)source_parser;
+
+        packet::PacketPtr new_pp = packet_factory.new_packet();
+        roc_panic_if(!new_pp);
+
+        if (!parser.parse(*new_pp, pp->buffer())) {
+            roc_panic("bench: can't parse packet");
+        }
+        new_pp->set_buffer(pp->buffer());
+
+        return is_repair ? repair_queue_.write(new_pp) : source_queue_.write(new_pp);
+    }
+
+    packet::IReader& source_reader() {
+        return source_queue_;
+    }
+
+    packet::IReader& repair_reader() {
+        return repair_queue_;
+    }
+
+private:
+    packet::SortedQueue source_queue_;
+    packet::SortedQueue repair_queue_;
+};
+
+packet::PacketPtr new_packet(packet::seqnum_t sn) {
+    const size_t rtp_payload_size = PayloadSize - sizeof(rtp::Header);
+
+    packet::PacketPtr pp = packet_factory.new_packet();
+    roc_panic_if(!pp);
+
+    core::Slice<uint8_t> bp = packet_factory.new_packet_buffer();
+    roc_panic_if(!bp);
+
+    roc_panic_if(!source_composer.prepare(*pp, bp, rtp_payload_size));
+    pp->set_buffer(bp);
+
+    pp->add_flags(packet::Packet::FlagAudio | packet::Packet::FlagPrepared);
+
+    pp->rtp()->source_id = 123;
+    pp->rtp()->payload_type = rtp::PayloadType_L16_Stereo;
+    pp->rtp()->seqnum = sn;
+    pp->rtp()->stream_timestamp = packet::stream_timestamp_t(sn * 10);
+
+    return pp;
+}
+
+void BM_Impairment_FecRecovery(benchmark::State& state) {
+    CodecConfig codec_config;
+    codec_config.scheme = packet::FEC_LDPC_Staircase;
+
+    if (!CodecMap::instance().is_supported(codec_config.scheme)) {
+        state.SkipWithError("FEC scheme not supported");
+        return;
+    }
+
+    core::ScopedPtr<IBlockEncoder> encoder(
+        CodecMap::instance().new_encoder(codec_config, packet_factory, arena), arena);
+    core::ScopedPtr<IBlockDecoder> decoder(
+        CodecMap::instance().new_decoder(codec_config, packet_factory, arena), arena);
+    roc_panic_if(!encoder || !decoder);
+
+    Receiver receiver;
+
+    packet::Impairer impairer(receiver,
+                              make_config((int)state.range(0), (int)state.range(1)),
+                              packet_factory, arena);
+    roc_panic_if(!impairer.is_valid());
+
+    WriterConfig writer_config;
+    writer_config.n_source_packets = NumSource;
+    writer_config.n_repair_packets = NumRepair;
+
+    Writer writer(writer_config, codec_config.scheme, *encoder, impairer,
+                  source_composer, repair_composer, packet_factory, arena);
+    roc_panic_if(!writer.is_valid());
+
+    Reader reader(ReaderConfig(), codec_config.scheme, *decoder,
+                  receiver.source_reader(), receiver.repair_reader(), rtp_parser,
+                  packet_factory, arena);
+    roc_panic_if(!reader.is_valid());
+
+    size_t n_sent = 0, n_due = 0, n_received = 0, n_restored = 0;
+    packet::PacketPtr next_pp;
+
+    while (state.KeepRunning()) {
+        const core::nanoseconds_t now = (core::nanoseconds_t)n_sent * Tick;
+
+        status::StatusCode code = writer.write(new_packet(packet::seqnum_t(n_sent)));
+        roc_panic_if(code != status::StatusOK);
+        n_sent++;
+
+        code = impairer.flush(now);
+        roc_panic_if(code != status::StatusOK);
+
+        if (n_sent <= LatencyTicks) {
+            continue;
+        }
+
+        // Play next packet. Like depacketizer, ask FEC reader for next packet
+        // only when previous one was played; if returned packet is ahead,
+        // packets before it are treated as lost.
+        const packet::seqnum_t due_sn = packet::seqnum_t(n_due++);
+
+        for (;;) {
+            if (!next_pp) {
+                code = reader.read(next_pp);
+                roc_panic_if(code != status::StatusOK && code != status::StatusNoData);
+                if (!next_pp) {
+                    break;
+                }
+            }
+            if (!packet::seqnum_lt(next_pp->rtp()->seqnum, due_sn)) {
+                break;
+            }
+            // too late
+            next_pp = NULL;
+        }
+
+        if (next_pp && next_pp->rtp()->seqnum == due_sn) {
+            if (next_pp->has_flags(packet::Packet::FlagRestored)) {
+                n_restored++;
+            } else {
+                n_received++;
+            }
+            next_pp = NULL;
+        }
+    }
+
+    const packet::ImpairerMetrics metrics = impairer.metrics();
+
+    const double n_total = n_due ? (double)n_due : 1.;
+    const double n_missing = (double)(n_due - n_received);
+
+    state.counters["loss"] = n_missing / n_total;
+    state.counters["recovered"] = n_missing > 0 ? (double)n_restored / n_missing : 1.;
+    state.counters["residual"] = (n_missing - (double)n_restored) / n_total;
+    state.counters["delay_ms"] = metrics.delivered_packets
+        ? (double)metrics.total_delay / metrics.delivered_packets / core::Millisecond
+        : 0;
+    state.counters["max_ms"] = (double)metrics.max_delay / core::Millisecond;
+}
+
+BENCHMARK(BM_Impairment_FecRecovery)
+    ->ArgPair(0, 0)
+    ->ArgPair(1, 0)
+    ->ArgPair(2, 0)
+    ->ArgPair(3, 0)
+    ->ArgPair(4, 0)
+    ->ArgPair(0, 10)
+    ->ArgPair(2, 10)
+    ->ArgPair(3, 10)
+    ->ArgPair(0, 40)
+    ->ArgPair(3, 40)
+    ->Iterations(NumPackets)
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace
+} // namespace fec
+} // namespace roc
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "roc_core/fast_random.h"
+#include "roc_core/heap_arena.h"
+#include "roc_core/panic.h"
+#include "roc_fec/ldpc_staircase_decoder.h"
+#include "roc_fec/ldpc_staircase_encoder.h"
+
+#ifdef ROC_TARGET_OPENFEC
+#include "roc_fec/openfec_decoder.h"
+#include "roc_fec/openfec_encoder.h"
+#endif // ROC_TARGET_OPENFEC
+
+namespace roc {
+namespace fec {
+namespace {
+
+// Measures encoding and decoding throughput of LDPC-Staircase codec,
+// built-in implementation vs OpenFEC (if enabled).
+//
+// Encode argument is payload size; decode arguments are payload size and
+// number of lost source packets in block.
+//
+// Output columns:
+//  Time       - time of encoding or decoding one block
+//  bytes/sec  - source bytes processed per second
+
+enum { NumSource = 20, NumRepair = 10, MaxPayloadSize = 1500 };
+
+core::HeapArena arena;
+packet::PacketFactory packet_factory(arena, MaxPayloadSize);
+
+CodecConfig make_config() {
+    CodecConfig config;
+    config.scheme = packet::FEC_LDPC_Staircase;
+    return config;
+}
+
+void make_buffers(core::Slice<uint8_t>* buffers, size_t payload_size) {
+    for (size_t i = 0; i < NumSource + NumRepair; i++) {
+        buffers[i] = packet_factory.new_packet_buffer();
+        roc_panic_if(!buffers[i]);
+        buffers[i].reslice(0, payload_size);
+
+        for (size_t j = 0; j < payload_size; j++) {
+            buffers[i].data()[j] = (uint8_t)core::fast_random_range(0, 0xff);
+        }
+    }
+}
+
+void encode(IBlockEncoder& encoder, core::Slice<uint8_t>* buffers, size_t payload_size) {
+    roc_panic_if(!encoder.begin(NumSource, NumRepair, payload_size));
+
+    for (size_t i = 0; i < NumSource + NumRepair; i++) {
+        encoder.set(i, buffers[i]);
+    }
+
+    encoder.fill();
+    encoder.end();
+}
+
+void report(benchmark::State& state, size_t payload_size) {
+    state.SetBytesProcessed((int64_t)state.iterations() * NumSource
+                            * (int64_t)payload_size);
+}
+
+template <class Encoder> void bench_encode(benchmark::State& state) {
+    const size_t payload_size = (size_t)state.range(0);
+
+    Encoder encoder(make_config(), packet_factory, arena);
+    roc_panic_if(!encoder.is_valid());
+
+    core::Slice<uint8_t> buffers[NumSource + NumRepair];
+    make_buffers(buffers, payload_size);
+
+    while (state.KeepRunning()) {
+        encode(encoder, buffers, payload_size);
+    }
+
+    report(state, payload_size);
+}
+
+template <class Encoder, class Decoder> void bench_decode(benchmark::State& state) {
+    const size_t payload_size = (size_t)state.range(0);
+    const size_t n_lost = (size_t)state.range(1);
+
+    Encoder encoder(make_config(), packet_factory, arena);
+    Decoder decoder(make_config(), packet_factory, arena);
+    roc_panic_if(!encoder.is_valid());
+    roc_panic_if(!decoder.is_valid());
+
+    core::Slice<uint8_t> buffers[NumSource + NumRepair];
+    make_buffers(buffers, payload_size);
+    encode(encoder, buffers, payload_size);
+
+    while (state.KeepRunning()) {
+        roc_panic_if(!decoder.begin(NumSource, NumRepair, payload_size));
+
+        // lose source packets evenly spread over block
+        for (size_t i = 0; i < NumSource + NumRepair; i++) {
+            if (i < NumSource && i % (NumSource / n_lost) == 0) {
+                continue;
+            }
+            decoder.set(i, buffers[i]);
+        }
+
+        for (size_t i = 0; i < NumSource; i++) {
+            benchmark::DoNotOptimize(decoder.repair(i));
+        }
+
+        decoder.end();
+    }
+
+    report(state, payload_size);
+}
+
+void BM_LdpcStaircase_Encode_Builtin(benchmark::State& state) {
+    bench_encode<LdpcStaircaseEncoder>(state);
+}
+
+BENCHMARK(BM_LdpcStaircase_Encode_Builtin)
+    ->Arg(64)
+    ->Arg(256)
+    ->Arg(1024)
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_LdpcStaircase_Decode_Builtin(benchmark::State& state) {
+    bench_decode<LdpcStaircaseEncoder, LdpcStaircaseDecoder>(state);
+}
+
+BENCHMARK(BM_LdpcStaircase_Decode_Builtin)
+    ->ArgPair(256, 1)
+    ->ArgPair(256, 5)
+    ->ArgPair(1024, 1)
+    ->ArgPair(1024, 5)
+    ->Unit(benchmark::kMicrosecond);
+
+#ifdef ROC_TARGET_OPENFEC
+
+void BM_LdpcStaircase_Encode_OpenFEC(benchmark::State& state) {
+    bench_encode<OpenfecEncoder>(state);
+}
+
+BENCHMARK(BM_LdpcStaircase_Encode_OpenFEC)
+    ->Arg(64)
+    ->Arg(256)
+    ->Arg(1024)
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_LdpcStaircase_Decode_OpenFEC(benchmark::State& state) {
+    bench_decode<OpenfecEncoder, OpenfecDecoder>(state);
+}
+
+BENCHMARK(BM_LdpcStaircase_Decode_OpenFEC)
+    ->ArgPair(256, 1)
+    ->ArgPair(256, 5)
+    ->ArgPair(1024, 1)
+    ->ArgPair(1024, 5)
+    ->Unit(benchmark::kMicrosecond);
+
+#endif // ROC_TARGET_OPENFEC
+
+} // namespace
+} // namespace fec
+} // namespace roc
@@ -12,6 +12,7 @@
 #include "roc_core/fast_random.h"
 #include "roc_core/heap_arena.h"
 #include "roc_core/log.h"
+#include "roc_core/macro_helpers.h"
 #include "roc_core/scoped_ptr.h"
 #include "roc_fec/codec_map.h"
 
@@ -231,5 +232,55 @@ TEST(encoder_decoder, max_source_block) {
     }
 }
 
+TEST(encoder_decoder, backends) {
+    enum { NumSourcePackets = 20, NumRepairPackets = 10, PayloadSize = 251 };
+
+    const CodecBackend backends[] = { CodecBackend_OpenFEC, CodecBackend_Builtin };
+
+    // built-in backend supports only LDPC-Staircase, and is always available
+    CHECK(CodecMap::instance().is_supported(packet::FEC_LDPC_Staircase,
+                                            CodecBackend_Builtin));
+    CHECK(!CodecMap::instance().is_supported(packet::FEC_ReedSolomon_M8,
+                                             CodecBackend_Builtin));
+
+#ifdef ROC_TARGET_OPENFEC
+    CHECK(CodecMap::instance().is_supported(packet::FEC_LDPC_Staircase,
+                                            CodecBackend_OpenFEC));
+#else  // !ROC_TARGET_OPENFEC
+    CHECK(!CodecMap::instance().is_supported(packet::FEC_LDPC_Staircase,
+                                             CodecBackend_OpenFEC));
+#endif // ROC_TARGET_OPENFEC
+
+    for (size_t n_backend = 0; n_backend < ROC_ARRAY_SIZE(backends); n_backend++) {
+        for (size_t n_scheme = 0; n_scheme < CodecMap::instance().num_schemes();
+             n_scheme++) {
+            CodecConfig config;
+            config.scheme = CodecMap::instance().nth_scheme(n_scheme);
+            config.backend = backends[n_backend];
+
+            if (!CodecMap::instance().is_supported(config.scheme, config.backend)) {
+                CHECK(!CodecMap::instance().new_encoder(config, packet_factory, arena));
+                CHECK(!CodecMap::instance().new_decoder(config, packet_factory, arena));
+                continue;
+            }
+
+            Codec code(config);
+            code.encode(NumSourcePackets, NumRepairPackets, PayloadSize);
+
+            CHECK(code.decoder().begin(NumSourcePackets, NumRepairPackets, PayloadSize));
+
+            for (size_t i = 0; i < NumSourcePackets + NumRepairPackets; ++i) {
+                if (i == 5) {
+                    continue;
+                }
+                code.decoder().set(i, code.get_buffer(i));
+            }
+            CHECK(code.decode(NumSourcePackets, PayloadSize));
+
+            code.decoder().end();
+        }
+    }
+}
+
 } // namespace fec
 } // namespace roc
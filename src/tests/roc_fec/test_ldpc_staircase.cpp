@@ -0,0 +1,482 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/array.h"
+#include "roc_core/cpu_features.h"
+#include "roc_core/fast_random.h"
+#include "roc_core/heap_arena.h"
+#include "roc_fec/ldpc_staircase_decoder.h"
+#include "roc_fec/ldpc_staircase_encoder.h"
+#include "roc_fec/ldpc_staircase_matrix.h"
+#include "roc_fec/symbol_ops.h"
+
+#ifdef ROC_TARGET_OPENFEC
+#include "roc_fec/openfec_decoder.h"
+#include "roc_fec/openfec_encoder.h"
+#endif // ROC_TARGET_OPENFEC
+
+namespace roc {
+namespace fec {
+
+namespace {
+
+enum { NumSource = 20, NumRepair = 10, PayloadSize = 251, MaxPayloadSize = 1024 };
+
+core::HeapArena arena;
+packet::PacketFactory packet_factory(arena, MaxPayloadSize);
+
+CodecConfig make_config() {
+    CodecConfig config;
+    config.scheme = packet::FEC_LDPC_Staircase;
+    return config;
+}
+
+core::Slice<uint8_t> make_buffer(size_t size) {
+    core::Slice<uint8_t> buf = packet_factory.new_packet_buffer();
+    CHECK(buf);
+    buf.reslice(0, size);
+    for (size_t i = 0; i < size; i++) {
+        buf.data()[i] = (uint8_t)core::fast_random_range(0, 0xff);
+    }
+    return buf;
+}
+
+void encode(IBlockEncoder& encoder,
+            core::Slice<uint8_t>* buffers,
+            size_t n_source,
+            size_t n_repair) {
+    CHECK(encoder.begin(n_source, n_repair, PayloadSize));
+    for (size_t i = 0; i < n_source + n_repair; i++) {
+        encoder.set(i, buffers[i]);
+    }
+    encoder.fill();
+    encoder.end();
+}
+
+#ifdef ROC_TARGET_OPENFEC
+
+// Encode block with one codec, and compare repair symbols with another codec.
+void check_same_repair(IBlockEncoder& encoder1,
+                       IBlockEncoder& encoder2,
+                       size_t n_source,
+                       size_t n_repair) {
+    core::Slice<uint8_t> buffers1[NumSource + NumRepair];
+    core::Slice<uint8_t> buffers2[NumSource + NumRepair];
+
+    CHECK(n_source + n_repair <= NumSource + NumRepair);
+
+    for (size_t i = 0; i < n_source + n_repair; i++) {
+        buffers1[i] = make_buffer(PayloadSize);
+        buffers2[i] = make_buffer(PayloadSize);
+        if (i < n_source) {
+            memcpy(buffers2[i].data(), buffers1[i].data(), PayloadSize);
+        }
+    }
+
+    encode(encoder1, buffers1, n_source, n_repair);
+    encode(encoder2, buffers2, n_source, n_repair);
+
+    for (size_t i = n_source; i < n_source + n_repair; i++) {
+        CHECK(memcmp(buffers1[i].data(), buffers2[i].data(), PayloadSize) == 0);
+    }
+}
+
+// Encode block with one codec, and repair lost symbols with another codec.
+// Every source symbol with index divisible by loss_step is lost.
+void check_repair(IBlockEncoder& encoder,
+                  IBlockDecoder& decoder,
+                  size_t n_source,
+                  size_t n_repair,
+                  size_t loss_step) {
+    core::Slice<uint8_t> buffers[NumSource + NumRepair];
+
+    CHECK(n_source + n_repair <= NumSource + NumRepair);
+
+    for (size_t i = 0; i < n_source + n_repair; i++) {
+        buffers[i] = make_buffer(PayloadSize);
+    }
+
+    encode(encoder, buffers, n_source, n_repair);
+
+    CHECK(decoder.begin(n_source, n_repair, PayloadSize));
+
+    for (size_t i = 0; i < n_source + n_repair; i++) {
+        if (i >= n_source || i % loss_step != 0) {
+            decoder.set(i, buffers[i]);
+        }
+    }
+
+    for (size_t i = 0; i < n_source; i += loss_step) {
+        core::Slice<uint8_t> repaired = decoder.repair(i);
+        CHECK(repaired);
+        CHECK(memcmp(buffers[i].data(), repaired.data(), PayloadSize) == 0);
+    }
+
+    decoder.end();
+}
+
+#endif // ROC_TARGET_OPENFEC
+
+} // namespace
+
+TEST_GROUP(ldpc_staircase) {};
+
+TEST(ldpc_staircase, symbol_xor) {
+    enum { MaxSize = 300, MaxOffset = 16 };
+
+    uint8_t src1[MaxSize + MaxOffset];
+    uint8_t src2[MaxSize + MaxOffset];
+    uint8_t dst[MaxSize + MaxOffset];
+    uint8_t expected[MaxSize + MaxOffset];
+
+    for (size_t i = 0; i < MaxSize + MaxOffset; i++) {
+        src1[i] = (uint8_t)core::fast_random_range(0, 0xff);
+        src2[i] = (uint8_t)core::fast_random_range(0, 0xff);
+    }
+
+    core::CpuFeatures& cpu_features = core::CpuFeatures::instance();
+    const core::CpuIsa saved_isa = cpu_features.max_isa();
+
+    // check every kernel supported by CPU
+    for (int isa = 0; isa < core::CpuIsa_Max; isa++) {
+        if (!cpu_features.is_detected((core::CpuIsa)isa)) {
+            continue;
+        }
+        cpu_features.set_max_isa((core::CpuIsa)isa);
+
+        for (size_t size = 0; size <= MaxSize; size += 7) {
+            for (size_t offset = 0; offset < MaxOffset; offset += 3) {
+                for (size_t i = 0; i < MaxSize + MaxOffset; i++) {
+                    dst[i] = expected[i] = (uint8_t)i;
+                }
+                for (size_t i = 0; i < size; i++) {
+                    expected[offset + i] ^= src1[i];
+                }
+
+                symbol_xor(dst + offset, src1, size);
+                CHECK(memcmp(dst, expected, sizeof(dst)) == 0);
+
+                for (size_t i = 0; i < size; i++) {
+                    expected[offset + i] ^= src1[offset + i] ^ src2[i];
+                }
+
+                symbol_xor2(dst + offset, src1 + offset, src2, size);
+                CHECK(memcmp(dst, expected, sizeof(dst)) == 0);
+            }
+        }
+    }
+
+    cpu_features.set_max_isa(saved_isa);
+}
+
+TEST(ldpc_staircase, matrix) {
+    const CodecConfig config = make_config();
+
+    const size_t params[][2] = {
+        { 1, 1 }, { 1, 5 }, { 5, 1 }, { 20, 10 }, { 10, 20 }, { 100, 3 }, { 200, 50 },
+    };
+
+    for (size_t p = 0; p < sizeof(params) / sizeof(params[0]); p++) {
+        const size_t n_source = params[p][0];
+        const size_t n_repair = params[p][1];
+
+        LdpcStaircaseMatrix matrix(arena);
+        CHECK(matrix.build(n_source, n_repair, (uint32_t)config.ldpc_prng_seed,
+                           config.ldpc_N1));
+
+        UNSIGNED_LONGS_EQUAL(n_source, matrix.num_source());
+        UNSIGNED_LONGS_EQUAL(n_repair, matrix.num_repair());
+
+        const size_t n1 = config.ldpc_N1 < n_repair ? config.ldpc_N1 : n_repair;
+
+        size_t n_entries = 0;
+
+        // every column has at least n1 distinct rows
+        for (size_t col = 0; col < n_source; col++) {
+            const size_t col_size = matrix.column_size(col);
+            const uint32_t* col_entries = matrix.column_entries(col);
+
+            CHECK(col_size >= n1);
+
+            for (size_t i = 0; i < col_size; i++) {
+                CHECK(col_entries[i] < n_repair);
+                for (size_t j = 0; j < i; j++) {
+                    CHECK(col_entries[i] != col_entries[j]);
+                }
+            }
+
+            n_entries += col_size;
+        }
+
+        // every row has at least two ones when possible, and rows are
+        // consistent with columns
+        for (size_t row = 0; row < n_repair; row++) {
+            const size_t row_size = matrix.row_size(row);
+            const uint32_t* row_entries = matrix.row_entries(row);
+
+            CHECK(row_size >= (n_source < 2 ? n_source : 2));
+
+            for (size_t i = 0; i < row_size; i++) {
+                const size_t col = row_entries[i];
+                CHECK(col < n_source);
+
+                bool found = false;
+                for (size_t j = 0; j < matrix.column_size(col); j++) {
+                    if (matrix.column_entries(col)[j] == row) {
+                        found = true;
+                    }
+                }
+                CHECK(found);
+            }
+
+            n_entries -= row_size;
+        }
+
+        UNSIGNED_LONGS_EQUAL(0, n_entries);
+    }
+}
+
+TEST(ldpc_staircase, matrix_deterministic) {
+    LdpcStaircaseMatrix matrix1(arena);
+    LdpcStaircaseMatrix matrix2(arena);
+
+    CHECK(matrix1.build(NumSource, NumRepair, 1297501556, 7));
+    CHECK(matrix2.build(NumRepair, NumSource, 12345, 3));
+    CHECK(matrix2.build(NumSource, NumRepair, 1297501556, 7));
+
+    for (size_t row = 0; row < NumRepair; row++) {
+        UNSIGNED_LONGS_EQUAL(matrix1.row_size(row), matrix2.row_size(row));
+        CHECK(memcmp(matrix1.row_entries(row), matrix2.row_entries(row),
+                     matrix1.row_size(row) * sizeof(uint32_t))
+              == 0);
+    }
+}
+
+TEST(ldpc_staircase, parity_check) {
+    const CodecConfig config = make_config();
+
+    LdpcStaircaseEncoder encoder(config, packet_factory, arena);
+    CHECK(encoder.is_valid());
+
+    core::Slice<uint8_t> buffers[NumSource + NumRepair];
+    for (size_t i = 0; i < NumSource + NumRepair; i++) {
+        buffers[i] = make_buffer(PayloadSize);
+    }
+
+    encode(encoder, buffers, NumSource, NumRepair);
+
+    LdpcStaircaseMatrix matrix(arena);
+    CHECK(matrix.build(NumSource, NumRepair, (uint32_t)config.ldpc_prng_seed,
+                       config.ldpc_N1));
+
+    // sum of symbols of every row should be zero
+    for (size_t row = 0; row < NumRepair; row++) {
+        uint8_t sum[PayloadSize];
+        memcpy(sum, buffers[NumSource + row].data(), PayloadSize);
+
+        if (row > 0) {
+            symbol_xor(sum, buffers[NumSource + row - 1].data(), PayloadSize);
+        }
+
+        for (size_t i = 0; i < matrix.row_size(row); i++) {
+            symbol_xor(sum, buffers[matrix.row_entries(row)[i]].data(), PayloadSize);
+        }
+
+        for (size_t i = 0; i < PayloadSize; i++) {
+            UNSIGNED_LONGS_EQUAL(0, sum[i]);
+        }
+    }
+}
+
+TEST(ldpc_staircase, gaussian_elimination) {
+    const CodecConfig config = make_config();
+
+    LdpcStaircaseMatrix matrix(arena);
+    CHECK(matrix.build(NumSource, NumRepair, (uint32_t)config.ldpc_prng_seed,
+                       config.ldpc_N1));
+
+    // Find source symbol which participates in odd number of rows (at least 3).
+    // If it's lost together with all repair symbols except the last one,
+    // iterative decoding stalls, because every row between the first and the
+    // last row of this symbol has two unknowns. However, sum of these rows gives
+    // the value of the lost symbol.
+    size_t lost = NumSource;
+    for (size_t col = 0; col < NumSource; col++) {
+        if (matrix.column_size(col) % 2 == 1 && matrix.column_size(col) >= 3) {
+            lost = col;
+            break;
+        }
+    }
+    CHECK(lost < NumSource);
+
+    LdpcStaircaseEncoder encoder(config, packet_factory, arena);
+    LdpcStaircaseDecoder decoder(config, packet_factory, arena);
+    CHECK(encoder.is_valid());
+    CHECK(decoder.is_valid());
+
+    core::Slice<uint8_t> buffers[NumSource + NumRepair];
+    for (size_t i = 0; i < NumSource + NumRepair; i++) {
+        buffers[i] = make_buffer(PayloadSize);
+    }
+
+    encode(encoder, buffers, NumSource, NumRepair);
+
+    CHECK(decoder.begin(NumSource, NumRepair, PayloadSize));
+
+    for (size_t i = 0; i < NumSource; i++) {
+        if (i != lost) {
+            decoder.set(i, buffers[i]);
+        }
+    }
+    decoder.set(NumSource + NumRepair - 1, buffers[NumSource + NumRepair - 1]);
+
+    core::Slice<uint8_t> repaired = decoder.repair(lost);
+    CHECK(repaired);
+    UNSIGNED_LONGS_EQUAL(PayloadSize, repaired.size());
+    CHECK(memcmp(buffers[lost].data(), repaired.data(), PayloadSize) == 0);
+
+    decoder.end();
+}
+
+TEST(ldpc_staircase, not_enough_symbols) {
+    const CodecConfig config = make_config();
+
+    LdpcStaircaseEncoder encoder(config, packet_factory, arena);
+    LdpcStaircaseDecoder decoder(config, packet_factory, arena);
+    CHECK(encoder.is_valid());
+    CHECK(decoder.is_valid());
+
+    core::Slice<uint8_t> buffers[NumSource + NumRepair];
+    for (size_t i = 0; i < NumSource + NumRepair; i++) {
+        buffers[i] = make_buffer(PayloadSize);
+    }
+
+    encode(encoder, buffers, NumSource, NumRepair);
+
+    CHECK(decoder.begin(NumSource, NumRepair, PayloadSize));
+
+    // lose more source symbols than there are repair symbols
+    for (size_t i = NumRepair + 1; i < NumSource + NumRepair; i++) {
+        decoder.set(i, buffers[i]);
+    }
+
+    for (size_t i = 0; i < NumRepair + 1; i++) {
+        CHECK(!decoder.repair(i));
+    }
+
+    decoder.end();
+}
+
+TEST(ldpc_staircase, reuse) {
+    const CodecConfig config = make_config();
+
+    LdpcStaircaseEncoder encoder(config, packet_factory, arena);
+    LdpcStaircaseDecoder decoder(config, packet_factory, arena);
+    CHECK(encoder.is_valid());
+    CHECK(decoder.is_valid());
+
+    const size_t params[][2] = { { 20, 10 }, { 12, 12 }, { 40, 20 }, { 20, 10 } };
+
+    for (size_t p = 0; p < sizeof(params) / sizeof(params[0]); p++) {
+        const size_t n_source = params[p][0];
+        const size_t n_repair = params[p][1];
+
+        core::Slice<uint8_t> buffers[40 + 20];
+        for (size_t i = 0; i < n_source + n_repair; i++) {
+            buffers[i] = make_buffer(PayloadSize);
+        }
+
+        encode(encoder, buffers, n_source, n_repair);
+
+        CHECK(decoder.begin(n_source, n_repair, PayloadSize));
+
+        // lose every fourth source symbol
+        for (size_t i = 0; i < n_source + n_repair; i++) {
+            if (i >= n_source || i % 4 != 0) {
+                decoder.set(i, buffers[i]);
+            }
+        }
+
+        for (size_t i = 0; i < n_source; i += 4) {
+            core::Slice<uint8_t> repaired = decoder.repair(i);
+            CHECK(repaired);
+            CHECK(memcmp(buffers[i].data(), repaired.data(), PayloadSize) == 0);
+        }
+
+        decoder.end();
+    }
+}
+
+#ifdef ROC_TARGET_OPENFEC
+
+TEST(ldpc_staircase, openfec_compatibility) {
+    const CodecConfig config = make_config();
+
+    LdpcStaircaseEncoder native_encoder(config, packet_factory, arena);
+    OpenfecEncoder openfec_encoder(config, packet_factory, arena);
+    CHECK(native_encoder.is_valid());
+    CHECK(openfec_encoder.is_valid());
+
+    check_same_repair(native_encoder, openfec_encoder, NumSource, NumRepair);
+}
+
+TEST(ldpc_staircase, openfec_decodes_native) {
+    const CodecConfig config = make_config();
+
+    LdpcStaircaseEncoder native_encoder(config, packet_factory, arena);
+    OpenfecDecoder openfec_decoder(config, packet_factory, arena);
+    CHECK(native_encoder.is_valid());
+    CHECK(openfec_decoder.is_valid());
+
+    check_repair(native_encoder, openfec_decoder, NumSource, NumRepair, 4);
+}
+
+TEST(ldpc_staircase, native_decodes_openfec) {
+    const CodecConfig config = make_config();
+
+    OpenfecEncoder openfec_encoder(config, packet_factory, arena);
+    LdpcStaircaseDecoder native_decoder(config, packet_factory, arena);
+    CHECK(openfec_encoder.is_valid());
+    CHECK(native_decoder.is_valid());
+
+    check_repair(openfec_encoder, native_decoder, NumSource, NumRepair, 4);
+}
+
+TEST(ldpc_staircase, openfec_compatibility_small_repair) {
+    // With fewer repair symbols than N1, built-in codec reduces N1 to
+    // the number of repair symbols, which should match OpenFEC configured
+    // with such N1.
+    const CodecConfig native_config = make_config();
+    CHECK(native_config.ldpc_N1 == 7);
+
+    for (size_t n_repair = 3; n_repair < native_config.ldpc_N1; n_repair++) {
+        CodecConfig openfec_config = make_config();
+        openfec_config.ldpc_N1 = (uint8_t)n_repair;
+
+        LdpcStaircaseEncoder native_encoder(native_config, packet_factory, arena);
+        LdpcStaircaseDecoder native_decoder(native_config, packet_factory, arena);
+        OpenfecEncoder openfec_encoder(openfec_config, packet_factory, arena);
+        OpenfecDecoder openfec_decoder(openfec_config, packet_factory, arena);
+        CHECK(native_encoder.is_valid());
+        CHECK(native_decoder.is_valid());
+        CHECK(openfec_encoder.is_valid());
+        CHECK(openfec_decoder.is_valid());
+
+        check_same_repair(native_encoder, openfec_encoder, NumSource, n_repair);
+        // lose one source symbol
+        check_repair(native_encoder, openfec_decoder, NumSource, n_repair, NumSource);
+        check_repair(openfec_encoder, native_decoder, NumSource, n_repair, NumSource);
+    }
+}
+
+#endif // ROC_TARGET_OPENFEC
+
+} // namespace fec
+} // namespace roc
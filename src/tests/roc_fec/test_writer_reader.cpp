@@ -14,6 +14,7 @@
 #include "roc_core/heap_arena.h"
 #include "roc_core/macro_helpers.h"
 #include "roc_core/scoped_ptr.h"
+#include "roc_core/time.h"
 #include "roc_fec/codec_map.h"
 #include "roc_fec/composer.h"
 #include "roc_fec/headers.h"
@@ -316,6 +317,80 @@ TEST(writer_reader, 1_loss) {
     }
 }
 
+TEST(writer_reader, repair_disabled) {
+    for (size_t n_scheme = 0; n_scheme < CodecMap::instance().num_schemes(); n_scheme++) {
+        codec_config.scheme = CodecMap::instance().nth_scheme(n_scheme);
+
+        core::ScopedPtr<IBlockEncoder> encoder(
+            CodecMap::instance().new_encoder(codec_config, packet_factory, arena), arena);
+
+        core::ScopedPtr<IBlockDecoder> decoder(
+            CodecMap::instance().new_decoder(codec_config, packet_factory, arena), arena);
+
+        CHECK(encoder);
+        CHECK(decoder);
+
+        test::PacketDispatcher dispatcher(source_parser(), repair_parser(),
+                                          packet_factory, NumSourcePackets,
+                                          NumRepairPackets);
+
+        Writer writer(writer_config, codec_config.scheme, *encoder, dispatcher,
+                      source_composer(), repair_composer(), packet_factory, arena);
+
+        Reader reader(reader_config, codec_config.scheme, *decoder,
+                      dispatcher.source_reader(), dispatcher.repair_reader(), rtp_parser,
+                      packet_factory, arena);
+
+        CHECK(writer.is_valid());
+        CHECK(reader.is_valid());
+
+        // First block: repair is disabled, lost packet is skipped.
+        reader.set_repair_enabled(false);
+
+        fill_all_packets(0);
+
+        dispatcher.lose(11);
+
+        for (size_t i = 0; i < NumSourcePackets; ++i) {
+            UNSIGNED_LONGS_EQUAL(status::StatusOK, writer.write(source_packets[i]));
+        }
+        dispatcher.push_stocks();
+
+        for (size_t i = 0; i < NumSourcePackets; ++i) {
+            if (i == 11) {
+                continue;
+            }
+            packet::PacketPtr p;
+            UNSIGNED_LONGS_EQUAL(status::StatusOK, reader.read(p));
+            CHECK(p);
+            check_audio_packet(p, i);
+            check_restored(p, false);
+        }
+
+        dispatcher.reset();
+
+        // Second block: repair is enabled again, lost packet is restored.
+        reader.set_repair_enabled(true);
+
+        fill_all_packets(NumSourcePackets);
+
+        dispatcher.lose(11);
+
+        for (size_t i = 0; i < NumSourcePackets; ++i) {
+            UNSIGNED_LONGS_EQUAL(status::StatusOK, writer.write(source_packets[i]));
+        }
+        dispatcher.push_stocks();
+
+        for (size_t i = 0; i < NumSourcePackets; ++i) {
+            packet::PacketPtr p;
+            UNSIGNED_LONGS_EQUAL(status::StatusOK, reader.read(p));
+            CHECK(p);
+            check_audio_packet(p, NumSourcePackets + i);
+            check_restored(p, i == 11);
+        }
+    }
+}
+
 TEST(writer_reader, lost_first_packet_in_first_block) {
     for (size_t n_scheme = 0; n_scheme < CodecMap::instance().num_schemes(); n_scheme++) {
         codec_config.scheme = CodecMap::instance().nth_scheme(n_scheme);
@@ -1054,6 +1129,95 @@ TEST(writer_reader, multiple_repair_attempts) {
     }
 }
 
+TEST(writer_reader, repair_twice_in_block) {
+    // 1. Lose several packets and hold every fec packet in first block.
+    // 2. Deliver fec packets one by one, before every read.
+    // 3. Codecs that can repair block partially (e.g. LDPC) restore some of
+    //    the lost packets on one attempt and the rest on next attempts, when
+    //    restored packets (which have no fec header) are already in block.
+    // 4. Check that all received packets and most of lost packets are delivered.
+    for (size_t n_scheme = 0; n_scheme < CodecMap::instance().num_schemes(); n_scheme++) {
+        codec_config.scheme = CodecMap::instance().nth_scheme(n_scheme);
+
+        core::ScopedPtr<IBlockEncoder> encoder(
+            CodecMap::instance().new_encoder(codec_config, packet_factory, arena), arena);
+
+        core::ScopedPtr<IBlockDecoder> decoder(
+            CodecMap::instance().new_decoder(codec_config, packet_factory, arena), arena);
+
+        CHECK(encoder);
+        CHECK(decoder);
+
+        test::PacketDispatcher dispatcher(source_parser(), repair_parser(),
+                                          packet_factory, NumSourcePackets,
+                                          NumRepairPackets);
+
+        Writer writer(writer_config, codec_config.scheme, *encoder, dispatcher,
+                      source_composer(), repair_composer(), packet_factory, arena);
+
+        Reader reader(reader_config, codec_config.scheme, *decoder,
+                      dispatcher.source_reader(), dispatcher.repair_reader(), rtp_parser,
+                      packet_factory, arena);
+
+        CHECK(writer.is_valid());
+        CHECK(reader.is_valid());
+
+        fill_all_packets(0);
+
+        const bool lost[NumSourcePackets] = {
+            false, false, false, false, true,  false, false, false, false, false,
+            false, true,  true,  false, false, false, false, true,  false, false,
+        };
+
+        for (size_t i = 0; i < NumSourcePackets; ++i) {
+            if (lost[i]) {
+                dispatcher.lose(i);
+            }
+        }
+
+        for (size_t i = 0; i < NumSourcePackets; ++i) {
+            UNSIGNED_LONGS_EQUAL(status::StatusOK, writer.write(source_packets[i]));
+            if (!lost[i]) {
+                dispatcher.push_source_stock(1);
+            }
+        }
+
+        dispatcher.clear_losses();
+
+        size_t n_repair = 0;
+        size_t n_received = 0;
+        size_t n_restored = 0;
+
+        for (size_t next = 0; next < NumSourcePackets;) {
+            if (n_repair < NumRepairPackets) {
+                dispatcher.push_repair_stock(1);
+                n_repair++;
+            }
+
+            packet::PacketPtr p;
+            UNSIGNED_LONGS_EQUAL(status::StatusOK, reader.read(p));
+            CHECK(p);
+
+            const size_t i = p->rtp()->seqnum;
+            CHECK(i >= next && i < NumSourcePackets);
+
+            check_audio_packet(p, i);
+            check_restored(p, lost[i]);
+
+            if (lost[i]) {
+                n_restored++;
+            } else {
+                n_received++;
+            }
+
+            next = i + 1;
+        }
+
+        UNSIGNED_LONGS_EQUAL(NumSourcePackets - 4, n_received);
+        CHECK(n_restored >= 3);
+    }
+}
+
 TEST(writer_reader, drop_outdated_block) {
     for (size_t n_scheme = 0; n_scheme < CodecMap::instance().num_schemes(); n_scheme++) {
         codec_config.scheme = CodecMap::instance().nth_scheme(n_scheme);
@@ -2007,6 +2171,140 @@ TEST(writer_reader, writer_encode_blocks) {
     }
 }
 
+TEST(writer_reader, writer_background_encoding) {
+    for (size_t n_scheme = 0; n_scheme < CodecMap::instance().num_schemes(); n_scheme++) {
+        codec_config.scheme = CodecMap::instance().nth_scheme(n_scheme);
+        writer_config.enable_background_encoding = true;
+
+        core::ScopedPtr<IBlockEncoder> encoder(
+            CodecMap::instance().new_encoder(codec_config, packet_factory, arena), arena);
+
+        core::ScopedPtr<IBlockDecoder> decoder(
+            CodecMap::instance().new_decoder(codec_config, packet_factory, arena), arena);
+
+        CHECK(encoder);
+        CHECK(decoder);
+
+        test::PacketDispatcher dispatcher(source_parser(), repair_parser(),
+                                          packet_factory, NumSourcePackets,
+                                          NumRepairPackets);
+
+        Writer writer(writer_config, codec_config.scheme, *encoder, dispatcher,
+                      source_composer(), repair_composer(), packet_factory, arena);
+
+        Reader reader(reader_config, codec_config.scheme, *decoder,
+                      dispatcher.source_reader(), dispatcher.repair_reader(), rtp_parser,
+                      packet_factory, arena);
+
+        CHECK(writer.is_valid());
+        CHECK(reader.is_valid());
+
+        fill_all_packets(0);
+
+        dispatcher.lose(11);
+
+        for (size_t i = 0; i < NumSourcePackets; ++i) {
+            UNSIGNED_LONGS_EQUAL(status::StatusOK, writer.write(source_packets[i]));
+        }
+
+        // source packets are written immediately
+        UNSIGNED_LONGS_EQUAL(NumSourcePackets - 1, dispatcher.source_size());
+
+        // repair packets are written by flush() when ready
+        const core::nanoseconds_t deadline =
+            core::timestamp(core::ClockMonotonic) + core::Second * 10;
+        while (writer.metrics().encoded_blocks == 0) {
+            if (core::timestamp(core::ClockMonotonic) > deadline) {
+                FAIL("timeout waiting for background encoding");
+            }
+            UNSIGNED_LONGS_EQUAL(status::StatusOK, writer.flush());
+            core::sleep_for(core::ClockMonotonic, core::Microsecond * 100);
+        }
+        dispatcher.push_stocks();
+
+        // time spent by background thread is reported
+        CHECK(writer.metrics().encoder_cpu_time > 0);
+
+        UNSIGNED_LONGS_EQUAL(NumSourcePackets - 1, dispatcher.source_size());
+        UNSIGNED_LONGS_EQUAL(NumRepairPackets, dispatcher.repair_size());
+
+        const WriterMetrics metrics = writer.metrics();
+        UNSIGNED_LONGS_EQUAL(1, metrics.encoded_blocks);
+        CHECK(metrics.repair_latency > 0);
+        CHECK(metrics.max_repair_latency == metrics.repair_latency);
+
+        for (size_t i = 0; i < NumSourcePackets; ++i) {
+            packet::PacketPtr p;
+            UNSIGNED_LONGS_EQUAL(status::StatusOK, reader.read(p));
+            CHECK(p);
+            check_audio_packet(p, i);
+            check_restored(p, i == 11);
+        }
+    }
+}
+
+TEST(writer_reader, writer_background_encoding_bounded) {
+    enum { NumBlocks = 5 };
+
+    for (size_t n_scheme = 0; n_scheme < CodecMap::instance().num_schemes(); n_scheme++) {
+        codec_config.scheme = CodecMap::instance().nth_scheme(n_scheme);
+        writer_config.enable_background_encoding = true;
+
+        core::ScopedPtr<IBlockEncoder> encoder(
+            CodecMap::instance().new_encoder(codec_config, packet_factory, arena), arena);
+
+        CHECK(encoder);
+
+        packet::Queue queue;
+
+        Writer writer(writer_config, codec_config.scheme, *encoder, queue,
+                      source_composer(), repair_composer(), packet_factory, arena);
+
+        CHECK(writer.is_valid());
+
+        for (size_t block_num = 0; block_num < NumBlocks; ++block_num) {
+            fill_all_packets(NumSourcePackets * block_num);
+
+            for (size_t i = 0; i < NumSourcePackets; ++i) {
+                UNSIGNED_LONGS_EQUAL(status::StatusOK, writer.write(source_packets[i]));
+            }
+
+            // repair packets are delayed by at most one block
+            CHECK(writer.metrics().encoded_blocks >= block_num);
+            CHECK(queue.size() >= (NumSourcePackets + NumRepairPackets) * block_num
+                      + NumSourcePackets);
+        }
+
+        // all repair packets have correct block numbers
+        packet::blknum_t sbn = 0;
+        size_t n_repair = 0;
+
+        const size_t n_packets = queue.size();
+
+        for (size_t n = 0; n < n_packets; n++) {
+            packet::PacketPtr p;
+            UNSIGNED_LONGS_EQUAL(status::StatusOK, queue.read(p));
+            CHECK(p);
+
+            if (n == 0) {
+                sbn = p->fec()->source_block_number;
+            }
+
+            if (p->flags() & packet::Packet::FlagRepair) {
+                UNSIGNED_LONGS_EQUAL(packet::blknum_t(sbn + n_repair / NumRepairPackets),
+                                     p->fec()->source_block_number);
+                UNSIGNED_LONGS_EQUAL(NumSourcePackets + n_repair % NumRepairPackets,
+                                     p->fec()->encoding_symbol_id);
+                n_repair++;
+            }
+        }
+
+        CHECK(n_repair >= NumRepairPackets * (NumBlocks - 1));
+
+        // writer is destroyed while last block may be still encoding
+    }
+}
+
 TEST(writer_reader, writer_resize_blocks) {
     for (size_t n_scheme = 0; n_scheme < CodecMap::instance().num_schemes(); n_scheme++) {
         codec_config.scheme = CodecMap::instance().nth_scheme(n_scheme);
@@ -2976,8 +3274,9 @@ TEST(writer_reader, reader_invalid_fec_scheme_source_packet) {
             UNSIGNED_LONGS_EQUAL(status::StatusOK, writer_queue.read(p));
             CHECK(p);
             CHECK((p->flags() & packet::Packet::FlagRepair) == 0);
-            p->fec()->fec_scheme = CodecMap::instance().nth_scheme(
-                (n_scheme + 1) % CodecMap::instance().num_schemes());
+            p->fec()->fec_scheme = codec_config.scheme == packet::FEC_LDPC_Staircase
+                ? packet::FEC_ReedSolomon_M8
+                : packet::FEC_LDPC_Staircase;
             UNSIGNED_LONGS_EQUAL(status::StatusOK, source_queue.write(p));
             UNSIGNED_LONGS_EQUAL(1, source_queue.size());
         }
@@ -3059,8 +3358,9 @@ TEST(writer_reader, reader_invalid_fec_scheme_repair_packet) {
             UNSIGNED_LONGS_EQUAL(status::StatusOK, writer_queue.read(p));
             CHECK(p);
             CHECK((p->flags() & packet::Packet::FlagRepair) != 0);
-            p->fec()->fec_scheme = CodecMap::instance().nth_scheme(
-                (n_scheme + 1) % CodecMap::instance().num_schemes());
+            p->fec()->fec_scheme = codec_config.scheme == packet::FEC_LDPC_Staircase
+                ? packet::FEC_ReedSolomon_M8
+                : packet::FEC_LDPC_Staircase;
             UNSIGNED_LONGS_EQUAL(status::StatusOK, repair_queue.write(p));
             UNSIGNED_LONGS_EQUAL(1, repair_queue.size());
         }
@@ -0,0 +1,516 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/heap_arena.h"
+#include "roc_packet/impairer.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_packet/queue.h"
+#include "roc_status/status_code.h"
+
+namespace roc {
+namespace packet {
+
+namespace {
+
+enum { NumPackets = 10000, MaxPackets = NumPackets * 2, PacketSize = 100 };
+
+const core::nanoseconds_t PacketInterval = core::Millisecond;
+const core::nanoseconds_t StartTime = 1000000 * core::Second;
+
+core::HeapArena arena;
+PacketFactory packet_factory(arena, PacketSize);
+
+PacketPtr new_packet(seqnum_t sn) {
+    PacketPtr packet = packet_factory.new_packet();
+    CHECK(packet);
+
+    packet->add_flags(Packet::FlagRTP | Packet::FlagAudio);
+    packet->rtp()->seqnum = sn;
+
+    core::Slice<uint8_t> buffer = packet_factory.new_packet_buffer();
+    CHECK(buffer);
+    buffer.reslice(0, PacketSize);
+    packet->set_buffer(buffer);
+
+    return packet;
+}
+
+// Remembers seqnum of each written packet and time when it was written.
+class RecordingWriter : public IWriter {
+public:
+    RecordingWriter()
+        : now_(0)
+        , n_packets_(0) {
+    }
+
+    virtual ROC_ATTR_NODISCARD status::StatusCode write(const PacketPtr& packet) {
+        CHECK(packet);
+        CHECK(n_packets_ < MaxPackets);
+        seqnums_[n_packets_] = packet->rtp()->seqnum;
+        times_[n_packets_] = now_;
+        n_packets_++;
+        return status::StatusOK;
+    }
+
+    void set_time(core::nanoseconds_t now) {
+        now_ = now;
+    }
+
+    size_t num_packets() const {
+        return n_packets_;
+    }
+
+    seqnum_t seqnum(size_t n) const {
+        CHECK(n < n_packets_);
+        return seqnums_[n];
+    }
+
+    core::nanoseconds_t time(size_t n) const {
+        CHECK(n < n_packets_);
+        return times_[n];
+    }
+
+    // Number of packets with seqnum less than seqnum of preceding packet.
+    size_t num_reordered() const {
+        size_t count = 0;
+        for (size_t n = 1; n < n_packets_; n++) {
+            if (seqnum_lt(seqnums_[n], seqnums_[n - 1])) {
+                count++;
+            }
+        }
+        return count;
+    }
+
+private:
+    core::nanoseconds_t now_;
+    seqnum_t seqnums_[MaxPackets];
+    core::nanoseconds_t times_[MaxPackets];
+    size_t n_packets_;
+};
+
+// Flushes impairer at every deadline before given time.
+void flush_until(Impairer& impairer, RecordingWriter& writer, core::nanoseconds_t until) {
+    core::nanoseconds_t deadline = 0;
+
+    while ((deadline = impairer.flush_deadline()) != 0 && deadline < until) {
+        writer.set_time(deadline);
+        LONGS_EQUAL(status::StatusOK, impairer.flush(deadline));
+    }
+}
+
+// Writes one packet per interval and flushes impairer after each write
+// and at every deadline, then flushes remaining packets.
+void run_link(Impairer& impairer, RecordingWriter& writer, size_t n_packets) {
+    core::nanoseconds_t now = StartTime;
+
+    for (size_t n = 0; n < n_packets; n++) {
+        LONGS_EQUAL(status::StatusOK, impairer.write(new_packet(seqnum_t(n))));
+
+        writer.set_time(now);
+        LONGS_EQUAL(status::StatusOK, impairer.flush(now));
+
+        now += PacketInterval;
+        flush_until(impairer, writer, now);
+    }
+
+    flush_until(impairer, writer, core::nanoseconds_t(INT64_MAX));
+
+    UNSIGNED_LONGS_EQUAL(0, impairer.metrics().queued_packets);
+}
+
+} // namespace
+
+TEST_GROUP(impairer) {};
+
+TEST(impairer, no_impairment) {
+    RecordingWriter writer;
+    Impairer impairer(writer, ImpairerConfig(), packet_factory, arena);
+    CHECK(impairer.is_valid());
+
+    run_link(impairer, writer, NumPackets);
+
+    UNSIGNED_LONGS_EQUAL(NumPackets, writer.num_packets());
+
+    for (size_t n = 0; n < writer.num_packets(); n++) {
+        UNSIGNED_LONGS_EQUAL(n, writer.seqnum(n));
+        LONGS_EQUAL(StartTime + (core::nanoseconds_t)n * PacketInterval,
+                    writer.time(n));
+    }
+
+    const ImpairerMetrics metrics = impairer.metrics();
+
+    UNSIGNED_LONGS_EQUAL(NumPackets, metrics.written_packets);
+    UNSIGNED_LONGS_EQUAL(NumPackets, metrics.delivered_packets);
+    UNSIGNED_LONGS_EQUAL(0, metrics.lost_packets);
+    UNSIGNED_LONGS_EQUAL(0, metrics.total_delay);
+}
+
+TEST(impairer, accept_on_flush) {
+    RecordingWriter writer;
+    Impairer impairer(writer, ImpairerConfig(), packet_factory, arena);
+    CHECK(impairer.is_valid());
+
+    LONGS_EQUAL(status::StatusOK, impairer.write(new_packet(0)));
+    LONGS_EQUAL(status::StatusOK, impairer.write(new_packet(1)));
+
+    // packets are not sent until flush
+    UNSIGNED_LONGS_EQUAL(0, writer.num_packets());
+    UNSIGNED_LONGS_EQUAL(2, impairer.metrics().queued_packets);
+
+    LONGS_EQUAL(status::StatusOK, impairer.flush(StartTime));
+
+    UNSIGNED_LONGS_EQUAL(2, writer.num_packets());
+    UNSIGNED_LONGS_EQUAL(0, impairer.metrics().queued_packets);
+    LONGS_EQUAL(0, impairer.flush_deadline());
+}
+
+TEST(impairer, random_loss) {
+    ImpairerConfig config;
+    config.good_loss = 0.1f;
+    config.seed = 1;
+
+    RecordingWriter writer;
+    Impairer impairer(writer, config, packet_factory, arena);
+    CHECK(impairer.is_valid());
+
+    run_link(impairer, writer, NumPackets);
+
+    const ImpairerMetrics metrics = impairer.metrics();
+
+    UNSIGNED_LONGS_EQUAL(NumPackets, metrics.written_packets);
+    UNSIGNED_LONGS_EQUAL(NumPackets, metrics.delivered_packets + metrics.lost_packets);
+    UNSIGNED_LONGS_EQUAL(metrics.delivered_packets, writer.num_packets());
+
+    DOUBLES_EQUAL(0.1, (double)metrics.lost_packets / NumPackets, 0.02);
+
+    // losses don't affect order
+    UNSIGNED_LONGS_EQUAL(0, writer.num_reordered());
+}
+
+TEST(impairer, burst_loss) {
+    // Gilbert model: mean burst length is 1 / bad_to_good = 4,
+    // mean loss rate is good_to_bad / (good_to_bad + bad_to_good) = 0.038
+    ImpairerConfig config;
+    config.good_to_bad = 0.01f;
+    config.bad_to_good = 0.25f;
+    config.seed = 1;
+
+    RecordingWriter writer;
+    Impairer impairer(writer, config, packet_factory, arena);
+    CHECK(impairer.is_valid());
+
+    run_link(impairer, writer, NumPackets);
+
+    const ImpairerMetrics metrics = impairer.metrics();
+
+    size_t n_lost = 0, n_bursts = 0;
+    for (size_t n = 1; n < writer.num_packets(); n++) {
+        const size_t gap = (size_t)seqnum_diff(writer.seqnum(n), writer.seqnum(n - 1));
+        if (gap > 1) {
+            n_lost += gap - 1;
+            n_bursts++;
+        }
+    }
+
+    CHECK(n_bursts > 0);
+    CHECK(n_lost <= metrics.lost_packets);
+
+    DOUBLES_EQUAL(0.038, (double)metrics.lost_packets / NumPackets, 0.015);
+    DOUBLES_EQUAL(4.0, (double)n_lost / n_bursts, 1.0);
+}
+
+TEST(impairer, delay) {
+    ImpairerConfig config;
+    config.delay = 10 * PacketInterval;
+
+    RecordingWriter writer;
+    Impairer impairer(writer, config, packet_factory, arena);
+    CHECK(impairer.is_valid());
+
+    LONGS_EQUAL(status::StatusOK, impairer.write(new_packet(0)));
+    LONGS_EQUAL(status::StatusOK, impairer.flush(StartTime));
+
+    UNSIGNED_LONGS_EQUAL(0, writer.num_packets());
+    LONGS_EQUAL(StartTime + config.delay, impairer.flush_deadline());
+
+    LONGS_EQUAL(status::StatusOK, impairer.flush(StartTime + config.delay - 1));
+    UNSIGNED_LONGS_EQUAL(0, writer.num_packets());
+
+    LONGS_EQUAL(status::StatusOK, impairer.flush(StartTime + config.delay));
+    UNSIGNED_LONGS_EQUAL(1, writer.num_packets());
+
+    LONGS_EQUAL(config.delay, impairer.metrics().total_delay);
+    LONGS_EQUAL(config.delay, impairer.metrics().max_delay);
+}
+
+TEST(impairer, jitter_uniform) {
+    ImpairerConfig config;
+    config.delay = 10 * PacketInterval;
+    config.jitter = 5 * PacketInterval;
+    config.jitter_distribution = ImpairerJitter_Uniform;
+    config.seed = 1;
+
+    RecordingWriter writer;
+    Impairer impairer(writer, config, packet_factory, arena);
+    CHECK(impairer.is_valid());
+
+    run_link(impairer, writer, NumPackets);
+
+    UNSIGNED_LONGS_EQUAL(NumPackets, writer.num_packets());
+
+    for (size_t n = 0; n < writer.num_packets(); n++) {
+        const core::nanoseconds_t delay = writer.time(n) - StartTime
+            - (core::nanoseconds_t)writer.seqnum(n) * PacketInterval;
+
+        CHECK(delay >= config.delay - config.jitter);
+        CHECK(delay <= config.delay + config.jitter);
+    }
+
+    const ImpairerMetrics metrics = impairer.metrics();
+
+    DOUBLES_EQUAL((double)config.delay, (double)metrics.total_delay / NumPackets,
+                  (double)PacketInterval / 2);
+    CHECK(metrics.max_delay <= config.delay + config.jitter);
+
+    // jitter larger than packet interval causes reordering
+    CHECK(writer.num_reordered() > 0);
+}
+
+TEST(impairer, jitter_normal) {
+    ImpairerConfig config;
+    config.delay = 10 * PacketInterval;
+    config.jitter = 2 * PacketInterval;
+    config.jitter_distribution = ImpairerJitter_Normal;
+    config.seed = 1;
+
+    RecordingWriter writer;
+    Impairer impairer(writer, config, packet_factory, arena);
+    CHECK(impairer.is_valid());
+
+    run_link(impairer, writer, NumPackets);
+
+    UNSIGNED_LONGS_EQUAL(NumPackets, writer.num_packets());
+
+    size_t n_within_sigma = 0;
+    for (size_t n = 0; n < writer.num_packets(); n++) {
+        const core::nanoseconds_t delay = writer.time(n) - StartTime
+            - (core::nanoseconds_t)writer.seqnum(n) * PacketInterval;
+
+        CHECK(delay >= 0);
+        if (delay >= config.delay - config.jitter
+            && delay <= config.delay + config.jitter) {
+            n_within_sigma++;
+        }
+    }
+
+    const ImpairerMetrics metrics = impairer.metrics();
+
+    DOUBLES_EQUAL((double)config.delay, (double)metrics.total_delay / NumPackets,
+                  (double)PacketInterval / 2);
+
+    // about 68% of normally distributed values are within one sigma
+    DOUBLES_EQUAL(0.68, (double)n_within_sigma / NumPackets, 0.05);
+}
+
+TEST(impairer, reorder) {
+    ImpairerConfig config;
+    config.delay = 5 * PacketInterval;
+    config.reorder = 0.1f;
+    config.seed = 1;
+
+    RecordingWriter writer;
+    Impairer impairer(writer, config, packet_factory, arena);
+    CHECK(impairer.is_valid());
+
+    run_link(impairer, writer, NumPackets);
+
+    UNSIGNED_LONGS_EQUAL(NumPackets, writer.num_packets());
+
+    const ImpairerMetrics metrics = impairer.metrics();
+
+    DOUBLES_EQUAL(0.1, (double)metrics.reordered_packets / NumPackets, 0.02);
+
+    // reordered packet overtakes packets delayed before it
+    CHECK(writer.num_reordered() > 0);
+    CHECK(writer.num_reordered() <= metrics.reordered_packets);
+}
+
+TEST(impairer, duplicate) {
+    ImpairerConfig config;
+    config.duplicate = 0.2f;
+    config.seed = 1;
+
+    RecordingWriter writer;
+    Impairer impairer(writer, config, packet_factory, arena);
+    CHECK(impairer.is_valid());
+
+    run_link(impairer, writer, NumPackets);
+
+    const ImpairerMetrics metrics = impairer.metrics();
+
+    UNSIGNED_LONGS_EQUAL(NumPackets + metrics.duplicated_packets,
+                         metrics.delivered_packets);
+    UNSIGNED_LONGS_EQUAL(metrics.delivered_packets, writer.num_packets());
+
+    DOUBLES_EQUAL(0.2, (double)metrics.duplicated_packets / NumPackets, 0.02);
+
+    size_t n_dups = 0;
+    for (size_t n = 1; n < writer.num_packets(); n++) {
+        if (writer.seqnum(n) == writer.seqnum(n - 1)) {
+            n_dups++;
+        }
+    }
+
+    // without delay, duplicate follows original
+    UNSIGNED_LONGS_EQUAL(metrics.duplicated_packets, n_dups);
+}
+
+TEST(impairer, duplicate_shares_buffer) {
+    ImpairerConfig config;
+    config.duplicate = 1;
+
+    Queue queue;
+    Impairer impairer(queue, config, packet_factory, arena);
+    CHECK(impairer.is_valid());
+
+    PacketPtr packet = new_packet(123);
+
+    LONGS_EQUAL(status::StatusOK, impairer.write(packet));
+    LONGS_EQUAL(status::StatusOK, impairer.flush(StartTime));
+
+    PacketPtr orig_packet, dup_packet;
+    LONGS_EQUAL(status::StatusOK, queue.read(orig_packet));
+    LONGS_EQUAL(status::StatusOK, queue.read(dup_packet));
+
+    CHECK(orig_packet == packet);
+    CHECK(dup_packet != packet);
+
+    UNSIGNED_LONGS_EQUAL(packet->flags(), dup_packet->flags());
+    UNSIGNED_LONGS_EQUAL(123, dup_packet->rtp()->seqnum);
+    POINTERS_EQUAL(packet->buffer().data(), dup_packet->buffer().data());
+    UNSIGNED_LONGS_EQUAL(packet->buffer().size(), dup_packet->buffer().size());
+}
+
+TEST(impairer, bitrate) {
+    enum { BurstSize = 10 };
+
+    // 100 bytes at 80 kbit/s take 10ms
+    const core::nanoseconds_t TxTime = 10 * core::Millisecond;
+
+    ImpairerConfig config;
+    config.max_bitrate = 80000;
+
+    RecordingWriter writer;
+    Impairer impairer(writer, config, packet_factory, arena);
+    CHECK(impairer.is_valid());
+
+    // burst of packets is spread in time
+    for (size_t n = 0; n < BurstSize; n++) {
+        LONGS_EQUAL(status::StatusOK, impairer.write(new_packet(seqnum_t(n))));
+    }
+
+    core::nanoseconds_t now = StartTime;
+    writer.set_time(now);
+    LONGS_EQUAL(status::StatusOK, impairer.flush(now));
+
+    while ((now = impairer.flush_deadline()) != 0) {
+        writer.set_time(now);
+        LONGS_EQUAL(status::StatusOK, impairer.flush(now));
+    }
+
+    UNSIGNED_LONGS_EQUAL(BurstSize, writer.num_packets());
+
+    for (size_t n = 0; n < BurstSize; n++) {
+        UNSIGNED_LONGS_EQUAL(n, writer.seqnum(n));
+        LONGS_EQUAL(StartTime + (core::nanoseconds_t)n * TxTime, writer.time(n));
+    }
+
+    LONGS_EQUAL((BurstSize - 1) * TxTime, impairer.metrics().max_delay);
+}
+
+TEST(impairer, bitrate_backlog) {
+    enum { BurstSize = 10 };
+
+    const core::nanoseconds_t TxTime = 10 * core::Millisecond;
+
+    ImpairerConfig config;
+    config.max_bitrate = 80000;
+    config.max_backlog = TxTime * 3 + TxTime / 2;
+
+    RecordingWriter writer;
+    Impairer impairer(writer, config, packet_factory, arena);
+    CHECK(impairer.is_valid());
+
+    for (size_t n = 0; n < BurstSize; n++) {
+        LONGS_EQUAL(status::StatusOK, impairer.write(new_packet(seqnum_t(n))));
+    }
+
+    core::nanoseconds_t now = StartTime;
+    LONGS_EQUAL(status::StatusOK, impairer.flush(now));
+
+    while ((now = impairer.flush_deadline()) != 0) {
+        LONGS_EQUAL(status::StatusOK, impairer.flush(now));
+    }
+
+    // packets that would wait more than 35ms are dropped
+    UNSIGNED_LONGS_EQUAL(4, writer.num_packets());
+    UNSIGNED_LONGS_EQUAL(BurstSize - 4, impairer.metrics().overflow_packets);
+}
+
+TEST(impairer, same_seed) {
+    ImpairerConfig config;
+    config.good_to_bad = 0.05f;
+    config.bad_to_good = 0.5f;
+    config.good_loss = 0.01f;
+    config.delay = 5 * PacketInterval;
+    config.jitter = 5 * PacketInterval;
+    config.duplicate = 0.05f;
+    config.seed = 42;
+
+    RecordingWriter writer1;
+    Impairer impairer1(writer1, config, packet_factory, arena);
+    CHECK(impairer1.is_valid());
+
+    RecordingWriter writer2;
+    Impairer impairer2(writer2, config, packet_factory, arena);
+    CHECK(impairer2.is_valid());
+
+    run_link(impairer1, writer1, NumPackets);
+    run_link(impairer2, writer2, NumPackets);
+
+    UNSIGNED_LONGS_EQUAL(writer1.num_packets(), writer2.num_packets());
+
+    for (size_t n = 0; n < writer1.num_packets(); n++) {
+        UNSIGNED_LONGS_EQUAL(writer1.seqnum(n), writer2.seqnum(n));
+        LONGS_EQUAL(writer1.time(n), writer2.time(n));
+    }
+}
+
+TEST(impairer, invalid_config) {
+    RecordingWriter writer;
+
+    {
+        ImpairerConfig config;
+        config.good_loss = 1.5f;
+
+        Impairer impairer(writer, config, packet_factory, arena);
+        CHECK(!impairer.is_valid());
+    }
+    {
+        ImpairerConfig config;
+        config.jitter = -1;
+
+        Impairer impairer(writer, config, packet_factory, arena);
+        CHECK(!impairer.is_valid());
+    }
+}
+
+} // namespace packet
+} // namespace roc
@@ -0,0 +1,360 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/heap_arena.h"
+#include "roc_packet/pacer.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_status/status_code.h"
+
+namespace roc {
+namespace packet {
+
+namespace {
+
+enum {
+    SampleRate = 48000,
+    PacketSamples = 120, // 2.5ms
+    PacketsPerFrame = 4, // 10ms
+    SourcePerBlock = 8,
+    RepairPerBlock = 4,
+    NumFrames = 50,
+    MaxPackets = NumFrames * PacketsPerFrame * 2
+};
+
+const core::nanoseconds_t PacketDuration = 2500 * core::Microsecond;
+const core::nanoseconds_t FrameDuration = PacketDuration * PacketsPerFrame;
+const core::nanoseconds_t StartTime = 1000000 * core::Second;
+const core::nanoseconds_t Epsilon = core::Microsecond;
+
+const audio::SampleSpec sample_spec(SampleRate,
+                                    audio::Sample_RawFormat,
+                                    audio::ChanLayout_Surround,
+                                    audio::ChanOrder_Smpte,
+                                    audio::ChanMask_Surround_Stereo);
+
+core::HeapArena arena;
+PacketFactory packet_factory(arena, 100);
+
+PacketPtr new_source_packet(stream_timestamp_t ts) {
+    PacketPtr packet = packet_factory.new_packet();
+    CHECK(packet);
+
+    packet->add_flags(Packet::FlagRTP | Packet::FlagAudio);
+    packet->rtp()->stream_timestamp = ts;
+    packet->rtp()->duration = PacketSamples;
+
+    return packet;
+}
+
+PacketPtr new_repair_packet() {
+    PacketPtr packet = packet_factory.new_packet();
+    CHECK(packet);
+
+    packet->add_flags(Packet::FlagFEC | Packet::FlagRepair);
+
+    return packet;
+}
+
+// Remembers time when each packet was written.
+class RecordingWriter : public IWriter {
+public:
+    RecordingWriter()
+        : now_(0)
+        , n_packets_(0) {
+    }
+
+    virtual ROC_ATTR_NODISCARD status::StatusCode write(const PacketPtr& packet) {
+        CHECK(packet);
+        CHECK(n_packets_ < MaxPackets);
+        times_[n_packets_++] = now_;
+        return status::StatusOK;
+    }
+
+    void set_time(core::nanoseconds_t now) {
+        now_ = now;
+    }
+
+    size_t num_packets() const {
+        return n_packets_;
+    }
+
+    core::nanoseconds_t time(size_t n) const {
+        CHECK(n < n_packets_);
+        return times_[n];
+    }
+
+    // Largest number of packets sent at the same time.
+    size_t max_burst() const {
+        size_t max_burst = 0, burst = 0;
+        for (size_t n = 0; n < n_packets_; n++) {
+            burst = (n != 0 && times_[n] == times_[n - 1]) ? burst + 1 : 1;
+            max_burst = std::max(max_burst, burst);
+        }
+        return max_burst;
+    }
+
+    // Number of gaps between consecutive packets within [lo, hi).
+    size_t count_gaps(core::nanoseconds_t lo, core::nanoseconds_t hi) const {
+        size_t count = 0;
+        for (size_t n = 1; n < n_packets_; n++) {
+            const core::nanoseconds_t gap = times_[n] - times_[n - 1];
+            if (gap >= lo && gap < hi) {
+                count++;
+            }
+        }
+        return count;
+    }
+
+private:
+    core::nanoseconds_t now_;
+    core::nanoseconds_t times_[MaxPackets];
+    size_t n_packets_;
+};
+
+// Simulates sender: every frame, all packets of the frame are written at once,
+// with repair packets written after every block of source packets. Between
+// frames, pacer is flushed at requested deadlines.
+void run_sender(Pacer& pacer, RecordingWriter& writer, bool with_repair) {
+    core::nanoseconds_t now = StartTime;
+    size_t n_source = 0;
+
+    for (size_t n_frame = 0; n_frame < NumFrames; n_frame++) {
+        const core::nanoseconds_t frame_time =
+            StartTime + (core::nanoseconds_t)n_frame * FrameDuration;
+
+        for (size_t n_pkt = 0; n_pkt < PacketsPerFrame; n_pkt++) {
+            LONGS_EQUAL(status::StatusOK,
+                        pacer.write(new_source_packet(
+                            stream_timestamp_t(n_source * PacketSamples))));
+            n_source++;
+
+            if (with_repair && n_source % SourcePerBlock == 0) {
+                for (size_t n_rpr = 0; n_rpr < RepairPerBlock; n_rpr++) {
+                    LONGS_EQUAL(status::StatusOK, pacer.write(new_repair_packet()));
+                }
+            }
+        }
+
+        const core::nanoseconds_t next_frame_time = frame_time + FrameDuration;
+
+        now = frame_time;
+        for (;;) {
+            writer.set_time(now);
+            LONGS_EQUAL(status::StatusOK, pacer.flush(now));
+
+            const core::nanoseconds_t deadline = pacer.flush_deadline(now);
+            if (deadline == 0 || deadline >= next_frame_time) {
+                break;
+            }
+            CHECK(deadline > now);
+            now = deadline;
+        }
+    }
+}
+
+} // namespace
+
+TEST_GROUP(pacer) {};
+
+TEST(pacer, empty) {
+    RecordingWriter writer;
+    Pacer pacer(writer, PacerConfig(), sample_spec);
+    CHECK(pacer.is_valid());
+
+    LONGS_EQUAL(0, pacer.flush_deadline(StartTime));
+    LONGS_EQUAL(status::StatusOK, pacer.flush(StartTime));
+    UNSIGNED_LONGS_EQUAL(0, writer.num_packets());
+}
+
+TEST(pacer, invalid_config) {
+    RecordingWriter writer;
+    PacerConfig config;
+    config.max_burst = 0;
+
+    Pacer pacer(writer, config, sample_spec);
+    CHECK(!pacer.is_valid());
+}
+
+TEST(pacer, source_packets) {
+    RecordingWriter writer;
+    Pacer pacer(writer, PacerConfig(), sample_spec);
+    CHECK(pacer.is_valid());
+
+    run_sender(pacer, writer, false);
+
+    UNSIGNED_LONGS_EQUAL(NumFrames * PacketsPerFrame, writer.num_packets());
+
+    // each packet is sent at time defined by its stream timestamp
+    for (size_t n = 0; n < writer.num_packets(); n++) {
+        CHECK(core::ns_equal_delta(StartTime + (core::nanoseconds_t)n * PacketDuration,
+                                   writer.time(n), Epsilon));
+    }
+
+    // all gaps are equal to packet duration
+    UNSIGNED_LONGS_EQUAL(writer.num_packets() - 1,
+                         writer.count_gaps(PacketDuration - Epsilon,
+                                           PacketDuration + Epsilon));
+    UNSIGNED_LONGS_EQUAL(1, writer.max_burst());
+
+    const PacerMetrics metrics = pacer.metrics();
+    UNSIGNED_LONGS_EQUAL(NumFrames * PacketsPerFrame, metrics.sent_packets);
+    UNSIGNED_LONGS_EQUAL(0, metrics.queued_packets);
+    UNSIGNED_LONGS_EQUAL(0, metrics.resyncs);
+}
+
+TEST(pacer, repair_packets) {
+    enum { TotalPackets = NumFrames * PacketsPerFrame * (SourcePerBlock + RepairPerBlock)
+               / SourcePerBlock };
+
+    PacerConfig config;
+    config.max_burst = 1;
+    config.burst_interval = 500 * core::Microsecond;
+
+    RecordingWriter writer;
+    Pacer pacer(writer, config, sample_spec);
+    CHECK(pacer.is_valid());
+
+    run_sender(pacer, writer, true);
+
+    UNSIGNED_LONGS_EQUAL(TotalPackets, writer.num_packets());
+
+    // no packets are sent back-to-back
+    UNSIGNED_LONGS_EQUAL(1, writer.max_burst());
+    UNSIGNED_LONGS_EQUAL(0, writer.count_gaps(0, config.burst_interval));
+
+    // repair packets are spread by burst interval
+    CHECK(writer.count_gaps(config.burst_interval, config.burst_interval + Epsilon)
+          >= NumFrames * PacketsPerFrame / SourcePerBlock * RepairPerBlock);
+
+    // no packet is delayed by more than a packet duration
+    CHECK(writer.count_gaps(PacketDuration + Epsilon, FrameDuration) == 0);
+
+    const PacerMetrics metrics = pacer.metrics();
+    UNSIGNED_LONGS_EQUAL(TotalPackets, metrics.sent_packets);
+    CHECK(metrics.limited_bursts > 0);
+    UNSIGNED_LONGS_EQUAL(0, metrics.resyncs);
+}
+
+TEST(pacer, burst) {
+    PacerConfig config;
+    config.max_burst = 3;
+
+    RecordingWriter writer;
+    Pacer pacer(writer, config, sample_spec);
+    CHECK(pacer.is_valid());
+
+    run_sender(pacer, writer, true);
+
+    // repair packets are sent in bursts of up to 3 packets
+    UNSIGNED_LONGS_EQUAL(3, writer.max_burst());
+}
+
+// Flush is invoked only once per frame, e.g. when sender is clocked by sound
+// card and has no timer. Packets should not pile up in queue.
+TEST(pacer, sparse_flush) {
+    PacerConfig config;
+    config.max_burst = 1;
+
+    RecordingWriter writer;
+    Pacer pacer(writer, config, sample_spec);
+    CHECK(pacer.is_valid());
+
+    size_t n_source = 0;
+
+    for (size_t n_frame = 0; n_frame < NumFrames; n_frame++) {
+        const core::nanoseconds_t frame_time =
+            StartTime + (core::nanoseconds_t)n_frame * FrameDuration;
+
+        for (size_t n_pkt = 0; n_pkt < PacketsPerFrame; n_pkt++) {
+            LONGS_EQUAL(status::StatusOK,
+                        pacer.write(new_source_packet(
+                            stream_timestamp_t(n_source * PacketSamples))));
+            n_source++;
+        }
+
+        writer.set_time(frame_time);
+        LONGS_EQUAL(status::StatusOK, pacer.flush(frame_time));
+
+        // all packets which became due since previous flush are sent
+        CHECK(pacer.metrics().queued_packets < PacketsPerFrame);
+    }
+
+    // no packet is delayed by more than a frame
+    for (size_t n = 0; n < writer.num_packets(); n++) {
+        const core::nanoseconds_t packet_time =
+            StartTime + (core::nanoseconds_t)n * PacketDuration;
+        CHECK(writer.time(n) >= packet_time);
+        CHECK(writer.time(n) < packet_time + FrameDuration);
+    }
+
+    const PacerMetrics metrics = pacer.metrics();
+    UNSIGNED_LONGS_EQUAL(0, metrics.overflows);
+    UNSIGNED_LONGS_EQUAL(0, metrics.resyncs);
+}
+
+TEST(pacer, resync) {
+    RecordingWriter writer;
+    Pacer pacer(writer, PacerConfig(), sample_spec);
+    CHECK(pacer.is_valid());
+
+    core::nanoseconds_t now = StartTime;
+
+    writer.set_time(now);
+    LONGS_EQUAL(status::StatusOK, pacer.write(new_source_packet(0)));
+    LONGS_EQUAL(status::StatusOK, pacer.flush(now));
+    UNSIGNED_LONGS_EQUAL(1, writer.num_packets());
+
+    // stream paused for a second
+    now += core::Second;
+
+    writer.set_time(now);
+    LONGS_EQUAL(status::StatusOK, pacer.write(new_source_packet(PacketSamples)));
+    LONGS_EQUAL(status::StatusOK,
+                pacer.write(new_source_packet(PacketSamples * 2)));
+
+    // first packet is sent immediately, and schedule is restarted from it
+    LONGS_EQUAL(status::StatusOK, pacer.flush(now));
+    UNSIGNED_LONGS_EQUAL(2, writer.num_packets());
+    LONGS_EQUAL(now + PacketDuration, pacer.flush_deadline(now));
+
+    now += PacketDuration;
+    writer.set_time(now);
+    LONGS_EQUAL(status::StatusOK, pacer.flush(now));
+    UNSIGNED_LONGS_EQUAL(3, writer.num_packets());
+
+    UNSIGNED_LONGS_EQUAL(1, pacer.metrics().resyncs);
+}
+
+TEST(pacer, queue_limit) {
+    PacerConfig config;
+    config.max_queue = 4;
+
+    RecordingWriter writer;
+    Pacer pacer(writer, config, sample_spec);
+    CHECK(pacer.is_valid());
+
+    writer.set_time(StartTime);
+
+    // flush is never called, packets above the limit are sent right away
+    for (size_t n = 0; n < 10; n++) {
+        const stream_timestamp_t ts = stream_timestamp_t(n * PacketSamples);
+        LONGS_EQUAL(status::StatusOK, pacer.write(new_source_packet(ts)));
+    }
+
+    UNSIGNED_LONGS_EQUAL(6, writer.num_packets());
+
+    const PacerMetrics metrics = pacer.metrics();
+    UNSIGNED_LONGS_EQUAL(6, metrics.sent_packets);
+    UNSIGNED_LONGS_EQUAL(6, metrics.overflows);
+    UNSIGNED_LONGS_EQUAL(4, metrics.queued_packets);
+}
+
+} // namespace packet
+} // namespace roc
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/heap_arena.h"
+#include "roc_core/ref_counted_impl.h"
+#include "roc_packet/concurrent_queue.h"
+#include "roc_packet/delayed_reader.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_packet/queue.h"
+#include "roc_packet/sorted_queue.h"
+#include "roc_status/status_code.h"
+
+// These tests check how many times reference counters are touched when packets
+// are passed through queues. They're enabled only with --enable-refcount-stats.
+#ifdef ROC_ENABLE_REFCOUNT_STATS
+
+namespace roc {
+namespace packet {
+
+namespace {
+
+enum { NumPackets = 100, NumSamples = 10, MaxBufSize = 100 };
+
+const audio::SampleSpec sample_spec(1000,
+                                    audio::Sample_RawFormat,
+                                    audio::ChanLayout_Surround,
+                                    audio::ChanOrder_Smpte,
+                                    audio::ChanMask_Surround_Stereo);
+
+core::HeapArena arena;
+PacketFactory packet_factory(arena, MaxBufSize);
+
+void make_packets(PacketPtr* packets) {
+    for (size_t n = 0; n < NumPackets; n++) {
+        packets[n] = packet_factory.new_packet();
+        CHECK(packets[n]);
+
+        packets[n]->add_flags(Packet::FlagRTP);
+        packets[n]->rtp()->seqnum = seqnum_t(n);
+        packets[n]->rtp()->stream_timestamp = stream_timestamp_t(n * NumSamples);
+        packets[n]->rtp()->duration = NumSamples;
+    }
+}
+
+// Write packets one by one and read each back, return average number of
+// reference counter operations per packet.
+double
+measure_ops(IWriter& writer, IReader& reader, PacketPtr* packets, size_t n_packets) {
+    core::RefCountedImpl::reset_refcount_ops();
+
+    for (size_t n = 0; n < n_packets; n++) {
+        LONGS_EQUAL(status::StatusOK, writer.write(packets[n]));
+
+        PacketPtr pp;
+        LONGS_EQUAL(status::StatusOK, reader.read(pp));
+        CHECK(pp == packets[n]);
+    }
+
+    return (double)core::RefCountedImpl::num_refcount_ops() / n_packets;
+}
+
+} // namespace
+
+TEST_GROUP(refcount_ops) {};
+
+TEST(refcount_ops, queue) {
+    PacketPtr packets[NumPackets];
+    make_packets(packets);
+
+    Queue queue;
+
+    // acquire by queue + release by reader
+    DOUBLES_EQUAL(2.0, measure_ops(queue, queue, packets, NumPackets), 0);
+}
+
+TEST(refcount_ops, concurrent_queue) {
+    PacketPtr packets[NumPackets];
+    make_packets(packets);
+
+    ConcurrentQueue queue(ConcurrentQueue::NonBlocking);
+
+    // acquire by queue + release by reader
+    DOUBLES_EQUAL(2.0, measure_ops(queue, queue, packets, NumPackets), 0);
+}
+
+TEST(refcount_ops, sorted_queue) {
+    PacketPtr packets[NumPackets];
+    make_packets(packets);
+
+    SortedQueue queue(0);
+
+    // acquire by queue + acquire and release of latest packet + release by reader
+    CHECK(measure_ops(queue, queue, packets, NumPackets) <= 4.0);
+}
+
+TEST(refcount_ops, delayed_reader) {
+    PacketPtr packets[NumPackets];
+    make_packets(packets);
+
+    SortedQueue queue(0);
+    DelayedReader reader(queue, NumSamples * core::Millisecond, sample_spec);
+    CHECK(reader.is_valid());
+
+    // accumulate initial delay
+    measure_ops(queue, reader, packets, 1);
+
+    // then delayed reader passes packets through without extra references
+    CHECK(measure_ops(queue, reader, packets + 1, NumPackets - 1) <= 4.0);
+}
+
+} // namespace packet
+} // namespace roc
+
+#endif // ROC_ENABLE_REFCOUNT_STATS
@@ -9,6 +9,7 @@
 #include <CppUTest/TestHarness.h>
 
 #include "roc_core/heap_arena.h"
+#include "roc_core/macro_helpers.h"
 #include "roc_packet/packet_factory.h"
 #include "roc_packet/queue.h"
 #include "roc_packet/router.h"
@@ -39,6 +40,33 @@ PacketPtr new_fec_packet(unsigned flags) {
     return packet;
 }
 
+// Counts write_batch() calls.
+class BatchCounter : public IWriter {
+public:
+    explicit BatchCounter(IWriter& writer)
+        : writer_(writer)
+        , n_batches_(0) {
+    }
+
+    virtual ROC_ATTR_NODISCARD status::StatusCode write(const PacketPtr& pp) {
+        return writer_.write(pp);
+    }
+
+    virtual ROC_ATTR_NODISCARD status::StatusCode write_batch(const PacketPtr* packets,
+                                                              size_t n_packets) {
+        n_batches_++;
+        return writer_.write_batch(packets, n_packets);
+    }
+
+    size_t num_batches() const {
+        return n_batches_;
+    }
+
+private:
+    IWriter& writer_;
+    size_t n_batches_;
+};
+
 } // namespace
 
 TEST_GROUP(router) {};
@@ -316,5 +344,46 @@ TEST(router, source_id_two_sources) {
     LONGS_EQUAL(22, router.get_source_id(Packet::FlagRepair));
 }
 
+TEST(router, write_batch) {
+    Router router(arena);
+
+    Queue queue_a;
+    Queue queue_r;
+    BatchCounter counter_a(queue_a);
+    BatchCounter counter_r(queue_r);
+    CHECK(router.add_route(counter_a, Packet::FlagAudio));
+    CHECK(router.add_route(counter_r, Packet::FlagRepair));
+
+    PacketPtr packets[] = {
+        new_rtp_packet(11, Packet::FlagAudio), new_rtp_packet(11, Packet::FlagAudio),
+        new_fec_packet(Packet::FlagRepair),    new_rtp_packet(11, Packet::FlagAudio),
+        new_rtp_packet(22, Packet::FlagAudio), new_rtp_packet(11, Packet::FlagAudio),
+    };
+
+    LONGS_EQUAL(status::StatusOK, router.write_batch(packets, ROC_ARRAY_SIZE(packets)));
+
+    // Consecutive packets of the same route are written at once,
+    // packet from unexpected source is dropped and splits the batch.
+    LONGS_EQUAL(3, counter_a.num_batches());
+    LONGS_EQUAL(1, counter_r.num_batches());
+
+    LONGS_EQUAL(4, queue_a.size());
+    LONGS_EQUAL(1, queue_r.size());
+
+    LONGS_EQUAL(1, packets[4]->getref());
+
+    const size_t expected_a[] = { 0, 1, 3, 5 };
+
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(expected_a); n++) {
+        PacketPtr pp;
+        LONGS_EQUAL(status::StatusOK, queue_a.read(pp));
+        CHECK(pp == packets[expected_a[n]]);
+    }
+
+    PacketPtr pp;
+    LONGS_EQUAL(status::StatusOK, queue_r.read(pp));
+    CHECK(pp == packets[2]);
+}
+
 } // namespace packet
 } // namespace roc
@@ -417,6 +417,34 @@ TEST(sorted_queue, overflow_out_of_order) {
     CHECK(!pp);
 }
 
+TEST(sorted_queue, batch) {
+    enum { NumPackets = 10 };
+
+    SortedQueue queue(0);
+
+    PacketPtr packets[NumPackets];
+    for (seqnum_t n = 0; n < NumPackets; n++) {
+        packets[n] = new_packet(seqnum_t((n * 7) % NumPackets));
+    }
+
+    LONGS_EQUAL(status::StatusOK, queue.write_batch(packets, NumPackets));
+    LONGS_EQUAL(NumPackets, queue.size());
+
+    PacketPtr rp[NumPackets];
+
+    for (seqnum_t n = 0; n < NumPackets; n++) {
+        LONGS_EQUAL(status::StatusOK, queue.read(rp[n]));
+        CHECK(rp[n]);
+        LONGS_EQUAL(n, rp[n]->rtp()->seqnum);
+    }
+
+    LONGS_EQUAL(0, queue.size());
+
+    PacketPtr pp;
+    LONGS_EQUAL(status::StatusNoData, queue.read(pp));
+    CHECK(!pp);
+}
+
 TEST(sorted_queue, latest) {
     SortedQueue queue(0);
 
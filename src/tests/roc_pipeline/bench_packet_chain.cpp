@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "roc_audio/pcm_decoder.h"
+#include "roc_core/heap_arena.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/panic.h"
+#include "roc_core/ref_counted_impl.h"
+#include "roc_packet/delayed_reader.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_packet/router.h"
+#include "roc_packet/sorted_queue.h"
+#include "roc_rtp/encoding_map.h"
+#include "roc_rtp/filter.h"
+#include "roc_rtp/headers.h"
+#include "roc_rtp/link_meter.h"
+#include "roc_rtp/timestamp_injector.h"
+#include "roc_status/status_code.h"
+
+namespace roc {
+namespace pipeline {
+namespace {
+
+// Measures cost of moving packets through receiver packet chain, from session
+// router to timestamp injector, when packets are moved one by one (PerPacket),
+// and when they're written in bursts (Batch). In both cases packets are read
+// one by one, like depacketizer does. Argument is burst size.
+//
+// Output columns:
+//  Time        - time of writing and reading one burst
+//  sec/packet  - time per packet
+//  refs/packet - reference counter operations per packet
+//                (only if built with --enable-refcount-stats)
+
+enum { MaxBatch = 128, PacketSz = 512, SamplesPerPacket = 100 };
+
+const audio::SampleSpec sample_spec(44100,
+                                    audio::PcmFormat_SInt16_Be,
+                                    audio::ChanLayout_Surround,
+                                    audio::ChanOrder_Smpte,
+                                    audio::ChanMask_Surround_Stereo);
+
+core::HeapArena arena;
+packet::PacketFactory packet_factory(arena, PacketSz);
+rtp::EncodingMap encoding_map(arena);
+
+// Same chain of writers and readers as in ReceiverSession, without FEC.
+class PacketChain : public core::NonCopyable<> {
+public:
+    PacketChain()
+        : router_(arena)
+        , queue_(0)
+        , meter_(encoding_map)
+        , decoder_(sample_spec)
+        , filter_(queue_, decoder_, rtp::FilterConfig(), sample_spec)
+        , delayed_reader_(
+              filter_, sample_spec.stream_timestamp_2_ns(SamplesPerPacket), sample_spec)
+        , injector_(meter_, sample_spec)
+        , seqnum_(0)
+        , timestamp_(0) {
+        meter_.set_writer(queue_);
+        meter_.set_reader(delayed_reader_);
+
+        roc_panic_if(!router_.add_route(meter_, packet::Packet::FlagAudio));
+        roc_panic_if(!delayed_reader_.is_valid());
+    }
+
+    // Pass one packet through chain, so that delayed reader accumulates
+    // its latency and then passes packets through.
+    void start(const packet::PacketPtr& packet) {
+        packet::PacketPtr pp = packet;
+        prepare(&pp, 1);
+
+        status::StatusCode code = router_.write(pp);
+        roc_panic_if(code != status::StatusOK);
+
+        code = injector_.read(pp);
+        roc_panic_if(code != status::StatusOK);
+    }
+
+    packet::IWriter& writer() {
+        return router_;
+    }
+
+    packet::IReader& reader() {
+        return injector_;
+    }
+
+    // Assign next seqnums and timestamps to packets.
+    void prepare(packet::PacketPtr* packets, size_t n_packets) {
+        for (size_t n = 0; n < n_packets; n++) {
+            packet::RTP& rtp = *packets[n]->rtp();
+
+            rtp.seqnum = seqnum_++;
+            rtp.stream_timestamp = timestamp_;
+            rtp.capture_timestamp = 0;
+
+            timestamp_ += SamplesPerPacket;
+        }
+    }
+
+private:
+    packet::Router router_;
+    packet::SortedQueue queue_;
+    rtp::LinkMeter meter_;
+
+    audio::PcmDecoder decoder_;
+    rtp::Filter filter_;
+    packet::DelayedReader delayed_reader_;
+    rtp::TimestampInjector injector_;
+
+    packet::seqnum_t seqnum_;
+    packet::stream_timestamp_t timestamp_;
+};
+
+void make_packets(packet::PacketPtr* packets, size_t n_packets) {
+    for (size_t n = 0; n < n_packets; n++) {
+        packet::PacketPtr pp = packet_factory.new_packet();
+        roc_panic_if(!pp);
+
+        pp->add_flags(packet::Packet::FlagRTP | packet::Packet::FlagAudio);
+
+        pp->rtp()->source_id = 123;
+        pp->rtp()->payload_type = rtp::PayloadType_L16_Stereo;
+        pp->rtp()->duration = SamplesPerPacket;
+        pp->rtp()->payload = packet_factory.new_packet_buffer();
+
+        packets[n] = pp;
+    }
+}
+
+void reset_stats() {
+#ifdef ROC_ENABLE_REFCOUNT_STATS
+    core::RefCountedImpl::reset_refcount_ops();
+#endif
+}
+
+void report(benchmark::State& state, size_t batch_size) {
+    state.counters["sec/packet"] =
+        benchmark::Counter((double)state.iterations() * batch_size,
+                           benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+
+#ifdef ROC_ENABLE_REFCOUNT_STATS
+    state.counters["refs/packet"] = (double)core::RefCountedImpl::num_refcount_ops()
+        / ((double)state.iterations() * batch_size);
+#endif
+}
+
+void BM_PacketChain_PerPacket(benchmark::State& state) {
+    const size_t batch_size = (size_t)state.range(0);
+
+    PacketChain chain;
+
+    packet::PacketPtr packets[MaxBatch];
+    make_packets(packets, batch_size);
+
+    chain.start(packets[0]);
+    reset_stats();
+
+    while (state.KeepRunning()) {
+        chain.prepare(packets, batch_size);
+
+        for (size_t n = 0; n < batch_size; n++) {
+            const status::StatusCode code = chain.writer().write(packets[n]);
+            roc_panic_if(code != status::StatusOK);
+        }
+
+        for (size_t n = 0; n < batch_size; n++) {
+            const status::StatusCode code = chain.reader().read(packets[n]);
+            roc_panic_if(code != status::StatusOK);
+        }
+    }
+
+    report(state, batch_size);
+}
+
+BENCHMARK(BM_PacketChain_PerPacket)
+    ->Arg(1)
+    ->Arg(8)
+    ->Arg(32)
+    ->Arg(128)
+    ->Unit(benchmark::kNanosecond);
+
+void BM_PacketChain_Batch(benchmark::State& state) {
+    const size_t batch_size = (size_t)state.range(0);
+
+    PacketChain chain;
+
+    packet::PacketPtr packets[MaxBatch];
+    make_packets(packets, batch_size);
+
+    chain.start(packets[0]);
+    reset_stats();
+
+    while (state.KeepRunning()) {
+        chain.prepare(packets, batch_size);
+
+        const status::StatusCode code = chain.writer().write_batch(packets, batch_size);
+        roc_panic_if(code != status::StatusOK);
+
+        for (size_t n = 0; n < batch_size; n++) {
+            const status::StatusCode code = chain.reader().read(packets[n]);
+            roc_panic_if(code != status::StatusOK);
+        }
+    }
+
+    report(state, batch_size);
+}
+
+BENCHMARK(BM_PacketChain_Batch)
+    ->Arg(1)
+    ->Arg(8)
+    ->Arg(32)
+    ->Arg(128)
+    ->Unit(benchmark::kNanosecond);
+
+} // namespace
+} // namespace pipeline
+} // namespace roc
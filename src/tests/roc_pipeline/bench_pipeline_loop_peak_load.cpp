@@ -345,6 +345,10 @@ private:
         return true;
     }
 
+    virtual core::nanoseconds_t refresh_imp(core::nanoseconds_t) {
+        return 0;
+    }
+
     virtual void schedule_task_processing(PipelineLoop&, core::nanoseconds_t deadline) {
         control_queue_.schedule_at(control_task_, deadline, *this, NULL);
     }
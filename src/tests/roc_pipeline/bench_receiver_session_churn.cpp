@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "roc_audio/frame_factory.h"
+#include "roc_core/heap_arena.h"
+#include "roc_core/panic.h"
+#include "roc_core/shared_ptr.h"
+#include "roc_core/stddefs.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_pipeline/config.h"
+#include "roc_pipeline/receiver_session.h"
+#include "roc_rtp/encoding_map.h"
+
+namespace roc {
+namespace pipeline {
+namespace {
+
+// Measures cost of session join and leave, when a session is created from
+// scratch and destroyed (Allocate), and when it is recycled and reset (Recycle).
+//
+// Output columns:
+//  Time          - time of one join + leave
+//  allocs/churn  - number of allocations from arena per join + leave
+
+enum { MaxBufSize = 4096 };
+
+core::HeapArena heap_arena;
+
+// Arena that counts allocation requests.
+class CountingArena : public core::IArena, public core::NonCopyable<> {
+public:
+    CountingArena()
+        : num_allocations_(0) {
+    }
+
+    virtual void* allocate(size_t size) {
+        num_allocations_++;
+        return heap_arena.allocate(size);
+    }
+
+    virtual void deallocate(void* ptr) {
+        heap_arena.deallocate(ptr);
+    }
+
+    virtual size_t compute_allocated_size(size_t size) const {
+        return heap_arena.compute_allocated_size(size);
+    }
+
+    virtual size_t allocated_size(void* ptr) const {
+        return heap_arena.allocated_size(ptr);
+    }
+
+    size_t num_allocations() const {
+        return num_allocations_;
+    }
+
+private:
+    size_t num_allocations_;
+};
+
+ReceiverSessionConfig make_session_config() {
+    ReceiverSessionConfig config;
+    config.payload_type = rtp::PayloadType_L16_Stereo;
+    config.deduce_defaults();
+    return config;
+}
+
+ReceiverCommonConfig make_common_config() {
+    ReceiverCommonConfig config;
+    config.output_sample_spec.set_sample_rate(48000);
+    config.deduce_defaults();
+    return config;
+}
+
+void BM_SessionChurn_Allocate(benchmark::State& state) {
+    CountingArena arena;
+
+    packet::PacketFactory packet_factory(arena, MaxBufSize);
+    audio::FrameFactory frame_factory(arena, MaxBufSize);
+    rtp::EncodingMap encoding_map(arena);
+
+    const ReceiverSessionConfig session_config = make_session_config();
+    const ReceiverCommonConfig common_config = make_common_config();
+
+    const size_t start_allocations = arena.num_allocations();
+
+    while (state.KeepRunning()) {
+        core::SharedPtr<ReceiverSession> sess =
+            new (arena) ReceiverSession(session_config, common_config, encoding_map,
+                                        packet_factory, frame_factory, arena);
+        roc_panic_if(!sess || !sess->is_valid());
+    }
+
+    state.counters["allocs/churn"] =
+        (double)(arena.num_allocations() - start_allocations) / state.iterations();
+}
+
+BENCHMARK(BM_SessionChurn_Allocate)->Unit(benchmark::kMicrosecond);
+
+void BM_SessionChurn_Recycle(benchmark::State& state) {
+    CountingArena arena;
+
+    packet::PacketFactory packet_factory(arena, MaxBufSize);
+    audio::FrameFactory frame_factory(arena, MaxBufSize);
+    rtp::EncodingMap encoding_map(arena);
+
+    const ReceiverSessionConfig session_config = make_session_config();
+    const ReceiverCommonConfig common_config = make_common_config();
+
+    core::SharedPtr<ReceiverSession> sess =
+        new (arena) ReceiverSession(session_config, common_config, encoding_map,
+                                    packet_factory, frame_factory, arena);
+    roc_panic_if(!sess || !sess->is_valid());
+
+    const size_t start_allocations = arena.num_allocations();
+
+    while (state.KeepRunning()) {
+        sess->recycle();
+        roc_panic_if(!sess->reset(session_config));
+    }
+
+    state.counters["allocs/churn"] =
+        (double)(arena.num_allocations() - start_allocations) / state.iterations();
+}
+
+BENCHMARK(BM_SessionChurn_Recycle)->Unit(benchmark::kMicrosecond);
+
+} // namespace
+} // namespace pipeline
+} // namespace roc
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "test_helpers/mock_source.h"
+
+#include "roc_core/array.h"
+#include "roc_core/heap_arena.h"
+#include "roc_core/macro_helpers.h"
+#include "roc_core/slab_pool.h"
+#include "roc_pipeline/batch_transcoder.h"
+#include "roc_pipeline/transcoder_sink.h"
+
+namespace roc {
+namespace pipeline {
+
+namespace {
+
+enum {
+    MaxBufSize = 10000,
+
+    InputRate = 44100,
+    OutputRate = 48000,
+
+    FrameSize = 441,
+    NumFrames = 200
+};
+
+const double Epsilon = 0.0001;
+
+const audio::ChannelMask Chans_Mono = audio::ChanMask_Surround_Mono;
+const audio::ChannelMask Chans_Stereo = audio::ChanMask_Surround_Stereo;
+
+core::HeapArena arena;
+
+core::SlabPool<core::Buffer> buffer_pool("frame_buffer_pool",
+                                         arena,
+                                         sizeof(core::Buffer)
+                                             + MaxBufSize * sizeof(audio::sample_t));
+
+// Collects all written samples.
+class CollectingWriter : public audio::IFrameWriter {
+public:
+    CollectingWriter()
+        : samples_(arena) {
+    }
+
+    virtual void write(audio::Frame& frame) {
+        const size_t pos = samples_.size();
+        CHECK(samples_.resize(pos + frame.num_raw_samples()));
+        memcpy(samples_.data() + pos, frame.raw_samples(),
+               frame.num_raw_samples() * sizeof(audio::sample_t));
+    }
+
+    const core::Array<audio::sample_t>& samples() const {
+        return samples_;
+    }
+
+private:
+    core::Array<audio::sample_t> samples_;
+};
+
+audio::SampleSpec make_spec(size_t rate, audio::ChannelMask chans) {
+    return audio::SampleSpec(rate, audio::Sample_RawFormat, audio::ChanLayout_Surround,
+                             audio::ChanOrder_Smpte, chans);
+}
+
+TranscoderConfig make_config(size_t in_rate,
+                             audio::ChannelMask in_chans,
+                             size_t out_rate,
+                             audio::ChannelMask out_chans) {
+    TranscoderConfig config;
+
+    config.input_sample_spec = make_spec(in_rate, in_chans);
+    config.output_sample_spec = make_spec(out_rate, out_chans);
+
+    config.resampler.backend = audio::ResamplerBackend_Builtin;
+
+    config.batch.num_workers = 3;
+    config.batch.segment_length = 300 * core::Millisecond;
+    config.batch.frame_length = 10 * core::Millisecond;
+
+    return config;
+}
+
+// Transcode input frame by frame using a single pipeline.
+// Optionally, append given number of frames of silence to input.
+void run_sequential(const TranscoderConfig& config,
+                    CollectingWriter& writer,
+                    size_t n_pad_frames = 0) {
+    test::MockSource source;
+    source.add(FrameSize * NumFrames, config.input_sample_spec);
+
+    TranscoderSink transcoder(config, &writer, buffer_pool, arena);
+    CHECK(transcoder.is_valid());
+
+    const size_t n_chans = config.input_sample_spec.num_channels();
+
+    audio::sample_t samples[FrameSize * 2];
+    for (;;) {
+        audio::Frame frame(samples, FrameSize * n_chans);
+        if (!source.read(frame)) {
+            break;
+        }
+        transcoder.write(frame);
+    }
+
+    for (size_t n = 0; n < n_pad_frames; n++) {
+        memset(samples, 0, sizeof(samples));
+        audio::Frame frame(samples, FrameSize * n_chans);
+        frame.set_duration(FrameSize);
+        transcoder.write(frame);
+    }
+}
+
+// Transcode input using batch transcoder.
+// Returns number of segments.
+size_t run_batch(const TranscoderConfig& config, CollectingWriter& writer) {
+    test::MockSource source;
+    source.add(FrameSize * NumFrames, config.input_sample_spec);
+
+    BatchTranscoder transcoder(config, arena);
+    CHECK(transcoder.is_valid());
+
+    CHECK(transcoder.run(source, writer));
+
+    LONGS_EQUAL(config.input_sample_spec.samples_per_chan_2_ns(FrameSize * NumFrames),
+                transcoder.metrics().input_duration);
+
+    return transcoder.metrics().num_segments;
+}
+
+// Compare actual output with beginning of expected output.
+void compare(const CollectingWriter& expected, const CollectingWriter& actual) {
+    CHECK(expected.samples().size() >= actual.samples().size());
+
+    for (size_t n = 0; n < actual.samples().size(); n++) {
+        DOUBLES_EQUAL((double)expected.samples()[n], (double)actual.samples()[n],
+                      Epsilon);
+    }
+}
+
+} // namespace
+
+TEST_GROUP(batch_transcoder) {};
+
+TEST(batch_transcoder, same_spec) {
+    const TranscoderConfig config =
+        make_config(InputRate, Chans_Stereo, InputRate, Chans_Stereo);
+
+    CollectingWriter expected;
+    run_sequential(config, expected);
+
+    CollectingWriter actual;
+    CHECK(run_batch(config, actual) > 1);
+
+    LONGS_EQUAL(FrameSize * NumFrames * 2, expected.samples().size());
+    LONGS_EQUAL(FrameSize * NumFrames * 2, actual.samples().size());
+    compare(expected, actual);
+}
+
+TEST(batch_transcoder, channel_mapping) {
+    const TranscoderConfig config =
+        make_config(InputRate, Chans_Stereo, InputRate, Chans_Mono);
+
+    CollectingWriter expected;
+    run_sequential(config, expected);
+
+    CollectingWriter actual;
+    CHECK(run_batch(config, actual) > 1);
+
+    LONGS_EQUAL(FrameSize * NumFrames, expected.samples().size());
+    LONGS_EQUAL(FrameSize * NumFrames, actual.samples().size());
+    compare(expected, actual);
+}
+
+TEST(batch_transcoder, resampling_parallel) {
+    // Resampler period is short (3 input samples per 2 output samples
+    // for downsampling, 3 per 4 for upsampling), so input is split into
+    // segments, and output should be identical to sequential transcoding
+    // of the same input followed by silence.
+    enum { NumPadFrames = 20 };
+
+    const size_t rates[][2] = {
+        { 48000, 32000 },
+        { 24000, 32000 },
+    };
+
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(rates); n++) {
+        const size_t in_rate = rates[n][0];
+        const size_t out_rate = rates[n][1];
+
+        TranscoderConfig config =
+            make_config(in_rate, Chans_Stereo, out_rate, Chans_Stereo);
+        config.batch.frame_length =
+            config.input_sample_spec.samples_per_chan_2_ns(FrameSize);
+
+        CollectingWriter expected;
+        run_sequential(config, expected, NumPadFrames);
+
+        CollectingWriter actual;
+        CHECK(run_batch(config, actual) > 1);
+
+        LONGS_EQUAL(FrameSize * NumFrames * out_rate / in_rate * 2,
+                    actual.samples().size());
+        compare(expected, actual);
+    }
+}
+
+TEST(batch_transcoder, resampling_sequential) {
+    // Resampler period for 44100 => 48000 is much longer than segment,
+    // so input is not split into segments.
+    const TranscoderConfig config =
+        make_config(InputRate, Chans_Stereo, OutputRate, Chans_Mono);
+
+    CollectingWriter expected;
+    run_sequential(config, expected);
+
+    CollectingWriter actual;
+    UNSIGNED_LONGS_EQUAL(1, run_batch(config, actual));
+
+    // whole output is the same as if input was transcoded frame by frame
+    CHECK(actual.samples().size() > 0);
+    LONGS_EQUAL(expected.samples().size(), actual.samples().size());
+    compare(expected, actual);
+}
+
+TEST(batch_transcoder, num_workers) {
+    // Segmentation doesn't depend on number of workers,
+    // so output should be identical.
+    TranscoderConfig config =
+        make_config(InputRate, Chans_Stereo, InputRate, Chans_Mono);
+
+    config.batch.num_workers = 1;
+    CollectingWriter expected;
+    run_batch(config, expected);
+
+    config.batch.num_workers = 4;
+    CollectingWriter actual;
+    run_batch(config, actual);
+
+    compare(expected, actual);
+}
+
+} // namespace pipeline
+} // namespace roc
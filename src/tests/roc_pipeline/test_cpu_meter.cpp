@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/time.h"
+#include "roc_pipeline/cpu_meter.h"
+
+namespace roc {
+namespace pipeline {
+
+namespace {
+
+const core::nanoseconds_t Busy = core::Millisecond;
+
+// Consume given amount of CPU time.
+void spin(core::nanoseconds_t duration) {
+    const core::nanoseconds_t start = core::thread_cpu_timestamp();
+
+    while (core::thread_cpu_timestamp() < start + duration) {
+    }
+}
+
+} // namespace
+
+TEST_GROUP(cpu_meter) {};
+
+TEST(cpu_meter, initial) {
+    CpuMeter meter(10);
+
+    const CpuMetrics& metrics = meter.metrics();
+
+    UNSIGNED_LONGS_EQUAL(0, metrics.frame_count);
+    LONGS_EQUAL(0, metrics.total_time);
+    LONGS_EQUAL(0, metrics.avg_frame_time);
+    LONGS_EQUAL(0, metrics.max_frame_time);
+
+    for (size_t n = 0; n < CpuStage_Max; n++) {
+        LONGS_EQUAL(0, metrics.avg_stage_time[n]);
+        LONGS_EQUAL(0, metrics.max_stage_time[n]);
+    }
+}
+
+TEST(cpu_meter, frame) {
+    CpuMeter meter(10);
+
+    meter.begin_frame();
+    spin(Busy);
+    meter.end_frame();
+
+    const CpuMetrics& metrics = meter.metrics();
+
+    UNSIGNED_LONGS_EQUAL(1, metrics.frame_count);
+    CHECK(metrics.total_time >= Busy);
+    CHECK(metrics.avg_frame_time >= Busy);
+    CHECK(metrics.max_frame_time >= Busy);
+
+    for (size_t n = 0; n < CpuStage_Max; n++) {
+        LONGS_EQUAL(0, metrics.avg_stage_time[n]);
+        LONGS_EQUAL(0, metrics.max_stage_time[n]);
+    }
+}
+
+TEST(cpu_meter, nested_stages) {
+    CpuMeter meter(10);
+
+    meter.begin_frame();
+    spin(Busy);
+    meter.begin_stage(CpuStage_Resampler);
+    spin(Busy);
+    meter.begin_stage(CpuStage_Codec);
+    spin(Busy);
+    meter.begin_stage(CpuStage_Fec);
+    spin(Busy);
+    meter.end_stage(CpuStage_Fec);
+    meter.end_stage(CpuStage_Codec);
+    meter.end_stage(CpuStage_Resampler);
+    meter.end_frame();
+
+    const CpuMetrics& metrics = meter.metrics();
+
+    CHECK(metrics.avg_frame_time >= Busy * 4);
+
+    // time of nested stage is not included into enclosing stage
+    CHECK(metrics.avg_stage_time[CpuStage_Fec] >= Busy);
+    CHECK(metrics.avg_stage_time[CpuStage_Codec] >= Busy);
+    CHECK(metrics.avg_stage_time[CpuStage_Codec] < Busy * 2);
+    CHECK(metrics.avg_stage_time[CpuStage_Resampler] >= Busy);
+    CHECK(metrics.avg_stage_time[CpuStage_Resampler] < Busy * 2);
+
+    CHECK(metrics.avg_frame_time
+          >= metrics.avg_stage_time[CpuStage_Fec] + metrics.avg_stage_time[CpuStage_Codec]
+              + metrics.avg_stage_time[CpuStage_Resampler]);
+
+    LONGS_EQUAL(0, metrics.avg_stage_time[CpuStage_Packets]);
+}
+
+TEST(cpu_meter, stage_outside_frame) {
+    CpuMeter meter(10);
+
+    // accounted in next frame
+    meter.begin_stage(CpuStage_Packets);
+    spin(Busy);
+    meter.end_stage(CpuStage_Packets);
+
+    UNSIGNED_LONGS_EQUAL(0, meter.metrics().frame_count);
+    LONGS_EQUAL(0, meter.metrics().avg_stage_time[CpuStage_Packets]);
+
+    meter.begin_frame();
+    meter.end_frame();
+
+    UNSIGNED_LONGS_EQUAL(1, meter.metrics().frame_count);
+    CHECK(meter.metrics().avg_stage_time[CpuStage_Packets] >= Busy);
+    CHECK(meter.metrics().avg_frame_time >= Busy);
+
+    // not accounted again
+    meter.begin_frame();
+    meter.end_frame();
+
+    CHECK(meter.metrics().avg_stage_time[CpuStage_Packets] >= Busy / 2);
+    CHECK(meter.metrics().avg_stage_time[CpuStage_Packets] < Busy);
+    CHECK(meter.metrics().max_stage_time[CpuStage_Packets] >= Busy);
+}
+
+TEST(cpu_meter, external_stage_time) {
+    CpuMeter meter(10);
+
+    // accounted in next frame, like stage outside frame
+    meter.add_stage_time(CpuStage_Fec, Busy);
+
+    meter.begin_frame();
+    meter.add_stage_time(CpuStage_Fec, Busy);
+    meter.end_frame();
+
+    // included into both stage and frame time
+    LONGS_EQUAL(Busy * 2, meter.metrics().avg_stage_time[CpuStage_Fec]);
+    CHECK(meter.metrics().avg_frame_time >= Busy * 2);
+
+    // negative time is ignored
+    meter.begin_frame();
+    meter.add_stage_time(CpuStage_Fec, -Busy);
+    meter.end_frame();
+
+    LONGS_EQUAL(Busy, meter.metrics().avg_stage_time[CpuStage_Fec]);
+    LONGS_EQUAL(Busy * 2, meter.metrics().max_stage_time[CpuStage_Fec]);
+}
+
+TEST(cpu_meter, window) {
+    enum { Window = 4 };
+
+    CpuMeter meter(Window);
+
+    // first window, metrics are updated on every frame
+    for (size_t n = 0; n < Window; n++) {
+        meter.begin_frame();
+        meter.begin_stage(CpuStage_Codec);
+        spin(Busy);
+        meter.end_stage(CpuStage_Codec);
+        meter.end_frame();
+
+        UNSIGNED_LONGS_EQUAL(n + 1, meter.metrics().frame_count);
+        CHECK(meter.metrics().avg_stage_time[CpuStage_Codec] >= Busy);
+        CHECK(meter.metrics().avg_stage_time[CpuStage_Codec] < Busy * 2);
+    }
+
+    const CpuMetrics first_metrics = meter.metrics();
+
+    // second window, metrics are updated when window is filled
+    for (size_t n = 0; n < Window; n++) {
+        meter.begin_frame();
+        meter.begin_stage(CpuStage_Codec);
+        spin(Busy * 3);
+        meter.end_stage(CpuStage_Codec);
+        meter.end_frame();
+
+        UNSIGNED_LONGS_EQUAL(Window + n + 1, meter.metrics().frame_count);
+
+        if (n + 1 < Window) {
+            LONGS_EQUAL(first_metrics.avg_frame_time, meter.metrics().avg_frame_time);
+            LONGS_EQUAL(first_metrics.max_frame_time, meter.metrics().max_frame_time);
+        }
+    }
+
+    CHECK(meter.metrics().avg_stage_time[CpuStage_Codec] >= Busy * 3);
+    CHECK(meter.metrics().max_stage_time[CpuStage_Codec] >= Busy * 3);
+    CHECK(meter.metrics().avg_frame_time >= Busy * 3);
+    CHECK(meter.metrics().total_time >= Busy * 4 * Window);
+}
+
+} // namespace pipeline
+} // namespace roc
@@ -66,6 +66,7 @@ enum {
     RepairPackets = 10,
 
     Latency = SamplesPerPacket * SourcePackets,
+    NetworkDelay = SamplesPerPacket * 2,
     Timeout = Latency * 20,
     Warmup = SamplesPerPacket * 3,
 
@@ -98,7 +99,13 @@ enum {
     FlagRTCP = (1 << 6),
 
     // enable capture timestamps
-    FlagCTS = (1 << 7)
+    FlagCTS = (1 << 7),
+
+    // enable network impairment on sender (fixed delay, reordering, duplicates)
+    FlagImpairment = (1 << 8),
+
+    // enable capture timestamp RTP header extension on sender
+    FlagCaptureTimeExt = (1 << 9)
 };
 
 core::HeapArena arena;
@@ -270,6 +277,17 @@ SenderSinkConfig make_sender_config(int flags,
     config.fec_writer.n_repair_packets = RepairPackets;
 
     config.enable_interleaving = (flags & FlagInterleaving);
+
+    config.rtp_composer.enable_capture_time = (flags & FlagCaptureTimeExt);
+
+    if (flags & FlagImpairment) {
+        config.impairer.enable = true;
+        // no jitter, so that receiver can start exactly after NetworkDelay
+        config.impairer.delay = NetworkDelay * core::Second / SampleRate;
+        config.impairer.reorder = 0.05f;
+        config.impairer.duplicate = 0.05f;
+        config.impairer.seed = 1;
+    }
     config.enable_timing = false;
     config.enable_profiling = true;
 
@@ -366,7 +384,7 @@ void check_metrics(ReceiverSlot& receiver, SenderSlot& sender, int flags) {
     CHECK(recv_party_metrics.latency.niq_latency > 0);
     CHECK(recv_party_metrics.latency.niq_stalling >= 0);
 
-    if ((flags & FlagRTCP) && (flags & FlagCTS)) {
+    if ((flags & (FlagRTCP | FlagCaptureTimeExt)) && (flags & FlagCTS)) {
         CHECK(recv_party_metrics.latency.e2e_latency > 0);
     } else {
         CHECK(recv_party_metrics.latency.e2e_latency == 0);
@@ -523,6 +541,13 @@ void send_receive(int flags,
 
     test::FrameReader frame_reader(receiver, frame_factory);
 
+    // receiver starts reading when latency is accumulated after arrival
+    // of the first packet
+    size_t start_delay = Latency;
+    if (flags & FlagImpairment) {
+        start_delay += NetworkDelay;
+    }
+
     for (size_t nf = 0; nf < ManyFrames; nf++) {
         frame_writer.write_samples(SamplesPerFrame, sender_config.input_sample_spec,
                                    send_base_cts);
@@ -530,7 +555,7 @@ void send_receive(int flags,
 
         proxy.deliver_from(sender_outbound_queue);
 
-        if (nf > Latency / SamplesPerFrame) {
+        if (nf > start_delay / SamplesPerFrame) {
             core::nanoseconds_t recv_base_cts = -1;
             if (flags & FlagCTS) {
                 recv_base_cts = send_base_cts;
@@ -549,7 +574,7 @@ void send_receive(int flags,
 
             reverse_proxy.deliver_from(receiver_outbound_queue);
 
-            if (num_sessions == 1 && nf > (Latency + Warmup) / SamplesPerFrame) {
+            if (num_sessions == 1 && nf > (start_delay + Warmup) / SamplesPerFrame) {
                 check_metrics(*receiver_slot, *sender_slot, flags);
             }
         }
@@ -572,6 +597,17 @@ void send_receive(int flags,
     } else {
         CHECK(proxy.n_control() == 0);
     }
+
+    if ((flags & FlagImpairment) != 0) {
+        SenderSlotMetrics send_metrics;
+        size_t send_party_count = 0;
+        sender_slot->get_metrics(send_metrics, NULL, &send_party_count);
+
+        CHECK(send_metrics.impairer.delivered_packets > 0);
+        CHECK(send_metrics.impairer.reordered_packets > 0);
+        CHECK(send_metrics.impairer.duplicated_packets > 0);
+        UNSIGNED_LONGS_EQUAL(0, send_metrics.impairer.lost_packets);
+    }
 }
 
 } // namespace
@@ -638,6 +674,21 @@ TEST(loopback_sink_2_source, fec_drop_repair) {
     }
 }
 
+TEST(loopback_sink_2_source, impairment) {
+    enum { Chans = Chans_Stereo, NumSess = 1 };
+
+    send_receive(FlagImpairment, NumSess, Chans, Chans);
+}
+
+TEST(loopback_sink_2_source, fec_impairment) {
+    enum { Chans = Chans_Stereo, NumSess = 1 };
+
+    if (is_fec_supported(FlagReedSolomon)) {
+        send_receive(FlagReedSolomon | FlagLosses | FlagImpairment, NumSess, Chans,
+                     Chans);
+    }
+}
+
 TEST(loopback_sink_2_source, channel_mapping_stereo_to_mono) {
     enum { FrameChans = Chans_Stereo, PacketChans = Chans_Mono, NumSess = 1 };
 
@@ -662,5 +713,17 @@ TEST(loopback_sink_2_source, timestamp_mapping_remixing) {
     send_receive(FlagRTCP | FlagCTS, NumSess, FrameChans, PacketChans);
 }
 
+TEST(loopback_sink_2_source, timestamp_mapping_header_extension) {
+    enum { Chans = Chans_Stereo, NumSess = 1 };
+
+    send_receive(FlagCaptureTimeExt | FlagCTS, NumSess, Chans, Chans);
+}
+
+TEST(loopback_sink_2_source, timestamp_mapping_header_extension_rtcp) {
+    enum { Chans = Chans_Stereo, NumSess = 1 };
+
+    send_receive(FlagCaptureTimeExt | FlagRTCP | FlagCTS, NumSess, Chans, Chans);
+}
+
 } // namespace pipeline
 } // namespace roc
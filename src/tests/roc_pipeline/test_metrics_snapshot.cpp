@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/time.h"
+#include "roc_pipeline/metrics_snapshot.h"
+
+namespace roc {
+namespace pipeline {
+
+namespace {
+
+enum { MaxParties = 4 };
+
+typedef MetricsSnapshot<ReceiverSlotMetrics, ReceiverParticipantMetrics, MaxParties>
+    TestSnapshot;
+
+void fill_data(TestSnapshot::Data& data, size_t num_participants, size_t party_count) {
+    data.slot_metrics.source_id = 123;
+    data.slot_metrics.num_participants = num_participants;
+    data.party_count = party_count;
+
+    for (size_t n = 0; n < party_count; n++) {
+        data.party_metrics[n].link.total_packets = (n + 1) * 10;
+        data.party_metrics[n].latency.niq_latency = (core::nanoseconds_t)(n + 1);
+    }
+}
+
+} // namespace
+
+TEST_GROUP(metrics_snapshot) {};
+
+TEST(metrics_snapshot, not_published) {
+    TestSnapshot snapshot(core::Second);
+
+    ReceiverSlotMetrics slot_metrics;
+    ReceiverParticipantMetrics party_metrics[MaxParties];
+    size_t party_count = MaxParties;
+
+    CHECK(!snapshot.read(slot_metrics, party_metrics, &party_count));
+    CHECK(!snapshot.read(slot_metrics, NULL, NULL));
+}
+
+TEST(metrics_snapshot, publish_read) {
+    TestSnapshot snapshot(core::Second);
+
+    for (size_t iter = 0; iter < 5; iter++) {
+        TestSnapshot::Data& data = snapshot.scratch();
+        fill_data(data, iter % MaxParties, iter % MaxParties);
+        snapshot.publish(data);
+
+        ReceiverSlotMetrics slot_metrics;
+        ReceiverParticipantMetrics party_metrics[MaxParties];
+        size_t party_count = MaxParties;
+
+        CHECK(snapshot.read(slot_metrics, party_metrics, &party_count));
+
+        UNSIGNED_LONGS_EQUAL(123, slot_metrics.source_id);
+        UNSIGNED_LONGS_EQUAL(iter % MaxParties, slot_metrics.num_participants);
+        UNSIGNED_LONGS_EQUAL(iter % MaxParties, party_count);
+
+        for (size_t n = 0; n < party_count; n++) {
+            UNSIGNED_LONGS_EQUAL((n + 1) * 10, party_metrics[n].link.total_packets);
+            LONGS_EQUAL(n + 1, party_metrics[n].latency.niq_latency);
+        }
+    }
+}
+
+TEST(metrics_snapshot, read_less_participants) {
+    TestSnapshot snapshot(core::Second);
+
+    TestSnapshot::Data& data = snapshot.scratch();
+    fill_data(data, 3, 3);
+    snapshot.publish(data);
+
+    ReceiverSlotMetrics slot_metrics;
+    ReceiverParticipantMetrics party_metrics[MaxParties];
+
+    size_t party_count = 1;
+    CHECK(snapshot.read(slot_metrics, party_metrics, &party_count));
+    UNSIGNED_LONGS_EQUAL(3, slot_metrics.num_participants);
+    UNSIGNED_LONGS_EQUAL(1, party_count);
+    UNSIGNED_LONGS_EQUAL(10, party_metrics[0].link.total_packets);
+
+    party_count = 10;
+    CHECK(snapshot.read(slot_metrics, NULL, &party_count));
+    UNSIGNED_LONGS_EQUAL(0, party_count);
+}
+
+TEST(metrics_snapshot, truncated) {
+    TestSnapshot snapshot(core::Second);
+
+    TestSnapshot::Data& data = snapshot.scratch();
+    fill_data(data, MaxParties + 2, MaxParties);
+    snapshot.publish(data);
+
+    ReceiverSlotMetrics slot_metrics;
+    ReceiverParticipantMetrics party_metrics[MaxParties + 2];
+
+    // can't provide all participants
+    size_t party_count = MaxParties + 2;
+    CHECK(!snapshot.read(slot_metrics, party_metrics, &party_count));
+
+    // can provide requested participants
+    party_count = MaxParties;
+    CHECK(snapshot.read(slot_metrics, party_metrics, &party_count));
+    UNSIGNED_LONGS_EQUAL(MaxParties + 2, slot_metrics.num_participants);
+    UNSIGNED_LONGS_EQUAL(MaxParties, party_count);
+
+    // slot metrics only
+    CHECK(snapshot.read(slot_metrics, NULL, NULL));
+    UNSIGNED_LONGS_EQUAL(MaxParties + 2, slot_metrics.num_participants);
+}
+
+TEST(metrics_snapshot, publish_due) {
+    TestSnapshot snapshot(core::Second);
+
+    CHECK(snapshot.publish_due(core::Second * 10));
+    CHECK(!snapshot.publish_due(core::Second * 10));
+    CHECK(!snapshot.publish_due(core::Second * 10 + core::Millisecond * 999));
+    CHECK(snapshot.publish_due(core::Second * 11));
+    CHECK(!snapshot.publish_due(core::Second * 11 + core::Millisecond));
+}
+
+} // namespace pipeline
+} // namespace roc
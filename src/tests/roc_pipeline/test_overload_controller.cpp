@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_audio/resampler_map.h"
+#include "roc_core/time.h"
+#include "roc_pipeline/overload_controller.h"
+
+namespace roc {
+namespace pipeline {
+
+namespace {
+
+const core::nanoseconds_t FrameLen = 5 * core::Millisecond;
+
+const core::nanoseconds_t HighLoadTime = FrameLen * 9 / 10;
+const core::nanoseconds_t MidLoadTime = FrameLen * 6 / 10;
+const core::nanoseconds_t LowLoadTime = FrameLen * 1 / 10;
+
+OverloadConfig make_config() {
+    OverloadConfig config;
+    config.enable = true;
+    config.high_load = 0.8f;
+    config.low_load = 0.4f;
+    config.window = 10 * core::Millisecond;
+    config.step_down_delay = 20 * core::Millisecond;
+    config.step_up_delay = 50 * core::Millisecond;
+    return config;
+}
+
+// Resampler config for which every level has effect.
+audio::ResamplerConfig make_resampler_config() {
+    audio::ResamplerConfig config;
+    config.backend = audio::ResamplerBackend_Builtin;
+    config.profile = audio::ResamplerProfile_High;
+    return config;
+}
+
+// Check if QualityLevel_Fast can switch builtin backend to faster one.
+bool has_fast_backend() {
+    return audio::ResamplerMap::instance().is_supported(
+        audio::ResamplerBackend_SpeexDec);
+}
+
+// Report frames with given processing time for given period.
+void report(OverloadController& controller,
+            core::nanoseconds_t processing_time,
+            core::nanoseconds_t duration) {
+    for (core::nanoseconds_t pos = 0; pos < duration; pos += FrameLen) {
+        controller.report_frame(FrameLen, processing_time);
+    }
+}
+
+} // namespace
+
+TEST_GROUP(overload_controller) {};
+
+TEST(overload_controller, initial) {
+    OverloadController controller(make_config(), make_resampler_config());
+
+    LONGS_EQUAL(QualityLevel_Full, controller.level());
+
+    LONGS_EQUAL(QualityLevel_Full, controller.metrics().level);
+    DOUBLES_EQUAL(0, controller.metrics().load, 0);
+    UNSIGNED_LONGS_EQUAL(0, controller.metrics().step_down_count);
+    UNSIGNED_LONGS_EQUAL(0, controller.metrics().step_up_count);
+}
+
+TEST(overload_controller, window) {
+    OverloadController controller(make_config(), make_resampler_config());
+
+    // Window is 2 frames.
+    CHECK(!controller.report_frame(FrameLen, FrameLen / 2));
+    CHECK(controller.report_frame(FrameLen, FrameLen / 4));
+
+    DOUBLES_EQUAL(0.375, controller.metrics().load, 0.0001);
+
+    CHECK(!controller.report_frame(FrameLen, FrameLen / 10));
+    CHECK(controller.report_frame(FrameLen, FrameLen / 10));
+
+    DOUBLES_EQUAL(0.1, controller.metrics().load, 0.0001);
+
+    // Frames without duration are ignored.
+    CHECK(!controller.report_frame(0, FrameLen));
+    CHECK(!controller.report_frame(FrameLen, FrameLen));
+    CHECK(!controller.report_frame(0, FrameLen));
+    CHECK(controller.report_frame(FrameLen, FrameLen));
+
+    DOUBLES_EQUAL(1.0, controller.metrics().load, 0.0001);
+}
+
+TEST(overload_controller, step_down) {
+    OverloadController controller(make_config(), make_resampler_config());
+
+    // Overload shorter than step down delay.
+    report(controller, HighLoadTime, 10 * core::Millisecond);
+    LONGS_EQUAL(QualityLevel_Full, controller.level());
+
+    // Overload reaches step down delay.
+    report(controller, HighLoadTime, 10 * core::Millisecond);
+    LONGS_EQUAL(QualityLevel_Reduced, controller.level());
+
+    // Every next step requires another delay.
+    report(controller, HighLoadTime, 10 * core::Millisecond);
+    LONGS_EQUAL(QualityLevel_Reduced, controller.level());
+
+    report(controller, HighLoadTime, 10 * core::Millisecond);
+    LONGS_EQUAL(QualityLevel_Low, controller.level());
+
+    // Fast level is skipped if there is no faster backend.
+    report(controller, HighLoadTime, 20 * core::Millisecond);
+    if (has_fast_backend()) {
+        LONGS_EQUAL(QualityLevel_Fast, controller.level());
+        report(controller, HighLoadTime, 20 * core::Millisecond);
+    }
+    LONGS_EQUAL(QualityLevel_NoRepair, controller.level());
+
+    // Cheapest level reached.
+    report(controller, HighLoadTime, 100 * core::Millisecond);
+    LONGS_EQUAL(QualityLevel_NoRepair, controller.level());
+
+    LONGS_EQUAL(QualityLevel_NoRepair, controller.metrics().level);
+    DOUBLES_EQUAL(0.9, controller.metrics().load, 0.0001);
+    UNSIGNED_LONGS_EQUAL(has_fast_backend() ? 4 : 3,
+                         controller.metrics().step_down_count);
+    UNSIGNED_LONGS_EQUAL(0, controller.metrics().step_up_count);
+}
+
+TEST(overload_controller, step_up) {
+    OverloadController controller(make_config(), make_resampler_config());
+
+    report(controller, HighLoadTime, 40 * core::Millisecond);
+    LONGS_EQUAL(QualityLevel_Low, controller.level());
+
+    // Underload shorter than step up delay.
+    report(controller, LowLoadTime, 40 * core::Millisecond);
+    LONGS_EQUAL(QualityLevel_Low, controller.level());
+
+    // Underload reaches step up delay.
+    report(controller, LowLoadTime, 10 * core::Millisecond);
+    LONGS_EQUAL(QualityLevel_Reduced, controller.level());
+
+    report(controller, LowLoadTime, 50 * core::Millisecond);
+    LONGS_EQUAL(QualityLevel_Full, controller.level());
+
+    // Best level reached.
+    report(controller, LowLoadTime, 100 * core::Millisecond);
+    LONGS_EQUAL(QualityLevel_Full, controller.level());
+
+    UNSIGNED_LONGS_EQUAL(2, controller.metrics().step_down_count);
+    UNSIGNED_LONGS_EQUAL(2, controller.metrics().step_up_count);
+}
+
+TEST(overload_controller, hysteresis) {
+    OverloadController controller(make_config(), make_resampler_config());
+
+    report(controller, HighLoadTime, 20 * core::Millisecond);
+    LONGS_EQUAL(QualityLevel_Reduced, controller.level());
+
+    // Load between thresholds keeps level.
+    report(controller, MidLoadTime, 200 * core::Millisecond);
+    LONGS_EQUAL(QualityLevel_Reduced, controller.level());
+
+    // Interrupted underload doesn't step up.
+    report(controller, LowLoadTime, 40 * core::Millisecond);
+    report(controller, MidLoadTime, 10 * core::Millisecond);
+    report(controller, LowLoadTime, 40 * core::Millisecond);
+    LONGS_EQUAL(QualityLevel_Reduced, controller.level());
+
+    // Interrupted overload doesn't step down.
+    report(controller, HighLoadTime, 10 * core::Millisecond);
+    report(controller, MidLoadTime, 10 * core::Millisecond);
+    report(controller, HighLoadTime, 10 * core::Millisecond);
+    LONGS_EQUAL(QualityLevel_Reduced, controller.level());
+
+    UNSIGNED_LONGS_EQUAL(1, controller.metrics().step_down_count);
+    UNSIGNED_LONGS_EQUAL(0, controller.metrics().step_up_count);
+}
+
+TEST(overload_controller, max_level) {
+    OverloadConfig config = make_config();
+    config.max_level = QualityLevel_Low;
+
+    OverloadController controller(config, make_resampler_config());
+
+    report(controller, HighLoadTime, 200 * core::Millisecond);
+    LONGS_EQUAL(QualityLevel_Low, controller.level());
+
+    UNSIGNED_LONGS_EQUAL(2, controller.metrics().step_down_count);
+}
+
+TEST(overload_controller, skip_levels_without_effect) {
+    audio::ResamplerConfig resampler_config;
+    resampler_config.backend = audio::ResamplerBackend_Speex;
+    resampler_config.profile = audio::ResamplerProfile_Low;
+
+    OverloadController controller(make_config(), resampler_config);
+
+    // Profile is already lowest and backend is already fast,
+    // so the only level that has effect is NoRepair.
+    report(controller, HighLoadTime, 20 * core::Millisecond);
+    LONGS_EQUAL(QualityLevel_NoRepair, controller.level());
+
+    report(controller, LowLoadTime, 50 * core::Millisecond);
+    LONGS_EQUAL(QualityLevel_Full, controller.level());
+
+    UNSIGNED_LONGS_EQUAL(1, controller.metrics().step_down_count);
+    UNSIGNED_LONGS_EQUAL(1, controller.metrics().step_up_count);
+}
+
+TEST(overload_controller, skip_levels_without_effect_medium) {
+    audio::ResamplerConfig resampler_config;
+    resampler_config.backend = audio::ResamplerBackend_Speex;
+    resampler_config.profile = audio::ResamplerProfile_Medium;
+
+    OverloadController controller(make_config(), resampler_config);
+
+    // Reduced lowers profile to lowest, so Low and Fast are skipped.
+    report(controller, HighLoadTime, 20 * core::Millisecond);
+    LONGS_EQUAL(QualityLevel_Reduced, controller.level());
+
+    report(controller, HighLoadTime, 20 * core::Millisecond);
+    LONGS_EQUAL(QualityLevel_NoRepair, controller.level());
+
+    report(controller, LowLoadTime, 50 * core::Millisecond);
+    LONGS_EQUAL(QualityLevel_Reduced, controller.level());
+
+    report(controller, LowLoadTime, 50 * core::Millisecond);
+    LONGS_EQUAL(QualityLevel_Full, controller.level());
+
+    UNSIGNED_LONGS_EQUAL(2, controller.metrics().step_down_count);
+    UNSIGNED_LONGS_EQUAL(2, controller.metrics().step_up_count);
+}
+
+TEST(overload_controller, max_level_without_effect) {
+    OverloadConfig config = make_config();
+    config.max_level = QualityLevel_Fast;
+
+    audio::ResamplerConfig resampler_config;
+    resampler_config.backend = audio::ResamplerBackend_Speex;
+    resampler_config.profile = audio::ResamplerProfile_Low;
+
+    OverloadController controller(config, resampler_config);
+
+    // No level up to max level has effect.
+    report(controller, HighLoadTime, 200 * core::Millisecond);
+    LONGS_EQUAL(QualityLevel_Full, controller.level());
+
+    UNSIGNED_LONGS_EQUAL(0, controller.metrics().step_down_count);
+}
+
+TEST(overload_controller, degrade_resampler_config) {
+    audio::ResamplerConfig config;
+    config.backend = audio::ResamplerBackend_Builtin;
+    config.profile = audio::ResamplerProfile_High;
+
+    {
+        const audio::ResamplerConfig result =
+            degrade_resampler_config(config, QualityLevel_Full);
+        LONGS_EQUAL(audio::ResamplerBackend_Builtin, result.backend);
+        LONGS_EQUAL(audio::ResamplerProfile_High, result.profile);
+    }
+    {
+        const audio::ResamplerConfig result =
+            degrade_resampler_config(config, QualityLevel_Reduced);
+        LONGS_EQUAL(audio::ResamplerBackend_Builtin, result.backend);
+        LONGS_EQUAL(audio::ResamplerProfile_Medium, result.profile);
+    }
+    {
+        const audio::ResamplerConfig result =
+            degrade_resampler_config(config, QualityLevel_Low);
+        LONGS_EQUAL(audio::ResamplerBackend_Builtin, result.backend);
+        LONGS_EQUAL(audio::ResamplerProfile_Low, result.profile);
+    }
+    {
+        const audio::ResamplerConfig result =
+            degrade_resampler_config(config, QualityLevel_Fast);
+        if (audio::ResamplerMap::instance().is_supported(
+                audio::ResamplerBackend_SpeexDec)) {
+            LONGS_EQUAL(audio::ResamplerBackend_SpeexDec, result.backend);
+        } else {
+            LONGS_EQUAL(audio::ResamplerBackend_Builtin, result.backend);
+        }
+        LONGS_EQUAL(audio::ResamplerProfile_Low, result.profile);
+    }
+
+    config.backend = audio::ResamplerBackend_Speex;
+    config.profile = audio::ResamplerProfile_Low;
+
+    {
+        const audio::ResamplerConfig result =
+            degrade_resampler_config(config, QualityLevel_NoRepair);
+        LONGS_EQUAL(audio::ResamplerBackend_Speex, result.backend);
+        LONGS_EQUAL(audio::ResamplerProfile_Low, result.profile);
+    }
+
+    CHECK(quality_level_has_repair(QualityLevel_Fast));
+    CHECK(!quality_level_has_repair(QualityLevel_NoRepair));
+}
+
+} // namespace pipeline
+} // namespace roc
@@ -250,6 +250,10 @@ private:
         return true;
     }
 
+    virtual core::nanoseconds_t refresh_imp(core::nanoseconds_t) {
+        return 0;
+    }
+
     virtual void schedule_task_processing(PipelineLoop& pipeline,
                                           core::nanoseconds_t deadline) {
         core::Mutex::Lock lock(mutex_);
@@ -15,6 +15,8 @@
 
 #include "roc_address/interface.h"
 #include "roc_address/protocol.h"
+#include "roc_audio/pcm_mapper.h"
+#include "roc_audio/resampler_map.h"
 #include "roc_core/heap_arena.h"
 #include "roc_core/slab_pool.h"
 #include "roc_core/time.h"
@@ -89,6 +91,38 @@ audio::FrameFactory frame_factory(frame_buffer_pool);
 
 rtp::EncodingMap encoding_map(arena);
 
+// Arena that counts allocation requests.
+class CountingArena : public core::IArena, public core::NonCopyable<> {
+public:
+    CountingArena()
+        : num_allocate_calls_(0) {
+    }
+
+    virtual void* allocate(size_t size) {
+        num_allocate_calls_++;
+        return arena.allocate(size);
+    }
+
+    virtual void deallocate(void* ptr) {
+        arena.deallocate(ptr);
+    }
+
+    virtual size_t compute_allocated_size(size_t size) const {
+        return arena.compute_allocated_size(size);
+    }
+
+    virtual size_t allocated_size(void* ptr) const {
+        return arena.allocated_size(ptr);
+    }
+
+    size_t num_allocate_calls() const {
+        return num_allocate_calls_;
+    }
+
+private:
+    size_t num_allocate_calls_;
+};
+
 ReceiverSlot* create_slot(ReceiverSource& source) {
     ReceiverSlotConfig slot_config;
     ReceiverSlot* slot = source.create_slot(slot_config);
@@ -118,6 +152,74 @@ packet::IWriter* create_control_endpoint(ReceiverSlot* slot,
     return &endpoint->inbound_writer();
 }
 
+// Read frame in non-raw format and check that it's bit-exact with the
+// expected samples (nth_sample() * num_sessions) encoded in the same format.
+void read_pcm_samples(ReceiverSource& receiver,
+                      size_t num_samples,
+                      size_t num_sessions,
+                      const audio::SampleSpec& sample_spec,
+                      size_t& offset) {
+    CHECK(num_samples * sample_spec.num_channels() <= MaxBufSize);
+
+    audio::sample_t samples[MaxBufSize];
+    for (size_t ns = 0; ns < num_samples; ns++) {
+        for (size_t nc = 0; nc < sample_spec.num_channels(); nc++) {
+            samples[ns * sample_spec.num_channels() + nc] =
+                test::nth_sample(uint8_t(offset + ns)) * num_sessions;
+        }
+    }
+
+    audio::PcmMapper mapper(audio::Sample_RawFormat, sample_spec.pcm_format());
+
+    const size_t n_bytes =
+        mapper.output_byte_count(num_samples * sample_spec.num_channels());
+
+    uint8_t expected_bytes[MaxBufSize * sizeof(audio::sample_t)];
+    size_t in_off = 0, out_off = 0;
+    mapper.map(samples, sizeof(samples), in_off, expected_bytes, sizeof(expected_bytes),
+               out_off, num_samples * sample_spec.num_channels());
+
+    uint8_t bytes[MaxBufSize * sizeof(audio::sample_t)];
+    audio::Frame frame(bytes, n_bytes);
+    CHECK(receiver.read(frame));
+
+    CHECK(!frame.is_raw());
+    UNSIGNED_LONGS_EQUAL(num_samples, frame.duration());
+
+    for (size_t n = 0; n < n_bytes; n++) {
+        UNSIGNED_LONGS_EQUAL(expected_bytes[n], bytes[n]);
+    }
+
+    offset += num_samples;
+}
+
+// Read frame of a single session in unmixed mode and check that it contains
+// expected samples of that session only (nth_sample()).
+void read_session_samples(ReceiverSource& receiver,
+                          ReceiverSlot* slot,
+                          packet::stream_source_t source_id,
+                          size_t num_samples,
+                          const audio::SampleSpec& sample_spec,
+                          size_t& offset) {
+    CHECK(num_samples * sample_spec.num_channels() <= MaxBufSize);
+
+    audio::sample_t samples[MaxBufSize];
+    audio::Frame frame(samples, num_samples * sample_spec.num_channels());
+
+    LONGS_EQUAL(status::StatusOK, receiver.read_session(slot, source_id, frame));
+    UNSIGNED_LONGS_EQUAL(num_samples, frame.duration());
+
+    for (size_t ns = 0; ns < num_samples; ns++) {
+        for (size_t nc = 0; nc < sample_spec.num_channels(); nc++) {
+            DOUBLES_EQUAL((double)test::nth_sample(uint8_t(offset + ns)),
+                          (double)samples[ns * sample_spec.num_channels() + nc],
+                          test::SampleEpsilon);
+        }
+    }
+
+    offset += num_samples;
+}
+
 } // namespace
 
 TEST_GROUP(receiver_source) {
@@ -349,6 +451,78 @@ TEST(receiver_source, initial_latency) {
     }
 }
 
+// Fast start: playback starts when start latency is accumulated, and then
+// latency grows up to target.
+TEST(receiver_source, initial_latency_fast_start) {
+    enum {
+        Rate = SampleRate,
+        Chans = Chans_Stereo,
+        StartLatency = Latency / 4,
+        MaxParties = 10
+    };
+
+    init(Rate, Chans, Rate, Chans);
+
+    ReceiverSourceConfig config = make_default_config();
+    config.session_defaults.latency.tuner_profile = audio::LatencyTunerProfile_Responsive;
+    config.session_defaults.latency.start_latency =
+        StartLatency * core::Second / (int)output_sample_spec.sample_rate();
+    // faster ramp than default, to keep test short
+    config.session_defaults.latency.start_scaling_tolerance = 0.05f;
+
+    ReceiverSource receiver(config, encoding_map, packet_pool, packet_buffer_pool,
+                            frame_buffer_pool, arena);
+    CHECK(receiver.is_valid());
+
+    ReceiverSlot* slot = create_slot(receiver);
+    CHECK(slot);
+
+    packet::IWriter* endpoint1_writer =
+        create_transport_endpoint(slot, address::Iface_AudioSource, proto1, dst_addr1);
+    CHECK(endpoint1_writer);
+
+    test::FrameReader frame_reader(receiver, frame_factory);
+
+    test::PacketWriter packet_writer(arena, *endpoint1_writer, encoding_map,
+                                     packet_factory, src_id1, src_addr1, dst_addr1,
+                                     PayloadType_Ch2);
+
+    packet_writer.write_packets(StartLatency / SamplesPerPacket, SamplesPerPacket,
+                                packet_sample_spec);
+
+    for (size_t np = 0; np < ManyPackets * 5; np++) {
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            receiver.refresh(frame_reader.refresh_ts());
+            frame_reader.read_any_samples(SamplesPerFrame, output_sample_spec);
+
+            UNSIGNED_LONGS_EQUAL(1, receiver.num_sessions());
+        }
+
+        packet_writer.write_packets(1, SamplesPerPacket, packet_sample_spec);
+
+        ReceiverSlotMetrics slot_metrics;
+        ReceiverParticipantMetrics party_metrics[MaxParties];
+        size_t party_metrics_size = MaxParties;
+
+        slot->get_metrics(slot_metrics, party_metrics, &party_metrics_size);
+        UNSIGNED_LONGS_EQUAL(1, party_metrics_size);
+
+        // playback started without waiting for target latency
+        CHECK(party_metrics[0].latency.time_to_first_audio > 0);
+
+        if (np == 0) {
+            CHECK(party_metrics[0].latency.niq_latency
+                  < output_sample_spec.samples_per_chan_2_ns(Latency / 2));
+        }
+
+        if (np == ManyPackets * 5 - 1) {
+            DOUBLES_EQUAL(output_sample_spec.samples_per_chan_2_ns(Latency),
+                          party_metrics[0].latency.niq_latency,
+                          output_sample_spec.samples_per_chan_2_ns(SamplesPerPacket));
+        }
+    }
+}
+
 // Timeout expires during initial latency accumulation.
 TEST(receiver_source, initial_latency_timeout) {
     enum { Rate = SampleRate, Chans = Chans_Stereo };
@@ -430,6 +604,64 @@ TEST(receiver_source, timeout) {
     }
 }
 
+// Sessions repeatedly join and leave. Ended sessions should be recycled
+// and reused without allocating memory.
+TEST(receiver_source, timeout_session_reuse) {
+    enum { Rate = SampleRate, Chans = Chans_Stereo, NumRounds = 5 };
+
+    init(Rate, Chans, Rate, Chans);
+
+    CountingArena counting_arena;
+
+    ReceiverSource receiver(make_default_config(), encoding_map, packet_pool,
+                            packet_buffer_pool, frame_buffer_pool, counting_arena);
+    CHECK(receiver.is_valid());
+
+    ReceiverSlot* slot = create_slot(receiver);
+    CHECK(slot);
+
+    packet::IWriter* endpoint1_writer =
+        create_transport_endpoint(slot, address::Iface_AudioSource, proto1, dst_addr1);
+    CHECK(endpoint1_writer);
+
+    test::FrameReader frame_reader(receiver, frame_factory);
+
+    size_t num_allocations = 0;
+
+    for (size_t nr = 0; nr < NumRounds; nr++) {
+        test::PacketWriter packet_writer(arena, *endpoint1_writer, encoding_map,
+                                         packet_factory, nr % 2 ? src_id2 : src_id1,
+                                         nr % 2 ? src_addr2 : src_addr1, dst_addr1,
+                                         PayloadType_Ch2);
+
+        // continue from where frame reader stopped
+        packet_writer.set_offset(nr * Latency);
+
+        packet_writer.write_packets(Latency / SamplesPerPacket, SamplesPerPacket,
+                                    packet_sample_spec);
+
+        for (size_t np = 0; np < Latency / SamplesPerPacket; np++) {
+            for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+                receiver.refresh(frame_reader.refresh_ts());
+                frame_reader.read_samples(SamplesPerFrame, 1, output_sample_spec);
+            }
+
+            UNSIGNED_LONGS_EQUAL(1, receiver.num_sessions());
+        }
+
+        while (receiver.num_sessions() != 0) {
+            receiver.refresh(frame_reader.refresh_ts());
+            frame_reader.read_zero_samples(SamplesPerFrame, output_sample_spec);
+        }
+
+        if (nr == 0) {
+            num_allocations = counting_arena.num_allocate_calls();
+        } else {
+            UNSIGNED_LONGS_EQUAL(num_allocations, counting_arena.num_allocate_calls());
+        }
+    }
+}
+
 // Checks that receiver can work with latency longer than timeout.
 TEST(receiver_source, timeout_smaller_than_latency) {
     enum {
@@ -2172,6 +2404,12 @@ TEST(receiver_source, metrics_participants) {
 
             CHECK(party_metrics[0].latency.niq_latency != 0);
             CHECK(party_metrics[0].latency.e2e_latency == 0);
+
+            CHECK(party_metrics[0].cpu.frame_count != 0);
+            CHECK(party_metrics[0].cpu.avg_frame_time > 0);
+            CHECK(party_metrics[0].cpu.max_frame_time
+                  >= party_metrics[0].cpu.avg_frame_time);
+            CHECK(party_metrics[0].cpu.avg_stage_time[CpuStage_Codec] > 0);
         }
     }
 
@@ -2913,5 +3151,339 @@ TEST(receiver_source, pipeline_state) {
     }
 }
 
+TEST(receiver_source, passthrough) {
+    enum { Rate = SampleRate, Chans = Chans_Stereo };
+
+    init(Rate, Chans, Rate, Chans);
+
+    // same format as in packets
+    output_sample_spec.set_pcm_format(audio::PcmFormat_SInt16_Be);
+
+    ReceiverSourceConfig config = make_default_config();
+    config.common.enable_passthrough = true;
+    // profiler should see passthrough frames too
+    config.common.enable_profiling = true;
+
+    ReceiverSource receiver(config, encoding_map, packet_pool, packet_buffer_pool,
+                            frame_buffer_pool, arena);
+    CHECK(receiver.is_valid());
+
+    ReceiverSlot* slot = create_slot(receiver);
+    CHECK(slot);
+
+    packet::IWriter* endpoint1_writer =
+        create_transport_endpoint(slot, address::Iface_AudioSource, proto1, dst_addr1);
+    CHECK(endpoint1_writer);
+
+    test::PacketWriter packet_writer(arena, *endpoint1_writer, encoding_map,
+                                     packet_factory, src_id1, src_addr1, dst_addr1,
+                                     PayloadType_Ch2);
+
+    packet_writer.write_packets(Latency / SamplesPerPacket, SamplesPerPacket,
+                                packet_sample_spec);
+
+    core::nanoseconds_t cur_time = core::Second;
+    size_t offset = 0;
+
+    for (size_t np = 0; np < ManyPackets; np++) {
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            receiver.refresh(cur_time);
+            read_pcm_samples(receiver, SamplesPerFrame, 1, output_sample_spec, offset);
+            cur_time += output_sample_spec.samples_per_chan_2_ns(SamplesPerFrame);
+
+            UNSIGNED_LONGS_EQUAL(1, receiver.num_sessions());
+            CHECK(slot->passthrough_reader());
+        }
+
+        packet_writer.write_packets(1, SamplesPerPacket, packet_sample_spec);
+    }
+}
+
+TEST(receiver_source, passthrough_fallback_two_sessions) {
+    enum { Rate = SampleRate, Chans = Chans_Stereo };
+
+    init(Rate, Chans, Rate, Chans);
+
+    output_sample_spec.set_pcm_format(audio::PcmFormat_SInt16_Be);
+
+    ReceiverSourceConfig config = make_default_config();
+    config.common.enable_passthrough = true;
+
+    ReceiverSource receiver(config, encoding_map, packet_pool, packet_buffer_pool,
+                            frame_buffer_pool, arena);
+    CHECK(receiver.is_valid());
+
+    ReceiverSlot* slot = create_slot(receiver);
+    CHECK(slot);
+
+    packet::IWriter* endpoint1_writer =
+        create_transport_endpoint(slot, address::Iface_AudioSource, proto1, dst_addr1);
+    CHECK(endpoint1_writer);
+
+    test::PacketWriter packet_writer1(arena, *endpoint1_writer, encoding_map,
+                                      packet_factory, src_id1, src_addr1, dst_addr1,
+                                      PayloadType_Ch2);
+
+    test::PacketWriter packet_writer2(arena, *endpoint1_writer, encoding_map,
+                                      packet_factory, src_id2, src_addr2, dst_addr1,
+                                      PayloadType_Ch2);
+
+    for (size_t np = 0; np < Latency / SamplesPerPacket; np++) {
+        packet_writer1.write_packets(1, SamplesPerPacket, packet_sample_spec);
+        packet_writer2.write_packets(1, SamplesPerPacket, packet_sample_spec);
+    }
+
+    core::nanoseconds_t cur_time = core::Second;
+    size_t offset = 0;
+
+    for (size_t np = 0; np < ManyPackets; np++) {
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            receiver.refresh(cur_time);
+            // samples are mixed, passthrough is not used
+            read_pcm_samples(receiver, SamplesPerFrame, 2, output_sample_spec, offset);
+            cur_time += output_sample_spec.samples_per_chan_2_ns(SamplesPerFrame);
+
+            UNSIGNED_LONGS_EQUAL(2, receiver.num_sessions());
+            CHECK(!slot->passthrough_reader());
+        }
+
+        packet_writer1.write_packets(1, SamplesPerPacket, packet_sample_spec);
+        packet_writer2.write_packets(1, SamplesPerPacket, packet_sample_spec);
+    }
+}
+
+TEST(receiver_source, passthrough_fallback_resampling) {
+    enum { Rate = SampleRate, Chans = Chans_Stereo };
+
+    init(Rate, Chans, Rate, Chans);
+
+    output_sample_spec.set_pcm_format(audio::PcmFormat_SInt16_Be);
+
+    ReceiverSourceConfig config = make_default_config();
+    config.common.enable_passthrough = true;
+    // drift correction requires resampler
+    config.session_defaults.latency.tuner_profile = audio::LatencyTunerProfile_Gradual;
+
+    ReceiverSource receiver(config, encoding_map, packet_pool, packet_buffer_pool,
+                            frame_buffer_pool, arena);
+    CHECK(receiver.is_valid());
+
+    ReceiverSlot* slot = create_slot(receiver);
+    CHECK(slot);
+
+    packet::IWriter* endpoint1_writer =
+        create_transport_endpoint(slot, address::Iface_AudioSource, proto1, dst_addr1);
+    CHECK(endpoint1_writer);
+
+    test::PacketWriter packet_writer(arena, *endpoint1_writer, encoding_map,
+                                     packet_factory, src_id1, src_addr1, dst_addr1,
+                                     PayloadType_Ch2);
+
+    packet_writer.write_packets(Latency / SamplesPerPacket, SamplesPerPacket,
+                                packet_sample_spec);
+
+    core::nanoseconds_t cur_time = core::Second;
+
+    uint8_t bytes[MaxBufSize];
+
+    for (size_t np = 0; np < ManyPackets; np++) {
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            receiver.refresh(cur_time);
+
+            audio::Frame frame(bytes,
+                               SamplesPerFrame * output_sample_spec.num_channels() * 2);
+            CHECK(receiver.read(frame));
+            CHECK(!frame.is_raw());
+            UNSIGNED_LONGS_EQUAL(SamplesPerFrame, frame.duration());
+
+            cur_time += output_sample_spec.samples_per_chan_2_ns(SamplesPerFrame);
+
+            UNSIGNED_LONGS_EQUAL(1, receiver.num_sessions());
+            CHECK(!slot->passthrough_reader());
+        }
+
+        packet_writer.write_packets(1, SamplesPerPacket, packet_sample_spec);
+    }
+}
+
+// Unmixed output mode: mixed output is silent, and each session is read
+// separately by sender source ID.
+TEST(receiver_source, unmixed_output) {
+    enum { Rate = SampleRate, Chans = Chans_Stereo, Offset2 = 77 };
+
+    init(Rate, Chans, Rate, Chans);
+
+    ReceiverSourceConfig config = make_default_config();
+    config.common.enable_unmixed_output = true;
+
+    ReceiverSource receiver(config, encoding_map, packet_pool, packet_buffer_pool,
+                            frame_buffer_pool, arena);
+    CHECK(receiver.is_valid());
+
+    ReceiverSlot* slot = create_slot(receiver);
+    CHECK(slot);
+
+    packet::IWriter* endpoint1_writer =
+        create_transport_endpoint(slot, address::Iface_AudioSource, proto1, dst_addr1);
+    CHECK(endpoint1_writer);
+
+    test::FrameReader frame_reader(receiver, frame_factory);
+
+    test::PacketWriter packet_writer1(arena, *endpoint1_writer, encoding_map,
+                                      packet_factory, src_id1, src_addr1, dst_addr1,
+                                      PayloadType_Ch2);
+
+    test::PacketWriter packet_writer2(arena, *endpoint1_writer, encoding_map,
+                                      packet_factory, src_id2, src_addr2, dst_addr1,
+                                      PayloadType_Ch2);
+
+    packet_writer2.set_offset(Offset2);
+
+    packet_writer1.write_packets(Latency / SamplesPerPacket, SamplesPerPacket,
+                                 packet_sample_spec);
+    packet_writer2.write_packets(Latency / SamplesPerPacket, SamplesPerPacket,
+                                 packet_sample_spec);
+
+    size_t offset1 = 0;
+    size_t offset2 = Offset2;
+
+    for (size_t np = 0; np < ManyPackets; np++) {
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            receiver.refresh(frame_reader.refresh_ts());
+            frame_reader.read_zero_samples(SamplesPerFrame, output_sample_spec);
+
+            UNSIGNED_LONGS_EQUAL(2, receiver.num_sessions());
+
+            read_session_samples(receiver, slot, src_id1, SamplesPerFrame,
+                                 output_sample_spec, offset1);
+            read_session_samples(receiver, slot, src_id2, SamplesPerFrame,
+                                 output_sample_spec, offset2);
+        }
+
+        packet_writer1.write_packets(1, SamplesPerPacket, packet_sample_spec);
+        packet_writer2.write_packets(1, SamplesPerPacket, packet_sample_spec);
+    }
+
+    { // unknown source
+        audio::sample_t samples[SamplesPerFrame * 2];
+        audio::Frame frame(samples, SamplesPerFrame * 2);
+
+        LONGS_EQUAL(status::StatusNoData, receiver.read_session(slot, 333, frame));
+    }
+
+    { // participant metrics report source IDs of sessions
+        ReceiverSlotMetrics slot_metrics;
+        ReceiverParticipantMetrics party_metrics[2];
+        size_t party_metrics_size = 2;
+
+        slot->get_metrics(slot_metrics, party_metrics, &party_metrics_size);
+
+        UNSIGNED_LONGS_EQUAL(2, party_metrics_size);
+        CHECK((party_metrics[0].source_id == src_id1
+               && party_metrics[1].source_id == src_id2)
+              || (party_metrics[0].source_id == src_id2
+                  && party_metrics[1].source_id == src_id1));
+    }
+}
+
+// Overload controller steps quality down on every frame, and new quality level
+// is applied to existing session, including replacement of its resampler.
+TEST(receiver_source, overload_control) {
+    enum { OutputRate = 48000, PacketRate = 44100, Chans = Chans_Stereo };
+
+    init(OutputRate, Chans, PacketRate, Chans);
+
+    ReceiverSourceConfig config = make_default_config();
+    config.common.overload.enable = true;
+    config.common.overload.high_load = 0;
+    config.common.overload.low_load = 0;
+    config.common.overload.window = 1;
+    config.common.overload.step_down_delay = 0;
+    config.session_defaults.resampler.backend = audio::ResamplerBackend_Builtin;
+    config.session_defaults.resampler.profile = audio::ResamplerProfile_High;
+
+    // Fast level has no effect and is skipped if there is no faster backend.
+    QualityLevel levels[QualityLevel_Max];
+    size_t n_levels = 0;
+    levels[n_levels++] = QualityLevel_Full;
+    levels[n_levels++] = QualityLevel_Reduced;
+    levels[n_levels++] = QualityLevel_Low;
+    if (audio::ResamplerMap::instance().is_supported(audio::ResamplerBackend_SpeexDec)) {
+        levels[n_levels++] = QualityLevel_Fast;
+    }
+    levels[n_levels++] = QualityLevel_NoRepair;
+
+    ReceiverSource receiver(config, encoding_map, packet_pool, packet_buffer_pool,
+                            frame_buffer_pool, arena);
+    CHECK(receiver.is_valid());
+
+    ReceiverSlot* slot = create_slot(receiver);
+    CHECK(slot);
+
+    packet::IWriter* endpoint1_writer =
+        create_transport_endpoint(slot, address::Iface_AudioSource, proto1, dst_addr1);
+    CHECK(endpoint1_writer);
+
+    test::FrameReader frame_reader(receiver, frame_factory);
+
+    test::PacketWriter packet_writer(arena, *endpoint1_writer, encoding_map,
+                                     packet_factory, src_id1, src_addr1, dst_addr1,
+                                     PayloadType_Ch2);
+
+    packet_writer.write_packets(Latency / SamplesPerPacket, SamplesPerPacket,
+                                packet_sample_spec);
+
+    size_t n_frames = 0;
+
+    for (size_t np = 0; np < ManyPackets; np++) {
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            receiver.refresh(frame_reader.refresh_ts());
+
+            {
+                ReceiverSlotMetrics slot_metrics;
+                ReceiverParticipantMetrics party_metrics;
+                size_t party_metrics_size = 1;
+
+                slot->get_metrics(slot_metrics, &party_metrics, &party_metrics_size);
+
+                UNSIGNED_LONGS_EQUAL(1, party_metrics_size);
+
+                const size_t expected_steps = std::min(n_frames, n_levels - 1);
+                const QualityLevel expected_level = levels[expected_steps];
+
+                LONGS_EQUAL(expected_level, slot_metrics.overload.level);
+                LONGS_EQUAL(expected_level, party_metrics.quality_level);
+                UNSIGNED_LONGS_EQUAL(expected_steps,
+                                     slot_metrics.overload.step_down_count);
+                UNSIGNED_LONGS_EQUAL(0, slot_metrics.overload.step_up_count);
+            }
+
+            frame_reader.read_nonzero_samples(SamplesPerFrame * OutputRate / PacketRate
+                                                  / output_sample_spec.num_channels()
+                                                  * output_sample_spec.num_channels(),
+                                              output_sample_spec);
+            n_frames++;
+
+            UNSIGNED_LONGS_EQUAL(1, receiver.num_sessions());
+        }
+
+        packet_writer.write_packets(1, SamplesPerPacket, packet_sample_spec);
+    }
+}
+
+TEST(receiver_source, unmixed_output_non_raw) {
+    enum { Rate = SampleRate, Chans = Chans_Stereo };
+
+    init(Rate, Chans, Rate, Chans);
+
+    ReceiverSourceConfig config = make_default_config();
+    config.common.enable_unmixed_output = true;
+    config.common.output_sample_spec.set_pcm_format(audio::PcmFormat_SInt16_Le);
+
+    ReceiverSource receiver(config, encoding_map, packet_pool, packet_buffer_pool,
+                            frame_buffer_pool, arena);
+    CHECK(!receiver.is_valid());
+}
+
 } // namespace pipeline
 } // namespace roc
@@ -46,8 +46,8 @@ TEST(sender_endpoint, valid) {
     SenderSession session(sink_config, encoding_map, packet_factory, frame_factory,
                           arena);
 
-    SenderEndpoint endpoint(address::Proto_RTP, state_tracker, session, addr, queue,
-                            arena);
+    SenderEndpoint endpoint(address::Proto_RTP, sink_config, state_tracker, session, addr,
+                            queue, arena);
     CHECK(endpoint.is_valid());
 }
 
@@ -61,8 +61,8 @@ TEST(sender_endpoint, invalid_proto) {
     SenderSession session(sink_config, encoding_map, packet_factory, frame_factory,
                           arena);
 
-    SenderEndpoint endpoint(address::Proto_None, state_tracker, session, addr, queue,
-                            arena);
+    SenderEndpoint endpoint(address::Proto_None, sink_config, state_tracker, session,
+                            addr, queue, arena);
     CHECK(!endpoint.is_valid());
 }
 
@@ -83,8 +83,8 @@ TEST(sender_endpoint, no_memory) {
         SenderSession session(sink_config, encoding_map, packet_factory, frame_factory,
                               arena);
 
-        SenderEndpoint endpoint(protos[n], state_tracker, session, addr, queue,
-                                core::NoopArena);
+        SenderEndpoint endpoint(protos[n], sink_config, state_tracker, session, addr,
+                                queue, core::NoopArena);
         CHECK(!endpoint.is_valid());
     }
 }
@@ -8,6 +8,7 @@
 
 #include <CppUTest/TestHarness.h>
 
+#include "test_helpers/frame_writer.h"
 #include "test_helpers/mock_scheduler.h"
 
 #include "roc_core/heap_arena.h"
@@ -21,7 +22,7 @@ namespace pipeline {
 
 namespace {
 
-enum { MaxBufSize = 1000 };
+enum { MaxBufSize = 1000, SamplesPerFrame = 441, NumFrames = 10 };
 
 core::HeapArena arena;
 
@@ -33,6 +34,8 @@ core::SlabPool<core::Buffer>
                       arena,
                       sizeof(core::Buffer) + MaxBufSize * sizeof(audio::sample_t));
 
+audio::FrameFactory frame_factory(frame_buffer_pool);
+
 rtp::EncodingMap encoding_map(arena);
 
 class TaskIssuer : public IPipelineTaskCompleter {
@@ -169,5 +172,182 @@ TEST(sender_loop, endpoints_async) {
     scheduler.wait_done();
 }
 
+TEST(sender_loop, timing_metrics) {
+    { // timing disabled
+        SenderLoop sender(scheduler, config, encoding_map, packet_pool,
+                          packet_buffer_pool, frame_buffer_pool, arena);
+        CHECK(sender.is_valid());
+
+        core::TickerMetrics metrics;
+        CHECK(!sender.get_timing_metrics(metrics));
+    }
+    { // timing enabled
+        config.enable_timing = true;
+        config.timing.enable_precise = true;
+
+        SenderLoop sender(scheduler, config, encoding_map, packet_pool,
+                          packet_buffer_pool, frame_buffer_pool, arena);
+        CHECK(sender.is_valid());
+
+        test::FrameWriter frame_writer(sender.sink(), frame_factory);
+
+        for (size_t nf = 0; nf < NumFrames; nf++) {
+            frame_writer.write_samples(SamplesPerFrame, config.input_sample_spec);
+        }
+
+        core::TickerMetrics metrics;
+        CHECK(sender.get_timing_metrics(metrics));
+
+        // first frame is written immediately, others wait for ticker
+        UNSIGNED_LONGS_EQUAL(NumFrames - 1, metrics.wakeups + metrics.overruns);
+    }
+}
+
+// Check that when timing and pacing are enabled, sender loop flushes pacer
+// between frames, at deadlines requested by it.
+TEST(sender_loop, pacing) {
+    config.enable_timing = true;
+    config.pacer.enable = true;
+    config.pacer.max_burst = 1;
+
+    SenderLoop sender(scheduler, config, encoding_map, packet_pool, packet_buffer_pool,
+                      frame_buffer_pool, arena);
+    CHECK(sender.is_valid());
+
+    SenderLoop::SlotHandle slot = NULL;
+
+    address::SocketAddr outbound_address;
+    packet::Queue outbound_writer;
+
+    {
+        SenderSlotConfig config;
+        SenderLoop::Tasks::CreateSlot task(config);
+        CHECK(sender.schedule_and_wait(task));
+        CHECK(task.success());
+
+        slot = task.get_handle();
+    }
+
+    {
+        SenderLoop::Tasks::AddEndpoint task(slot, address::Iface_AudioSource,
+                                            address::Proto_RTP, outbound_address,
+                                            outbound_writer);
+        CHECK(sender.schedule_and_wait(task));
+        CHECK(task.success());
+    }
+
+    test::FrameWriter frame_writer(sender.sink(), frame_factory);
+
+    for (size_t nf = 0; nf < NumFrames * 5; nf++) {
+        frame_writer.write_samples(SamplesPerFrame, config.input_sample_spec);
+    }
+
+    {
+        SenderSlotMetrics slot_metrics;
+        SenderLoop::Tasks::QuerySlot task(slot, slot_metrics, NULL, NULL);
+        CHECK(sender.schedule_and_wait(task));
+        CHECK(task.success());
+
+        // every frame produces more than one packet, but pacer sends only
+        // one packet per flush, so without refreshes between frames queue
+        // would grow with every frame
+        CHECK(slot_metrics.pacer.sent_packets > NumFrames * 5);
+        CHECK(slot_metrics.pacer.queued_packets <= 3);
+        UNSIGNED_LONGS_EQUAL(0, slot_metrics.pacer.overflows);
+
+        UNSIGNED_LONGS_EQUAL(slot_metrics.pacer.sent_packets, outbound_writer.size());
+    }
+
+    {
+        SenderLoop::Tasks::DeleteSlot task(slot);
+        CHECK(sender.schedule_and_wait(task));
+        CHECK(task.success());
+    }
+}
+
+// Check that when pacing is enabled, but timing is disabled (e.g. sender is
+// clocked by sound card), pacer is flushed only once per frame, but still
+// sends all due packets, and neither queue size nor packet delay grow.
+TEST(sender_loop, pacing_without_timing) {
+    enum { MaxQueue = 64 };
+
+    const core::nanoseconds_t FrameDuration =
+        config.input_sample_spec.samples_per_chan_2_ns(SamplesPerFrame);
+
+    config.enable_timing = false;
+    config.packet_length = FrameDuration / 4;
+    config.pacer.enable = true;
+    config.pacer.max_burst = 1;
+    config.pacer.max_queue = MaxQueue;
+
+    SenderLoop sender(scheduler, config, encoding_map, packet_pool, packet_buffer_pool,
+                      frame_buffer_pool, arena);
+    CHECK(sender.is_valid());
+
+    SenderLoop::SlotHandle slot = NULL;
+
+    address::SocketAddr outbound_address;
+    packet::Queue outbound_writer;
+
+    {
+        SenderSlotConfig config;
+        SenderLoop::Tasks::CreateSlot task(config);
+        CHECK(sender.schedule_and_wait(task));
+        CHECK(task.success());
+
+        slot = task.get_handle();
+    }
+
+    {
+        SenderLoop::Tasks::AddEndpoint task(slot, address::Iface_AudioSource,
+                                            address::Proto_RTP, outbound_address,
+                                            outbound_writer);
+        CHECK(sender.schedule_and_wait(task));
+        CHECK(task.success());
+    }
+
+    test::FrameWriter frame_writer(sender.sink(), frame_factory);
+
+    const core::nanoseconds_t start_time = core::timestamp(core::ClockUnix);
+
+    size_t n_packets = 0;
+
+    for (size_t nf = 0; nf < NumFrames * 5; nf++) {
+        // simulate sound card: frame is delivered when it's fully captured
+        core::sleep_until(core::ClockUnix,
+                          start_time + FrameDuration * (core::nanoseconds_t)(nf + 1));
+
+        frame_writer.write_samples(SamplesPerFrame, config.input_sample_spec,
+                                   start_time);
+
+        const core::nanoseconds_t now = core::timestamp(core::ClockUnix);
+
+        packet::PacketPtr pp;
+        while (outbound_writer.read(pp) == status::StatusOK) {
+            CHECK(pp->rtp());
+            // packet is sent at most about one frame later than it would be
+            // sent without pacing
+            CHECK(now - pp->rtp()->capture_timestamp < FrameDuration * 4);
+            n_packets++;
+        }
+
+        SenderSlotMetrics slot_metrics;
+        SenderLoop::Tasks::QuerySlot task(slot, slot_metrics, NULL, NULL);
+        CHECK(sender.schedule_and_wait(task));
+        CHECK(task.success());
+
+        CHECK(slot_metrics.pacer.queued_packets < MaxQueue / 4);
+        UNSIGNED_LONGS_EQUAL(0, slot_metrics.pacer.overflows);
+    }
+
+    CHECK(n_packets > NumFrames * 5 * 3);
+
+    {
+        SenderLoop::Tasks::DeleteSlot task(slot);
+        CHECK(sender.schedule_and_wait(task));
+        CHECK(task.success());
+    }
+}
+
 } // namespace pipeline
 } // namespace roc
@@ -214,6 +214,66 @@ TEST(sender_sink, basic) {
     packet_reader.read_eof();
 }
 
+// Slots are processed in parallel by fanout workers.
+TEST(sender_sink, parallel_slots) {
+    enum { Rate = SampleRate, Chans = Chans_Stereo, NumSlots = 3 };
+
+    init(Rate, Chans, Rate, Chans);
+
+    SenderSinkConfig config = make_config();
+    config.fanout.num_threads = 2;
+
+    SenderSink sender(config, encoding_map, packet_pool, packet_buffer_pool,
+                      frame_buffer_pool, arena);
+    CHECK(sender.is_valid());
+
+    packet::Queue queues[NumSlots];
+    address::SocketAddr dst_addrs[NumSlots];
+    SenderSlot* slots[NumSlots];
+
+    for (size_t ns = 0; ns < NumSlots; ns++) {
+        dst_addrs[ns] = test::new_address(int(30 + ns));
+
+        slots[ns] = create_slot(sender);
+        CHECK(slots[ns]);
+        create_transport_endpoint(slots[ns], address::Iface_AudioSource, proto,
+                                  dst_addrs[ns], queues[ns]);
+    }
+
+    test::FrameWriter frame_writer(sender, frame_factory);
+
+    for (size_t nf = 0; nf < ManyFrames; nf++) {
+        frame_writer.write_samples(SamplesPerFrame, input_sample_spec);
+        sender.refresh(frame_writer.refresh_ts());
+    }
+
+    for (size_t ns = 0; ns < NumSlots; ns++) {
+        test::PacketReader packet_reader(arena, queues[ns], encoding_map, packet_factory,
+                                         dst_addrs[ns], PayloadType_Ch2);
+
+        for (size_t np = 0; np < ManyFrames / FramesPerPacket; np++) {
+            packet_reader.read_packet(SamplesPerPacket, packet_sample_spec);
+        }
+
+        packet_reader.read_eof();
+
+        SenderSlotMetrics slot_metrics;
+        slots[ns]->get_metrics(slot_metrics, NULL, NULL);
+
+        UNSIGNED_LONGS_EQUAL(ManyFrames, slot_metrics.frame_count);
+        CHECK(slot_metrics.frame_time > 0);
+        CHECK(slot_metrics.max_frame_time >= slot_metrics.frame_time);
+        CHECK(slot_metrics.total_frame_time >= slot_metrics.max_frame_time);
+
+        // measured on worker thread
+        UNSIGNED_LONGS_EQUAL(ManyFrames, slot_metrics.cpu.frame_count);
+        CHECK(slot_metrics.cpu.avg_frame_time > 0);
+        CHECK(slot_metrics.cpu.max_frame_time >= slot_metrics.cpu.avg_frame_time);
+        CHECK(slot_metrics.cpu.total_time >= slot_metrics.cpu.max_frame_time);
+        CHECK(slot_metrics.cpu.avg_stage_time[CpuStage_Codec] > 0);
+    }
+}
+
 // Frames smaller than packets.
 TEST(sender_sink, frame_size_small) {
     enum {
@@ -392,6 +452,62 @@ TEST(sender_sink, sample_rate_mapping) {
     }
 }
 
+// Check that when pacing is enabled, packets of one frame are not sent
+// at once, but are spread in time according to their timestamps.
+TEST(sender_sink, pacing) {
+    enum { Rate = SampleRate, Chans = Chans_Stereo, PacketsPerFrame = 4, NumFrames = 10 };
+
+    init(Rate, Chans, Rate, Chans);
+
+    packet::Queue queue;
+
+    SenderSinkConfig config = make_config();
+    config.pacer.enable = true;
+
+    SenderSink sender(config, encoding_map, packet_pool, packet_buffer_pool,
+                      frame_buffer_pool, arena);
+    CHECK(sender.is_valid());
+
+    SenderSlot* slot = create_slot(sender);
+    CHECK(slot);
+    create_transport_endpoint(slot, address::Iface_AudioSource, proto, dst_addr1, queue);
+
+    test::FrameWriter frame_writer(sender, frame_factory);
+
+    for (size_t nf = 0; nf < NumFrames; nf++) {
+        frame_writer.write_samples(SamplesPerPacket * PacketsPerFrame, input_sample_spec);
+
+        core::nanoseconds_t now = frame_writer.refresh_ts();
+
+        for (size_t np = 0; np < PacketsPerFrame; np++) {
+            // one packet is sent per refresh, and refresh deadline
+            // tells when to send next one
+            const core::nanoseconds_t deadline = sender.refresh(now);
+            UNSIGNED_LONGS_EQUAL(nf * PacketsPerFrame + np + 1, queue.size());
+
+            if (np + 1 < PacketsPerFrame) {
+                CHECK(deadline > now);
+                now = deadline;
+            }
+        }
+    }
+
+    test::PacketReader packet_reader(arena, queue, encoding_map, packet_factory,
+                                     dst_addr1, PayloadType_Ch2);
+
+    for (size_t np = 0; np < NumFrames * PacketsPerFrame; np++) {
+        packet_reader.read_packet(SamplesPerPacket, packet_sample_spec);
+    }
+
+    packet_reader.read_eof();
+
+    SenderSlotMetrics slot_metrics;
+    slot->get_metrics(slot_metrics, NULL, NULL);
+
+    UNSIGNED_LONGS_EQUAL(NumFrames * PacketsPerFrame, slot_metrics.pacer.sent_packets);
+    UNSIGNED_LONGS_EQUAL(0, slot_metrics.pacer.queued_packets);
+}
+
 // Check how sender sets CTS of packets based on CTS of frames
 // written to it.
 TEST(sender_sink, timestamp_mapping) {
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "roc_core/heap_arena.h"
+#include "roc_core/panic.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/time.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_packet/queue.h"
+#include "roc_rtcp/communicator.h"
+#include "roc_rtcp/composer.h"
+#include "roc_rtcp/iparticipant.h"
+
+namespace roc {
+namespace rtcp {
+namespace {
+
+enum { MaxParticipants = 64, MaxPacketSz = 1500, SampleRate = 44100 };
+
+const core::nanoseconds_t StartTime = core::Second * 1000000;
+
+core::HeapArena arena;
+packet::PacketFactory packet_factory(arena, MaxPacketSz);
+Composer composer;
+
+struct BenchSender : public IParticipant, public core::NonCopyable<> {
+    BenchSender()
+        : source_id(0) {
+        cname[0] = '\0';
+    }
+
+    virtual ParticipantInfo participant_info() {
+        ParticipantInfo info;
+        info.cname = cname;
+        info.source_id = source_id;
+        info.report_mode = Report_ToAddress;
+        info.report_address = report_address;
+        return info;
+    }
+
+    virtual void change_source_id() {
+    }
+
+    virtual bool has_send_stream() {
+        return true;
+    }
+
+    virtual SendReport query_send_stream(core::nanoseconds_t report_time) {
+        SendReport report;
+        report.sender_cname = cname;
+        report.sender_source_id = source_id;
+        report.report_timestamp = report_time;
+        report.sample_rate = SampleRate;
+        return report;
+    }
+
+    virtual status::StatusCode notify_send_stream(packet::stream_source_t,
+                                                  const RecvReport&) {
+        return status::StatusOK;
+    }
+
+    char cname[32];
+    packet::stream_source_t source_id;
+    address::SocketAddr report_address;
+};
+
+struct BenchReceiver : public IParticipant, public core::NonCopyable<> {
+    BenchReceiver()
+        : n_streams(0) {
+    }
+
+    virtual ParticipantInfo participant_info() {
+        ParticipantInfo info;
+        info.cname = "receiver";
+        info.source_id = 1;
+        info.report_mode = Report_Back;
+        return info;
+    }
+
+    virtual void change_source_id() {
+    }
+
+    virtual size_t num_recv_streams() {
+        return n_streams;
+    }
+
+    virtual void query_recv_streams(RecvReport* reports,
+                                    size_t n_reports,
+                                    core::nanoseconds_t report_time) {
+        for (size_t n = 0; n < n_reports; n++) {
+            reports[n] = RecvReport();
+            reports[n].receiver_cname = "receiver";
+            reports[n].receiver_source_id = 1;
+            reports[n].sender_source_id = packet::stream_source_t(100 + n);
+            reports[n].report_timestamp = report_time;
+            reports[n].sample_rate = SampleRate;
+        }
+    }
+
+    virtual status::StatusCode notify_recv_stream(packet::stream_source_t,
+                                                  const SendReport&) {
+        return status::StatusOK;
+    }
+
+    size_t n_streams;
+};
+
+// Receiver communicator which gets reports from N senders.
+class BM_Communicator : public benchmark::Fixture {
+public:
+    void setup(const benchmark::State& state, bool interval_scaling) {
+        n_senders_ = (size_t)state.range(0);
+        roc_panic_if(n_senders_ > MaxParticipants);
+
+        config_.enable_interval_scaling = interval_scaling;
+
+        receiver_.n_streams = n_senders_;
+
+        core::nanoseconds_t time = StartTime;
+
+        for (size_t n = 0; n < n_senders_; n++) {
+            senders_[n].source_id = packet::stream_source_t(100 + n);
+            senders_[n].report_address = make_address_(20000);
+            snprintf(senders_[n].cname, sizeof(senders_[n].cname), "sender%d", (int)n);
+
+            packet::Queue queue;
+            Communicator comm(config_, senders_[n], queue, composer, packet_factory,
+                              arena);
+            roc_panic_if(!comm.is_valid());
+            roc_panic_if(comm.generate_reports(time) != status::StatusOK);
+            roc_panic_if(queue.read(packets_[n]) != status::StatusOK);
+
+            packets_[n]->udp()->src_addr = make_address_(10000 + (int)n);
+        }
+    }
+
+    void teardown() {
+        for (size_t n = 0; n < n_senders_; n++) {
+            packets_[n] = NULL;
+        }
+    }
+
+    void run(benchmark::State& state) {
+        packet::Queue queue;
+        Communicator comm(config_, receiver_, queue, composer, packet_factory, arena);
+        roc_panic_if(!comm.is_valid());
+
+        core::nanoseconds_t time = StartTime;
+        size_t n_reports = 0;
+
+        while (state.KeepRunning()) {
+            for (size_t n = 0; n < n_senders_; n++) {
+                time += core::Millisecond;
+                roc_panic_if(comm.process_packet(packets_[n], time) != status::StatusOK);
+            }
+
+            if (comm.generation_deadline(time) <= time) {
+                roc_panic_if(comm.generate_reports(time) != status::StatusOK);
+                n_reports++;
+            }
+
+            packet::PacketPtr pp;
+            while (queue.read(pp) == status::StatusOK) {
+            }
+        }
+
+        // Average interval between our reports, in simulated time.
+        state.counters["report_interval_ms"] = n_reports
+            ? (double)(time - StartTime) / n_reports / core::Millisecond
+            : 0;
+    }
+
+private:
+    static address::SocketAddr make_address_(int port) {
+        address::SocketAddr addr;
+        roc_panic_if(!addr.set_host_port(address::Family_IPv4, "127.0.0.1", port));
+        return addr;
+    }
+
+    Config config_;
+
+    size_t n_senders_;
+    BenchSender senders_[MaxParticipants];
+    BenchReceiver receiver_;
+
+    packet::PacketPtr packets_[MaxParticipants];
+};
+
+BENCHMARK_DEFINE_F(BM_Communicator, FixedInterval)(benchmark::State& state) {
+    setup(state, false);
+    run(state);
+    teardown();
+}
+
+BENCHMARK_REGISTER_F(BM_Communicator, FixedInterval)
+    ->RangeMultiplier(2)
+    ->Range(1, MaxParticipants)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(BM_Communicator, ScaledInterval)(benchmark::State& state) {
+    setup(state, true);
+    run(state);
+    teardown();
+}
+
+BENCHMARK_REGISTER_F(BM_Communicator, ScaledInterval)
+    ->RangeMultiplier(2)
+    ->Range(1, MaxParticipants)
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace
+} // namespace rtcp
+} // namespace roc
@@ -1334,6 +1334,71 @@ TEST(communicator, halt_goodbye) {
     CHECK_EQUAL(SendSsrc, recv_part.next_halt_notification());
 }
 
+// Check that number of senders used for interval scaling is updated
+// when sender reports arrive and when sender leaves
+TEST(communicator, halt_goodbye_interval_scaling) {
+    enum { SendSsrc = 11, RecvSsrc = 22 };
+
+    const char* SendCname = "send_cname";
+    const char* RecvCname = "recv_cname";
+
+    Config config;
+    config.enable_interval_scaling = true;
+
+    packet::Queue send_queue;
+    MockParticipant send_part(SendCname, SendSsrc, Report_ToAddress);
+    Communicator send_comm(config, send_part, send_queue, composer, packet_factory,
+                           arena);
+    CHECK(send_comm.is_valid());
+
+    packet::Queue recv_queue;
+    MockParticipant recv_part(RecvCname, RecvSsrc, Report_Back);
+    Communicator recv_comm(config, recv_part, recv_queue, composer, packet_factory,
+                           arena);
+    CHECK(recv_comm.is_valid());
+
+    core::nanoseconds_t send_time = 10000000000000000;
+    core::nanoseconds_t recv_time = 30000000000000000;
+
+    CHECK_EQUAL(0, recv_comm.total_senders());
+
+    for (int iter = 0; iter < 3; iter++) {
+        // Generate sender report
+        send_part.set_send_report(
+            make_send_report(send_time, SendCname, SendSsrc, Seed1));
+        LONGS_EQUAL(status::StatusOK, send_comm.generate_reports(send_time));
+        CHECK_EQUAL(1, send_comm.total_senders());
+
+        // Deliver sender report to receiver
+        LONGS_EQUAL(status::StatusOK,
+                    recv_comm.process_packet(read_packet(send_queue), recv_time));
+        CHECK_EQUAL(1, recv_comm.total_streams());
+        CHECK_EQUAL(1, recv_comm.total_senders());
+
+        // Check notifications on receiver
+        CHECK_EQUAL(1, recv_part.pending_notifications());
+        expect_send_report(recv_part.next_send_notification(), send_time, SendCname,
+                           SendSsrc, Seed1);
+
+        advance_time(send_time);
+        advance_time(recv_time);
+    }
+
+    // Generate sender goodbye
+    send_part.set_send_report(make_send_report(send_time, SendCname, SendSsrc, Seed2));
+    LONGS_EQUAL(status::StatusOK, send_comm.generate_goodbye(send_time));
+
+    // Deliver sender goodbye to receiver
+    LONGS_EQUAL(status::StatusOK,
+                recv_comm.process_packet(read_packet(send_queue), recv_time));
+    CHECK_EQUAL(0, recv_comm.total_streams());
+    CHECK_EQUAL(0, recv_comm.total_senders());
+
+    // Check notifications on receiver
+    CHECK_EQUAL(1, recv_part.pending_notifications());
+    CHECK_EQUAL(SendSsrc, recv_part.next_halt_notification());
+}
+
 // Check how stream is terminated when we don't hear from it during timeout
 TEST(communicator, halt_timeout) {
     enum { SendSsrc1 = 11, SendSsrc2 = 22, RecvSsrc = 33, NumIters = 10 };
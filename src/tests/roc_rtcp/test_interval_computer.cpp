@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/time.h"
+#include "roc_rtcp/interval_computer.h"
+
+namespace roc {
+namespace rtcp {
+
+namespace {
+
+const core::nanoseconds_t Start = core::Second * 1000;
+
+// Randomization range, divided by e-3/2 compensation.
+const double MinFactor = 0.5 / 1.21828;
+const double MaxFactor = 1.5 / 1.21828;
+
+Config make_config() {
+    Config config;
+    config.report_interval = core::Millisecond * 100;
+    config.report_bandwidth = 1000;
+    config.enable_interval_scaling = true;
+    return config;
+}
+
+void check_in_range(core::nanoseconds_t interval, core::nanoseconds_t det_interval) {
+    CHECK(interval >= core::nanoseconds_t(det_interval * MinFactor) - 1);
+    CHECK(interval <= core::nanoseconds_t(det_interval * MaxFactor) + 1);
+}
+
+} // namespace
+
+TEST_GROUP(interval_computer) {};
+
+TEST(interval_computer, first_report_immediate) {
+    IntervalComputer computer(make_config());
+
+    CHECK_EQUAL(Start, computer.deadline(Start));
+    CHECK(computer.reconsider(Start));
+}
+
+TEST(interval_computer, min_interval) {
+    Config config = make_config();
+    config.report_bandwidth = 100000;
+
+    IntervalComputer computer(config);
+
+    computer.update_members(2, 1, true, Start);
+
+    // Few participants, interval is limited by minimum.
+    CHECK_EQUAL(config.report_interval, computer.deterministic_interval());
+
+    core::nanoseconds_t time = Start;
+
+    for (int n = 0; n < 100; n++) {
+        computer.report_sent(time);
+
+        const core::nanoseconds_t interval = computer.deadline(time) - time;
+        check_in_range(interval, config.report_interval);
+
+        time += interval;
+    }
+}
+
+TEST(interval_computer, scale_with_members) {
+    IntervalComputer computer(make_config());
+
+    computer.update_members(100, 50, false, Start);
+    const core::nanoseconds_t interval_100 = computer.deterministic_interval();
+
+    computer.update_members(200, 100, false, Start);
+    const core::nanoseconds_t interval_200 = computer.deterministic_interval();
+
+    // avg_size * members / bandwidth
+    CHECK(core::ns_equal_delta(
+        core::nanoseconds_t(computer.avg_packet_size() * 100 / 1000 * core::Second),
+        interval_100, core::Microsecond));
+
+    CHECK(core::ns_equal_delta(interval_100 * 2, interval_200, core::Microsecond));
+}
+
+TEST(interval_computer, senders_bandwidth_share) {
+    IntervalComputer computer(make_config());
+
+    // 2 senders out of 100 members, senders share 1/4 of bandwidth.
+    computer.update_members(100, 2, true, Start);
+    const core::nanoseconds_t sender_interval = computer.deterministic_interval();
+
+    // Receivers share 3/4 of bandwidth.
+    computer.update_members(100, 2, false, Start);
+    const core::nanoseconds_t receiver_interval = computer.deterministic_interval();
+
+    CHECK(core::ns_equal_delta(
+        core::nanoseconds_t(computer.avg_packet_size() * 2 / 250 * core::Second),
+        sender_interval, core::Microsecond));
+
+    CHECK(core::ns_equal_delta(
+        core::nanoseconds_t(computer.avg_packet_size() * 98 / 750 * core::Second),
+        receiver_interval, core::Microsecond));
+
+    CHECK(sender_interval < receiver_interval);
+}
+
+TEST(interval_computer, avg_packet_size) {
+    IntervalComputer computer(make_config());
+
+    for (int n = 0; n < 500; n++) {
+        computer.add_packet(172);
+    }
+
+    // Payload size plus UDP/IP headers.
+    DOUBLES_EQUAL(200, computer.avg_packet_size(), 0.1);
+}
+
+TEST(interval_computer, timer_reconsideration) {
+    IntervalComputer computer(make_config());
+
+    computer.update_members(2, 1, true, Start);
+    computer.report_sent(Start);
+
+    const core::nanoseconds_t deadline = computer.deadline(Start);
+
+    // Many participants joined, report should be postponed.
+    computer.update_members(1000, 1, false, deadline);
+    CHECK(!computer.reconsider(deadline));
+
+    const core::nanoseconds_t new_deadline = computer.deadline(deadline);
+    CHECK(new_deadline > deadline);
+    check_in_range(new_deadline - Start, computer.deterministic_interval());
+
+    // Interval is re-randomized on every reconsideration, but can't exceed
+    // upper bound of randomization range.
+    CHECK(computer.reconsider(
+        Start + core::nanoseconds_t(computer.deterministic_interval() * MaxFactor) + 1));
+}
+
+TEST(interval_computer, reverse_reconsideration) {
+    IntervalComputer computer(make_config());
+
+    computer.update_members(1000, 1, false, Start);
+    computer.report_sent(Start);
+
+    const core::nanoseconds_t deadline = computer.deadline(Start);
+    const core::nanoseconds_t now = Start + (deadline - Start) / 2;
+
+    // Half of participants left, deadline should be moved closer.
+    computer.update_members(500, 1, false, now);
+
+    const core::nanoseconds_t new_deadline = computer.deadline(now);
+    CHECK(core::ns_equal_delta(now + (deadline - now) / 2, new_deadline,
+                               core::Microsecond));
+
+    // Number of participants grows again, no change.
+    computer.update_members(800, 1, false, now);
+    CHECK_EQUAL(new_deadline, computer.deadline(now));
+}
+
+} // namespace rtcp
+} // namespace roc
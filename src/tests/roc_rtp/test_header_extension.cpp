@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/heap_arena.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/time.h"
+#include "roc_packet/ntp.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_rtp/composer.h"
+#include "roc_rtp/encoding_map.h"
+#include "roc_rtp/headers.h"
+#include "roc_rtp/parser.h"
+
+namespace roc {
+namespace rtp {
+
+namespace {
+
+enum { MaxBufSize = 200, PayloadSize = 40 };
+
+// 2024-01-01 00:00:00.123456789 UTC
+const core::nanoseconds_t CaptureTs = 1704067200123456789ll;
+
+core::HeapArena arena;
+packet::PacketFactory packet_factory(arena, MaxBufSize);
+EncodingMap encoding_map(arena);
+
+core::Slice<uint8_t> compose_packet(Composer& composer, core::nanoseconds_t cts) {
+    packet::PacketPtr pp = packet_factory.new_packet();
+    CHECK(pp);
+
+    core::Slice<uint8_t> buffer = packet_factory.new_packet_buffer();
+    CHECK(buffer);
+
+    CHECK(composer.prepare(*pp, buffer, PayloadSize));
+    pp->set_buffer(buffer);
+
+    pp->rtp()->source_id = 123;
+    pp->rtp()->seqnum = 456;
+    pp->rtp()->stream_timestamp = 789;
+    pp->rtp()->payload_type = PayloadType_L16_Stereo;
+    pp->rtp()->capture_timestamp = cts;
+
+    CHECK(composer.compose(*pp));
+
+    return pp->buffer();
+}
+
+// Build packet with given extension profile and data.
+core::Slice<uint8_t>
+make_packet(uint16_t ext_type, const uint8_t* ext_data, size_t ext_size) {
+    core::Slice<uint8_t> buffer = packet_factory.new_packet_buffer();
+    CHECK(buffer);
+
+    buffer.reslice(0, sizeof(Header) + sizeof(ExtentionHeader) + ext_size + PayloadSize);
+    memset(buffer.data(), 0, buffer.size());
+
+    Header& header = *(Header*)buffer.data();
+    header.set_version(V2);
+    header.set_payload_type(PayloadType_L16_Stereo);
+    header.set_extension(true);
+
+    ExtentionHeader& extension = *(ExtentionHeader*)(buffer.data() + sizeof(Header));
+    extension.set_type(ext_type);
+    extension.set_data_size((uint32_t)ext_size);
+
+    memcpy(buffer.data() + sizeof(Header) + sizeof(ExtentionHeader), ext_data, ext_size);
+
+    return buffer;
+}
+
+packet::PacketPtr parse_packet(const core::Slice<uint8_t>& buffer) {
+    Parser parser(encoding_map, NULL);
+
+    packet::PacketPtr pp = packet_factory.new_packet();
+    CHECK(pp);
+
+    CHECK(parser.parse(*pp, buffer));
+    CHECK(pp->rtp());
+
+    return pp;
+}
+
+void write_ntp(uint8_t* data, core::nanoseconds_t unix_ts) {
+    const packet::ntp_timestamp_t ntp_ts = packet::unix_2_ntp(unix_ts);
+
+    for (size_t n = 0; n < 8; n++) {
+        data[n] = uint8_t(ntp_ts >> (56 - n * 8));
+    }
+}
+
+} // namespace
+
+TEST_GROUP(header_extension) {};
+
+TEST(header_extension, compose_parse) {
+    ComposerConfig config;
+    config.enable_capture_time = true;
+
+    Composer composer(NULL, config);
+
+    core::Slice<uint8_t> buffer = compose_packet(composer, CaptureTs);
+
+    UNSIGNED_LONGS_EQUAL(sizeof(Header) + sizeof(CaptureTimeExtension) + PayloadSize,
+                         buffer.size());
+
+    const uint8_t* ext = buffer.data() + sizeof(Header);
+
+    // 0xBEDE profile, 3 words of data
+    UNSIGNED_LONGS_EQUAL(0xBE, ext[0]);
+    UNSIGNED_LONGS_EQUAL(0xDE, ext[1]);
+    UNSIGNED_LONGS_EQUAL(0x00, ext[2]);
+    UNSIGNED_LONGS_EQUAL(0x03, ext[3]);
+    // id 1, length 8
+    UNSIGNED_LONGS_EQUAL(0x17, ext[4]);
+    // padding
+    UNSIGNED_LONGS_EQUAL(0x00, ext[13]);
+    UNSIGNED_LONGS_EQUAL(0x00, ext[14]);
+    UNSIGNED_LONGS_EQUAL(0x00, ext[15]);
+
+    packet::PacketPtr pp = parse_packet(buffer);
+
+    CHECK(pp->rtp()->header.size() == sizeof(Header) + sizeof(CaptureTimeExtension));
+    UNSIGNED_LONGS_EQUAL(PayloadSize, pp->rtp()->payload.size());
+
+    UNSIGNED_LONGS_EQUAL(123, pp->rtp()->source_id);
+    UNSIGNED_LONGS_EQUAL(456, pp->rtp()->seqnum);
+    UNSIGNED_LONGS_EQUAL(789, pp->rtp()->stream_timestamp);
+
+    // NTP fraction has sub-nanosecond resolution, rounding may
+    // lose a nanosecond or so
+    CHECK(core::ns_equal_delta(CaptureTs, pp->rtp()->capture_timestamp,
+                               core::Microsecond));
+}
+
+TEST(header_extension, compose_no_capture_time) {
+    ComposerConfig config;
+    config.enable_capture_time = true;
+
+    Composer composer(NULL, config);
+
+    core::Slice<uint8_t> buffer = compose_packet(composer, 0);
+
+    // header size doesn't depend on presence of timestamp
+    UNSIGNED_LONGS_EQUAL(sizeof(Header) + sizeof(CaptureTimeExtension) + PayloadSize,
+                         buffer.size());
+
+    const uint8_t* ext = buffer.data() + sizeof(Header);
+
+    UNSIGNED_LONGS_EQUAL(0xBE, ext[0]);
+    UNSIGNED_LONGS_EQUAL(0xDE, ext[1]);
+
+    // only padding
+    for (size_t n = sizeof(ExtentionHeader); n < sizeof(CaptureTimeExtension); n++) {
+        UNSIGNED_LONGS_EQUAL(0, ext[n]);
+    }
+
+    packet::PacketPtr pp = parse_packet(buffer);
+
+    LONGS_EQUAL(0, pp->rtp()->capture_timestamp);
+    UNSIGNED_LONGS_EQUAL(PayloadSize, pp->rtp()->payload.size());
+}
+
+TEST(header_extension, compose_disabled) {
+    Composer composer(NULL);
+
+    core::Slice<uint8_t> buffer = compose_packet(composer, CaptureTs);
+
+    UNSIGNED_LONGS_EQUAL(sizeof(Header) + PayloadSize, buffer.size());
+
+    const Header& header = *(const Header*)buffer.data();
+    CHECK(!header.has_extension());
+
+    packet::PacketPtr pp = parse_packet(buffer);
+
+    LONGS_EQUAL(0, pp->rtp()->capture_timestamp);
+}
+
+TEST(header_extension, parse_one_byte) {
+    uint8_t data[20];
+    memset(data, 0, sizeof(data));
+
+    // id 3, length 2
+    data[0] = 0x31;
+    data[1] = 0xAA;
+    data[2] = 0xBB;
+    // padding
+    data[3] = 0x00;
+    // id 1, length 8
+    data[4] = 0x17;
+    write_ntp(data + 5, CaptureTs);
+    // id 2, length 1
+    data[13] = 0x20;
+    data[14] = 0xCC;
+
+    packet::PacketPtr pp = parse_packet(make_packet(0xBEDE, data, sizeof(data)));
+
+    CHECK(core::ns_equal_delta(CaptureTs, pp->rtp()->capture_timestamp,
+                               core::Microsecond));
+    UNSIGNED_LONGS_EQUAL(PayloadSize, pp->rtp()->payload.size());
+}
+
+TEST(header_extension, parse_one_byte_with_offset) {
+    uint8_t data[20];
+    memset(data, 0, sizeof(data));
+
+    // id 1, length 16: NTP timestamp followed by estimated clock offset
+    data[0] = 0x1F;
+    write_ntp(data + 1, CaptureTs);
+
+    packet::PacketPtr pp = parse_packet(make_packet(0xBEDE, data, sizeof(data)));
+
+    CHECK(core::ns_equal_delta(CaptureTs, pp->rtp()->capture_timestamp,
+                               core::Microsecond));
+}
+
+TEST(header_extension, parse_two_byte) {
+    uint8_t data[16];
+    memset(data, 0, sizeof(data));
+
+    // id 5, length 0
+    data[0] = 0x05;
+    data[1] = 0x00;
+    // padding
+    data[2] = 0x00;
+    // id 1, length 8
+    data[3] = 0x01;
+    data[4] = 0x08;
+    write_ntp(data + 5, CaptureTs);
+
+    packet::PacketPtr pp = parse_packet(make_packet(0x1000, data, sizeof(data)));
+
+    CHECK(core::ns_equal_delta(CaptureTs, pp->rtp()->capture_timestamp,
+                               core::Microsecond));
+}
+
+TEST(header_extension, parse_bad_element) {
+    { // element length exceeds extension size
+        uint8_t data[8];
+        memset(data, 0, sizeof(data));
+
+        data[0] = 0x17;
+
+        packet::PacketPtr pp = parse_packet(make_packet(0xBEDE, data, sizeof(data)));
+
+        LONGS_EQUAL(0, pp->rtp()->capture_timestamp);
+        UNSIGNED_LONGS_EQUAL(PayloadSize, pp->rtp()->payload.size());
+    }
+    { // unexpected element length
+        uint8_t data[8];
+        memset(data, 0, sizeof(data));
+
+        data[0] = 0x13;
+        write_ntp(data + 1, CaptureTs);
+
+        packet::PacketPtr pp = parse_packet(make_packet(0xBEDE, data, sizeof(data)));
+
+        LONGS_EQUAL(0, pp->rtp()->capture_timestamp);
+    }
+    { // reserved id stops parsing
+        uint8_t data[12];
+        memset(data, 0, sizeof(data));
+
+        data[0] = 0xF0;
+        data[2] = 0x17;
+        write_ntp(data + 3, CaptureTs);
+
+        packet::PacketPtr pp = parse_packet(make_packet(0xBEDE, data, sizeof(data)));
+
+        LONGS_EQUAL(0, pp->rtp()->capture_timestamp);
+    }
+}
+
+TEST(header_extension, parse_unknown_profile) {
+    uint8_t data[12];
+    memset(data, 0, sizeof(data));
+
+    data[0] = 0x17;
+    write_ntp(data + 1, CaptureTs);
+
+    packet::PacketPtr pp = parse_packet(make_packet(0x0005, data, sizeof(data)));
+
+    LONGS_EQUAL(0, pp->rtp()->capture_timestamp);
+    UNSIGNED_LONGS_EQUAL(PayloadSize, pp->rtp()->payload.size());
+}
+
+} // namespace rtp
+} // namespace roc
@@ -123,5 +123,54 @@ TEST(timestamp_injector, negative_and_positive_dn) {
     }
 }
 
+TEST(timestamp_injector, keep_packet_timestamp) {
+    enum {
+        ChMask = 3,
+        SampleRate = 48000,
+        PacketSz = 128,
+        NPackets = 16,
+    };
+
+    const audio::SampleSpec sample_spec =
+        audio::SampleSpec(SampleRate, audio::Sample_RawFormat, audio::ChanLayout_Surround,
+                          audio::ChanOrder_Smpte, ChMask);
+
+    const core::nanoseconds_t packet_capt_ts = 1691499037871419405;
+
+    packet::Queue queue;
+    TimestampInjector injector(queue, sample_spec);
+    // mapping differs from timestamps carried by packets
+    injector.update_mapping(packet_capt_ts + core::Second, 0);
+
+    for (size_t i = 0; i < NPackets; i++) {
+        packet::PacketPtr pp = new_packet((packet::seqnum_t)i,
+                                          (packet::stream_timestamp_t)(i * PacketSz));
+        // packets which already have capture timestamp, e.g. from
+        // RTP header extension, should be left untouched
+        if (i % 2 == 0) {
+            pp->rtp()->capture_timestamp =
+                packet_capt_ts + sample_spec.samples_per_chan_2_ns(i * PacketSz);
+        }
+        UNSIGNED_LONGS_EQUAL(status::StatusOK, queue.write(pp));
+    }
+
+    for (size_t i = 0; i < NPackets; i++) {
+        packet::PacketPtr pp;
+        UNSIGNED_LONGS_EQUAL(status::StatusOK, injector.read(pp));
+        CHECK(pp);
+
+        const core::nanoseconds_t ts_offset =
+            sample_spec.samples_per_chan_2_ns(i * PacketSz);
+
+        if (i % 2 == 0) {
+            LONGS_EQUAL(packet_capt_ts + ts_offset, pp->rtp()->capture_timestamp);
+        } else {
+            CHECK(core::ns_equal_delta(packet_capt_ts + core::Second + ts_offset,
+                                       pp->rtp()->capture_timestamp,
+                                       sample_spec.samples_per_chan_2_ns(1)));
+        }
+    }
+}
+
 } // namespace rtp
 } // namespace roc
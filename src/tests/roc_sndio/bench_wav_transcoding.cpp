@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "roc_core/heap_arena.h"
+#include "roc_core/panic.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/temp_file.h"
+#include "roc_sndio/wav_sink.h"
+#include "roc_sndio/wav_source.h"
+
+namespace roc {
+namespace sndio {
+namespace {
+
+enum {
+    SampleRate = 44100,
+    NumChans = 2,
+    // 10ms frames, as used by roc-copy by default
+    FrameSize = SampleRate / 100 * NumChans,
+    // length of input file
+    FileSeconds = 120
+};
+
+core::HeapArena arena;
+
+// Create input file with given sample format.
+void make_input(const char* path, drwav_uint32 format, drwav_uint32 bits) {
+    drwav_data_format fmt;
+    fmt.container = drwav_container_riff;
+    fmt.format = format;
+    fmt.channels = NumChans;
+    fmt.sampleRate = SampleRate;
+    fmt.bitsPerSample = bits;
+
+    drwav wav;
+    roc_panic_if(!drwav_init_file_write(&wav, path, &fmt, NULL));
+
+    const size_t sample_bytes = bits / 8;
+    const size_t total_bytes = (size_t)FileSeconds * SampleRate * NumChans * sample_bytes;
+
+    uint8_t block[64 * 1024];
+    for (size_t n = 0; n < sizeof(block); n++) {
+        block[n] = uint8_t(n * 31 % 251);
+    }
+    if (format == DR_WAVE_FORMAT_IEEE_FLOAT) {
+        // avoid NaNs and infinities
+        for (size_t n = 0; n < sizeof(block) / sizeof(float); n++) {
+            ((float*)block)[n] = float(n % 1000) / 1000.f - 0.5f;
+        }
+    }
+
+    for (size_t pos = 0; pos < total_bytes; pos += sizeof(block)) {
+        const size_t n_bytes = std::min(sizeof(block), total_bytes - pos);
+        roc_panic_if(drwav_write_raw(&wav, n_bytes, block) != n_bytes);
+    }
+
+    drwav_uninit(&wav);
+}
+
+struct BM_WavTranscoding : benchmark::Fixture {
+    core::TempFile* input_file;
+    core::TempFile* output_file;
+
+    void SetUp(benchmark::State& state) {
+        input_file = new core::TempFile("input.wav");
+        output_file = new core::TempFile("output.wav");
+
+        if (state.range(0) == 32) {
+            make_input(input_file->path(), DR_WAVE_FORMAT_IEEE_FLOAT, 32);
+        } else {
+            make_input(input_file->path(), DR_WAVE_FORMAT_PCM,
+                       (drwav_uint32)state.range(0));
+        }
+    }
+
+    void TearDown(benchmark::State& state) {
+        delete input_file;
+        delete output_file;
+    }
+
+    // Report how many seconds of audio were processed per second of wall time.
+    void export_counters(benchmark::State& state) {
+        state.counters["x_realtime"] = benchmark::Counter(
+            double(state.iterations()) * FileSeconds, benchmark::Counter::kIsRate);
+    }
+};
+
+BENCHMARK_DEFINE_F(BM_WavTranscoding, Read)(benchmark::State& state) {
+    Config config;
+    WavSource source(arena, config);
+    roc_panic_if(!source.is_valid());
+    roc_panic_if(!source.open(input_file->path()));
+
+    audio::sample_t samples[FrameSize];
+
+    while (state.KeepRunning()) {
+        for (;;) {
+            audio::Frame frame(samples, FrameSize);
+            if (!source.read(frame)) {
+                break;
+            }
+            benchmark::DoNotOptimize(samples[0]);
+        }
+        roc_panic_if(!source.restart());
+    }
+
+    export_counters(state);
+}
+
+BENCHMARK_REGISTER_F(BM_WavTranscoding, Read)
+    ->Arg(16)
+    ->Arg(24)
+    ->Arg(32)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(BM_WavTranscoding, Copy)(benchmark::State& state) {
+    Config source_config;
+    WavSource source(arena, source_config);
+    roc_panic_if(!source.is_valid());
+    roc_panic_if(!source.open(input_file->path()));
+
+    Config sink_config;
+    sink_config.sample_spec = source.sample_spec();
+
+    audio::sample_t samples[FrameSize];
+
+    while (state.KeepRunning()) {
+        WavSink sink(arena, sink_config);
+        roc_panic_if(!sink.is_valid());
+        roc_panic_if(!sink.open(output_file->path()));
+
+        for (;;) {
+            audio::Frame frame(samples, FrameSize);
+            if (!source.read(frame)) {
+                break;
+            }
+            sink.write(frame);
+        }
+        roc_panic_if(!source.restart());
+    }
+
+    export_counters(state);
+}
+
+BENCHMARK_REGISTER_F(BM_WavTranscoding, Copy)
+    ->Arg(16)
+    ->Arg(32)
+    ->Unit(benchmark::kMillisecond);
+
+} // namespace
+} // namespace sndio
+} // namespace roc
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <stdio.h>
+
+#include "roc_core/heap_arena.h"
+#include "roc_core/string_builder.h"
+#include "roc_core/temp_file.h"
+#include "roc_sndio/alsa_device.h"
+
+namespace roc {
+namespace sndio {
+
+namespace {
+
+enum { SampleRate = 48000, NumChans = 2, FrameSize = 480 * NumChans, NumFrames = 20 };
+
+core::HeapArena arena;
+
+Config make_config() {
+    Config config;
+    config.sample_spec =
+        audio::SampleSpec(SampleRate, audio::Sample_RawFormat, audio::ChanLayout_Surround,
+                          audio::ChanOrder_Smpte, audio::ChanMask_Surround_Stereo);
+    config.frame_length = 10 * core::Millisecond;
+    config.latency = 40 * core::Millisecond;
+    return config;
+}
+
+} // namespace
+
+// These tests use ALSA "null" and "file" plugins, which don't need
+// sound card and are available in default ALSA configuration.
+TEST_GROUP(alsa_device) {};
+
+TEST(alsa_device, sink_null) {
+    AlsaDevice sink(arena, make_config(), DeviceType_Sink);
+    CHECK(sink.open("null"));
+
+    CHECK(sink.to_sink() != NULL);
+    CHECK(sink.to_source() == NULL);
+
+    CHECK(sink.has_clock());
+    CHECK(sink.has_latency());
+
+    UNSIGNED_LONGS_EQUAL(SampleRate, sink.sample_spec().sample_rate());
+    UNSIGNED_LONGS_EQUAL(NumChans, sink.sample_spec().num_channels());
+
+    audio::sample_t samples[FrameSize] = {};
+
+    for (size_t n = 0; n < NumFrames; n++) {
+        audio::Frame frame(samples, FrameSize);
+        sink.write(frame);
+    }
+
+    CHECK(sink.latency() >= 0);
+    CHECK(sink.latency() <= 100 * core::Millisecond);
+}
+
+TEST(alsa_device, sink_pause_resume) {
+    AlsaDevice sink(arena, make_config(), DeviceType_Sink);
+    CHECK(sink.open("null"));
+
+    LONGS_EQUAL(DeviceState_Active, sink.state());
+
+    sink.pause();
+    LONGS_EQUAL(DeviceState_Paused, sink.state());
+
+    CHECK(sink.resume());
+    LONGS_EQUAL(DeviceState_Active, sink.state());
+
+    audio::sample_t samples[FrameSize] = {};
+    audio::Frame frame(samples, FrameSize);
+    sink.write(frame);
+}
+
+TEST(alsa_device, sink_file) {
+    core::TempFile file("test.raw");
+
+    char device[256];
+    core::StringBuilder b(device, sizeof(device));
+    CHECK(b.append_str("file:FILE="));
+    CHECK(b.append_str(file.path()));
+    CHECK(b.append_str(",FORMAT=raw"));
+
+    {
+        AlsaDevice sink(arena, make_config(), DeviceType_Sink);
+        CHECK(sink.open(device));
+
+        audio::sample_t samples[FrameSize];
+
+        for (size_t n_frame = 0; n_frame < NumFrames; n_frame++) {
+            for (size_t n = 0; n < FrameSize; n++) {
+                samples[n] = (audio::sample_t)(n_frame * FrameSize + n) / 1e5f;
+            }
+            audio::Frame frame(samples, FrameSize);
+            sink.write(frame);
+        }
+    }
+
+    // Null slave accepts any format, so float32 should be chosen
+    // and samples should be written as is.
+    FILE* fp = fopen(file.path(), "rb");
+    CHECK(fp);
+
+    float samples[FrameSize * NumFrames];
+    const size_t n_read = fread(samples, sizeof(float), FrameSize * NumFrames, fp);
+    fclose(fp);
+
+    UNSIGNED_LONGS_EQUAL(FrameSize * NumFrames, n_read);
+
+    for (size_t n = 0; n < n_read; n++) {
+        DOUBLES_EQUAL((double)n / 1e5, (double)samples[n], 0.0001);
+    }
+}
+
+TEST(alsa_device, source_null) {
+    AlsaDevice source(arena, make_config(), DeviceType_Source);
+    CHECK(source.open("null"));
+
+    CHECK(source.to_source() != NULL);
+    CHECK(source.to_sink() == NULL);
+
+    UNSIGNED_LONGS_EQUAL(SampleRate, source.sample_spec().sample_rate());
+
+    audio::sample_t samples[FrameSize];
+
+    for (size_t n = 0; n < NumFrames; n++) {
+        audio::Frame frame(samples, FrameSize);
+        CHECK(source.read(frame));
+    }
+
+    CHECK(source.restart());
+
+    audio::Frame frame(samples, FrameSize);
+    CHECK(source.read(frame));
+}
+
+TEST(alsa_device, bad_device) {
+    AlsaDevice sink(arena, make_config(), DeviceType_Sink);
+    CHECK(!sink.open("no_such_device_xyz"));
+}
+
+} // namespace sndio
+} // namespace roc
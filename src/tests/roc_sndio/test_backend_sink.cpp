@@ -13,6 +13,7 @@
 #include "roc_core/temp_file.h"
 #include "roc_sndio/backend_map.h"
 #include "roc_sndio/pump.h"
+#include "roc_sndio/wav_backend.h"
 
 namespace roc {
 namespace sndio {
@@ -137,5 +138,53 @@ TEST(backend_sink, sample_rate_force) {
     }
 }
 
+TEST(backend_sink, write_sint16) {
+    enum { NumSamples = FrameSize };
+
+    sink_config.sample_spec.set_pcm_format(audio::PcmFormat_SInt16_Le);
+
+    int16_t samples[NumSamples];
+    for (size_t n = 0; n < NumSamples; n++) {
+        samples[n] = int16_t((int)n * 64 - 16000);
+    }
+
+    core::TempFile file("test.wav");
+    WavBackend backend;
+
+    {
+        IDevice* backend_device = backend.open_device(
+            DeviceType_Sink, DriverType_File, "wav", file.path(), sink_config, arena);
+        CHECK(backend_device != NULL);
+        core::ScopedPtr<ISink> backend_sink(backend_device->to_sink(), arena);
+        CHECK(backend_sink != NULL);
+
+        CHECK(backend_sink->sample_spec().pcm_format() == audio::PcmFormat_SInt16_Le);
+
+        audio::Frame frame((uint8_t*)samples, sizeof(samples));
+        frame.set_flags(audio::Frame::FlagNotRaw);
+        backend_sink->write(frame);
+    }
+
+    Config source_config;
+    source_config.frame_length = sink_config.frame_length;
+
+    IDevice* backend_device = backend.open_device(
+        DeviceType_Source, DriverType_File, "wav", file.path(), source_config, arena);
+    CHECK(backend_device != NULL);
+    core::ScopedPtr<ISource> backend_source(backend_device->to_source(), arena);
+    CHECK(backend_source != NULL);
+
+    UNSIGNED_LONGS_EQUAL(SampleRate, backend_source->sample_spec().sample_rate());
+    UNSIGNED_LONGS_EQUAL(2, backend_source->sample_spec().num_channels());
+
+    audio::sample_t read_samples[NumSamples];
+    audio::Frame frame(read_samples, NumSamples);
+    CHECK(backend_source->read(frame));
+
+    for (size_t n = 0; n < NumSamples; n++) {
+        DOUBLES_EQUAL((double)samples[n] / 32768, (double)read_samples[n], 1e-6);
+    }
+}
+
 } // namespace sndio
 } // namespace roc
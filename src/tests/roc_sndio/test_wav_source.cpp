@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2024 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/heap_arena.h"
+#include "roc_core/temp_file.h"
+#include "roc_sndio/wav_sink.h"
+#include "roc_sndio/wav_source.h"
+
+namespace roc {
+namespace sndio {
+
+namespace {
+
+enum { SampleRate = 44100, NumChans = 2, NumSamples = 10000, FrameSize = 300 };
+
+const double Epsilon = 0.0001;
+
+core::HeapArena arena;
+
+// Write file with given format using dr_wav.
+void write_wav(const char* path, drwav_uint32 format, drwav_uint32 bits) {
+    drwav_data_format fmt;
+    fmt.container = drwav_container_riff;
+    fmt.format = format;
+    fmt.channels = NumChans;
+    fmt.sampleRate = SampleRate;
+    fmt.bitsPerSample = bits;
+
+    drwav wav;
+    CHECK(drwav_init_file_write(&wav, path, &fmt, NULL));
+
+    for (size_t n = 0; n < NumSamples; n++) {
+        const double value = double(int(n % 200) - 100) / 128.0;
+
+        if (format == DR_WAVE_FORMAT_IEEE_FLOAT) {
+            const float sample = (float)value;
+            CHECK(drwav_write_raw(&wav, sizeof(sample), &sample) == sizeof(sample));
+        } else if (bits == 16) {
+            const int16_t sample = (int16_t)(value * 32768);
+            CHECK(drwav_write_raw(&wav, sizeof(sample), &sample) == sizeof(sample));
+        } else if (bits == 24) {
+            const int32_t sample = (int32_t)(value * 8388608);
+            const uint8_t bytes[3] = { uint8_t(sample & 0xff),
+                                       uint8_t((sample >> 8) & 0xff),
+                                       uint8_t((sample >> 16) & 0xff) };
+            CHECK(drwav_write_raw(&wav, sizeof(bytes), bytes) == sizeof(bytes));
+        } else {
+            FAIL("unexpected format");
+        }
+    }
+
+    drwav_uninit(&wav);
+}
+
+// Read whole file and check samples.
+void check_source(WavSource& source) {
+    audio::sample_t samples[FrameSize];
+    size_t pos = 0;
+
+    for (;;) {
+        audio::Frame frame(samples, FrameSize);
+        if (!source.read(frame)) {
+            break;
+        }
+
+        for (size_t n = 0; n < FrameSize; n++) {
+            const double expected =
+                pos < NumSamples ? double(int(pos % 200) - 100) / 128.0 : 0;
+            DOUBLES_EQUAL(expected, (double)samples[n], Epsilon);
+            pos++;
+        }
+    }
+
+    CHECK(pos >= NumSamples);
+    CHECK(pos < NumSamples + FrameSize);
+}
+
+} // namespace
+
+TEST_GROUP(wav_source) {};
+
+TEST(wav_source, sint16) {
+    core::TempFile file("test.wav");
+    write_wav(file.path(), DR_WAVE_FORMAT_PCM, 16);
+
+    Config config;
+    WavSource source(arena, config);
+    CHECK(source.is_valid());
+    CHECK(source.open(file.path()));
+
+    UNSIGNED_LONGS_EQUAL(SampleRate, source.sample_spec().sample_rate());
+    UNSIGNED_LONGS_EQUAL(NumChans, source.sample_spec().num_channels());
+
+    check_source(source);
+}
+
+TEST(wav_source, sint24) {
+    core::TempFile file("test.wav");
+    write_wav(file.path(), DR_WAVE_FORMAT_PCM, 24);
+
+    Config config;
+    WavSource source(arena, config);
+    CHECK(source.is_valid());
+    CHECK(source.open(file.path()));
+
+    check_source(source);
+}
+
+TEST(wav_source, float32) {
+    core::TempFile file("test.wav");
+    write_wav(file.path(), DR_WAVE_FORMAT_IEEE_FLOAT, 32);
+
+    Config config;
+    WavSource source(arena, config);
+    CHECK(source.is_valid());
+    CHECK(source.open(file.path()));
+
+    check_source(source);
+}
+
+TEST(wav_source, restart) {
+    core::TempFile file("test.wav");
+    write_wav(file.path(), DR_WAVE_FORMAT_PCM, 16);
+
+    Config config;
+    WavSource source(arena, config);
+    CHECK(source.is_valid());
+    CHECK(source.open(file.path()));
+
+    for (int iter = 0; iter < 3; iter++) {
+        check_source(source);
+        CHECK(source.restart());
+    }
+}
+
+TEST(wav_source, sink_roundtrip) {
+    core::TempFile file("test.wav");
+
+    enum { NumFrames = 1000 };
+
+    {
+        Config config;
+        config.sample_spec =
+            audio::SampleSpec(SampleRate, audio::Sample_RawFormat,
+                              audio::ChanLayout_Surround, audio::ChanOrder_Smpte,
+                              audio::ChanMask_Surround_Stereo);
+
+        WavSink sink(arena, config);
+        CHECK(sink.is_valid());
+        CHECK(sink.open(file.path()));
+
+        audio::sample_t samples[FrameSize];
+        for (size_t n_frame = 0; n_frame < NumFrames; n_frame++) {
+            for (size_t n = 0; n < FrameSize; n++) {
+                samples[n] = (audio::sample_t)(n_frame * FrameSize + n) / 1e6f;
+            }
+            audio::Frame frame(samples, FrameSize);
+            sink.write(frame);
+        }
+    }
+
+    Config config;
+    WavSource source(arena, config);
+    CHECK(source.is_valid());
+    CHECK(source.open(file.path()));
+
+    audio::sample_t samples[FrameSize];
+    for (size_t n_frame = 0; n_frame < NumFrames; n_frame++) {
+        audio::Frame frame(samples, FrameSize);
+        CHECK(source.read(frame));
+        for (size_t n = 0; n < FrameSize; n++) {
+            DOUBLES_EQUAL((double)(n_frame * FrameSize + n) / 1e6, (double)samples[n],
+                          Epsilon);
+        }
+    }
+
+    audio::Frame frame(samples, FrameSize);
+    CHECK(!source.read(frame));
+}
+
+} // namespace sndio
+} // namespace roc
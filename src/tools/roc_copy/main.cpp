@@ -7,11 +7,13 @@
  */
 
 #include "roc_address/io_uri.h"
+#include "roc_audio/null_writer.h"
 #include "roc_core/crash_handler.h"
 #include "roc_core/heap_arena.h"
 #include "roc_core/log.h"
 #include "roc_core/parse_units.h"
 #include "roc_core/scoped_ptr.h"
+#include "roc_pipeline/batch_transcoder.h"
 #include "roc_pipeline/transcoder_sink.h"
 #include "roc_sndio/backend_dispatcher.h"
 #include "roc_sndio/backend_map.h"
@@ -83,6 +85,37 @@ int main(int argc, char** argv) {
         }
     }
 
+    if (args.jobs_given) {
+        if (args.jobs_arg <= 0) {
+            roc_log(LogError, "invalid --jobs: should be > 0");
+            return 1;
+        }
+        transcoder_config.batch.num_workers = (size_t)args.jobs_arg;
+
+        // Batch mode benefits from large frames.
+        if (args.frame_len_given) {
+            transcoder_config.batch.frame_length = source_config.frame_length;
+        } else {
+            source_config.frame_length = transcoder_config.batch.frame_length;
+        }
+    }
+
+    if (args.segment_len_given) {
+        if (!args.jobs_given) {
+            roc_log(LogError, "--segment-len can be used only with --jobs");
+            return 1;
+        }
+        if (!core::parse_duration(args.segment_len_arg,
+                                  transcoder_config.batch.segment_length)) {
+            roc_log(LogError, "invalid --segment-len: bad format");
+            return 1;
+        }
+        if (transcoder_config.batch.segment_length <= 0) {
+            roc_log(LogError, "invalid --segment-len: should be > 0");
+            return 1;
+        }
+    }
+
     sndio::BackendMap::instance().set_frame_size(source_config.frame_length,
                                                  transcoder_config.input_sample_spec);
 
@@ -204,6 +237,21 @@ int main(int argc, char** argv) {
         output_writer = output_sink.get();
     }
 
+    if (transcoder_config.batch.num_workers != 0) {
+        audio::NullWriter null_writer;
+
+        pipeline::BatchTranscoder batch_transcoder(transcoder_config, arena);
+        if (!batch_transcoder.is_valid()) {
+            roc_log(LogError, "can't create batch transcoder");
+            return 1;
+        }
+
+        const bool ok = batch_transcoder.run(
+            *input_source, output_writer ? *output_writer : null_writer);
+
+        return ok ? 0 : 1;
+    }
+
     pipeline::TranscoderSink transcoder(transcoder_config, output_writer,
                                         frame_buffer_pool, arena);
     if (!transcoder.is_valid()) {
@@ -129,6 +129,48 @@ int main(int argc, char** argv) {
         }
     }
 
+    receiver_config.session_defaults.latency.enable_adaptive_target =
+        args.adaptive_latency_flag;
+
+    if (args.min_target_latency_given) {
+        if (!core::parse_duration(
+                args.min_target_latency_arg,
+                receiver_config.session_defaults.latency.min_target_latency)) {
+            roc_log(LogError, "invalid --min-target-latency: bad format");
+            return 1;
+        }
+        if (receiver_config.session_defaults.latency.min_target_latency <= 0) {
+            roc_log(LogError, "invalid --min-target-latency: should be > 0");
+            return 1;
+        }
+    }
+
+    if (args.max_target_latency_given) {
+        if (!core::parse_duration(
+                args.max_target_latency_arg,
+                receiver_config.session_defaults.latency.max_target_latency)) {
+            roc_log(LogError, "invalid --max-target-latency: bad format");
+            return 1;
+        }
+        if (receiver_config.session_defaults.latency.max_target_latency <= 0) {
+            roc_log(LogError, "invalid --max-target-latency: should be > 0");
+            return 1;
+        }
+    }
+
+    if (args.start_latency_given) {
+        if (!core::parse_duration(
+                args.start_latency_arg,
+                receiver_config.session_defaults.latency.start_latency)) {
+            roc_log(LogError, "invalid --start-latency: bad format");
+            return 1;
+        }
+        if (receiver_config.session_defaults.latency.start_latency <= 0) {
+            roc_log(LogError, "invalid --start-latency: should be > 0");
+            return 1;
+        }
+    }
+
     if (args.no_play_timeout_given) {
         if (!core::parse_duration(
                 args.no_play_timeout_arg,
@@ -222,8 +264,48 @@ int main(int argc, char** argv) {
         break;
     }
 
+    switch (args.plc_arg) {
+    case plc_arg_none:
+        receiver_config.session_defaults.plc.backend = audio::PlcBackend_None;
+        break;
+    case plc_arg_wsola:
+        receiver_config.session_defaults.plc.backend = audio::PlcBackend_Wsola;
+        break;
+    default:
+        break;
+    }
+
     receiver_config.session_defaults.enable_beeping = args.beep_flag;
     receiver_config.common.enable_profiling = args.profiling_flag;
+    receiver_config.common.enable_passthrough = args.passthrough_flag;
+    receiver_config.common.overload.enable = args.overload_control_flag;
+
+    receiver_config.common.timing.enable_precise = args.precise_timing_flag;
+
+    if (args.timer_slack_given) {
+        if (!core::parse_duration(args.timer_slack_arg,
+                                  receiver_config.common.timing.timer_slack)) {
+            roc_log(LogError, "invalid --timer-slack: bad format");
+            return 1;
+        }
+        if (receiver_config.common.timing.timer_slack <= 0) {
+            roc_log(LogError, "invalid --timer-slack: should be > 0");
+            return 1;
+        }
+    }
+
+    if (args.rtcp_bandwidth_given) {
+        if (!core::parse_size(args.rtcp_bandwidth_arg,
+                              receiver_config.common.rtcp.report_bandwidth)) {
+            roc_log(LogError, "invalid --rtcp-bandwidth: bad format");
+            return 1;
+        }
+        if (receiver_config.common.rtcp.report_bandwidth == 0) {
+            roc_log(LogError, "invalid --rtcp-bandwidth: should be > 0");
+            return 1;
+        }
+        receiver_config.common.rtcp.enable_interval_scaling = true;
+    }
 
     node::ContextConfig context_config;
 
@@ -296,10 +378,33 @@ int main(int argc, char** argv) {
         }
     }
 
+    if (args.passthrough_flag) {
+        if (!output_uri.is_valid() || !output_uri.is_file()
+            || (args.output_format_given && strcmp(args.output_format_arg, "wav") != 0)) {
+            roc_log(LogError, "--passthrough can be used only if --output is a wav file");
+            return 1;
+        }
+        if (args.backup_given) {
+            roc_log(LogError, "--passthrough can't be used together with --backup");
+            return 1;
+        }
+    }
+
     core::ScopedPtr<sndio::ISink> output_sink;
     if (output_uri.is_valid()) {
+        sndio::Config output_config = io_config;
+        const char* output_format = args.output_format_arg;
+
+        if (args.passthrough_flag) {
+            // Write 16-bit samples as is, so that receiver can deliver
+            // samples from packets without conversion.
+            output_config.sample_spec.set_sample_format(audio::SampleFormat_Pcm);
+            output_config.sample_spec.set_pcm_format(audio::PcmFormat_SInt16_Le);
+            output_format = "wav";
+        }
+
         output_sink.reset(
-            backend_dispatcher.open_sink(output_uri, args.output_format_arg, io_config),
+            backend_dispatcher.open_sink(output_uri, output_format, output_config),
             context.arena());
     } else {
         output_sink.reset(backend_dispatcher.open_default_sink(io_config),
@@ -529,5 +634,17 @@ int main(int argc, char** argv) {
 
     const bool ok = pump.run();
 
+    core::TickerMetrics timing_metrics;
+    if (receiver.get_timing_metrics(timing_metrics) && timing_metrics.wakeups > 0) {
+        roc_log(LogInfo,
+                "internal clock: wakeups=%llu overruns=%llu avg_error=%.3fms"
+                " max_error=%.3fms",
+                (unsigned long long)timing_metrics.wakeups,
+                (unsigned long long)timing_metrics.overruns,
+                (double)timing_metrics.total_wakeup_error
+                    / (double)timing_metrics.wakeups / core::Millisecond,
+                (double)timing_metrics.max_wakeup_error / core::Millisecond);
+    }
+
     return ok ? 0 : 1;
 }
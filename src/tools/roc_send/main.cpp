@@ -152,6 +152,22 @@ int main(int argc, char** argv) {
         sender_config.fec_writer.n_repair_packets = (size_t)args.nbrpr_arg;
     }
 
+    if (args.fec_thread_flag) {
+        if (sender_config.fec_encoder.scheme == packet::FEC_None) {
+            roc_log(LogError, "--fec-thread can't be used when fec is disabled");
+            return 1;
+        }
+        sender_config.fec_writer.enable_background_encoding = true;
+    }
+
+    if (args.slot_threads_given) {
+        if (args.slot_threads_arg < 0) {
+            roc_log(LogError, "invalid --slot-threads: should be >= 0");
+            return 1;
+        }
+        sender_config.fanout.num_threads = (size_t)args.slot_threads_arg;
+    }
+
     if (args.target_latency_given) {
         if (!core::parse_duration(args.target_latency_arg,
                                   sender_config.latency.target_latency)) {
@@ -230,8 +246,48 @@ int main(int argc, char** argv) {
     }
 
     sender_config.enable_interleaving = args.interleaving_flag;
+
+    sender_config.rtp_composer.enable_capture_time = args.capture_time_ext_flag;
+
+    sender_config.pacer.enable = args.pacing_flag;
+
+    if (args.max_burst_given) {
+        if (args.max_burst_arg <= 0) {
+            roc_log(LogError, "invalid --max-burst: should be > 0");
+            return 1;
+        }
+        sender_config.pacer.max_burst = (size_t)args.max_burst_arg;
+    }
+
+    sender_config.timing.enable_precise = args.precise_timing_flag;
+
+    if (args.timer_slack_given) {
+        if (!core::parse_duration(args.timer_slack_arg,
+                                  sender_config.timing.timer_slack)) {
+            roc_log(LogError, "invalid --timer-slack: bad format");
+            return 1;
+        }
+        if (sender_config.timing.timer_slack <= 0) {
+            roc_log(LogError, "invalid --timer-slack: should be > 0");
+            return 1;
+        }
+    }
+
     sender_config.enable_profiling = args.profiling_flag;
 
+    if (args.rtcp_bandwidth_given) {
+        if (!core::parse_size(args.rtcp_bandwidth_arg,
+                              sender_config.rtcp.report_bandwidth)) {
+            roc_log(LogError, "invalid --rtcp-bandwidth: bad format");
+            return 1;
+        }
+        if (sender_config.rtcp.report_bandwidth == 0) {
+            roc_log(LogError, "invalid --rtcp-bandwidth: should be > 0");
+            return 1;
+        }
+        sender_config.rtcp.enable_interval_scaling = true;
+    }
+
     node::ContextConfig context_config;
 
     if (args.max_packet_size_given) {
@@ -442,5 +498,17 @@ int main(int argc, char** argv) {
 
     const bool ok = pump.run();
 
+    core::TickerMetrics timing_metrics;
+    if (sender.get_timing_metrics(timing_metrics) && timing_metrics.wakeups > 0) {
+        roc_log(LogInfo,
+                "internal clock: wakeups=%llu overruns=%llu avg_error=%.3fms"
+                " max_error=%.3fms",
+                (unsigned long long)timing_metrics.wakeups,
+                (unsigned long long)timing_metrics.overruns,
+                (double)timing_metrics.total_wakeup_error
+                    / (double)timing_metrics.wakeups / core::Millisecond,
+                (double)timing_metrics.max_wakeup_error / core::Millisecond);
+    }
+
     return ok ? 0 : 1;
 }